@@ -0,0 +1,213 @@
+#include <memory>
+
+#include "micro_benchmark_basic_fixture.hpp"
+
+#include "benchmark/benchmark.h"
+#include "dependency_discovery/validation_strategy/fd_validation_rule.hpp"
+#include "dependency_discovery/validation_strategy/fd_validation_rule_ablation.hpp"
+#include "dependency_discovery/validation_strategy/ind_validation_rule.hpp"
+#include "dependency_discovery/validation_strategy/ind_validation_rule_ablation.hpp"
+#include "dependency_discovery/validation_strategy/od_validation_rule.hpp"
+#include "dependency_discovery/validation_strategy/od_validation_rule_ablation.hpp"
+#include "dependency_discovery/validation_strategy/ucc_validation_rule.hpp"
+#include "dependency_discovery/validation_strategy/ucc_validation_rule_ablation.hpp"
+#include "hyrise.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "synthetic_table_generator.hpp"
+
+namespace hyrise {
+
+/**
+ * Benchmarks the validation rules of the DependencyDiscoveryPlugin and their ablation variants. The benchmarks are
+ * parameterized by
+ *   - the row count and the chunk size of the tables,
+ *   - the encoding of all segments,
+ *   - the position of a single violating row (none, in the first chunk, or in the last chunk), and
+ *   - for INDs, the ratio of NULLs in the foreign key column (NULLs always violate UCCs and are not interesting there).
+ * Throughput is reported in validated rows per second.
+ *
+ * The validated table has the following columns (i is the row index):
+ *   id      i                      ordering column of the OD candidate
+ *   key     i                      UCC candidate; the violating row duplicates row 0
+ *   ordered 2 * i                  ordered column of the OD candidate; the violating row is -1
+ *   even    2 * i                  referenced column of the IND candidate
+ *   group   i % 100                FD candidate together with key
+ * The foreign key table is generated by the SyntheticTableGenerator with uniformly distributed values. We double the
+ * values to reference `even`. The violating value is the odd value 1, so the violation is not found by min/max checks.
+ */
+class DependencyValidationFixture : public MicroBenchmarkBasicFixture {
+ public:
+  enum class ViolationPosition { None, Early, Late };
+
+  void SetUp(::benchmark::State& state) override {
+    _row_count = static_cast<size_t>(state.range(0));
+    const auto chunk_size = ChunkOffset{static_cast<ChunkOffset::base_type>(state.range(1))};
+    const auto encoding_spec = SegmentEncodingSpec{ENCODING_TYPES.at(static_cast<size_t>(state.range(2)))};
+    const auto violation_position = static_cast<ViolationPosition>(state.range(3));
+    const auto null_ratio = static_cast<float>(state.range(4)) / 100.0f;
+
+    auto violating_row = std::optional<size_t>{};
+    if (violation_position == ViolationPosition::Early) {
+      violating_row = 1;
+    } else if (violation_position == ViolationPosition::Late) {
+      violating_row = _row_count - 1;
+    }
+
+    auto& storage_manager = Hyrise::get().storage_manager;
+    storage_manager.add_table(TABLE_NAME, _generate_table(chunk_size, encoding_spec, violating_row));
+    storage_manager.add_table(FOREIGN_KEY_TABLE_NAME,
+                              _generate_foreign_key_table(chunk_size, encoding_spec, null_ratio, violation_position));
+  }
+
+ protected:
+  template <typename Rule>
+  void _benchmark_rule(::benchmark::State& state, const AbstractDependencyCandidate& candidate) {
+    _clear_cache();
+    auto rule = Rule{};
+    for (auto _ : state) {
+      const auto result = rule.validate(candidate);
+      benchmark::DoNotOptimize(result.status);
+    }
+
+    state.counters["rows_per_second"] =
+        benchmark::Counter(static_cast<double>(_row_count), benchmark::Counter::kIsIterationInvariantRate);
+  }
+
+  std::shared_ptr<Table> _generate_table(const ChunkOffset chunk_size, const SegmentEncodingSpec& encoding_spec,
+                                         const std::optional<size_t> violating_row) const {
+    const auto column_definitions =
+        TableColumnDefinitions{{"id", DataType::Int, false},
+                               {"key", DataType::Int, false},
+                               {"ordered", DataType::Int, false},
+                               {"even", DataType::Int, false},
+                               {"group", DataType::Int, false}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
+
+    for (auto chunk_begin = size_t{0}; chunk_begin < _row_count; chunk_begin += chunk_size) {
+      const auto chunk_end = std::min(chunk_begin + chunk_size, _row_count);
+      auto columns = std::vector<pmr_vector<int32_t>>(column_definitions.size());
+      for (auto& values : columns) {
+        values.reserve(chunk_end - chunk_begin);
+      }
+
+      for (auto row = chunk_begin; row < chunk_end; ++row) {
+        const auto value = SyntheticTableGenerator::generate_value<int32_t>(static_cast<int>(row));
+        const auto violates = violating_row && row == *violating_row;
+        columns[0].emplace_back(value);
+        columns[1].emplace_back(violates ? 0 : value);
+        columns[2].emplace_back(violates ? -1 : 2 * value);
+        columns[3].emplace_back(2 * value);
+        columns[4].emplace_back(value % 100);
+      }
+
+      auto segments = Segments{};
+      for (auto& values : columns) {
+        segments.emplace_back(std::make_shared<ValueSegment<int32_t>>(std::move(values)));
+      }
+      table->append_chunk(segments, std::make_shared<MvccData>(chunk_end - chunk_begin, CommitID{0}));
+      table->last_chunk()->finalize();
+    }
+
+    ChunkEncoder::encode_all_chunks(table, encoding_spec);
+    return table;
+  }
+
+  std::shared_ptr<Table> _generate_foreign_key_table(const ChunkOffset chunk_size,
+                                                     const SegmentEncodingSpec& encoding_spec, const float null_ratio,
+                                                     const ViolationPosition violation_position) const {
+    const auto column_specification =
+        ColumnSpecification{ColumnDataDistribution::make_uniform_config(0.0, static_cast<double>(_row_count - 1)),
+                            DataType::Int, SegmentEncodingSpec{EncodingType::Unencoded}, "foreign_key", null_ratio};
+    const auto table =
+        SyntheticTableGenerator::generate_table({column_specification}, _row_count, chunk_size, UseMvcc::Yes);
+
+    // NULLs cannot violate the IND, so the violating value replaces the first or the last non-NULL value.
+    auto* violating_value = static_cast<int32_t*>(nullptr);
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      auto& segment = static_cast<ValueSegment<int32_t>&>(*table->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+      auto& values = segment.values();
+      const auto value_count = values.size();
+      for (auto offset = size_t{0}; offset < value_count; ++offset) {
+        values[offset] *= 2;
+        const auto is_null = segment.is_nullable() && segment.null_values()[offset];
+        if (!is_null && (violation_position == ViolationPosition::Late ||
+                         (violation_position == ViolationPosition::Early && !violating_value))) {
+          violating_value = &values[offset];
+        }
+      }
+    }
+
+    if (violating_value) {
+      *violating_value = 1;
+    }
+
+    // Encoding the chunks also recreates the pruning statistics, which were created for the original values.
+    ChunkEncoder::encode_all_chunks(table, encoding_spec);
+    return table;
+  }
+
+  inline static const auto ENCODING_TYPES =
+      std::vector<EncodingType>{EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::FrameOfReference,
+                                EncodingType::RunLength, EncodingType::LZ4};
+
+  inline static const auto TABLE_NAME = std::string{"validation_table"};
+  inline static const auto FOREIGN_KEY_TABLE_NAME = std::string{"foreign_key_table"};
+
+  size_t _row_count{0};
+};
+
+// Arguments: row count, chunk size, index of the encoding type, violation position, and null ratio in percent.
+void validation_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgsProduct({{100'000, 1'000'000}, {10'000, 100'000}, {0, 1, 2, 3, 4}, {0, 1, 2}, {0}});
+}
+
+void ind_validation_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgsProduct({{100'000, 1'000'000}, {10'000, 100'000}, {0, 1, 2, 3, 4}, {0, 1, 2}, {0, 20}});
+}
+
+BENCHMARK_DEFINE_F(DependencyValidationFixture, BM_UccValidation)(benchmark::State& state) {
+  _benchmark_rule<UccValidationRule>(state, UccCandidate{TABLE_NAME, ColumnID{1}});
+}
+
+BENCHMARK_DEFINE_F(DependencyValidationFixture, BM_UccValidationAblation)(benchmark::State& state) {
+  _benchmark_rule<UccValidationRuleAblation>(state, UccCandidate{TABLE_NAME, ColumnID{1}});
+}
+
+BENCHMARK_DEFINE_F(DependencyValidationFixture, BM_OdValidation)(benchmark::State& state) {
+  _benchmark_rule<OdValidationRule>(state, OdCandidate{TABLE_NAME, ColumnID{0}, ColumnID{2}});
+}
+
+BENCHMARK_DEFINE_F(DependencyValidationFixture, BM_OdValidationAblation)(benchmark::State& state) {
+  _benchmark_rule<OdValidationRuleAblation>(state, OdCandidate{TABLE_NAME, ColumnID{0}, ColumnID{2}});
+}
+
+BENCHMARK_DEFINE_F(DependencyValidationFixture, BM_IndValidation)(benchmark::State& state) {
+  _benchmark_rule<IndValidationRule>(state, IndCandidate{FOREIGN_KEY_TABLE_NAME, ColumnID{0}, TABLE_NAME, ColumnID{3}});
+}
+
+BENCHMARK_DEFINE_F(DependencyValidationFixture, BM_IndValidationAblation)(benchmark::State& state) {
+  _benchmark_rule<IndValidationRuleAblation>(
+      state, IndCandidate{FOREIGN_KEY_TABLE_NAME, ColumnID{0}, TABLE_NAME, ColumnID{3}});
+}
+
+BENCHMARK_DEFINE_F(DependencyValidationFixture, BM_FdValidation)(benchmark::State& state) {
+  _benchmark_rule<FdValidationRule>(state, FdCandidate{TABLE_NAME, {ColumnID{1}, ColumnID{4}}});
+}
+
+BENCHMARK_DEFINE_F(DependencyValidationFixture, BM_FdValidationAblation)(benchmark::State& state) {
+  _benchmark_rule<FdValidationRuleAblation>(state, FdCandidate{TABLE_NAME, {ColumnID{1}, ColumnID{4}}});
+}
+
+BENCHMARK_REGISTER_F(DependencyValidationFixture, BM_UccValidation)->Apply(validation_arguments);
+BENCHMARK_REGISTER_F(DependencyValidationFixture, BM_UccValidationAblation)->Apply(validation_arguments);
+BENCHMARK_REGISTER_F(DependencyValidationFixture, BM_OdValidation)->Apply(validation_arguments);
+BENCHMARK_REGISTER_F(DependencyValidationFixture, BM_OdValidationAblation)->Apply(validation_arguments);
+BENCHMARK_REGISTER_F(DependencyValidationFixture, BM_IndValidation)->Apply(ind_validation_arguments);
+BENCHMARK_REGISTER_F(DependencyValidationFixture, BM_IndValidationAblation)->Apply(ind_validation_arguments);
+BENCHMARK_REGISTER_F(DependencyValidationFixture, BM_FdValidation)->Apply(validation_arguments);
+BENCHMARK_REGISTER_F(DependencyValidationFixture, BM_FdValidationAblation)->Apply(validation_arguments);
+
+}  // namespace hyrise
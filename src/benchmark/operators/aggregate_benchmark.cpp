@@ -1,15 +1,23 @@
 #include <memory>
+#include <thread>
 #include <vector>
 
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/aggregate_sort.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 #include "types.hpp"
 
+#include "micro_benchmark_utils.hpp"
+
 namespace hyrise {
 
 using namespace expression_functional;  // NOLINT(build/namespaces)
@@ -150,4 +158,139 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_AggregateSortSortedMultipleGroupBy)(b
   }
 }
 
+// Aggregates a table with a group key and a value column. The keys are spread out so that AggregateHash does not use
+// the immediate key shortcut, but hashes the keys.
+static void BM_AggregateHashParallel(benchmark::State& state) {
+  const auto group_count = static_cast<int64_t>(state.range(0));
+  const auto core_count = static_cast<uint32_t>(state.range(1));
+  constexpr auto ROW_COUNT = int64_t{10'000'000};
+
+  const auto column_definitions =
+      TableColumnDefinitions{{"key", DataType::Long, false}, {"value", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  const auto chunk_size = static_cast<int64_t>(Chunk::DEFAULT_SIZE);
+  for (auto chunk_begin = int64_t{0}; chunk_begin < ROW_COUNT; chunk_begin += chunk_size) {
+    const auto chunk_end = std::min(chunk_begin + chunk_size, ROW_COUNT);
+    auto keys = pmr_vector<int64_t>{};
+    auto values = pmr_vector<int32_t>{};
+    keys.reserve(chunk_end - chunk_begin);
+    values.reserve(chunk_end - chunk_begin);
+    for (auto row = chunk_begin; row < chunk_end; ++row) {
+      keys.emplace_back(((row * 7'919) % group_count) * 1'000'003);
+      values.emplace_back(static_cast<int32_t>(row % 1'000));
+    }
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int64_t>>(std::move(keys)),
+                                 std::make_shared<ValueSegment<int32_t>>(std::move(values))});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  const auto value = pqp_column_(ColumnID{1}, DataType::Int, false, "value");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::static_pointer_cast<AggregateExpression>(sum_(value)),
+      std::static_pointer_cast<AggregateExpression>(max_(value))};
+  const auto groupby = std::vector<ColumnID>{ColumnID{0}};
+
+  Hyrise::get().topology.use_non_numa_topology(core_count);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  micro_benchmark_clear_cache();
+
+  for (auto _ : state) {
+    auto aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby);
+    aggregate->execute();
+  }
+
+  Hyrise::get().scheduler()->finish();
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+  Hyrise::get().topology.use_default_topology();
+}
+
+// Arguments: group count (low and high cardinality) and core count, from a single core to all cores of the machine.
+static void parallel_aggregate_arguments(benchmark::internal::Benchmark* benchmark) {
+  const auto max_core_count = static_cast<int64_t>(std::thread::hardware_concurrency());
+  for (const auto group_count : {int64_t{100}, int64_t{5'000'000}}) {
+    for (auto core_count = int64_t{1}; core_count < max_core_count; core_count *= 2) {
+      benchmark->Args({group_count, core_count});
+    }
+    benchmark->Args({group_count, max_core_count});
+  }
+}
+
+BENCHMARK(BM_AggregateHashParallel)->Apply(parallel_aggregate_arguments)->UseRealTime();
+
+// Aggregates a time-series-like table that is sorted by its group key, either with AggregateHash or with AggregateSort
+// streaming over the sorted input.
+static void BM_AggregateSortedInputParallel(benchmark::State& state) {
+  const auto group_count = static_cast<int64_t>(state.range(0));
+  const auto core_count = static_cast<uint32_t>(state.range(1));
+  const auto use_aggregate_sort = state.range(2) != 0;
+  constexpr auto ROW_COUNT = int64_t{10'000'000};
+
+  const auto column_definitions =
+      TableColumnDefinitions{{"timestamp", DataType::Long, false}, {"value", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  const auto chunk_size = static_cast<int64_t>(Chunk::DEFAULT_SIZE);
+  for (auto chunk_begin = int64_t{0}; chunk_begin < ROW_COUNT; chunk_begin += chunk_size) {
+    const auto chunk_end = std::min(chunk_begin + chunk_size, ROW_COUNT);
+    auto keys = pmr_vector<int64_t>{};
+    auto values = pmr_vector<int32_t>{};
+    keys.reserve(chunk_end - chunk_begin);
+    values.reserve(chunk_end - chunk_begin);
+    for (auto row = chunk_begin; row < chunk_end; ++row) {
+      keys.emplace_back((row * group_count / ROW_COUNT) * 1'000'003);
+      values.emplace_back(static_cast<int32_t>(row % 1'000));
+    }
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int64_t>>(std::move(keys)),
+                                 std::make_shared<ValueSegment<int32_t>>(std::move(values))});
+    table->last_chunk()->finalize();
+    table->last_chunk()->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}, SortMode::Ascending});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  const auto value = pqp_column_(ColumnID{1}, DataType::Int, false, "value");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::static_pointer_cast<AggregateExpression>(sum_(value)),
+      std::static_pointer_cast<AggregateExpression>(max_(value))};
+  const auto groupby = std::vector<ColumnID>{ColumnID{0}};
+
+  Hyrise::get().topology.use_non_numa_topology(core_count);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  micro_benchmark_clear_cache();
+
+  for (auto _ : state) {
+    auto aggregate = std::shared_ptr<AbstractOperator>{};
+    if (use_aggregate_sort) {
+      aggregate =
+          std::make_shared<AggregateSort>(table_wrapper, aggregates, groupby, AggregateSort::SortedInput::Yes);
+    } else {
+      aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby);
+    }
+    aggregate->execute();
+  }
+
+  Hyrise::get().scheduler()->finish();
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+  Hyrise::get().topology.use_default_topology();
+}
+
+// Arguments: group count, core count, and whether AggregateSort (1) or AggregateHash (0) is used.
+static void sorted_input_aggregate_arguments(benchmark::internal::Benchmark* benchmark) {
+  const auto max_core_count = static_cast<int64_t>(std::thread::hardware_concurrency());
+  for (const auto use_aggregate_sort : {int64_t{0}, int64_t{1}}) {
+    for (const auto group_count : {int64_t{100}, int64_t{5'000'000}}) {
+      for (auto core_count = int64_t{1}; core_count < max_core_count; core_count *= 2) {
+        benchmark->Args({group_count, core_count, use_aggregate_sort});
+      }
+      benchmark->Args({group_count, max_core_count, use_aggregate_sort});
+    }
+  }
+}
+
+BENCHMARK(BM_AggregateSortedInputParallel)->Apply(sorted_input_aggregate_arguments)->UseRealTime();
+
 }  // namespace hyrise
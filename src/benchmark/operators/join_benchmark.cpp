@@ -60,6 +60,23 @@ std::shared_ptr<TableWrapper> generate_table(const size_t number_of_rows) {
   return table_wrapper;
 }
 
+// Generates a table whose values follow a Pareto distribution, i.e., few values occur very often. Such heavy hitters
+// make some partitions of radix-partitioning joins much larger than others.
+std::shared_ptr<TableWrapper> generate_skewed_table(const size_t number_of_rows) {
+  const auto chunk_size = static_cast<ChunkOffset>(number_of_rows / NUMBER_OF_CHUNKS);
+  Assert(chunk_size > 0, "The chunk size is 0 or less, can not generate such a table");
+
+  const auto column_specification = ColumnSpecification{ColumnDataDistribution::make_pareto_config(), DataType::Int,
+                                                         SegmentEncodingSpec{EncodingType::Dictionary}};
+  auto table = SyntheticTableGenerator::generate_table({column_specification}, number_of_rows, chunk_size);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  return table_wrapper;
+}
+
 template <class C>
 void bm_join_impl(benchmark::State& state, std::shared_ptr<TableWrapper> table_wrapper_left,
                   std::shared_ptr<TableWrapper> table_wrapper_right) {
@@ -101,6 +118,14 @@ void BM_Join_MediumAndMedium(benchmark::State& state) {  // NOLINT 100,000 x 100
   bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
 }
 
+template <class C>
+void BM_Join_MediumAndSkewedMedium(benchmark::State& state) {  // NOLINT 100,000 x 100,000 (Pareto-distributed)
+  auto table_wrapper_left = generate_table(TABLE_SIZE_MEDIUM);
+  auto table_wrapper_right = generate_skewed_table(TABLE_SIZE_MEDIUM);
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
+}
+
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinNestedLoop);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinIndex);
@@ -110,9 +135,11 @@ BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinIndex);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinHash);
+BENCHMARK_TEMPLATE(BM_Join_MediumAndSkewedMedium, JoinHash);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinSortMerge);
+BENCHMARK_TEMPLATE(BM_Join_MediumAndSkewedMedium, JoinSortMerge);
 
 }  // namespace hyrise
@@ -1,4 +1,5 @@
 #include <memory>
+#include <thread>
 
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "expression/expression_functional.hpp"
@@ -7,6 +8,8 @@
 #include "operators/limit.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_translator.hpp"
 #include "synthetic_table_generator.hpp"
@@ -33,7 +36,7 @@ static std::shared_ptr<Table> generate_custom_table(const size_t row_count, cons
 
 static void BM_Sort(benchmark::State& state, const size_t row_count = 40'000, const DataType data_type = DataType::Int,
                     const float null_ratio = 0.0f, const bool multi_column_sort = true,
-                    const bool use_reference_segment = false) {
+                    const bool use_reference_segment = false, const std::optional<size_t> top_k = std::nullopt) {
   micro_benchmark_clear_cache();
 
   const auto input_table = generate_custom_table(row_count, data_type, null_ratio);
@@ -56,7 +59,8 @@ static void BM_Sort(benchmark::State& state, const size_t row_count = 40'000, co
   }
 
   for (auto _ : state) {
-    auto sort = std::make_shared<Sort>(input_operator, sort_definitions);
+    auto sort = std::make_shared<Sort>(input_operator, sort_definitions, Chunk::DEFAULT_SIZE,
+                                       Sort::ForceMaterialization::No, top_k);
     sort->execute();
   }
 }
@@ -91,11 +95,49 @@ static void BM_SortWithStrings(benchmark::State& state) {
   BM_Sort(state, row_count, DataType::String);
 }
 
+// ORDER BY ... LIMIT 10, which only keeps the first ten rows instead of sorting the entire input.
+static void BM_SortTopK(benchmark::State& state) {
+  const size_t row_count = state.range(0);
+  BM_Sort(state, row_count, DataType::Int, 0.0f, false, false, 10);
+}
+
+static void BM_SortTopKTwoColumns(benchmark::State& state) {
+  const size_t row_count = state.range(0);
+  BM_Sort(state, row_count, DataType::Int, 0.0f, true, false, 10);
+}
+
+// Sorts with a NodeQueueScheduler that uses the given number of cores to report how the parallel sort scales.
+static void BM_SortParallel(benchmark::State& state) {
+  const auto row_count = static_cast<size_t>(state.range(0));
+  const auto core_count = static_cast<uint32_t>(state.range(1));
+
+  Hyrise::get().topology.use_non_numa_topology(core_count);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  BM_Sort(state, row_count);
+
+  Hyrise::get().scheduler()->finish();
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+  Hyrise::get().topology.use_default_topology();
+}
+
+// Arguments: row count and core count, from a single core to all cores of the machine.
+static void parallel_sort_arguments(benchmark::internal::Benchmark* benchmark) {
+  const auto max_core_count = static_cast<int64_t>(std::thread::hardware_concurrency());
+  for (auto core_count = int64_t{1}; core_count < max_core_count; core_count *= 2) {
+    benchmark->Args({10'000'000, core_count});
+  }
+  benchmark->Args({10'000'000, max_core_count});
+}
+
 BENCHMARK(BM_Sort)->RangeMultiplier(100)->Range(100, 1'000'000);
 BENCHMARK(BM_SortTwoColumns)->RangeMultiplier(100)->Range(100, 1'000'000);
 BENCHMARK(BM_SortWithNullValues)->RangeMultiplier(100)->Range(100, 1'000'000);
 BENCHMARK(BM_SortWithReferenceSegments)->RangeMultiplier(100)->Range(100, 1'000'000);
 BENCHMARK(BM_SortWithReferenceSegmentsTwoColumns)->RangeMultiplier(100)->Range(100, 1'000'000);
 BENCHMARK(BM_SortWithStrings)->RangeMultiplier(100)->Range(100, 1'000'000);
+BENCHMARK(BM_SortTopK)->RangeMultiplier(100)->Range(100, 1'000'000);
+BENCHMARK(BM_SortTopKTwoColumns)->RangeMultiplier(100)->Range(100, 1'000'000);
+BENCHMARK(BM_SortParallel)->Apply(parallel_sort_arguments)->UseRealTime();
 
 }  // namespace hyrise
@@ -6,6 +6,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/table.hpp"
+#include "synthetic_table_generator.hpp"
 #include "utils/load_table.hpp"
 
 namespace hyrise {
@@ -57,6 +58,19 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanVariable_OnDict)(benchmark::
   benchmark_tablescan_impl(state, _table_dict_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, ColumnID{1});
 }
 
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanConstant_OnDictBitPacking)(benchmark::State& state) {
+  // Same as BM_TableScanConstant_OnDict, but the attribute vectors are bit-packed and unpacked block-wise.
+  const auto table = SyntheticTableGenerator{}.generate_table(
+      2ul, size_t{40'000}, ChunkOffset{2'000},
+      SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  _clear_cache();
+  benchmark_tablescan_impl(state, table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 7);
+}
+
 BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScan_Like)(benchmark::State& state) {
   const auto lineitem_table = load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl");
 
@@ -32,6 +32,9 @@ class AbstractCache {
   // Returns the number of elements currently held in the cache.
   virtual size_t size() const = 0;
 
+  // Remove the element at the given key (if present).
+  virtual void erase(const Key& key) = 0;
+
   // Remove all elements from the cache.
   virtual void clear() = 0;
 
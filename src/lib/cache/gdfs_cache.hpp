@@ -98,6 +98,17 @@ class GDFSCache : public AbstractCache<Key, Value> {
     return _map.size();
   }
 
+  void erase(const Key& key) final {
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    auto it = _map.find(key);
+    if (it == _map.end()) {
+      return;
+    }
+
+    _queue.erase(it->second);
+    _map.erase(it);
+  }
+
   void clear() final {
     std::unique_lock<std::shared_mutex> lock(_mutex);
     _map.clear();
@@ -31,6 +31,7 @@
 #include "operators/abstract_operator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -1160,6 +1161,19 @@ RowIDPosList ExpressionEvaluator::evaluate_expression_to_pos_list(const Abstract
       const auto left_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[0]);
       const auto right_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[1]);
 
+      // Dense matches are combined as bitmaps, which are intersected or united word by word instead of merging the
+      // sorted RowIDs with a branch per position.
+      const auto chunk_size = ChunkOffset{static_cast<ChunkOffset::base_type>(_output_row_count)};
+      if (BitmapPosList::use_for(left_pos_list.size() + right_pos_list.size(), chunk_size)) {
+        const auto left_bitmap = BitmapPosList{_chunk_id, chunk_size, left_pos_list.cbegin(), left_pos_list.cend()};
+        const auto right_bitmap = BitmapPosList{_chunk_id, chunk_size, right_pos_list.cbegin(), right_pos_list.cend()};
+        const auto result_bitmap = logical_expression.logical_operator == LogicalOperator::And
+                                       ? BitmapPosList::intersect(left_bitmap, right_bitmap)
+                                       : BitmapPosList::unite(left_bitmap, right_bitmap);
+        result_pos_list = RowIDPosList{result_bitmap->cbegin(), result_bitmap->cend()};
+        break;
+      }
+
       switch (logical_expression.logical_operator) {
         case LogicalOperator::And:
           std::set_intersection(left_pos_list.begin(), left_pos_list.end(), right_pos_list.begin(),
@@ -5,8 +5,10 @@
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
@@ -32,6 +34,57 @@ std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
   return table;
 }
 
+ConstraintCatalog BinaryParser::parse_constraint_catalog(const std::string& filename) {
+  std::ifstream file;
+  file.open(filename, std::ios::binary);
+  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+
+  const auto table_count = _read_value<uint32_t>(file);
+  auto catalog = ConstraintCatalog{};
+  catalog.reserve(table_count);
+  for (auto table_index = uint32_t{0}; table_index < table_count; ++table_index) {
+    auto entry = TableConstraintCatalogEntry{};
+    entry.table_name = std::string{_read_string_values(file, 1).front()};
+
+    auto& fingerprint = entry.fingerprint;
+    fingerprint.row_count = _read_value<uint64_t>(file);
+    fingerprint.chunk_count = _read_value<ChunkID>(file);
+    const auto max_begin_cids = _read_values<CommitID>(file, fingerprint.chunk_count);
+    fingerprint.max_begin_cids = std::vector<CommitID>{max_begin_cids.cbegin(), max_begin_cids.cend()};
+    const auto invalid_row_counts = _read_values<ChunkOffset>(file, fingerprint.chunk_count);
+    fingerprint.invalid_row_counts = std::vector<ChunkOffset>{invalid_row_counts.cbegin(), invalid_row_counts.cend()};
+    const auto segment_checksums = _read_values<size_t>(file, _read_value<uint64_t>(file));
+    fingerprint.segment_checksums = std::vector<size_t>{segment_checksums.cbegin(), segment_checksums.cend()};
+
+    const auto key_constraint_count = _read_value<uint32_t>(file);
+    for (auto constraint_index = uint32_t{0}; constraint_index < key_constraint_count; ++constraint_index) {
+      const auto key_type = _read_value<KeyConstraintType>(file);
+      const auto columns = _read_column_ids(file);
+      entry.key_constraints.emplace_back(std::set<ColumnID>{columns.cbegin(), columns.cend()}, key_type);
+    }
+
+    const auto order_constraint_count = _read_value<uint32_t>(file);
+    for (auto constraint_index = uint32_t{0}; constraint_index < order_constraint_count; ++constraint_index) {
+      auto ordering_columns = _read_column_ids(file);
+      auto ordered_columns = _read_column_ids(file);
+      entry.order_constraints.emplace_back(ordering_columns, ordered_columns);
+    }
+
+    const auto foreign_key_count = _read_value<uint32_t>(file);
+    for (auto constraint_index = uint32_t{0}; constraint_index < foreign_key_count; ++constraint_index) {
+      auto foreign_key_constraint = ForeignKeyCatalogEntry{};
+      foreign_key_constraint.foreign_key_columns = _read_column_ids(file);
+      foreign_key_constraint.primary_key_table_name = std::string{_read_string_values(file, 1).front()};
+      foreign_key_constraint.primary_key_columns = _read_column_ids(file);
+      entry.foreign_key_constraints.emplace_back(std::move(foreign_key_constraint));
+    }
+
+    catalog.emplace_back(std::move(entry));
+  }
+
+  return catalog;
+}
+
 template <typename T>
 pmr_compact_vector BinaryParser::_read_values_compact_vector(std::ifstream& file, const size_t count) {
   const auto bit_width = _read_value<uint8_t>(file);
@@ -62,6 +115,11 @@ pmr_vector<bool> BinaryParser::_read_values(std::ifstream& file, const size_t co
   return {readable_bools.begin(), readable_bools.end()};
 }
 
+std::vector<ColumnID> BinaryParser::_read_column_ids(std::ifstream& file) {
+  const auto column_ids = _read_values<ColumnID>(file, _read_value<uint32_t>(file));
+  return {column_ids.cbegin(), column_ids.cend()};
+}
+
 pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, const size_t count) {
   const auto string_lengths = _read_values<size_t>(file, count);
   const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
@@ -169,6 +227,13 @@ std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& fi
       }
     case EncodingType::LZ4:
       return _import_lz4_segment<ColumnDataType>(file, row_count);
+    case EncodingType::FSST:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FSST>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_fsst_segment(file, row_count);
+      } else {
+        Fail("Unsupported data type for FSST encoding");
+      }
   }
 
   Fail("Invalid EncodingType");
@@ -286,6 +351,30 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
                                          block_size, last_block_size, compressed_size, num_elements);
 }
 
+std::shared_ptr<FSSTSegment<pmr_string>> BinaryParser::_import_fsst_segment(std::ifstream& file,
+                                                                          ChunkOffset row_count) {
+  const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
+
+  const auto symbol_count = _read_value<uint32_t>(file);
+  auto symbols = _read_values<uint64_t>(file, symbol_count);
+  auto symbol_lengths = _read_values<uint8_t>(file, symbol_count);
+
+  const auto code_count = _read_value<uint32_t>(file);
+  auto codes = _read_values<uint8_t>(file, code_count);
+
+  const auto null_values_stored = _read_value<BoolAsByteType>(file);
+  std::optional<pmr_vector<bool>> null_values;
+  if (null_values_stored) {
+    null_values = _read_values<bool>(file, row_count);
+  }
+
+  // The code offsets contain the end of the last string in addition to the begin of each string.
+  auto code_offsets = _import_offset_value_vector(file, ChunkOffset{row_count + 1}, compressed_vector_type_id);
+
+  return std::make_shared<FSSTSegment<pmr_string>>(FSSTSymbolTable{std::move(symbols), std::move(symbol_lengths)},
+                                                   std::move(codes), std::move(code_offsets), std::move(null_values));
+}
+
 std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
     std::ifstream& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
   const auto compressed_vector_type = static_cast<CompressedVectorType>(compressed_vector_type_id);
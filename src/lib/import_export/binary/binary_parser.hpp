@@ -7,11 +7,13 @@
 #include <utility>
 #include <vector>
 
+#include "import_export/binary/constraint_catalog.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/table.hpp"
@@ -39,6 +41,9 @@ class BinaryParser {
    */
   static std::shared_ptr<Table> parse(const std::string& filename);
 
+  // Reads a constraint catalog written by BinaryWriter::write_constraint_catalog().
+  static ConstraintCatalog parse_constraint_catalog(const std::string& filename);
+
  private:
   /*
    * Reads the header from the given file.
@@ -89,6 +94,8 @@ class BinaryParser {
   template <typename T>
   static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::ifstream& file, ChunkOffset row_count);
 
+  static std::shared_ptr<FSSTSegment<pmr_string>> _import_fsst_segment(std::ifstream& file, ChunkOffset row_count);
+
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given compressed_vector_type_id.
   static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(
       std::ifstream& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
@@ -109,6 +116,9 @@ class BinaryParser {
   // Reads row_count many strings from input file. String lengths are encoded in type T.
   static pmr_vector<pmr_string> _read_string_values(std::ifstream& file, const size_t count);
 
+  // Reads a list of ColumnIDs, prefixed by its length.
+  static std::vector<ColumnID> _read_column_ids(std::ifstream& file);
+
   // Reads a single value of type T from the input file.
   template <typename T>
   static T _read_value(std::ifstream& file);
@@ -88,6 +88,15 @@ void export_value(std::ofstream& ofstream, const T& value) {
   ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
 }
 
+void export_column_ids(std::ofstream& ofstream, const std::vector<ColumnID>& column_ids) {
+  export_value(ofstream, static_cast<uint32_t>(column_ids.size()));
+  export_values(ofstream, column_ids);
+}
+
+void export_string(std::ofstream& ofstream, const std::string& value) {
+  export_string_values(ofstream, pmr_vector<pmr_string>{pmr_string{value}});
+}
+
 void export_compact_vector(std::ofstream& ofstream, const pmr_compact_vector& values) {
   export_value(ofstream, static_cast<uint8_t>(values.bits()));
   ofstream.write(reinterpret_cast<const char*>(values.get()), static_cast<int64_t>(values.bytes()));
@@ -110,6 +119,47 @@ void BinaryWriter::write(const Table& table, const std::string& filename) {
   }
 }
 
+void BinaryWriter::write_constraint_catalog(const ConstraintCatalog& catalog, const std::string& filename) {
+  std::ofstream ofstream;
+  ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  ofstream.open(filename, std::ios::binary);
+
+  export_value(ofstream, static_cast<uint32_t>(catalog.size()));
+  for (const auto& entry : catalog) {
+    const auto& fingerprint = entry.fingerprint;
+    export_string(ofstream, entry.table_name);
+    export_value(ofstream, fingerprint.row_count);
+    export_value(ofstream, fingerprint.chunk_count);
+    Assert(fingerprint.max_begin_cids.size() == fingerprint.chunk_count &&
+               fingerprint.invalid_row_counts.size() == fingerprint.chunk_count,
+           "Fingerprint must contain values for each chunk.");
+    export_values(ofstream, fingerprint.max_begin_cids);
+    export_values(ofstream, fingerprint.invalid_row_counts);
+    export_value(ofstream, static_cast<uint64_t>(fingerprint.segment_checksums.size()));
+    export_values(ofstream, fingerprint.segment_checksums);
+
+    export_value(ofstream, static_cast<uint32_t>(entry.key_constraints.size()));
+    for (const auto& key_constraint : entry.key_constraints) {
+      export_value(ofstream, key_constraint.key_type());
+      const auto& columns = key_constraint.columns();
+      export_column_ids(ofstream, std::vector<ColumnID>{columns.cbegin(), columns.cend()});
+    }
+
+    export_value(ofstream, static_cast<uint32_t>(entry.order_constraints.size()));
+    for (const auto& order_constraint : entry.order_constraints) {
+      export_column_ids(ofstream, order_constraint.ordering_columns());
+      export_column_ids(ofstream, order_constraint.ordered_columns());
+    }
+
+    export_value(ofstream, static_cast<uint32_t>(entry.foreign_key_constraints.size()));
+    for (const auto& foreign_key_constraint : entry.foreign_key_constraints) {
+      export_column_ids(ofstream, foreign_key_constraint.foreign_key_columns);
+      export_string(ofstream, foreign_key_constraint.primary_key_table_name);
+      export_column_ids(ofstream, foreign_key_constraint.primary_key_columns);
+    }
+  }
+}
+
 void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
   const auto target_chunk_size = table.type() == TableType::Data ? table.target_chunk_size() : Chunk::DEFAULT_SIZE;
   export_value(ofstream, static_cast<ChunkOffset>(target_chunk_size));
@@ -335,6 +385,36 @@ void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, bool /*colum
   }
 }
 
+template <typename T>
+void BinaryWriter::_write_segment(const FSSTSegment<T>& fsst_segment, bool /*column_is_nullable*/,
+                                  std::ofstream& ofstream) {
+  export_value(ofstream, EncodingType::FSST);
+
+  // Write code offsets compression id
+  const auto compressed_vector_type_id = _compressed_vector_type_id<T>(fsst_segment);
+  export_value(ofstream, compressed_vector_type_id);
+
+  // Write the symbol table
+  const auto& symbol_table = fsst_segment.symbol_table();
+  export_value(ofstream, static_cast<uint32_t>(symbol_table.symbols().size()));
+  export_values(ofstream, symbol_table.symbols());
+  export_values(ofstream, symbol_table.lengths());
+
+  // Write the codes
+  export_value(ofstream, static_cast<uint32_t>(fsst_segment.codes().size()));
+  export_values(ofstream, fsst_segment.codes());
+
+  // Write flag if optional NULL value vector is written
+  export_value(ofstream, static_cast<BoolAsByteType>(fsst_segment.null_values().has_value()));
+  if (fsst_segment.null_values()) {
+    // Write NULL values
+    export_values(ofstream, *fsst_segment.null_values());
+  }
+
+  // Write code offsets
+  _export_compressed_vector(ofstream, *fsst_segment.compressed_vector_type(), fsst_segment.code_offsets());
+}
+
 template <typename T>
 CompressedVectorTypeID BinaryWriter::_compressed_vector_type_id(
     const AbstractEncodedSegment& abstract_encoded_segment) {
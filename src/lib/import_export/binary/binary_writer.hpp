@@ -4,9 +4,11 @@
 #include <string>
 #include <vector>
 
+#include "import_export/binary/constraint_catalog.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
@@ -21,6 +23,36 @@ class BinaryWriter {
  public:
   static void write(const Table& table, const std::string& filename);
 
+  /**
+   * Writes a catalog of soft constraints (see constraint_catalog.hpp) with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Table count                 | uint32_t                            | 4
+   * Table entries               | see below                           | Table count * variable
+   *
+   * Each table entry has the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Table name                  | std::string (with length)           | 8 + length
+   * Row count                   | uint64_t                            | 8
+   * Chunk count                 | ChunkID                             | 4
+   * Max begin CIDs              | CommitID array                      | Chunk count * 4
+   * Invalid row counts          | ChunkOffset array                   | Chunk count * 4
+   * Segment checksum count      | uint64_t                            | 8
+   * Segment checksums           | size_t array                        | Segment checksum count * 8
+   * Key constraint count        | uint32_t                            | 4
+   * Key constraints¹            | KeyConstraintType, ColumnID list    | variable
+   * Order constraint count      | uint32_t                            | 4
+   * Order constraints¹          | two ColumnID lists                  | variable
+   * Foreign key count           | uint32_t                            | 4
+   * Foreign keys¹               | ColumnID list, table name, list     | variable
+   *
+   * ¹ ColumnID lists are written as their length (uint32_t) followed by the ColumnIDs.
+   */
+  static void write_constraint_catalog(const ConstraintCatalog& catalog, const std::string& filename);
+
  private:
   /**
    * This methods writes the header of this table into the given ofstream.
@@ -222,6 +254,35 @@ class BinaryWriter {
   template <typename T>
   static void _write_segment(const LZ4Segment<T>& lz4_segment, bool /*column_is_nullable*/, std::ofstream& ofstream);
 
+  /**
+   * FSSTSegments are dumped with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Encoding Type               | EncodingType                        | 1
+   * Code offsets compr. ID      | CompressedVectorTypeID              | 1
+   * Number of symbols           | uint32_t                            | 4
+   * Symbols                     | uint64_t                            | Number of symbols * 8
+   * Symbol lengths              | uint8_t                             | Number of symbols * 1
+   * Number of codes             | uint32_t                            | 4
+   * Codes                       | uint8_t                             | Number of codes * 1
+   * Stores NULL values          | bool (stored as BoolAsByteType)     | 1
+   * NULL values¹                | vector<bool> (BoolAsByteType)       | Rows * 1
+   * Vector compress. bit width² | uint8_t                             | 1
+   * Code offsets²               | uint8_t                             | (Rows + 1) * (vector compr. bit width) / 8
+   *                                                                     rounded up to next multiple of word (8 byte)
+   * Code offsets³               | uint(8|16|32)_t                     | (Rows + 1) * width of offset vector
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   *
+   * ¹: This field is only written when the optional NULL values are stored
+   * ²: This field is only written if the vector compression is BitPacking
+   * ³: This field is only written if the vector compression is FixedWidthInteger
+   */
+  template <typename T>
+  static void _write_segment(const FSSTSegment<T>& fsst_segment, bool /*column_is_nullable*/, std::ofstream& ofstream);
+
   template <typename T>
   static CompressedVectorTypeID _compressed_vector_type_id(const AbstractEncodedSegment& abstract_encoded_segment);
 
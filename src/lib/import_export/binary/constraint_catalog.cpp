@@ -0,0 +1,71 @@
+#include "constraint_catalog.hpp"
+
+#include <boost/container_hash/hash.hpp>
+
+#include "storage/table.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace hyrise {
+
+TableFingerprint TableFingerprint::compute(const Table& table) {
+  // Accessing single values via operator[] is fine for the few positions per segment.
+  auto performance_warning_disabler = PerformanceWarningDisabler{};
+  auto fingerprint = TableFingerprint{};
+  fingerprint.row_count = table.row_count();
+  fingerprint.chunk_count = table.chunk_count();
+  fingerprint.max_begin_cids.reserve(fingerprint.chunk_count);
+  fingerprint.invalid_row_counts.reserve(fingerprint.chunk_count);
+  fingerprint.segment_checksums.reserve(fingerprint.chunk_count * table.column_count());
+
+  const auto column_count = table.column_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < fingerprint.chunk_count; ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (!chunk) {
+      fingerprint.max_begin_cids.emplace_back(MvccData::MAX_COMMIT_ID);
+      fingerprint.invalid_row_counts.emplace_back(ChunkOffset{0});
+      continue;
+    }
+
+    const auto chunk_size = chunk->size();
+    auto max_begin_cid = CommitID{0};
+    if (const auto& mvcc_data = chunk->mvcc_data()) {
+      // The max_begin_cid is only set for finalized chunks.
+      if (mvcc_data->max_begin_cid) {
+        max_begin_cid = *mvcc_data->max_begin_cid;
+      } else {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          max_begin_cid = std::max(max_begin_cid, mvcc_data->get_begin_cid(chunk_offset));
+        }
+      }
+    }
+    fingerprint.max_begin_cids.emplace_back(max_begin_cid);
+    fingerprint.invalid_row_counts.emplace_back(chunk->invalid_row_count());
+
+    // Include the first and the last value as well as values at equidistant positions in between.
+    const auto step = std::max(ChunkOffset{1}, ChunkOffset{chunk_size / CHECKSUM_POSITIONS});
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto& segment = *chunk->get_segment(column_id);
+      auto checksum = size_t{chunk_size};
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; chunk_offset += step) {
+        boost::hash_combine(checksum, std::hash<AllTypeVariant>{}(segment[chunk_offset]));
+      }
+      if (chunk_size > 0) {
+        boost::hash_combine(checksum, std::hash<AllTypeVariant>{}(segment[ChunkOffset{chunk_size - 1}]));
+      }
+      fingerprint.segment_checksums.emplace_back(checksum);
+    }
+  }
+
+  return fingerprint;
+}
+
+bool TableFingerprint::operator==(const TableFingerprint& other) const {
+  return row_count == other.row_count && chunk_count == other.chunk_count && max_begin_cids == other.max_begin_cids &&
+         invalid_row_counts == other.invalid_row_counts && segment_checksums == other.segment_checksums;
+}
+
+bool TableFingerprint::operator!=(const TableFingerprint& other) const {
+  return !(*this == other);
+}
+
+}  // namespace hyrise
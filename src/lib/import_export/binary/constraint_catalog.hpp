@@ -0,0 +1,60 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "storage/constraints/table_key_constraint.hpp"
+#include "storage/constraints/table_order_constraint.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+
+/**
+ * Identifies the data of a table without reading all of it. The fingerprint consists of the row count, the chunk
+ * count, and per chunk the largest begin commit ID and the number of invalidated rows. Thus, any insert, update, or
+ * delete changes the fingerprint. Furthermore, it contains a checksum per segment, which combines the segment's size
+ * and the values at a few fixed positions. The checksums detect tables that were regenerated with different data (but
+ * not every possible change of a single value).
+ */
+struct TableFingerprint {
+  static TableFingerprint compute(const Table& table);
+
+  bool operator==(const TableFingerprint& other) const;
+  bool operator!=(const TableFingerprint& other) const;
+
+  // Number of positions per segment that are included in the checksum.
+  constexpr static ChunkOffset CHECKSUM_POSITIONS{16};
+
+  uint64_t row_count{0};
+  ChunkID chunk_count{0};
+  std::vector<CommitID> max_begin_cids{};
+  std::vector<ChunkOffset> invalid_row_counts{};
+  std::vector<size_t> segment_checksums{};
+};
+
+// Foreign key constraints reference other tables. The catalog stores the name of the referenced table instead.
+struct ForeignKeyCatalogEntry {
+  std::vector<ColumnID> foreign_key_columns{};
+  std::string primary_key_table_name{};
+  std::vector<ColumnID> primary_key_columns{};
+};
+
+struct TableConstraintCatalogEntry {
+  std::string table_name{};
+  TableFingerprint fingerprint{};
+  std::vector<TableKeyConstraint> key_constraints{};
+  std::vector<TableOrderConstraint> order_constraints{};
+  std::vector<ForeignKeyCatalogEntry> foreign_key_constraints{};
+};
+
+/**
+ * Soft constraints of tables together with the fingerprints of the tables' data at the time the constraints were
+ * valid. The catalog is written by BinaryWriter::write_constraint_catalog() and read by
+ * BinaryParser::parse_constraint_catalog(). If the fingerprint of a table still matches, its constraints can be
+ * restored without validating them again.
+ */
+using ConstraintCatalog = std::vector<TableConstraintCatalogEntry>;
+
+}  // namespace hyrise
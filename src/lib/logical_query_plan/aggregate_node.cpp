@@ -64,6 +64,10 @@ std::string AggregateNode::description(const DescriptionMode mode) const {
   }
   stream << "]";
 
+  if (input_is_sorted) {
+    stream << " sorted input";
+  }
+
   return stream.str();
 }
 
@@ -206,7 +210,9 @@ FunctionalDependencies AggregateNode::non_trivial_functional_dependencies() cons
 }
 
 size_t AggregateNode::_on_shallow_hash() const {
-  return aggregate_expressions_begin_idx;
+  auto hash = aggregate_expressions_begin_idx;
+  boost::hash_combine(hash, input_is_sorted);
+  return hash;
 }
 
 std::shared_ptr<AbstractLQPNode> AggregateNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
@@ -218,9 +224,11 @@ std::shared_ptr<AbstractLQPNode> AggregateNode::_on_shallow_copy(LQPNodeMapping&
       node_expressions.begin() + static_cast<NodeExpressionsDifferenceType>(aggregate_expressions_begin_idx),
       node_expressions.end()};
 
-  return std::make_shared<AggregateNode>(
-      expressions_copy_and_adapt_to_different_lqp(group_by_expressions, node_mapping),
-      expressions_copy_and_adapt_to_different_lqp(aggregate_expressions, node_mapping));
+  const auto aggregate_node =
+      std::make_shared<AggregateNode>(expressions_copy_and_adapt_to_different_lqp(group_by_expressions, node_mapping),
+                                      expressions_copy_and_adapt_to_different_lqp(aggregate_expressions, node_mapping));
+  aggregate_node->input_is_sorted = input_is_sorted;
+  return aggregate_node;
 }
 
 bool AggregateNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
@@ -228,6 +236,7 @@ bool AggregateNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNode
 
   return expressions_equal_to_expressions_in_different_lqp(node_expressions, aggregate_node.node_expressions,
                                                            node_mapping) &&
-         aggregate_expressions_begin_idx == aggregate_node.aggregate_expressions_begin_idx;
+         aggregate_expressions_begin_idx == aggregate_node.aggregate_expressions_begin_idx &&
+         input_is_sorted == aggregate_node.input_is_sorted;
 }
 }  // namespace hyrise
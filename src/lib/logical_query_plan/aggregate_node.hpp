@@ -43,6 +43,11 @@ class AggregateNode : public EnableMakeForLQPNode<AggregateNode>, public Abstrac
   // node_expression contains both the group_by- and the aggregate_expressions in that order.
   size_t aggregate_expressions_begin_idx;
 
+  // Set by the StreamingAggregateRule if the rows of each group are known to be consecutive in the input, e.g.,
+  // because the input is sorted by the group-by expressions. The aggregation can then stream over the input (see
+  // AggregateSort).
+  bool input_is_sorted{false};
+
  protected:
   size_t _on_shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
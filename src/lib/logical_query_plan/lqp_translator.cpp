@@ -29,7 +29,9 @@
 #include "intersect_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lqp_utils.hpp"
 #include "operators/aggregate_hash.hpp"
+#include "operators/aggregate_sort.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/change_meta_table.hpp"
 #include "operators/delete.hpp"
@@ -68,6 +70,164 @@
 #include "update_node.hpp"
 #include "utils/column_pruning_utils.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+using OperatorByLQPNode = LQPNodeUnorderedMap<std::shared_ptr<AbstractOperator>>;
+
+// Operators below a join input that can discard rows without join partner: the GetTable at the bottom and the lowest
+// TableScan (if any) on the join column.
+struct RuntimeFilterTargets {
+  std::shared_ptr<const GetTable> get_table;
+  ColumnID stored_column_id{INVALID_COLUMN_ID};
+  std::shared_ptr<const TableScan> table_scan;
+  ColumnID scan_column_id{INVALID_COLUMN_ID};
+  size_t stored_row_count{0};
+};
+
+// Finds the operators that a runtime filter on `join_key` can be pushed into. This is only possible if the input is a
+// chain of TableScans and Validates on top of a GetTable and if `join_key` is a column of the stored table. Filtering
+// rows earlier does not change the result of scans and validations. All operators must have the join as their only
+// (transitive) consumer, otherwise we would remove rows that other operators require.
+std::optional<RuntimeFilterTargets> find_runtime_filter_targets(const std::shared_ptr<AbstractLQPNode>& input_node,
+                                                                const AbstractExpression& join_key,
+                                                                const OperatorByLQPNode& operator_by_lqp_node) {
+  auto targets = RuntimeFilterTargets{};
+  auto node = input_node;
+  while (node) {
+    const auto operator_iter = operator_by_lqp_node.find(node);
+    if (operator_iter == operator_by_lqp_node.end() || operator_iter->second->consumer_count() != 1) {
+      return std::nullopt;
+    }
+
+    const auto& op = operator_iter->second;
+    if (node->type == LQPNodeType::Predicate && op->type() == OperatorType::TableScan) {
+      targets.table_scan = std::static_pointer_cast<const TableScan>(op);
+      targets.scan_column_id = node->left_input()->get_column_id(join_key);
+    } else if (node->type == LQPNodeType::StoredTable && op->type() == OperatorType::GetTable) {
+      const auto* const lqp_column = dynamic_cast<const LQPColumnExpression*>(&join_key);
+      if (!lqp_column) {
+        return std::nullopt;
+      }
+
+      const auto original_node = lqp_column->original_node.lock();
+      if (!original_node || *original_node != *node) {
+        return std::nullopt;
+      }
+
+      targets.get_table = std::static_pointer_cast<const GetTable>(op);
+      targets.stored_column_id = lqp_column->original_column_id;
+      targets.stored_row_count =
+          Hyrise::get().storage_manager.get_table(static_cast<const StoredTableNode&>(*node).table_name)->row_count();
+      return targets;
+    } else if (node->type != LQPNodeType::Validate || op->type() != OperatorType::Validate) {
+      return std::nullopt;
+    }
+
+    node = node->left_input();
+  }
+
+  return std::nullopt;
+}
+
+// Lets the inputs of inner and semi hash joins filter their rows with the join column of the other input (see
+// JoinRuntimeFilter). For inner joins, we only filter one input to avoid that both inputs wait for each other. We
+// choose the larger one, which is usually the probe side of the join.
+void set_runtime_filters(const JoinNode& join_node, const std::shared_ptr<const AbstractOperator>& join_operator,
+                         const OperatorByLQPNode& operator_by_lqp_node) {
+  if (join_operator->type() != OperatorType::JoinHash ||
+      (join_node.join_mode != JoinMode::Inner && join_node.join_mode != JoinMode::Semi)) {
+    return;
+  }
+
+  const auto& primary_predicate = join_node.join_predicates().front();
+  if (primary_predicate->type != ExpressionType::Predicate ||
+      static_cast<const AbstractPredicateExpression&>(*primary_predicate).predicate_condition !=
+          PredicateCondition::Equals) {
+    return;
+  }
+
+  auto left_key = primary_predicate->arguments[0];
+  auto right_key = primary_predicate->arguments[1];
+  if (left_key->data_type() != right_key->data_type()) {
+    return;
+  }
+
+  if (!join_node.left_input()->find_column_id(*left_key)) {
+    std::swap(left_key, right_key);
+  }
+
+  const auto left_targets = find_runtime_filter_targets(join_node.left_input(), *left_key, operator_by_lqp_node);
+  auto right_targets = std::optional<RuntimeFilterTargets>{};
+  if (join_node.join_mode == JoinMode::Inner) {
+    right_targets = find_runtime_filter_targets(join_node.right_input(), *right_key, operator_by_lqp_node);
+  }
+
+  auto targets = left_targets;
+  auto source_side = LQPInputSide::Right;
+  if (right_targets && (!left_targets || right_targets->stored_row_count > left_targets->stored_row_count)) {
+    targets = right_targets;
+    source_side = LQPInputSide::Left;
+  }
+
+  if (!targets) {
+    return;
+  }
+
+  auto runtime_filters = targets->get_table->runtime_filters();
+  runtime_filters.emplace_back(JoinRuntimeFilterReference{join_operator, source_side, targets->stored_column_id});
+  targets->get_table->set_runtime_filters(std::move(runtime_filters));
+
+  if (targets->table_scan) {
+    auto runtime_filters = targets->table_scan->runtime_filters();
+    runtime_filters.emplace_back(JoinRuntimeFilterReference{join_operator, source_side, targets->scan_column_id});
+    targets->table_scan->set_runtime_filters(std::move(runtime_filters));
+  }
+}
+
+// Returns true if the rows of `node` are sorted by `expression`. This is the case if they are passed on in the order
+// of a SortNode with `expression` as first sort expression or in the stored order of a table that is currently sorted
+// by the column `expression` refers to (see AggregateSort::is_sorted_by).
+bool node_output_is_sorted_by(const std::shared_ptr<AbstractLQPNode>& node, const AbstractExpression& expression,
+                              const bool consider_sort_nodes) {
+  auto input_node = node;
+  while (lqp_node_preserves_order(*input_node)) {
+    input_node = input_node->left_input();
+  }
+
+  if (consider_sort_nodes && input_node->type == LQPNodeType::Sort) {
+    return *input_node->node_expressions.front() == expression;
+  }
+
+  const auto* lqp_column = dynamic_cast<const LQPColumnExpression*>(&expression);
+  if (!lqp_column) {
+    return false;
+  }
+
+  const auto original_node = lqp_column->original_node.lock();
+  if (input_node->type != LQPNodeType::StoredTable || !original_node || *original_node != *input_node) {
+    return false;
+  }
+
+  const auto& table_name = static_cast<const StoredTableNode&>(*input_node).table_name;
+  return AggregateSort::is_sorted_by(*Hyrise::get().storage_manager.get_table(table_name),
+                                     lqp_column->original_column_id);
+}
+
+// Returns true if the only group-by expression is a column of a stored table that is currently sorted by it and the
+// rows of the table reach the AggregateNode in their stored order. Sorted inputs of other nodes are handled by the
+// StreamingAggregateRule.
+bool group_by_column_is_sorted_in_storage(const AggregateNode& aggregate_node) {
+  if (aggregate_node.aggregate_expressions_begin_idx != 1) {
+    return false;
+  }
+
+  return node_output_is_sorted_by(aggregate_node.left_input(), *aggregate_node.node_expressions.front(), false);
+}
+
+}  // namespace
+
 namespace hyrise {
 
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
@@ -101,6 +261,14 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
     static_cast<GetTable&>(*op).set_prunable_subquery_scans(prunable_pqp_predicates);
   }
 
+  // Similarly, we pass the join column of one input of hash joins to the GetTable and TableScan operators of the other
+  // input. As these operators are translated first, we have to wait for the entire PQP to be translated, too.
+  for (const auto& [node, op] : _operator_by_lqp_node) {
+    if (node->type == LQPNodeType::Join) {
+      set_runtime_filters(static_cast<const JoinNode&>(*node), op, _operator_by_lqp_node);
+    }
+  }
+
   return pqp;
 }
 
@@ -352,7 +520,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 
     column_definitions.emplace_back(pqp_column_expression->column_id, *sort_mode_iter);
   }
-  current_pqp = std::make_shared<Sort>(current_pqp, column_definitions);
+  current_pqp = std::make_shared<Sort>(current_pqp, column_definitions, Chunk::DEFAULT_SIZE,
+                                      Sort::ForceMaterialization::No, sort_node->top_k);
 
   return current_pqp;
 }
@@ -391,6 +560,24 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   const auto left_data_type = join_node->join_predicates().front()->arguments[0]->data_type();
   const auto right_data_type = join_node->join_predicates().front()->arguments[1]->data_type();
 
+  // If both inputs are already sorted by the join columns, the clusters of JoinSortMerge are sorted, too, and sorting
+  // them takes linear time (pdqsort detects sorted sequences). We then prefer merging the inputs over building and
+  // probing a hash table.
+  const auto join_configuration =
+      JoinConfiguration{join_node->join_mode, primary_join_predicate.predicate_condition, left_data_type,
+                        right_data_type, !secondary_join_predicates.empty()};
+  if (primary_join_predicate.predicate_condition == PredicateCondition::Equals &&
+      JoinSortMerge::supports(join_configuration)) {
+    const auto& left_expressions = join_node->left_input()->output_expressions();
+    const auto& right_expressions = join_node->right_input()->output_expressions();
+    const auto& [left_column_id, right_column_id] = primary_join_predicate.column_ids;
+    if (node_output_is_sorted_by(join_node->left_input(), *left_expressions[left_column_id], true) &&
+        node_output_is_sorted_by(join_node->right_input(), *right_expressions[right_column_id], true)) {
+      return std::make_shared<JoinSortMerge>(left_input_operator, right_input_operator, join_node->join_mode,
+                                             primary_join_predicate, secondary_join_predicates);
+    }
+  }
+
   // Lacking a proper cost model, we assume JoinHash is always faster than JoinSortMerge, which is faster than
   // JoinNestedLoop and thus check for an operator compatible with the JoinNode in that order
   constexpr auto JOIN_OPERATOR_PREFERENCE_ORDER =
@@ -405,8 +592,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
 
     // NOLINTBEGIN(bugprone-use-after-move, hicpp-invalid-access-moved)
     // clang-tidy complains about the move in the loop as it does not recognize the early out above.
-    if (JoinOperator::supports({join_node->join_mode, primary_join_predicate.predicate_condition, left_data_type,
-                                right_data_type, !secondary_join_predicates.empty()})) {
+    if (JoinOperator::supports(join_configuration)) {
       join_operator = std::make_shared<JoinOperator>(left_input_operator, right_input_operator, join_node->join_mode,
                                                      primary_join_predicate, std::move(secondary_join_predicates));
     }
@@ -453,6 +639,19 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     Assert(column_id, "GroupBy expression '" + expression->as_column_name() + "' not available as column");
     group_by_column_ids.emplace_back(*column_id);
   }
+
+  if (aggregate_node->input_is_sorted) {
+    return std::make_shared<AggregateSort>(input_operator, pqp_aggregate_expressions, group_by_column_ids,
+                                           AggregateSort::SortedInput::Yes);
+  }
+
+  // The table might change before the operator is executed (e.g., if the plan is cached). Thus, AggregateSort checks
+  // again if its input is sorted and falls back to hash aggregation otherwise.
+  if (group_by_column_is_sorted_in_storage(*aggregate_node)) {
+    return std::make_shared<AggregateSort>(input_operator, pqp_aggregate_expressions, group_by_column_ids,
+                                           AggregateSort::SortedInput::Expected);
+  }
+
   return std::make_shared<AggregateHash>(input_operator, pqp_aggregate_expressions, group_by_column_ids);
 }
 
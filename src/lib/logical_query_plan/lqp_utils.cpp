@@ -277,6 +277,20 @@ bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp) {
   return lqp_is_validated(lqp->left_input()) && lqp_is_validated(lqp->right_input());
 }
 
+bool lqp_node_preserves_order(const AbstractLQPNode& node) {
+  switch (node.type) {
+    case LQPNodeType::Alias:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Validate:
+      return true;
+    case LQPNodeType::Predicate:
+      return static_cast<const PredicateNode&>(node).scan_type == ScanType::TableScan;
+    default:
+      return false;
+  }
+}
+
 std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQPNode>& lqp) {
   std::set<std::string> modified_tables;
 
@@ -104,6 +104,12 @@ void lqp_insert_node_above(const std::shared_ptr<AbstractLQPNode>& node,
  */
 bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp);
 
+/**
+ * @return whether the node's operator outputs the rows of its input in the same order, i.e., it only filters rows or
+ *         adds, removes, or renames columns. Predicates that are executed as index scans do not preserve the order.
+ */
+bool lqp_node_preserves_order(const AbstractLQPNode& node);
+
 /**
  * @return all names of tables that have been accessed in modifying nodes (e.g., InsertNode, UpdateNode)
  */
@@ -32,6 +32,10 @@ std::string SortNode::description(const DescriptionMode mode) const {
       stream << ", ";
     }
   }
+
+  if (top_k) {
+    stream << " top " << *top_k;
+  }
   return stream.str();
 }
 
@@ -52,11 +56,15 @@ size_t SortNode::_on_shallow_hash() const {
   for (const auto& sort_mode : sort_modes) {
     boost::hash_combine(hash, sort_mode);
   }
+  boost::hash_combine(hash, top_k.value_or(0));
   return hash;
 }
 
 std::shared_ptr<AbstractLQPNode> SortNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return SortNode::make(expressions_copy_and_adapt_to_different_lqp(node_expressions, node_mapping), sort_modes);
+  const auto sort_node =
+      SortNode::make(expressions_copy_and_adapt_to_different_lqp(node_expressions, node_mapping), sort_modes);
+  sort_node->top_k = top_k;
+  return sort_node;
 }
 
 bool SortNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
@@ -64,7 +72,7 @@ bool SortNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMappi
 
   return expressions_equal_to_expressions_in_different_lqp(node_expressions, sort_node.node_expressions,
                                                            node_mapping) &&
-         sort_modes == sort_node.sort_modes;
+         sort_modes == sort_node.sort_modes && top_k == sort_node.top_k;
 }
 
 }  // namespace hyrise
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -27,6 +28,10 @@ class SortNode : public EnableMakeForLQPNode<SortNode>, public AbstractLQPNode {
 
   const std::vector<SortMode> sort_modes;
 
+  // If set, only the first top_k rows of the sorted input are required. This is set by the TopKRule if the SortNode is
+  // followed by a LimitNode. The LimitNode is kept, so the node still behaves like a regular SortNode for other rules.
+  std::optional<size_t> top_k;
+
  protected:
   size_t _on_shallow_hash() const override;
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
@@ -6,6 +6,7 @@
 #include "logical_query_plan/abstract_non_query_node.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
 #include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/operator_task.hpp"
 #include "storage/table.hpp"
@@ -230,6 +231,34 @@ std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy() const {
     static_cast<GetTable&>(*op_copy).set_prunable_subquery_scans(prunable_subquery_scans_copy);
   }
 
+  // The same applies to the runtime filters of GetTable and TableScan operators, which reference the JoinHash operators
+  // above them. If only a part of the PQP is copied, the joins might not be part of the copy and we drop the filters.
+  const auto copy_runtime_filters = [&](const auto& runtime_filters) {
+    auto runtime_filters_copy = std::vector<JoinRuntimeFilterReference>{};
+    for (const auto& runtime_filter : runtime_filters) {
+      const auto copied_join_iter = copied_ops.find(runtime_filter.join.lock().get());
+      if (copied_join_iter != copied_ops.end()) {
+        runtime_filters_copy.emplace_back(
+            JoinRuntimeFilterReference{copied_join_iter->second, runtime_filter.source_side, runtime_filter.column_id});
+      }
+    }
+    return runtime_filters_copy;
+  };
+
+  for (const auto& [op, op_copy] : copied_ops) {
+    if (op->type() == OperatorType::GetTable) {
+      const auto& runtime_filters = static_cast<const GetTable&>(*op).runtime_filters();
+      if (!runtime_filters.empty()) {
+        static_cast<GetTable&>(*op_copy).set_runtime_filters(copy_runtime_filters(runtime_filters));
+      }
+    } else if (op->type() == OperatorType::TableScan) {
+      const auto& runtime_filters = static_cast<const TableScan&>(*op).runtime_filters();
+      if (!runtime_filters.empty()) {
+        static_cast<TableScan&>(*op_copy).set_runtime_filters(copy_runtime_filters(runtime_filters));
+      }
+    }
+  }
+
   return copy;
 }
 
@@ -1,6 +1,7 @@
 #include "aggregate_hash.hpp"
 
 #include <cmath>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -16,8 +17,10 @@
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/job_utils.hpp"
 #include "storage/segment_iterate.hpp"
 #include "utils/assert.hpp"
+#include "utils/fibonacci_hash.hpp"
 #include "utils/timer.hpp"
 
 namespace {
@@ -119,6 +122,27 @@ typename Results::reference get_or_add_result(CacheResultIds /*cache_result_ids*
   }
 }
 
+// Returns the only or the first entry of the AggregateKey, which stores the cached result id (see get_or_add_result).
+template <typename AggregateKey>
+AggregateKeyEntry& first_key_entry(AggregateKey& key) {
+  if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+    return key;
+  } else {
+    return key[0];
+  }
+}
+
+// Thread-local groups are merged in partitions of about GROUPS_PER_MERGE_PARTITION groups, with at most
+// 2^MAX_MERGE_PARTITION_BITS partitions (see AggregateHash::_aggregate_in_parallel).
+constexpr auto GROUPS_PER_MERGE_PARTITION = size_t{50'000};
+constexpr auto MAX_MERGE_PARTITION_BITS = uint32_t{8};
+
+template <typename AggregateKey>
+size_t merge_partition(const AggregateKey& key, const uint32_t partition_bits) {
+  // std::hash is the identity for a single AggregateKeyEntry, so the hash has to be mixed before selecting a partition.
+  return fibonacci_partition(std::hash<AggregateKey>{}(key), partition_bits);
+}
+
 template <typename AggregateKey>
 AggregateKey& get_aggregate_key([[maybe_unused]] KeysPerChunk<AggregateKey>& keys_per_chunk,
                                 [[maybe_unused]] const ChunkID chunk_id,
@@ -201,20 +225,108 @@ struct AggregateContext : public AggregateResultContext<ColumnDataType, aggregat
   std::unique_ptr<AggregateResultIdMap<AggregateKey>> result_ids;
 };
 
+// Thread-local results of the morsels that are pre-aggregated by _aggregate_in_parallel, and the mapping of their
+// groups to the output groups.
+struct PreAggregatedMorsels {
+  // Contexts per morsel, indexed like _contexts_per_column.
+  std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>> contexts;
+
+  // Thread-local result ids per merge partition and morsel.
+  std::vector<std::vector<std::vector<AggregateResultId>>> local_ids_per_partition;
+
+  // Group ids per morsel, indexed by thread-local result ids. Group ids start at zero for each partition.
+  std::vector<std::vector<AggregateResultId>> group_ids;
+
+  // Group id of each partition's first group in the output.
+  std::vector<size_t> partition_offsets;
+};
+
+// Merges a thread-local result into the result of its group. The first thread-local result of a group is moved, so the
+// results of groups that are found in a single morsel are exactly the same as if they were aggregated by one thread.
+template <typename ColumnDataType, AggregateFunction aggregate_function>
+void merge_aggregate_result(AggregateResult<ColumnDataType, aggregate_function>& result,
+                            AggregateResult<ColumnDataType, aggregate_function>& local_result) {
+  if (local_result.row_id.is_null()) {
+    return;
+  }
+
+  if (result.row_id.is_null()) {
+    result = std::move(local_result);
+    return;
+  }
+
+  if constexpr (aggregate_function == AggregateFunction::Min) {
+    if (local_result.aggregate_count > 0 &&
+        (result.aggregate_count == 0 || value_smaller(local_result.accumulator, result.accumulator))) {
+      result.accumulator = std::move(local_result.accumulator);
+    }
+  } else if constexpr (aggregate_function == AggregateFunction::Max) {
+    if (local_result.aggregate_count > 0 &&
+        (result.aggregate_count == 0 || value_greater(local_result.accumulator, result.accumulator))) {
+      result.accumulator = std::move(local_result.accumulator);
+    }
+  } else if constexpr (aggregate_function == AggregateFunction::Sum || aggregate_function == AggregateFunction::Avg) {
+    result.accumulator += local_result.accumulator;
+  } else if constexpr (aggregate_function == AggregateFunction::CountDistinct) {
+    result.accumulator.insert(local_result.accumulator.begin(), local_result.accumulator.end());
+  } else if constexpr (aggregate_function == AggregateFunction::StandardDeviationSample) {
+    // Combine the counts, means, and squared distances from the mean of both parts, see
+    // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+    auto& [count, mean, squared_distance_from_mean, standard_deviation] = result.accumulator;
+    const auto& local_accumulator = local_result.accumulator;
+    const auto local_count = local_accumulator[0];
+    if (local_count > 0) {
+      const auto combined_count = count + local_count;
+      const auto delta = local_accumulator[1] - mean;
+      mean += delta * local_count / combined_count;
+      squared_distance_from_mean += local_accumulator[2] + delta * delta * count * local_count / combined_count;
+      count = combined_count;
+
+      if (count > 1) {
+        standard_deviation = std::sqrt(squared_distance_from_mean / (count - 1));
+      }
+    }
+  }
+
+  // COUNT and ANY only need the number of aggregated values, which all other functions track as well.
+  result.aggregate_count += local_result.aggregate_count;
+}
+
+// Merges the thread-local results of all morsels for the groups of one partition.
+template <typename ColumnDataType, AggregateFunction aggregate_function>
+void merge_partition_results(SegmentVisitorContext& context, PreAggregatedMorsels& morsels, const size_t context_idx,
+                             const size_t partition) {
+  using Context = AggregateResultContext<ColumnDataType, aggregate_function>;
+  auto& results = static_cast<Context&>(context).results;
+  const auto group_id_offset = morsels.partition_offsets[partition];
+
+  const auto morsel_count = morsels.contexts.size();
+  for (auto morsel_idx = size_t{0}; morsel_idx < morsel_count; ++morsel_idx) {
+    auto& local_results = static_cast<Context&>(*morsels.contexts[morsel_idx][context_idx]).results;
+    const auto& group_ids = morsels.group_ids[morsel_idx];
+    for (const auto local_id : morsels.local_ids_per_partition[partition][morsel_idx]) {
+      // Without GROUP BY columns, get_or_add_result only adds the result once the morsel has a row.
+      if (local_id < local_results.size()) {
+        merge_aggregate_result(results[group_id_offset + group_ids[local_id]], local_results[local_id]);
+      }
+    }
+  }
+}
+
 template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
-__attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index,
-                                                            const AbstractSegment& abstract_segment,
-                                                            KeysPerChunk<AggregateKey>& keys_per_chunk) {
+__attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, const AbstractSegment& abstract_segment,
+                                                            SegmentVisitorContext& context,
+                                                            KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                                            const bool use_cached_result_ids) {
   using AggregateType = typename AggregateTraits<ColumnDataType, aggregate_function>::AggregateType;
 
   auto aggregator =
       AggregateFunctionBuilder<ColumnDataType, AggregateType, aggregate_function>().get_aggregate_function();
 
-  auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, aggregate_function, AggregateKey>>(
-      _contexts_per_column[column_index]);
+  auto& aggregate_context = static_cast<AggregateContext<ColumnDataType, aggregate_function, AggregateKey>&>(context);
 
-  auto& result_ids = *context.result_ids;
-  auto& results = context.results;
+  auto& result_ids = *aggregate_context.result_ids;
+  auto& results = aggregate_context.results;
 
   auto chunk_offset = ChunkOffset{0};
 
@@ -240,11 +352,9 @@ __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, Co
     ++chunk_offset;
   };
 
-  // Pass true_type into get_or_add_result to enable certain optimizations: If we have more than one aggregate function
-  // (and thus more than one context), it makes sense to cache the results indexes, see get_or_add_result for details.
-  // Furthermore, if we use the immediate key shortcut (which uses the same code path as caching), we need to pass
-  // true_type so that the aggregate keys are checked for immediate access values.
-  if (_contexts_per_column.size() > 1 || _use_immediate_key_shortcut) {
+  // Pass true_type into get_or_add_result if the result ids are cached in the AggregateKeys or if the immediate key
+  // shortcut is used (which uses the same code path as caching), see _aggregate.
+  if (use_cached_result_ids) {
     segment_iterate<ColumnDataType>(abstract_segment,
                                     [&](const auto& position) { process_position(std::true_type{}, position); });
   } else {
@@ -569,51 +679,34 @@ void AggregateHash::_aggregate() {
 
   /**
    * AGGREGATION STEP
+   *
+   * Consecutive chunks are grouped into morsels of at least ROWS_PER_JOB rows. If there are multiple morsels, they are
+   * pre-aggregated in parallel (see _aggregate_in_parallel). The immediate key shortcut already maps the AggregateKeys
+   * to dense result ids, so there is no hash map to parallelize and we aggregate all chunks in a single pass.
    */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
-
-  if (!_has_aggregate_functions) {
-    /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
-    The template parameters (int32_t, AggregateFunction::Min) do not matter, as we do not calculate an aggregate anyway.
-    */
-    auto context =
-        std::make_shared<AggregateContext<int32_t, AggregateFunction::Min, AggregateKey>>(_expected_result_size);
-
-    _contexts_per_column.push_back(context);
-  }
-
-  /**
-   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
-   */
-  const auto aggregate_count = _aggregates.size();
-  for (auto aggregate_idx = ColumnID{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
-    const auto& aggregate = _aggregates[aggregate_idx];
-
-    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-    const auto input_column_id = pqp_column.column_id;
+  const auto chunk_count = input_table->chunk_count();
+  const auto morsels = chunk_ranges_for_jobs(*input_table, ROWS_PER_JOB);
 
-    if (input_column_id == INVALID_COLUMN_ID) {
-      Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
-      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
-      auto context = std::make_shared<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>(
-          _expected_result_size);
+  if (morsels.size() > 1 && !_use_immediate_key_shortcut) {
+    _aggregate_in_parallel<AggregateKey>(morsels, keys_per_chunk);
+  } else {
+    _contexts_per_column = _create_aggregate_contexts<AggregateKey>(_expected_result_size);
 
-      _contexts_per_column[aggregate_idx] = context;
-      continue;
-    }
-    const auto data_type = input_table->column_data_type(input_column_id);
-    _contexts_per_column[aggregate_idx] =
-        _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function);
+    // If we have more than one aggregate function (and thus more than one context), it makes sense to cache the result
+    // ids, see get_or_add_result for details. The immediate key shortcut writes cached result ids itself.
+    const auto use_cached_result_ids = _contexts_per_column.size() > 1 || _use_immediate_key_shortcut;
+    _aggregate_chunks<AggregateKey>(ChunkID{0}, chunk_count, _contexts_per_column, keys_per_chunk,
+                                    use_cached_result_ids);
   }
+  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
+}
 
-  // Process Chunks and perform aggregations
-  const auto chunk_count = input_table->chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+template <typename AggregateKey>
+void AggregateHash::_aggregate_chunks(const ChunkID begin_chunk_id, const ChunkID end_chunk_id,
+                                      std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts,
+                                      KeysPerChunk<AggregateKey>& keys_per_chunk, const bool use_cached_result_ids) {
+  const auto& input_table = left_input_table();
+  for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
     const auto chunk_in = input_table->get_chunk(chunk_id);
     if (!chunk_in) {
       continue;
@@ -637,24 +730,24 @@ void AggregateHash::_aggregate() {
 
       auto context =
           std::static_pointer_cast<AggregateContext<DistinctColumnType, AggregateFunction::Min, AggregateKey>>(
-              _contexts_per_column[0]);
+              contexts[0]);
 
       auto& result_ids = *context->result_ids;
       auto& results = context->results;
 
       // Add value or combination of values is added to the list of distinct value(s). This is done by calling
       // get_or_add_result, which adds the corresponding entry in the list of GROUP BY values.
-      if (_use_immediate_key_shortcut) {
+      if (use_cached_result_ids) {
         for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-          // We are able to use immediate keys, so pass true_type so that the combined caching/immediate key code path
-          // is enabled in get_or_add_result.
+          // The AggregateKeys might contain cached result ids or immediate keys, so pass true_type so that the
+          // combined caching/immediate key code path is enabled in get_or_add_result.
           get_or_add_result(std::true_type{}, result_ids, results,
                             get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
                             RowID{chunk_id, chunk_offset});
         }
       } else {
-        // Same as above, but we do not have immediate keys, so we disable that code path to reduce the complexity of
-        // get_aggregate_key.
+        // Same as above, but we do not have cached result ids or immediate keys, so we disable that code path to
+        // reduce the complexity of get_aggregate_key.
         for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
           get_or_add_result(std::false_type{}, result_ids, results,
                             get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
@@ -679,7 +772,7 @@ void AggregateHash::_aggregate() {
           Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
           auto context =
               std::static_pointer_cast<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>(
-                  _contexts_per_column[aggregate_idx]);
+                  contexts[aggregate_idx]);
 
           auto& result_ids = *context->result_ids;
           auto& results = context->results;
@@ -694,12 +787,9 @@ void AggregateHash::_aggregate() {
             // not NULL_ROW_ID.
             results[0].row_id = RowID{ChunkID{0}, ChunkOffset{0}};
           } else {
-            // Count occurrences for each group key -  If we have more than one aggregate function (and thus more than
-            // one context), it makes sense to cache the results indexes, see get_or_add_result for details.
-            if (_contexts_per_column.size() > 1 || _use_immediate_key_shortcut) {
+            // Count occurrences for each group key.
+            if (use_cached_result_ids) {
               for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk_size; ++chunk_offset) {
-                // Use CacheResultIds==true_type if we have more than one group by column or if the cached result ids
-                // have been written by the immediate key shortcut
                 auto& result =
                     get_or_add_result(std::true_type{}, result_ids, results,
                                       get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
@@ -734,31 +824,31 @@ void AggregateHash::_aggregate() {
           switch (aggregate->aggregate_function) {
             case AggregateFunction::Min:
               _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  chunk_id, *abstract_segment, *contexts[aggregate_idx], keys_per_chunk, use_cached_result_ids);
               break;
             case AggregateFunction::Max:
               _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  chunk_id, *abstract_segment, *contexts[aggregate_idx], keys_per_chunk, use_cached_result_ids);
               break;
             case AggregateFunction::Sum:
               _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  chunk_id, *abstract_segment, *contexts[aggregate_idx], keys_per_chunk, use_cached_result_ids);
               break;
             case AggregateFunction::Avg:
               _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  chunk_id, *abstract_segment, *contexts[aggregate_idx], keys_per_chunk, use_cached_result_ids);
               break;
             case AggregateFunction::Count:
               _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  chunk_id, *abstract_segment, *contexts[aggregate_idx], keys_per_chunk, use_cached_result_ids);
               break;
             case AggregateFunction::CountDistinct:
               _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  chunk_id, *abstract_segment, *contexts[aggregate_idx], keys_per_chunk, use_cached_result_ids);
               break;
             case AggregateFunction::StandardDeviationSample:
               _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+                  chunk_id, *abstract_segment, *contexts[aggregate_idx], keys_per_chunk, use_cached_result_ids);
               break;
             case AggregateFunction::Any:
               // ANY is a pseudo-function and is handled by _write_groupby_output
@@ -770,9 +860,169 @@ void AggregateHash::_aggregate() {
       }
     }
   }
-  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
 }  // NOLINT(readability/fn_size)
 
+template <typename AggregateKey>
+void AggregateHash::_aggregate_in_parallel(const std::vector<std::pair<ChunkID, ChunkID>>& morsels,
+                                           KeysPerChunk<AggregateKey>& keys_per_chunk) {
+  const auto morsel_count = morsels.size();
+  auto pre_aggregated_morsels = PreAggregatedMorsels{};
+  pre_aggregated_morsels.contexts.resize(morsel_count);
+
+  // Pre-aggregate each morsel into thread-local results. First, the AggregateKeys of the morsel's rows are mapped to
+  // thread-local result ids, which are cached in the AggregateKeys (see get_or_add_result). Thus, the aggregation does
+  // not look up the AggregateKeys again, not even for the first aggregate function.
+  auto local_keys = std::vector<std::vector<AggregateKey>>(morsel_count);
+  execute_jobs(morsel_count, [&](const size_t morsel_idx) {
+    const auto [begin_chunk_id, end_chunk_id] = morsels[morsel_idx];
+    auto& keys = local_keys[morsel_idx];
+    auto preallocated_size = size_t{0};
+    if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+      // All rows belong to the same group, whose result is added by get_or_add_result.
+      keys.emplace_back();
+    } else {
+      auto result_ids = AggregateResultIdMap<AggregateKey>{};
+      for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+        for (auto& key : keys_per_chunk[chunk_id]) {
+          const auto [iter, inserted] = result_ids.emplace(key, keys.size());
+          if (inserted) {
+            keys.emplace_back(key);
+          }
+          first_key_entry(key) = CACHE_MASK | iter->second;
+        }
+      }
+      preallocated_size = keys.size();
+    }
+
+    auto& contexts = pre_aggregated_morsels.contexts[morsel_idx];
+    contexts = _create_aggregate_contexts<AggregateKey>(preallocated_size);
+    _aggregate_chunks<AggregateKey>(begin_chunk_id, end_chunk_id, contexts, keys_per_chunk, true);
+  });
+
+  // The same group can be found in multiple morsels. If there are many groups, we radix-partition them by the hash of
+  // their AggregateKey so that the groups can be merged in parallel, one job per partition.
+  auto local_group_count = size_t{0};
+  for (const auto& keys : local_keys) {
+    local_group_count += keys.size();
+  }
+
+  auto partition_bits = uint32_t{0};
+  while (partition_bits < MAX_MERGE_PARTITION_BITS &&
+         (size_t{1} << partition_bits) * GROUPS_PER_MERGE_PARTITION < local_group_count) {
+    ++partition_bits;
+  }
+  const auto partition_count = size_t{1} << partition_bits;
+
+  auto& local_ids_per_partition = pre_aggregated_morsels.local_ids_per_partition;
+  local_ids_per_partition.resize(partition_count, std::vector<std::vector<AggregateResultId>>(morsel_count));
+  execute_jobs(morsel_count, [&](const size_t morsel_idx) {
+    const auto& keys = local_keys[morsel_idx];
+    const auto key_count = keys.size();
+    for (auto local_id = AggregateResultId{0}; local_id < key_count; ++local_id) {
+      const auto partition = merge_partition(keys[local_id], partition_bits);
+      local_ids_per_partition[partition][morsel_idx].emplace_back(local_id);
+    }
+  });
+
+  // Assign the group ids of each partition. The groups are numbered in the order of the morsels in which they are first
+  // found. Thus, if there is only one partition, the groups are ordered as if they were aggregated by a single thread.
+  auto& group_ids = pre_aggregated_morsels.group_ids;
+  group_ids.resize(morsel_count);
+  for (auto morsel_idx = size_t{0}; morsel_idx < morsel_count; ++morsel_idx) {
+    group_ids[morsel_idx].resize(local_keys[morsel_idx].size());
+  }
+
+  auto partition_group_counts = std::vector<size_t>(partition_count);
+  execute_jobs(partition_count, [&](const size_t partition) {
+    auto result_ids = AggregateResultIdMap<AggregateKey>{};
+    auto group_count = size_t{0};
+    for (auto morsel_idx = size_t{0}; morsel_idx < morsel_count; ++morsel_idx) {
+      for (const auto local_id : local_ids_per_partition[partition][morsel_idx]) {
+        if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+          group_ids[morsel_idx][local_id] = 0;
+          group_count = 1;
+        } else {
+          const auto [iter, inserted] = result_ids.emplace(local_keys[morsel_idx][local_id], result_ids.size());
+          group_ids[morsel_idx][local_id] = iter->second;
+          group_count = result_ids.size();
+        }
+      }
+    }
+    partition_group_counts[partition] = group_count;
+  });
+
+  auto& partition_offsets = pre_aggregated_morsels.partition_offsets;
+  partition_offsets.resize(partition_count);
+  auto group_count = size_t{0};
+  for (auto partition = size_t{0}; partition < partition_count; ++partition) {
+    partition_offsets[partition] = group_count;
+    group_count += partition_group_counts[partition];
+  }
+
+  // Merge the thread-local results. The partitions have disjoint ranges of group ids, so their results can be merged
+  // concurrently.
+  _contexts_per_column = _create_aggregate_contexts<AggregateKey>(group_count);
+  const auto& input_table = left_input_table();
+  execute_jobs(partition_count, [&](const size_t partition) {
+    if (!_has_aggregate_functions) {
+      merge_partition_results<DistinctColumnType, AggregateFunction::Min>(*_contexts_per_column[0],
+                                                                          pre_aggregated_morsels, 0, partition);
+      return;
+    }
+
+    const auto aggregate_count = _aggregates.size();
+    for (auto aggregate_idx = ColumnID{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
+      const auto& aggregate = _aggregates[aggregate_idx];
+      const auto input_column_id = static_cast<const PQPColumnExpression&>(*aggregate->argument()).column_id;
+      auto& context = *_contexts_per_column[aggregate_idx];
+
+      if (input_column_id == INVALID_COLUMN_ID) {
+        merge_partition_results<CountColumnType, AggregateFunction::Count>(context, pre_aggregated_morsels,
+                                                                           aggregate_idx, partition);
+        continue;
+      }
+
+      resolve_data_type(input_table->column_data_type(input_column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        switch (aggregate->aggregate_function) {
+          case AggregateFunction::Min:
+            merge_partition_results<ColumnDataType, AggregateFunction::Min>(context, pre_aggregated_morsels,
+                                                                            aggregate_idx, partition);
+            break;
+          case AggregateFunction::Max:
+            merge_partition_results<ColumnDataType, AggregateFunction::Max>(context, pre_aggregated_morsels,
+                                                                            aggregate_idx, partition);
+            break;
+          case AggregateFunction::Sum:
+            merge_partition_results<ColumnDataType, AggregateFunction::Sum>(context, pre_aggregated_morsels,
+                                                                            aggregate_idx, partition);
+            break;
+          case AggregateFunction::Avg:
+            merge_partition_results<ColumnDataType, AggregateFunction::Avg>(context, pre_aggregated_morsels,
+                                                                            aggregate_idx, partition);
+            break;
+          case AggregateFunction::Count:
+            merge_partition_results<ColumnDataType, AggregateFunction::Count>(context, pre_aggregated_morsels,
+                                                                              aggregate_idx, partition);
+            break;
+          case AggregateFunction::CountDistinct:
+            merge_partition_results<ColumnDataType, AggregateFunction::CountDistinct>(context, pre_aggregated_morsels,
+                                                                                      aggregate_idx, partition);
+            break;
+          case AggregateFunction::StandardDeviationSample:
+            merge_partition_results<ColumnDataType, AggregateFunction::StandardDeviationSample>(
+                context, pre_aggregated_morsels, aggregate_idx, partition);
+            break;
+          case AggregateFunction::Any:
+            // ANY is a pseudo-function and is handled by _write_groupby_output
+            break;
+        }
+      });
+    }
+  });
+}
+
 std::shared_ptr<const Table> AggregateHash::_on_execute() {
   // We do not want the overhead of a vector with heap storage when we have a limited number of aggregate columns.
   // However, more specializations mean more compile time. We now have specializations for 0, 1, 2, and >2 GROUP BY
@@ -1180,39 +1430,94 @@ void AggregateHash::_write_aggregate_output(ColumnID aggregate_index) {
   aggregate_columns_writing_duration += timer.lap() - excluded_time;
 }
 
+template <typename AggregateKey>
+std::vector<std::shared_ptr<SegmentVisitorContext>> AggregateHash::_create_aggregate_contexts(
+    const size_t preallocated_size) const {
+  auto contexts = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+
+  if (!_has_aggregate_functions) {
+    /*
+    Insert a dummy context for the DISTINCT implementation.
+    That way, the contexts will always have at least one context with results.
+    This is important later on when we write the group keys into the table.
+    The template parameters (DistinctColumnType, AggregateFunction::Min) do not matter, as we do not calculate an
+    aggregate anyway.
+    */
+    auto context = std::make_shared<AggregateContext<DistinctColumnType, AggregateFunction::Min, AggregateKey>>(
+        preallocated_size);
+
+    contexts.push_back(context);
+  }
+
+  /**
+   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
+   * created on. We do this before processing the chunks because there might be no Chunks in the input and
+   * _write_aggregate_output() needs these contexts anyway.
+   */
+  const auto& input_table = left_input_table();
+  const auto aggregate_count = _aggregates.size();
+  for (auto aggregate_idx = ColumnID{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
+    const auto& aggregate = _aggregates[aggregate_idx];
+
+    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+    const auto input_column_id = pqp_column.column_id;
+
+    if (input_column_id == INVALID_COLUMN_ID) {
+      Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
+      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
+      auto context = std::make_shared<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>(
+          preallocated_size);
+
+      contexts[aggregate_idx] = context;
+      continue;
+    }
+    const auto data_type = input_table->column_data_type(input_column_id);
+    contexts[aggregate_idx] =
+        _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function, preallocated_size);
+  }
+
+  return contexts;
+}
+
 template <typename AggregateKey>
 std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
-    const DataType data_type, const AggregateFunction aggregate_function) const {
+    const DataType data_type, const AggregateFunction aggregate_function, const size_t preallocated_size) const {
   std::shared_ptr<SegmentVisitorContext> context;
   resolve_data_type(data_type, [&](auto type) {
-    const auto size = _expected_result_size.load();
     using ColumnDataType = typename decltype(type)::type;
     switch (aggregate_function) {
       case AggregateFunction::Min:
-        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Min, AggregateKey>>(size);
+        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Min, AggregateKey>>(
+            preallocated_size);
         break;
       case AggregateFunction::Max:
-        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Max, AggregateKey>>(size);
+        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Max, AggregateKey>>(
+            preallocated_size);
         break;
       case AggregateFunction::Sum:
-        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Sum, AggregateKey>>(size);
+        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Sum, AggregateKey>>(
+            preallocated_size);
         break;
       case AggregateFunction::Avg:
-        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Avg, AggregateKey>>(size);
+        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Avg, AggregateKey>>(
+            preallocated_size);
         break;
       case AggregateFunction::Count:
-        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Count, AggregateKey>>(size);
+        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Count, AggregateKey>>(
+            preallocated_size);
         break;
       case AggregateFunction::CountDistinct:
-        context =
-            std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>>(size);
+        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>>(
+            preallocated_size);
         break;
       case AggregateFunction::StandardDeviationSample:
         context = std::make_shared<
-            AggregateContext<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>>(size);
+            AggregateContext<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>>(
+            preallocated_size);
         break;
       case AggregateFunction::Any:
-        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Any, AggregateKey>>(size);
+        context = std::make_shared<AggregateContext<ColumnDataType, AggregateFunction::Any, AggregateKey>>(
+            preallocated_size);
         break;
     }
   });
@@ -136,8 +136,19 @@ using CountAggregateType = int64_t;
 using DistinctColumnType = int8_t;
 using DistinctAggregateType = int8_t;
 
+/**
+ * Aggregation is parallelized in multiple steps. First, the AggregateKeys of all rows are computed with one job per
+ * GROUP BY column. Second, consecutive chunks are grouped into morsels of at least ROWS_PER_JOB rows, and each morsel
+ * is pre-aggregated by its own job: The job maps the AggregateKeys of its rows to thread-local result ids and
+ * aggregates into thread-local results. Third, the thread-local results are merged. If there are many groups, they are
+ * radix-partitioned by the hash of their AggregateKey, and each partition is merged by its own job. Inputs with a
+ * single morsel and inputs that use the immediate key shortcut (see _partition_by_groupby_keys) are aggregated by a
+ * single thread.
+ */
 class AggregateHash : public AbstractAggregateOperator {
  public:
+  static constexpr auto ROWS_PER_JOB = size_t{50'000};
+
   AggregateHash(const std::shared_ptr<AbstractOperator>& input_operator,
                 const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
                 const std::vector<ColumnID>& groupby_column_ids);
@@ -161,6 +172,15 @@ class AggregateHash : public AbstractAggregateOperator {
   template <typename AggregateKey>
   void _aggregate();
 
+  template <typename AggregateKey>
+  void _aggregate_chunks(const ChunkID begin_chunk_id, const ChunkID end_chunk_id,
+                         std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts,
+                         KeysPerChunk<AggregateKey>& keys_per_chunk, const bool use_cached_result_ids);
+
+  template <typename AggregateKey>
+  void _aggregate_in_parallel(const std::vector<std::pair<ChunkID, ChunkID>>& morsels,
+                              KeysPerChunk<AggregateKey>& keys_per_chunk);
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input,
@@ -176,12 +196,16 @@ class AggregateHash : public AbstractAggregateOperator {
   void _write_aggregate_output(ColumnID aggregate_index);
 
   template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
-  void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
-                          KeysPerChunk<AggregateKey>& keys_per_chunk);
+  void _aggregate_segment(ChunkID chunk_id, const AbstractSegment& abstract_segment, SegmentVisitorContext& context,
+                          KeysPerChunk<AggregateKey>& keys_per_chunk, const bool use_cached_result_ids);
+
+  template <typename AggregateKey>
+  std::vector<std::shared_ptr<SegmentVisitorContext>> _create_aggregate_contexts(const size_t preallocated_size) const;
 
   template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
-                                                                   const AggregateFunction aggregate_function) const;
+                                                                   const AggregateFunction aggregate_function,
+                                                                   const size_t preallocated_size) const;
 
   std::vector<std::shared_ptr<BaseValueSegment>> _groupby_segments;
   std::vector<std::shared_ptr<SegmentVisitorContext>> _contexts_per_column;
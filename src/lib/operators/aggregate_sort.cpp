@@ -1,13 +1,17 @@
 #include "aggregate_sort.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "aggregate/aggregate_traits.hpp"
+#include "aggregate_hash.hpp"
 #include "all_type_variant.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "operators/sort.hpp"
+#include "scheduler/job_utils.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/segment_iterate.hpp"
 #include "table_wrapper.hpp"
@@ -35,20 +39,112 @@ std::shared_ptr<const Table> sort_table_by_column_ids(const std::shared_ptr<cons
   return sort->get_output();
 }
 
+// Returns the offsets of the rows in the chunk where the value of the column differs from the value of the previous
+// row. The first row of a chunk is compared with the last row of the previous non-empty chunk. The first row of the
+// table does not have a previous row and is not returned.
+template <typename ColumnDataType>
+std::vector<ChunkOffset> find_value_changes(const Table& table, const ChunkID chunk_id, const ColumnID column_id) {
+  const auto& segment = *table.get_chunk(chunk_id)->get_segment(column_id);
+  auto value_changes = std::vector<ChunkOffset>{};
+  if (segment.size() == 0) {
+    return value_changes;
+  }
+
+  // We are aware that operator[] is slow, however, for one value it should be faster than segment_iterate_filtered.
+  auto previous_variant = segment[ChunkOffset{0}];
+  for (auto previous_chunk_id = chunk_id; previous_chunk_id > 0; --previous_chunk_id) {
+    const auto& previous_segment = *table.get_chunk(ChunkID{previous_chunk_id - 1})->get_segment(column_id);
+    const auto previous_segment_size = previous_segment.size();
+    if (previous_segment_size > 0) {
+      previous_variant = previous_segment[ChunkOffset{previous_segment_size - 1}];
+      break;
+    }
+  }
+
+  auto previous_value = std::optional<ColumnDataType>{};
+  if (!variant_is_null(previous_variant)) {
+    previous_value = boost::get<ColumnDataType>(previous_variant);
+  }
+
+  segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+    if (previous_value.has_value() == position.is_null() ||
+        (previous_value && !position.is_null() && position.value() != *previous_value)) {
+      value_changes.emplace_back(position.chunk_offset());
+      if (position.is_null()) {
+        previous_value.reset();
+      } else {
+        previous_value.emplace(position.value());
+      }
+    }
+  });
+
+  return value_changes;
+}
+
 }  // namespace
 
 namespace hyrise {
 
 AggregateSort::AggregateSort(const std::shared_ptr<AbstractOperator>& input_operator,
                              const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
-                             const std::vector<ColumnID>& groupby_column_ids)
-    : AbstractAggregateOperator(input_operator, aggregates, groupby_column_ids) {}
+                             const std::vector<ColumnID>& groupby_column_ids, const SortedInput sorted_input)
+    : AbstractAggregateOperator(input_operator, aggregates, groupby_column_ids), _sorted_input(sorted_input) {}
 
 const std::string& AggregateSort::name() const {
   static const auto name = std::string{"AggregateSort"};
   return name;
 }
 
+AggregateSort::SortedInput AggregateSort::sorted_input() const {
+  return _sorted_input;
+}
+
+bool AggregateSort::is_sorted_by(const Table& table, const ColumnID column_id) {
+  auto sort_mode = std::optional<SortMode>{};
+  auto previous_last_value = std::optional<AllTypeVariant>{};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) {
+      return false;
+    }
+
+    const auto chunk_size = chunk->size();
+    if (chunk_size == 0) {
+      continue;
+    }
+
+    const auto& sorted_by = chunk->individually_sorted_by();
+    const auto sort_definition = std::find_if(sorted_by.cbegin(), sorted_by.cend(), [&](const auto& definition) {
+      return definition.column == column_id;
+    });
+    if (sort_definition == sorted_by.cend() || (sort_mode && sort_definition->sort_mode != *sort_mode)) {
+      return false;
+    }
+    sort_mode = sort_definition->sort_mode;
+
+    const auto& segment = *chunk->get_segment(column_id);
+    const auto first_value = segment[ChunkOffset{0}];
+
+    // NULLs come first. Thus, a NULL can only follow NULLs, while a value can follow both.
+    if (previous_last_value && !variant_is_null(*previous_last_value)) {
+      if (variant_is_null(first_value)) {
+        return false;
+      }
+
+      const auto is_ascending = *sort_mode == SortMode::Ascending;
+      if ((is_ascending && first_value < *previous_last_value) ||
+          (!is_ascending && *previous_last_value < first_value)) {
+        return false;
+      }
+    }
+
+    previous_last_value = segment[ChunkOffset{chunk_size - 1}];
+  }
+
+  return true;
+}
+
 /**
  * Calculates the value for the aggregate_index'th aggregate.
  * To do this, we iterate over all segments of the corresponding column.
@@ -56,89 +152,66 @@ const std::string& AggregateSort::name() const {
  * Every time we reach the beginning of a new group-by-combination,
  * we store the aggregate value for the current (now previous) group.
  *
+ * The groups are aggregated in parallel. Each job aggregates the groups that start in its chunk range. The last of
+ * these groups may continue in the following chunks, so the job reads past the end of its range until the group ends.
+ *
  * @tparam ColumnType the type of the input column to aggregate on
  * @tparam AggregateType the type of the aggregate (=output column)
  * @tparam aggregate_function as type parameter - e.g. AggregateFunction::MIN, AVG, COUNT, ...
- * @param group_boundaries the row ids where a new combination in the sorted table begins
+ * @param group_starts the row ids where a group in the sorted table begins, in order
+ * @param chunk_ranges the ranges of chunks that are processed by one job each
  * @param aggregate_index determines which aggregate to calculate (from _aggregates)
- * @param aggregate_function the aggregate function - as callable object. This should always be the same as aggregate_function
  * @param sorted_table the input table, sorted by the group by columns
  */
 template <typename ColumnType, typename AggregateType, AggregateFunction aggregate_function>
-void AggregateSort::_aggregate_values(const std::set<RowID>& group_boundaries, const uint64_t aggregate_index,
+void AggregateSort::_aggregate_values(const std::vector<RowID>& group_starts,
+                                      const std::vector<std::pair<ChunkID, ChunkID>>& chunk_ranges,
+                                      const uint64_t aggregate_index,
                                       const std::shared_ptr<const Table>& sorted_table) {
   const auto& pqp_column = static_cast<const PQPColumnExpression&>(*_aggregates[aggregate_index]->argument());
   const auto input_column_id = pqp_column.column_id;
 
-  auto aggregator = AggregateFunctionBuilder<ColumnType, AggregateType, aggregate_function>().get_aggregate_function();
-
   // We already know beforehand how many aggregate values (=group-by-combinations) we have to calculate
-  const auto num_groups = group_boundaries.size() + 1;
+  const auto num_groups = group_starts.size();
 
   // Vectors to store aggregate values (and if they are NULL) for later usage in value segments
   auto aggregate_results = pmr_vector<AggregateType>(num_groups);
   auto aggregate_null_values = pmr_vector<bool>(num_groups);
 
-  // Variables needed for the aggregates. Not all variables are needed for all aggregates
-
-  // Row counts per group, ex- and including null values. Needed for count (<column>/*) and average
-  auto value_count = uint64_t{0};
-  auto value_count_with_null = uint64_t{0};
-
-  // All unique values found. Needed for count distinct
-  auto unique_values = std::unordered_set<ColumnType>{};
-
-  // The number of the current group-by-combination. Used as offset when storing values
-  auto aggregate_group_index = uint64_t{0};
-
   const auto chunk_count = sorted_table->chunk_count();
 
-  auto accumulator = AggregateAccumulator<aggregate_function, AggregateType>{};
-  auto current_chunk_id = ChunkID{0};
   if (aggregate_function == AggregateFunction::Count && input_column_id == INVALID_COLUMN_ID) {
     /*
      * Special COUNT(*) implementation.
      * We do not need to care about null values for COUNT(*).
      * Because of this, we can simply calculate the number of elements per group (=COUNT(*))
-     * by calculating the distance between the first and the last corresponding row (+1) in the table.
+     * by calculating the distance between the first row of the group and the first row of the next group.
      * This results in a runtime of O(output rows) rather than O(input rows), which can be quite significant.
      */
-    auto current_group_begin_pointer = RowID{ChunkID{0u}, ChunkOffset{0}};
-    for (const auto& group_boundary : group_boundaries) {
-      if (current_group_begin_pointer.chunk_id == group_boundary.chunk_id) {
-        // Group is located within a single chunk
-        value_count_with_null = group_boundary.chunk_offset - current_group_begin_pointer.chunk_offset;
-      } else {
-        // Group is spread over multiple chunks
-        auto count = uint64_t{0};
-        count += sorted_table->get_chunk(current_group_begin_pointer.chunk_id)->size() -
-                 current_group_begin_pointer.chunk_offset;
-        for (auto chunk_id = ChunkID{current_group_begin_pointer.chunk_id + 1}; chunk_id < group_boundary.chunk_id;
-             chunk_id++) {
-          count += sorted_table->get_chunk(chunk_id)->size();
-        }
-        count += group_boundary.chunk_offset + 1;
-        value_count_with_null = count;
-      }
-      _set_and_write_aggregate_value<AggregateType, aggregate_function>(
-          aggregate_results, aggregate_null_values, aggregate_group_index, aggregate_index, accumulator, value_count,
-          value_count_with_null, unique_values.size());
-      current_group_begin_pointer = group_boundary;
-      aggregate_group_index++;
-    }
-    // Compute value count with null values for the last iteration
-    value_count_with_null = sorted_table->get_chunk(current_group_begin_pointer.chunk_id)->size() -
-                            current_group_begin_pointer.chunk_offset;
-    for (auto chunk_id = ChunkID{current_group_begin_pointer.chunk_id + 1}; chunk_id < chunk_count; ++chunk_id) {
-      value_count_with_null += sorted_table->get_chunk(chunk_id)->size();
+    auto chunk_row_offsets = std::vector<uint64_t>(chunk_count + 1);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      chunk_row_offsets[chunk_id + 1] = chunk_row_offsets[chunk_id] + sorted_table->get_chunk(chunk_id)->size();
     }
 
+    const auto row_number = [&](const RowID& row_id) {
+      return chunk_row_offsets[row_id.chunk_id] + row_id.chunk_offset;
+    };
+
+    auto accumulator = AggregateAccumulator<aggregate_function, AggregateType>{};
+    for (auto group_index = uint64_t{0}; group_index < num_groups; ++group_index) {
+      const auto group_end = group_index + 1 < num_groups ? row_number(group_starts[group_index + 1])
+                                                          : chunk_row_offsets[chunk_count];
+      const auto value_count_with_null = group_end - row_number(group_starts[group_index]);
+      _set_and_write_aggregate_value<AggregateType, aggregate_function>(
+          aggregate_results, aggregate_null_values, group_index, aggregate_index, accumulator, 0,
+          value_count_with_null, 0);
+    }
   } else {
     /*
      * High-level overview of the algorithm:
      *
      * We already know at which RowIDs a new group (=group-by-combination) begins,
-     * it is stored in group_boundaries.
+     * it is stored in group_starts.
      * The base idea is:
      *
      * Iterate over every value in the aggregate column, and keep track of the current RowID
@@ -148,51 +221,113 @@ void AggregateSort::_aggregate_values(const std::set<RowID>& group_boundaries, c
      *
      *   update helper variables
      *
+     * Each job writes the results of its groups into its own vectors, which are concatenated afterwards. Writing into
+     * aggregate_null_values concurrently is not safe, as the elements of a vector<bool> share bytes.
      */
-    auto group_boundary_iter = group_boundaries.cbegin();
-    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-      auto segment = sorted_table->get_chunk(chunk_id)->get_segment(input_column_id);
-      segment_iterate<ColumnType>(*segment, [&](const auto& position) {
-        const auto row_id = RowID{current_chunk_id, position.chunk_offset()};
-        const auto is_new_group = group_boundary_iter != group_boundaries.cend() && row_id == *group_boundary_iter;
-        const auto& new_value = position.value();
-        if (is_new_group) {
-          // New group is starting. Store the aggregate value of the just finished group
-          _set_and_write_aggregate_value<AggregateType, aggregate_function>(
-              aggregate_results, aggregate_null_values, aggregate_group_index, aggregate_index, accumulator,
-              value_count, value_count_with_null, unique_values.size());
-
-          // Reset helper variables
-          accumulator = {};
-          unique_values.clear();
-          value_count = 0;
-          value_count_with_null = 0;
-
-          // Update indexing variables
-          ++aggregate_group_index;
-          ++group_boundary_iter;
+    const auto range_count = chunk_ranges.size();
+    auto results_per_range = std::vector<pmr_vector<AggregateType>>(range_count);
+    auto null_values_per_range = std::vector<pmr_vector<bool>>(range_count);
+    auto group_begin_per_range = std::vector<uint64_t>(range_count);
+
+    execute_jobs(range_count, [&](const size_t range_index) {
+      const auto [begin_chunk_id, end_chunk_id] = chunk_ranges[range_index];
+      const auto group_begin = static_cast<uint64_t>(
+          std::lower_bound(group_starts.begin(), group_starts.end(), RowID{begin_chunk_id, ChunkOffset{0}}) -
+          group_starts.begin());
+      const auto group_end = static_cast<uint64_t>(
+          std::lower_bound(group_starts.begin(), group_starts.end(), RowID{end_chunk_id, ChunkOffset{0}}) -
+          group_starts.begin());
+      group_begin_per_range[range_index] = group_begin;
+      if (group_begin == group_end) {
+        return;
+      }
+
+      auto aggregator =
+          AggregateFunctionBuilder<ColumnType, AggregateType, aggregate_function>().get_aggregate_function();
+
+      auto& local_results = results_per_range[range_index];
+      auto& local_null_values = null_values_per_range[range_index];
+      local_results.resize(group_end - group_begin);
+      local_null_values.resize(group_end - group_begin);
+
+      // Variables needed for the aggregates. Not all variables are needed for all aggregates
+
+      // Row counts per group, ex- and including null values. Needed for count (<column>/*) and average
+      auto value_count = uint64_t{0};
+      auto value_count_with_null = uint64_t{0};
+
+      // All unique values found. Needed for count distinct
+      auto unique_values = std::unordered_set<ColumnType>{};
+
+      // The number of the current group-by-combination, relative to the first group of the job. Used as offset when
+      // storing values
+      auto aggregate_group_index = uint64_t{0};
+      auto next_group = group_begin + 1;
+
+      auto accumulator = AggregateAccumulator<aggregate_function, AggregateType>{};
+
+      // The job ends where the first group of the next range starts.
+      const auto first_row = group_starts[group_begin];
+      const auto end_row = group_end < num_groups ? group_starts[group_end] : RowID{chunk_count, ChunkOffset{0}};
+      for (auto chunk_id = first_row.chunk_id; chunk_id < chunk_count && chunk_id <= end_row.chunk_id; ++chunk_id) {
+        const auto& segment = *sorted_table->get_chunk(chunk_id)->get_segment(input_column_id);
+        const auto begin_offset = chunk_id == first_row.chunk_id ? first_row.chunk_offset : ChunkOffset{0};
+        const auto end_offset = chunk_id == end_row.chunk_id ? end_row.chunk_offset : ChunkOffset{segment.size()};
+        if (begin_offset >= end_offset) {
+          continue;
         }
 
-        // Update helper variables
-        if (!position.is_null()) {
-          aggregator(new_value, value_count, accumulator);
-          ++value_count;
-          if constexpr (aggregate_function == AggregateFunction::CountDistinct) {
-            unique_values.insert(new_value);
-          } else if constexpr (aggregate_function == AggregateFunction::Any) {
-            // Gathering the group's first value for ANY() is sufficient
-            return;
+        segment_with_iterators<ColumnType>(segment, [&](const auto begin, const auto& /*end*/) {
+          const auto range_end = begin + end_offset;
+          for (auto iter = begin + begin_offset; iter != range_end; ++iter) {
+            const auto& position = *iter;
+            if (next_group < group_end && RowID{chunk_id, position.chunk_offset()} == group_starts[next_group]) {
+              // New group is starting. Store the aggregate value of the just finished group
+              _set_and_write_aggregate_value<AggregateType, aggregate_function>(
+                  local_results, local_null_values, aggregate_group_index, aggregate_index, accumulator, value_count,
+                  value_count_with_null, unique_values.size());
+
+              // Reset helper variables
+              accumulator = {};
+              unique_values.clear();
+              value_count = 0;
+              value_count_with_null = 0;
+
+              // Update indexing variables
+              ++aggregate_group_index;
+              ++next_group;
+            }
+
+            // Update helper variables
+            if (!position.is_null()) {
+              aggregator(position.value(), value_count, accumulator);
+              ++value_count;
+              if constexpr (aggregate_function == AggregateFunction::CountDistinct) {
+                unique_values.insert(position.value());
+              } else if constexpr (aggregate_function == AggregateFunction::Any) {
+                // Gathering the group's first value for ANY() is sufficient
+                continue;
+              }
+            }
+            ++value_count_with_null;
           }
-        }
-        ++value_count_with_null;
-      });
-      ++current_chunk_id;
+        });
+      }
+
+      // Aggregate value for the last group of the job was not written yet
+      _set_and_write_aggregate_value<AggregateType, aggregate_function>(
+          local_results, local_null_values, aggregate_group_index, aggregate_index, accumulator, value_count,
+          value_count_with_null, unique_values.size());
+    });
+
+    for (auto range_index = size_t{0}; range_index < range_count; ++range_index) {
+      auto& local_results = results_per_range[range_index];
+      std::move(local_results.begin(), local_results.end(),
+                aggregate_results.begin() + static_cast<std::ptrdiff_t>(group_begin_per_range[range_index]));
+      std::copy(null_values_per_range[range_index].begin(), null_values_per_range[range_index].end(),
+                aggregate_null_values.begin() + static_cast<std::ptrdiff_t>(group_begin_per_range[range_index]));
     }
   }
-  // Aggregate value for the last group was not written yet
-  _set_and_write_aggregate_value<AggregateType, aggregate_function>(
-      aggregate_results, aggregate_null_values, aggregate_group_index, aggregate_index, accumulator, value_count,
-      value_count_with_null, unique_values.size());
 
   // Store the aggregate values in a value segment
   if (_output_column_definitions.at(aggregate_index + _groupby_column_ids.size()).nullable) {
@@ -369,14 +504,16 @@ std::shared_ptr<Table> AggregateSort::_sort_table_chunk_wise(const std::shared_p
  * 2. Build the output table definition.
  *    - If empty, return (empty) result table.
  * 3. Sort the input table by group by columns using the sort operator.
- *    - depending on characteristics of the input table, sorting can either be skipped (input already sorted by group
- *      by column) or sorting can be limited to chunks instead of sorting the whole table (input table is clustered)
+ *    - depending on characteristics of the input table, sorting can either be skipped (rows of each group are known
+ *      to be consecutive or input already sorted by group by column) or sorting can be limited to chunks instead of
+ *      sorting the whole table (input table is clustered)
  * 4. Find the group boundaries.
  *    - The unit of aggregation (either chunks or the whole table, depending on the table's value clustering) is now
  *      sorted by all group by columns.
  *    - As a result, all rows that fall into the same group are consecutive within that unit.
  *    - Thus, we can find all group boundaries (specifically their first element) by iterating over the group by
- *      columns and storing RowIDs of rows where the value of any group by column changes.
+ *      columns and storing RowIDs of rows where the value of any group by column changes. This is done in parallel
+ *      for ranges of chunks.
  *    - The result is a (sorted) vector of RowIDs, its entries marking the beginning of a new group-by-combination.
  * 5. Write the values of group by columns for each group into a ValueSegment.
  *    - For each group by column, iterate over the group boundaries (RowIDs) and output the value.
@@ -389,6 +526,18 @@ std::shared_ptr<Table> AggregateSort::_sort_table_chunk_wise(const std::shared_p
 std::shared_ptr<const Table> AggregateSort::_on_execute() {
   const auto input_table = left_input_table();
 
+  const auto input_is_sorted =
+      _sorted_input == SortedInput::Yes ||
+      (_groupby_column_ids.size() == 1 && is_sorted_by(*input_table, _groupby_column_ids.front()));
+  if (_sorted_input == SortedInput::Expected && !input_is_sorted) {
+    // Sorting the input would be more expensive than hashing it (see class comment).
+    const auto table_wrapper = std::make_shared<TableWrapper>(input_table);
+    table_wrapper->execute();
+    const auto aggregate_hash = std::make_shared<AggregateHash>(table_wrapper, _aggregates, _groupby_column_ids);
+    aggregate_hash->execute();
+    return aggregate_hash->get_output();
+  }
+
   // Check for invalid aggregates
   _validate_aggregates();
 
@@ -453,7 +602,7 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
   }
 
   auto sorted_table = input_table;
-  if (!_groupby_column_ids.empty()) {
+  if (!_groupby_column_ids.empty() && !input_is_sorted) {
     /**
     * If there is a value clustering for a column, it means that all tuples with the same value in that column are in
     * the same chunk. Therefore, if one of the value clustering columns is part of the group by vector, we can skip
@@ -488,70 +637,45 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
 
   /*
    * Find all RowIDs where a value in any group by column changes compared to the previous row,
-   * as those are exactly the boundaries of the different groups.
-   * Everytime a value changes in any of the group by columns, we add the current position to the set.
-   * We are aware that std::set is known to be not the most efficient,
-   * but our profiling revealed that the current implementation is not a bottleneck.
-   * Currently, the vast majority of execution time is spent with sorting.
-   * Moreover, this set grows only to O(output) many elements, so inserts and lookups should stay reasonably fast.
+   * as those are exactly the boundaries of the different groups. Together with the first row of the table, they are
+   * the starts of the groups.
    *
-   *
-   * If this does become a performance problem at some point, one could try e.g. a vector of vectors,
-   * with one vector per column.
-   * Each vector stores all RowIDs where the corresponding column changes.
-   * Afterwards, the vectors have to be merged and deduplicated (presorted list merge).
-   * We have not benchmarked this solution, so we do not know how it performs in comparison to the current one.
-   *
-   * General note: group_boundaries contains the first entry of a new group,
-   *               or in other words: the last entry of a group + 1 row, similar to vector::end()
-   *
-   *               It is (in _aggregate_values) used as indicator that a group has ended just before this row.
-   *               As a result, the start of the very first group is not represented in group_boundaries,
-   *               as there was no group before that ended.
-   *               Further, the end of the last group is not represented as well.
-   *               This is because no new group starts after it.
-   *               So in total, group_boundaries will contain one element less than there are groups.
+   * Each job finds the value changes of the chunks in its range, where the first row of a chunk is compared with the
+   * last row of the previous chunk. Per chunk, the value changes of all group by columns are merged and deduplicated.
+   * As the chunks are in order, concatenating the results of all chunks yields the sorted vector of group starts.
    */
-  auto group_boundaries = std::set<RowID>{};
   const auto chunk_count = sorted_table->chunk_count();
-  for (const auto& column_id : _groupby_column_ids) {
-    auto data_type = input_table->column_data_type(column_id);
-    resolve_data_type(data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
-      auto previous_value = std::optional<ColumnDataType>{};
-
-      /*
-       * Initialize previous_value to the first value in the table, so we avoid considering it a value change.
-       * We do not want to consider it as a value change, because we the first row should not be part of the boundaries.
-       * For the reasoning behind it see above.
-       * We are aware that operator[] is slow, however, for one value it should be faster than segment_iterate_filtered.
-       */
-      const auto& first_segment = sorted_table->get_chunk(ChunkID{0})->get_segment(column_id);
-      const auto& first_value = (*first_segment)[ChunkOffset{0}];
-      if (variant_is_null(first_value)) {
-        previous_value.reset();
-      } else {
-        previous_value = boost::get<ColumnDataType>(first_value);
+  const auto chunk_ranges = chunk_ranges_for_jobs(*sorted_table, ROWS_PER_JOB);
+  auto group_starts_per_chunk = std::vector<std::vector<ChunkOffset>>(chunk_count);
+  execute_jobs(chunk_ranges.size(), [&](const size_t range_index) {
+    const auto [begin_chunk_id, end_chunk_id] = chunk_ranges[range_index];
+    for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+      auto& group_starts = group_starts_per_chunk[chunk_id];
+      for (const auto& column_id : _groupby_column_ids) {
+        resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          const auto value_changes = find_value_changes<ColumnDataType>(*sorted_table, chunk_id, column_id);
+          group_starts.insert(group_starts.end(), value_changes.begin(), value_changes.end());
+        });
       }
 
-      // Iterate over all chunks and insert RowIDs when values change
-      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-        const auto chunk = sorted_table->get_chunk(chunk_id);
-        Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-        const auto& segment = chunk->get_segment(column_id);
-        segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
-          if (previous_value.has_value() == position.is_null() ||
-              (previous_value && !position.is_null() && position.value() != *previous_value)) {
-            group_boundaries.insert(RowID{chunk_id, position.chunk_offset()});
-            if (position.is_null()) {
-              previous_value.reset();
-            } else {
-              previous_value.emplace(position.value());
-            }
-          }
-        });
+      if (_groupby_column_ids.size() > 1) {
+        std::sort(group_starts.begin(), group_starts.end());
+        group_starts.erase(std::unique(group_starts.begin(), group_starts.end()), group_starts.end());
       }
-    });
+    }
+  });
+
+  auto group_starts = std::vector<RowID>{};
+  auto first_chunk_id = ChunkID{0};
+  while (sorted_table->get_chunk(first_chunk_id)->size() == 0) {
+    ++first_chunk_id;
+  }
+  group_starts.emplace_back(first_chunk_id, ChunkOffset{0});
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    for (const auto chunk_offset : group_starts_per_chunk[chunk_id]) {
+      group_starts.emplace_back(chunk_id, chunk_offset);
+    }
   }
 
   /*
@@ -562,24 +686,15 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
    */
   const auto write_groupby_column = [&](const ColumnID input_column_id, const ColumnID output_column_id) {
     const auto column_is_nullable = _output_column_definitions.at(output_column_id).nullable;
-    auto group_boundary_iter = group_boundaries.cbegin();
     auto data_type = input_table->column_data_type(input_column_id);
     resolve_data_type(data_type, [&](auto type) {
       using ColumnDataType = typename decltype(type)::type;
-      auto values = pmr_vector<ColumnDataType>(group_boundaries.size() + 1);
-      auto null_values = pmr_vector<bool>(column_is_nullable ? group_boundaries.size() + 1 : 0);
+      auto values = pmr_vector<ColumnDataType>(group_starts.size());
+      auto null_values = pmr_vector<bool>(column_is_nullable ? group_starts.size() : 0);
 
       const auto value_count = values.size();
       for (size_t value_index = 0; value_index < value_count; ++value_index) {
-        RowID group_start;
-        if (value_index == 0) {
-          // First group starts in the first row, but there is no corresponding entry in the set. See above for reasons.
-          group_start = RowID{ChunkID{0}, ChunkOffset{0}};
-        } else {
-          group_start = *group_boundary_iter;
-          group_boundary_iter++;
-        }
-
+        const auto& group_start = group_starts[value_index];
         const auto chunk = sorted_table->get_chunk(group_start.chunk_id);
         const auto& segment = chunk->get_segment(input_column_id);
 
@@ -587,8 +702,8 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
          * We are aware that operator[] and AllTypeVariant are known to be inefficient.
          * However, for accessing a single value it is probably more efficient than segment_iterate_filtered,
          * besides being more readable.
-         * We cannot use segment_iterate_filtered with the whole group_boundaries (converted to a PosList).
-         * This is because the RowIDs in group_boundaries can reference multiple chunks.
+         * We cannot use segment_iterate_filtered with the whole group_starts (converted to a PosList).
+         * This is because the RowIDs in group_starts can reference multiple chunks.
          */
         const auto& value = (*segment)[group_start.chunk_offset];
 
@@ -646,47 +761,47 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
       switch (aggregate->aggregate_function) {
         case AggregateFunction::Min: {
           using AggregateType = typename AggregateTraits<ColumnDataType, AggregateFunction::Min>::AggregateType;
-          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::Min>(group_boundaries, aggregate_index,
-                                                                                   sorted_table);
+          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::Min>(group_starts, chunk_ranges,
+                                                                                   aggregate_index, sorted_table);
           break;
         }
         case AggregateFunction::Max: {
           using AggregateType = typename AggregateTraits<ColumnDataType, AggregateFunction::Max>::AggregateType;
-          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::Max>(group_boundaries, aggregate_index,
-                                                                                   sorted_table);
+          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::Max>(group_starts, chunk_ranges,
+                                                                                   aggregate_index, sorted_table);
           break;
         }
         case AggregateFunction::Sum: {
           using AggregateType = typename AggregateTraits<ColumnDataType, AggregateFunction::Sum>::AggregateType;
-          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::Sum>(group_boundaries, aggregate_index,
-                                                                                   sorted_table);
+          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::Sum>(group_starts, chunk_ranges,
+                                                                                   aggregate_index, sorted_table);
           break;
         }
 
         case AggregateFunction::Avg: {
           using AggregateType = typename AggregateTraits<ColumnDataType, AggregateFunction::Avg>::AggregateType;
-          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::Avg>(group_boundaries, aggregate_index,
-                                                                                   sorted_table);
+          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::Avg>(group_starts, chunk_ranges,
+                                                                                   aggregate_index, sorted_table);
           break;
         }
         case AggregateFunction::Count: {
           using AggregateType = typename AggregateTraits<ColumnDataType, AggregateFunction::Count>::AggregateType;
-          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::Count>(group_boundaries, aggregate_index,
-                                                                                     sorted_table);
+          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::Count>(group_starts, chunk_ranges,
+                                                                                     aggregate_index, sorted_table);
           break;
         }
         case AggregateFunction::CountDistinct: {
           using AggregateType = typename AggregateTraits<
               ColumnDataType, AggregateFunction::CountDistinct>::AggregateType;  // NOLINT(whitespace/line_length)
           _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::CountDistinct>(
-              group_boundaries, aggregate_index, sorted_table);
+              group_starts, chunk_ranges, aggregate_index, sorted_table);
           break;
         }
         case AggregateFunction::StandardDeviationSample: {
           using AggregateType =
               typename AggregateTraits<ColumnDataType, AggregateFunction::StandardDeviationSample>::AggregateType;
           _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::StandardDeviationSample>(
-              group_boundaries, aggregate_index, sorted_table);
+              group_starts, chunk_ranges, aggregate_index, sorted_table);
           break;
         }
         case AggregateFunction::Any: {
@@ -715,7 +830,7 @@ std::shared_ptr<AbstractOperator> AggregateSort::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
-  return std::make_shared<AggregateSort>(copied_left_input, _aggregates, _groupby_column_ids);
+  return std::make_shared<AggregateSort>(copied_left_input, _aggregates, _groupby_column_ids, _sorted_input);
 }
 
 void AggregateSort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
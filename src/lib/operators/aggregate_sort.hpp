@@ -4,7 +4,6 @@
 #include <limits>
 #include <memory>
 #include <optional>
-#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -42,31 +41,46 @@ namespace hyrise {
  * https://github.com/hyrise/hyrise/wiki/Operators_Aggregate .
  * While most of this page refers to the hash-based aggregate, it also explains common features like aggregate traits.
  *
- * Some notes regarding future optimization:
- * Currently, we always sort the input table by the group by columns.
- * In some cases this might be unnecessary, as the table could already be sorted.
- * There is an issue that discusses how such information as sortedness should be propagated:
- *  https://github.com/hyrise/hyrise/issues/1519
- * As soon as this issue is decided, the sort aggregate operator should be adapted to benefit from sortedness.
- *  If the issue comes to the conclusion that it is the optimizer's responsibility to be aware of sortedness,
- *  this operator might be refactored to expect sorted input and to not sort at all;
- *  and let the optimizer add the required sort operators to the LQP.
+ * We do NOT need the input to be sorted. What we actually need is that all rows belonging to the same group are
+ * consecutive, and sorting is merely a technique to achieve consecutiveness. Thus, sorting is skipped if
+ *  - the operator is created with SortedInput::Yes, i.e., the optimizer knows that the rows of each group are
+ *    consecutive (see StreamingAggregateRule), or
+ *  - there is a single group by column and the chunks' individually_sorted_by() and their first and last values show
+ *    that the input is sorted by it (see is_sorted_by()).
+ * In this streaming mode, the groups are aggregated in a single pass over the input without a sort and without a hash
+ * table. If the input is not sorted, the output will not be sorted either.
  *
- *  To be precise: We do NOT need the input to be sorted.
- *  What we actually need is that all rows belonging to the same group are consecutive,
- *  and sorting is merely a technique to achieve consecutiveness.
- *   There is one minor thing we lose if the input is consecutive but not sorted: the output will not be sorted either.
- *   However, the output of an aggregate is usually much smaller than the input, so it is still more efficient
- *   to aggregate on the consecutive input and then sort the output, than sorting the input and then aggregating it.
+ * With SortedInput::Expected, the LQPTranslator chose this operator because a stored table was sorted by the group by
+ * column when the plan was translated. The table might have changed before the execution (e.g., rows were inserted
+ * into a new, unsorted chunk and the plan was cached). If the input is not sorted anymore, the operator falls back to
+ * an AggregateHash instead of sorting the input.
+ *
+ * Group boundaries are found and values are aggregated in parallel, one job per range of at least ROWS_PER_JOB rows.
+ * Jobs compare the first row of a chunk with the last row of the previous chunk, and a job that aggregates the last
+ * group starting in its range continues reading the following chunks until that group ends. Thus, groups that span
+ * chunk boundaries are not split.
  */
 class AggregateSort : public AbstractAggregateOperator {
  public:
+  enum class SortedInput { Yes, No, Expected };
+
+  static constexpr auto ROWS_PER_JOB = size_t{50'000};
+
   AggregateSort(const std::shared_ptr<AbstractOperator>& input_operator,
                 const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
-                const std::vector<ColumnID>& groupby_column_ids);
+                const std::vector<ColumnID>& groupby_column_ids, const SortedInput sorted_input = SortedInput::No);
 
   const std::string& name() const override;
 
+  SortedInput sorted_input() const;
+
+  /**
+   * Returns true if all chunks of the table are individually sorted by the column with the same sort mode and each
+   * chunk's first value does not precede the previous chunk's last value, i.e., the entire table is sorted by the
+   * column. Only the chunks' first and last values are accessed. NULLs are expected to come first (see Sort).
+   */
+  static bool is_sorted_by(const Table& table, const ColumnID column_id);
+
   /**
    * Creates the aggregate column definitions and appends it to `_output_column_definitions`
    * We need the input column data type because the aggregate type can depend on it.
@@ -99,7 +113,8 @@ class AggregateSort : public AbstractAggregateOperator {
   using AggregateFunctor = std::function<void(const ColumnType&, std::optional<AggregateType>&)>;
 
   template <typename ColumnType, typename AggregateType, AggregateFunction aggregate_function>
-  void _aggregate_values(const std::set<RowID>& group_boundaries, const uint64_t aggregate_index,
+  void _aggregate_values(const std::vector<RowID>& group_starts,
+                         const std::vector<std::pair<ChunkID, ChunkID>>& chunk_ranges, const uint64_t aggregate_index,
                          const std::shared_ptr<const Table>& sorted_table);
 
   template <typename ColumnType>
@@ -127,6 +142,8 @@ class AggregateSort : public AbstractAggregateOperator {
                                                        const std::vector<ColumnID>& groupby_column_ids);
 
   static Segments _get_segments_of_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id);
+
+  const SortedInput _sorted_input;
 };
 
 }  // namespace hyrise
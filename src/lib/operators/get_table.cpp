@@ -100,13 +100,21 @@ std::vector<std::shared_ptr<const AbstractOperator>> GetTable::prunable_subquery
   return subquery_scans;
 }
 
+void GetTable::set_runtime_filters(std::vector<JoinRuntimeFilterReference> runtime_filters) const {
+  _runtime_filters = std::move(runtime_filters);
+}
+
+const std::vector<JoinRuntimeFilterReference>& GetTable::runtime_filters() const {
+  return _runtime_filters;
+}
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
     const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
-  // We cannot copy _prunable_subquery_scans here since deep_copy() recurses into the input oprators and the GetTable
-  // operators are the first ones to be copied. Instead, AbstractOperator::deep_copy() sets the copied TableScans after
-  // the whole PQP has been copied.
+  // We cannot copy _prunable_subquery_scans and _runtime_filters here since deep_copy() recurses into the input
+  // oprators and the GetTable operators are the first ones to be copied. Instead, AbstractOperator::deep_copy() sets
+  // the copied TableScans and joins after the whole PQP has been copied.
   return std::make_shared<GetTable>(_name, _pruned_chunk_ids, _pruned_column_ids);
 }
 
@@ -311,7 +319,7 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
 }
 
 std::set<ChunkID> GetTable::_prune_chunks_dynamically() {
-  if (_prunable_subquery_scans.empty()) {
+  if (_prunable_subquery_scans.empty() && _runtime_filters.empty()) {
     return {};
   }
 
@@ -325,7 +333,17 @@ std::set<ChunkID> GetTable::_prune_chunks_dynamically() {
   // the original predicate to ignore any other nodes in between. Since the ChunkPruningRule already took care to add
   // only predicates that are safe to prune with, we can act as if there were no other LQP nodes.
   auto prunable_predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
-  prunable_predicate_nodes.reserve(_prunable_subquery_scans.size());
+  prunable_predicate_nodes.reserve(_prunable_subquery_scans.size() + _runtime_filters.size());
+
+  // Add a new PredicateNode to the pruning chain.
+  const auto add_predicate_node = [&](const std::shared_ptr<AbstractExpression>& predicate) {
+    auto input_node = static_pointer_cast<AbstractLQPNode>(dummy_stored_table_node);
+    if (!prunable_predicate_nodes.empty()) {
+      input_node = prunable_predicate_nodes.back();
+    }
+    prunable_predicate_nodes.emplace_back(PredicateNode::make(predicate, input_node));
+  };
+
   for (const auto& op : prunable_subquery_scans()) {
     const auto& table_scan = static_cast<const TableScan&>(*op);
     const auto& operator_predicate_arguments = table_scan.predicate()->arguments;
@@ -366,12 +384,24 @@ std::set<ChunkID> GetTable::_prune_chunks_dynamically() {
       argument = value_(resolve_uncorrelated_subquery(subquery.pqp));
     }
 
-    // Add a new PredicateNode to the pruning chain.
-    auto input_node = static_pointer_cast<AbstractLQPNode>(dummy_stored_table_node);
-    if (!prunable_predicate_nodes.empty()) {
-      input_node = prunable_predicate_nodes.back();
+    add_predicate_node(adjusted_predicate);
+  }
+
+  // Rows whose join column value is not in the value range of the other join input cannot find a join partner. The
+  // LQPTranslator only sets runtime filters if such rows are not part of the join result.
+  for (const auto& runtime_filter_reference : _runtime_filters) {
+    const auto runtime_filter = runtime_filter_reference.runtime_filter();
+    if (!runtime_filter || !runtime_filter->value_range()) {
+      continue;
     }
-    prunable_predicate_nodes.emplace_back(PredicateNode::make(adjusted_predicate, input_node));
+
+    const auto& [min, max] = *runtime_filter->value_range();
+    add_predicate_node(between_inclusive_(lqp_column_(dummy_stored_table_node, runtime_filter_reference.column_id),
+                                          value_(min), value_(max)));
+  }
+
+  if (prunable_predicate_nodes.empty()) {
+    return {};
   }
 
   _dynamically_pruned_chunk_ids = compute_chunk_exclude_list(prunable_predicate_nodes, dummy_stored_table_node);
@@ -2,6 +2,7 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "operators/join_hash/join_runtime_filter.hpp"
 
 namespace hyrise {
 
@@ -34,6 +35,11 @@ class GetTable : public AbstractReadOnlyOperator {
   void set_prunable_subquery_scans(std::vector<std::weak_ptr<const AbstractOperator>> subquery_scans) const;
   std::vector<std::shared_ptr<const AbstractOperator>> prunable_subquery_scans() const;
 
+  // Similarly, a JoinHash above this operator can provide the value range of the other join input at runtime if that
+  // input has already been executed (see JoinRuntimeFilter). We prune chunks that cannot contain join partners.
+  void set_runtime_filters(std::vector<JoinRuntimeFilterReference> runtime_filters) const;
+  const std::vector<JoinRuntimeFilterReference>& runtime_filters() const;
+
  protected:
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
@@ -43,8 +49,8 @@ class GetTable : public AbstractReadOnlyOperator {
 
   std::shared_ptr<const Table> _on_execute() override;
 
-  // Resolve the predicate values for uncorrelated subqueries if they have already been executed. If so, perform chunk
-  // pruning with the predicates and return the pruned ChunkIDs.
+  // Resolve the predicate values for uncorrelated subqueries and the value ranges of runtime filters if they have
+  // already been executed. If so, perform chunk pruning with the predicates and return the pruned ChunkIDs.
   std::set<ChunkID> _prune_chunks_dynamically();
 
   // Name of the table to retrieve.
@@ -53,6 +59,7 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::vector<ColumnID> _pruned_column_ids;
 
   mutable std::vector<std::weak_ptr<const AbstractOperator>> _prunable_subquery_scans{};
+  mutable std::vector<JoinRuntimeFilterReference> _runtime_filters{};
   std::set<ChunkID> _dynamically_pruned_chunk_ids{};
 };
 
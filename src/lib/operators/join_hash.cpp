@@ -14,6 +14,7 @@
 #include "hyrise.hpp"
 #include "join_hash/join_hash_steps.hpp"
 #include "join_hash/join_hash_traits.hpp"
+#include "join_hash/join_runtime_filter.hpp"
 #include "join_helper/join_output_writing.hpp"
 #include "scheduler/job_task.hpp"
 #include "type_comparison.hpp"
@@ -102,6 +103,22 @@ size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t
   return std::min(size_t{8}, static_cast<size_t>(std::ceil(std::log2(cluster_count))));
 }
 
+std::shared_ptr<const JoinRuntimeFilter> JoinHash::runtime_filter(const LQPInputSide source_side) const {
+  const auto& source_input = source_side == LQPInputSide::Left ? _left_input : _right_input;
+  if (source_input->state() != OperatorState::ExecutedAndAvailable) {
+    return nullptr;
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_runtime_filter_mutex};
+  auto& runtime_filter = _runtime_filters[static_cast<size_t>(source_side)];
+  if (!runtime_filter) {
+    const auto column_id = source_side == LQPInputSide::Left ? _primary_predicate.column_ids.first
+                                                             : _primary_predicate.column_ids.second;
+    runtime_filter = std::make_shared<JoinRuntimeFilter>(*source_input->get_output(), column_id);
+  }
+  return runtime_filter;
+}
+
 std::shared_ptr<const Table> JoinHash::_on_execute() {
   Assert(supports({_mode, _primary_predicate.predicate_condition,
                    left_input_table()->column_data_type(_primary_predicate.column_ids.first),
@@ -215,6 +232,9 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
 void JoinHash::_on_cleanup() {
   _impl.reset();
+
+  const auto lock = std::lock_guard<std::mutex>{_runtime_filter_mutex};
+  _runtime_filters = {};
 }
 
 template <typename BuildColumnType, typename ProbeColumnType>
@@ -318,8 +338,8 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      * 1.1. Materialize the build partition, which is expected to be smaller. Create a Bloom filter.
      */
 
-    auto build_side_bloom_filter = BloomFilter{};
-    auto probe_side_bloom_filter = BloomFilter{};
+    auto build_side_bloom_filter = BlockedBloomFilter{};
+    auto probe_side_bloom_filter = BlockedBloomFilter{};
 
     const auto materialize_build_side = [&](const auto& input_bloom_filter) {
       if (keep_nulls_build_column) {
@@ -352,9 +372,9 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
     auto timer_materialization = Timer{};
     if (_build_input_table->row_count() < _probe_input_table->row_count()) {
       // When materializing the first side (here: the build side), we do not yet have a Bloom filter. To keep the number
-      // of code paths low, materialize_*_side always expects a Bloom filter. For the first step, we thus pass in a
-      // Bloom filter that returns true for every probe.
-      materialize_build_side(ALL_TRUE_BLOOM_FILTER);
+      // of code paths low, materialize_*_side always expects a Bloom filter. For the first step, we thus pass in an
+      // empty Bloom filter, which is never active.
+      materialize_build_side(BlockedBloomFilter{});
       _performance_data.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer_materialization.lap());
       materialize_probe_side(build_side_bloom_filter);
       _performance_data.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
@@ -362,7 +382,7 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       // Here, we first materialize the probe side and use the resulting Bloom filter in the materialization of the
       // build side. Consequently, the Bloom filter later passed into build() will have no effect as it has already
       // been used here to filter non-matching values.
-      materialize_probe_side(ALL_TRUE_BLOOM_FILTER);
+      materialize_probe_side(BlockedBloomFilter{});
       _performance_data.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
       materialize_build_side(probe_side_bloom_filter);
       _performance_data.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer_materialization.lap());
@@ -445,6 +465,14 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
     }
     _performance_data.set_step_runtime(OperatorSteps::Building, timer_hash_map_building.lap());
 
+    // Store how effective the Bloom filters were. Only the filter of the side that was materialized first is used
+    // during materialization, but the probe side's filter is also used in build().
+    for (const auto* bloom_filter : {&build_side_bloom_filter, &probe_side_bloom_filter}) {
+      _performance_data.bloom_filter_probed_value_count += bloom_filter->probed_value_count();
+      _performance_data.bloom_filter_filtered_value_count += bloom_filter->filtered_value_count();
+      _performance_data.bloom_filter_disabled |= bloom_filter->block_count() > 0 && !bloom_filter->is_active();
+    }
+
     // Store the element counts of the built hash tables. Depending on the Bloom filter, we might have significantly
     // less values stored than in the initial input table.
     for (const auto& hash_table : hash_tables) {
@@ -485,52 +513,56 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
 
     /**
      * 4. Probe step
+     *    Partitions with skewed keys are split into multiple ranges that are probed by separate jobs. Each range
+     *    writes its own position lists.
      */
+    Timer timer_probing;
+    const auto probe_ranges = plan_probe_ranges(radix_probe_column, hash_tables);
+    const auto probe_range_count = probe_ranges.size();
+    for (auto probe_range_idx = size_t{0}; probe_range_idx < probe_range_count; ++probe_range_idx) {
+      if (probe_ranges[probe_range_idx].begin > 0) {
+        ++_performance_data.additional_probe_range_count;
+        if (probe_ranges[probe_range_idx - 1].begin == 0) {
+          ++_performance_data.split_probe_partition_count;
+        }
+      }
+    }
+
     auto build_side_pos_lists = std::vector<RowIDPosList>{};
     auto probe_side_pos_lists = std::vector<RowIDPosList>{};
-    const size_t partition_count = radix_probe_column.size();
-    build_side_pos_lists.resize(partition_count);
-    probe_side_pos_lists.resize(partition_count);
-
-    // simple heuristic: half of the rows of the probe side will match
-    const size_t result_rows_per_partition =
-        _probe_input_table->row_count() > 0 ? _probe_input_table->row_count() / partition_count / 2 : 0;
-    for (auto partition_index = size_t{0}; partition_index < partition_count; ++partition_index) {
-      build_side_pos_lists[partition_index].reserve(result_rows_per_partition);
-      probe_side_pos_lists[partition_index].reserve(result_rows_per_partition);
-    }
+    build_side_pos_lists.resize(probe_range_count);
+    probe_side_pos_lists.resize(probe_range_count);
 
-    Timer timer_probing;
     switch (_mode) {
       case JoinMode::Inner:
-        probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables, build_side_pos_lists,
+        probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables, probe_ranges, build_side_pos_lists,
                                                   probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
                                                   _secondary_predicates);
         break;
 
       case JoinMode::Left:
       case JoinMode::Right:
-        probe<ProbeColumnType, HashedType, true>(radix_probe_column, hash_tables, build_side_pos_lists,
+        probe<ProbeColumnType, HashedType, true>(radix_probe_column, hash_tables, probe_ranges, build_side_pos_lists,
                                                  probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
                                                  _secondary_predicates);
         break;
 
       case JoinMode::Semi:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(radix_probe_column, hash_tables,
+        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(radix_probe_column, hash_tables, probe_ranges,
                                                                      probe_side_pos_lists, *_build_input_table,
                                                                      *_probe_input_table, _secondary_predicates);
         break;
 
       case JoinMode::AntiNullAsTrue:
         probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
+            radix_probe_column, hash_tables, probe_ranges, probe_side_pos_lists, *_build_input_table,
+            *_probe_input_table, _secondary_predicates);
         break;
 
       case JoinMode::AntiNullAsFalse:
         probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
+            radix_probe_column, hash_tables, probe_ranges, probe_side_pos_lists, *_build_input_table,
+            *_probe_input_table, _secondary_predicates);
         break;
 
       default:
@@ -577,6 +609,17 @@ void JoinHash::PerformanceData::output_to_stream(std::ostream& stream, Descripti
   const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
   stream << separator << "Radix bits: " << radix_bits << ".";
   stream << separator << "Build side is " << (left_input_is_build_side ? "left." : "right.");
+  if (bloom_filter_probed_value_count > 0) {
+    const auto filter_rate =
+        static_cast<double>(bloom_filter_filtered_value_count) / static_cast<double>(bloom_filter_probed_value_count);
+    stream << separator << "Bloom filters removed " << bloom_filter_filtered_value_count << " of "
+           << bloom_filter_probed_value_count << " values (" << std::lround(filter_rate * 100.0) << " %)"
+           << (bloom_filter_disabled ? " and were disabled." : ".");
+  }
+  if (split_probe_partition_count > 0) {
+    stream << separator << "Probing split " << split_probe_partition_count << " skewed partition(s) into "
+           << split_probe_partition_count + additional_probe_range_count << " ranges.";
+  }
 }
 
 }  // namespace hyrise
@@ -1,13 +1,18 @@
 #pragma once
 
+#include <array>
+#include <mutex>
 #include <optional>
 
 #include "abstract_join_operator.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
 #include "operator_join_predicate.hpp"
 #include "types.hpp"
 
 namespace hyrise {
 
+class JoinRuntimeFilter;
+
 /**
  * This operator joins two tables using one column of each table.
  * The output is a new table with referenced columns for all columns of the two inputs and filtered pos_lists.
@@ -35,6 +40,11 @@ class JoinHash : public AbstractJoinOperator {
 
   static size_t calculate_radix_bits(const size_t build_side_size, const size_t probe_side_size);
 
+  // Returns the runtime filter for the join column of the given input, which operators below the other input can use to
+  // discard rows without join partner early (see JoinRuntimeFilter). The filter is created on the first call after the
+  // input has been executed. Before, nullptr is returned.
+  std::shared_ptr<const JoinRuntimeFilter> runtime_filter(const LQPInputSide source_side) const;
+
   enum class OperatorSteps : uint8_t {
     BuildSideMaterializing,
     ProbeSideMaterializing,
@@ -63,6 +73,18 @@ class JoinHash : public AbstractJoinOperator {
     // build_side_position_count (see order of materialization in hash_join.cpp).
     size_t hash_tables_distinct_value_count{0};
     std::optional<size_t> hash_tables_position_count;
+
+    // Number of values probed against the Bloom filters and number of values that were filtered out by them. The
+    // observed filter rate is their ratio. Bloom filters with a poor filter rate are disabled at runtime (see
+    // BlockedBloomFilter).
+    size_t bloom_filter_probed_value_count{0};
+    size_t bloom_filter_filtered_value_count{0};
+    bool bloom_filter_disabled{false};
+
+    // Partitions with skewed join keys are probed by multiple jobs (see plan_probe_ranges()). We store how many
+    // partitions were split and how many ranges were created in addition to one range per partition.
+    size_t split_probe_partition_count{0};
+    size_t additional_probe_range_count{0};
   };
 
  protected:
@@ -77,6 +99,9 @@ class JoinHash : public AbstractJoinOperator {
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
   std::optional<size_t> _radix_bits;
 
+  mutable std::mutex _runtime_filter_mutex;
+  mutable std::array<std::shared_ptr<const JoinRuntimeFilter>, 2> _runtime_filters;
+
   template <typename LeftType, typename RightType>
   class JoinHashImpl;
   template <typename LeftType, typename RightType>
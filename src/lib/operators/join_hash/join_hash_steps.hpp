@@ -3,7 +3,6 @@
 #include <boost/container/pmr/monotonic_buffer_resource.hpp>
 #include <boost/container/pmr/unsynchronized_pool_resource.hpp>
 #include <boost/container/small_vector.hpp>
-#include <boost/dynamic_bitset.hpp>
 #include <boost/lexical_cast.hpp>
 #include <uninitialized_vector.hpp>
 
@@ -17,6 +16,7 @@
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
+#include "utils/blocked_bloom_filter.hpp"
 
 /*
   This file includes the functions that cover the main steps of our hash join implementation
@@ -225,47 +225,30 @@ class PosHashTable {
   std::optional<UnifiedPosList> _unified_pos_list{};
 };
 
-// The Bloom filter (with k=1) is used during the materialization and build phases. It contains `true` for each
-// `hash_function(value) % BLOOM_FILTER_SIZE`. Much of how the Bloom filter is used in the hash join could be improved:
-// (1) Dynamically check whether Bloom filters are worth the memory and computational costs. This could be based on the
-//     input table sizes, the expected cardinalities, the hardware characteristics, or other factors.
-// (2) Choosing an appropriate filter size. 2^20 was experimentally found to be good for TPC-H SF 10, but is certainly
-//     not optimal in every situation.
-// (3) Evaluate whether using multiple hash functions (k>1) brings any improvement. In a first experiment, however, we
-//     saw no benefits for single-threaded TPC-H SF 10.
-// (4) Use the probe side Bloom filter when partitioning the build side. By doing that, we reduce the size of the
+// Bloom filters are used during the materialization and build phases to skip values that will not find a join partner.
+// The filter of one side is created while materializing it and is sized by its cardinality (see BlockedBloomFilter).
+// Bloom filters that turn out to filter only few values disable themselves, so that we do not pay for probing them
+// (e.g., for foreign key joins without selective predicates on the primary key side). Open points:
+// (1) The filter of the second materialized side is also built when it is not used afterwards (i.e., when the probe
+//     side is materialized first).
+// (2) Use the probe side Bloom filter when partitioning the build side. By doing that, we reduce the size of the
 //     intermediary results. When a Bloom filter-supported partitioning has been done (i.e., partitioning has not
 //     been skipped), we do not need to use a Bloom filter in the build phase anymore.
-// Some of these points could be addressed with relatively low effort and should bring additional, significant benefits.
-// We did not yet work on this because the Bloom filter was a byproduct of a research project and we have not had the
-// resources to optimize it at the time.
-static constexpr auto BLOOM_FILTER_SIZE = 1 << 20;
-static constexpr auto BLOOM_FILTER_MASK = BLOOM_FILTER_SIZE - 1;
-
-// Using dynamic_bitset because, different from vector<bool>, it has an efficient operator| implementation, which is
-// needed for merging partial Bloom filters created by different threads. Note that the dynamic_bitset(n, value)
-// constructor does not do what you would expect it to, so try to avoid it.
-using BloomFilter = boost::dynamic_bitset<>;
-
-// ALL_TRUE_BLOOM_FILTER is initialized by creating a BloomFilter with every value being false and using bitwise
-// negation (~x). As the negation is surprisingly expensive, we create a static empty Bloom filter and reference
-// it where needed. Having a Bloom filter that always returns true avoids a branch in the hot loop.
-static const auto ALL_TRUE_BLOOM_FILTER = ~BloomFilter(BLOOM_FILTER_SIZE);
 
 // @param in_table             Table to materialize
 // @param column_id            Column within that table to materialize
 // @param histograms           Out: If radix_bits > 0, contains one histogram per chunk where each histogram contains
 //                             1 << radix_bits slots
 // @param radix_bits           Number of radix_bits, needed only for histogram calculation
-// @param output_bloom_filter  Out: A filled BloomFilter where `value & BLOOM_FILTER_MASK == true` for each value
+// @param output_bloom_filter  Out: A Bloom filter sized for the input table that contains the hash of each value
 //                             encountered in the input column
-// @param input_bloom_filter   Optional: Materialization is skipped for each value where the corresponding slot in the
-//                             Bloom filter is false
+// @param input_bloom_filter   Optional: Materialization is skipped for each value that is not contained in the Bloom
+//                             filter as long as the filter is active
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
                                     std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
-                                    BloomFilter& output_bloom_filter,
-                                    const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER) {
+                                    BlockedBloomFilter& output_bloom_filter,
+                                    const BlockedBloomFilter& input_bloom_filter = BlockedBloomFilter{}) {
   // Retrieve input chunk_count as it might change during execution if we work on a non-reference table
   auto chunk_count = in_table->chunk_count();
 
@@ -281,11 +264,9 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   const auto pass = size_t{0};
   const auto radix_mask = static_cast<size_t>(std::pow(2, radix_bits * (pass + 1)) - 1);
 
-  Assert(output_bloom_filter.empty(), "output_bloom_filter should be empty");
-  output_bloom_filter.resize(BLOOM_FILTER_SIZE);
-  std::mutex output_bloom_filter_mutex;
-
-  Assert(input_bloom_filter.size() == BLOOM_FILTER_SIZE, "Invalid input_bloom_filter");
+  Assert(output_bloom_filter.block_count() == 0, "output_bloom_filter should be empty");
+  // The row count is an upper bound for the distinct values. Values are inserted concurrently by the jobs below.
+  output_bloom_filter = BlockedBloomFilter{in_table->row_count()};
 
   // Create histograms per chunk
   histograms.resize(chunk_count);
@@ -301,13 +282,10 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
     const auto num_rows = chunk_in->size();
 
     const auto materialize = [&, chunk_in, chunk_id, num_rows]() {
-      auto local_output_bloom_filter = BloomFilter{};
-      std::reference_wrapper<BloomFilter> used_output_bloom_filter = output_bloom_filter;
-      if (Hyrise::get().is_multi_threaded()) {
-        // We cannot write to BloomFilter concurrently, so we build a local one first.
-        local_output_bloom_filter = BloomFilter(BLOOM_FILTER_SIZE, false);
-        used_output_bloom_filter = local_output_bloom_filter;
-      }
+      // Whether the input Bloom filter is used is decided once per chunk. Meanwhile, other jobs might have disabled it.
+      const auto use_input_bloom_filter = !keep_null_values && input_bloom_filter.is_active();
+      auto probed_value_count = size_t{0};
+      auto filtered_value_count = size_t{0};
 
       // Skip chunks that were physically deleted
       if (!chunk_in) {
@@ -354,14 +332,15 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
             const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
 
             auto skip = false;
-            if (!value.is_null() && !input_bloom_filter[hashed_value & BLOOM_FILTER_MASK] && !keep_null_values) {
-              // Value in not present in input bloom filter and can be skipped
-              skip = true;
+            if (use_input_bloom_filter) {
+              // Value is not present in the input Bloom filter and can be skipped.
+              skip = !input_bloom_filter.contains(hashed_value);
+              ++probed_value_count;
+              filtered_value_count += skip;
             }
 
             if (!skip) {
-              // Fill the corresponding slot in the bloom filter
-              used_output_bloom_filter.get()[hashed_value & BLOOM_FILTER_MASK] = true;
+              output_bloom_filter.insert(hashed_value);
 
               /*
               For ReferenceSegments we do not use the RowIDs from the referenced tables.
@@ -406,10 +385,8 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
 
       histograms[chunk_id] = std::move(histogram);
 
-      if (Hyrise::get().is_multi_threaded()) {
-        // Merge the local_output_bloom_filter into output_bloom_filter
-        const auto lock = std::lock_guard<std::mutex>{output_bloom_filter_mutex};
-        output_bloom_filter |= local_output_bloom_filter;
+      if (use_input_bloom_filter) {
+        input_bloom_filter.record_probes(probed_value_count, filtered_value_count);
       }
     };
     if (JoinHash::JOB_SPAWN_THRESHOLD > num_rows) {
@@ -430,9 +407,7 @@ Build all the hash tables for the partitions of the build column. One job per pa
 template <typename BuildColumnType, typename HashedType>
 std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<BuildColumnType>& radix_container,
                                                            const JoinHashBuildMode mode, const size_t radix_bits,
-                                                           const BloomFilter& input_bloom_filter) {
-  Assert(input_bloom_filter.size() == BLOOM_FILTER_SIZE, "invalid input_bloom_filter");
-
+                                                           const BlockedBloomFilter& input_bloom_filter) {
   if (radix_container.empty()) {
     return {};
   }
@@ -469,6 +444,8 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
 
     const auto insert_into_hash_table = [&, partition_idx, elements_count]() {
       const auto hash_table_idx = radix_bits > 0 ? partition_idx : 0;
+      const auto use_input_bloom_filter = input_bloom_filter.is_active();
+      auto filtered_value_count = size_t{0};
 
       auto& hash_table = hash_tables[hash_table_idx];
       if (radix_bits > 0) {
@@ -477,14 +454,21 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
       for (const auto& element : elements) {
         DebugAssert(!(element.row_id == NULL_ROW_ID), "No NULL_ROW_IDs should make it to this point");
 
-        const Hash hashed_value = hash_function(static_cast<HashedType>(element.value));
-        if (!input_bloom_filter[hashed_value & BLOOM_FILTER_MASK]) {
-          continue;
+        if (use_input_bloom_filter) {
+          const Hash hashed_value = hash_function(static_cast<HashedType>(element.value));
+          if (!input_bloom_filter.contains(hashed_value)) {
+            ++filtered_value_count;
+            continue;
+          }
         }
 
         hash_table->emplace(element.value, element.row_id);
       }
 
+      if (use_input_bloom_filter) {
+        input_bloom_filter.record_probes(elements_count, filtered_value_count);
+      }
+
       if (radix_bits > 0) {
         // In case only a single hash table is built, shrink to fit is called outside of the loop.
         hash_table->finalize();
@@ -513,7 +497,7 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
                                      std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
-                                     const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER) {
+                                     const BlockedBloomFilter& input_bloom_filter = BlockedBloomFilter{}) {
   if (radix_container.empty()) {
     return radix_container;
   }
@@ -623,6 +607,86 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   return output;
 }
 
+/*
+  A range of elements of a probe-side partition. Each range is probed by one job and yields one output position list.
+*/
+struct ProbeRange {
+  size_t partition_idx;
+  size_t begin;
+  size_t end;
+};
+
+/*
+  Without skew, each partition of the probe side is probed by a single job. If the join keys are skewed (e.g.,
+  Zipf-distributed), the radix partitions (as predicted by the materialization histograms) can differ in size by
+  orders of magnitude, and the job probing the partition of a heavy hitter becomes a straggler. Heavy hitters on the
+  build side have the same effect, as each probed value yields many matches.
+
+  We estimate the work of each partition as its number of probe elements times the average number of build-side
+  positions per distinct value in its hash table. Partitions whose work exceeds SKEW_FACTOR times the average work of
+  the non-empty partitions are split into ranges of roughly average work, which are probed by separate jobs. Ranges are
+  never smaller than JoinHash::JOB_SPAWN_THRESHOLD elements. The ranges are returned in partition and element order, so
+  splitting does not change the order of the join result.
+*/
+template <typename ProbeColumnType, typename HashedType>
+std::vector<ProbeRange> plan_probe_ranges(const RadixContainer<ProbeColumnType>& probe_radix_container,
+                                          const std::vector<std::optional<PosHashTable<HashedType>>>& hash_tables) {
+  constexpr auto SKEW_FACTOR = 2.0;
+
+  const auto partition_count = probe_radix_container.size();
+  auto work_by_partition = std::vector<double>(partition_count);
+  auto total_work = 0.0;
+  auto non_empty_partition_count = size_t{0};
+  for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+    const auto element_count = probe_radix_container[partition_idx].elements.size();
+    if (element_count == 0) {
+      continue;
+    }
+
+    auto matches_per_element = 1.0;
+    const auto hash_table_idx = hash_tables.size() > 1 ? partition_idx : 0;
+    if (hash_table_idx < hash_tables.size() && hash_tables[hash_table_idx]) {
+      const auto& hash_table = *hash_tables[hash_table_idx];
+      const auto position_count = hash_table.position_count();
+      const auto distinct_value_count = hash_table.distinct_value_count();
+      if (position_count && distinct_value_count > 0) {
+        matches_per_element =
+            std::max(1.0, static_cast<double>(*position_count) / static_cast<double>(distinct_value_count));
+      }
+    }
+
+    work_by_partition[partition_idx] = static_cast<double>(element_count) * matches_per_element;
+    total_work += work_by_partition[partition_idx];
+    ++non_empty_partition_count;
+  }
+
+  auto probe_ranges = std::vector<ProbeRange>{};
+  probe_ranges.reserve(non_empty_partition_count);
+  const auto average_work = non_empty_partition_count > 0 ? total_work / static_cast<double>(non_empty_partition_count)
+                                                          : 0.0;
+
+  for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+    const auto element_count = probe_radix_container[partition_idx].elements.size();
+    if (element_count == 0) {
+      continue;
+    }
+
+    auto range_count = size_t{1};
+    const auto work = work_by_partition[partition_idx];
+    if (work > SKEW_FACTOR * average_work) {
+      range_count = std::min(static_cast<size_t>(std::ceil(work / average_work)),
+                             std::max(size_t{1}, element_count / JoinHash::JOB_SPAWN_THRESHOLD));
+    }
+
+    const auto range_size = (element_count + range_count - 1) / range_count;
+    for (auto begin = size_t{0}; begin < element_count; begin += range_size) {
+      probe_ranges.emplace_back(ProbeRange{partition_idx, begin, std::min(begin + range_size, element_count)});
+    }
+  }
+
+  return probe_ranges;
+}
+
 /*
   In the probe phase we take all partitions from the probe partition, iterate over them and compare each join candidate
   with the values in the hash table. Since build and probe are hashed using the same hash function, we can reduce the
@@ -631,11 +695,11 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
 template <typename ProbeColumnType, typename HashedType, bool keep_null_values>
 void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
            const std::vector<std::optional<PosHashTable<HashedType>>>& hash_tables,
-           std::vector<RowIDPosList>& pos_lists_build_side, std::vector<RowIDPosList>& pos_lists_probe_side,
-           const JoinMode mode, const Table& build_table, const Table& probe_table,
-           const std::vector<OperatorJoinPredicate>& secondary_join_predicates) {
+           const std::vector<ProbeRange>& probe_ranges, std::vector<RowIDPosList>& pos_lists_build_side,
+           std::vector<RowIDPosList>& pos_lists_probe_side, const JoinMode mode, const Table& build_table,
+           const Table& probe_table, const std::vector<OperatorJoinPredicate>& secondary_join_predicates) {
   std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(probe_radix_container.size());
+  jobs.reserve(probe_ranges.size());
 
   /*
     NUMA notes:
@@ -645,17 +709,18 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
     and the job that probes that partition should also be on that NUMA node.
   */
 
-  for (size_t partition_idx = 0; partition_idx < probe_radix_container.size(); ++partition_idx) {
-    // Skip empty partitions to avoid empty output chunks
-    if (probe_radix_container[partition_idx].elements.empty()) {
-      continue;
-    }
-
+  // Empty partitions have no probe ranges, which avoids empty output chunks.
+  const auto probe_range_count = probe_ranges.size();
+  for (auto probe_range_idx = size_t{0}; probe_range_idx < probe_range_count; ++probe_range_idx) {
+    const auto& probe_range = probe_ranges[probe_range_idx];
+    const auto partition_idx = probe_range.partition_idx;
+    const auto range_begin = probe_range.begin;
+    const auto range_end = probe_range.end;
     const auto& partition = probe_radix_container[partition_idx];
     const auto& elements = partition.elements;
-    const auto elements_count = elements.size();
+    const auto elements_count = range_end - range_begin;
 
-    const auto probe_partition = [&, partition_idx, elements_count]() {
+    const auto probe_partition = [&, probe_range_idx, partition_idx, range_begin, range_end, elements_count]() {
       const auto& null_values = partition.null_values;
 
       RowIDPosList pos_list_build_side_local;
@@ -679,11 +744,11 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
 
         // Simple heuristic to estimate result size: half of the partition's rows will match
         // a more conservative pre-allocation would be the size of the build cluster
-        const size_t expected_output_size = static_cast<size_t>(std::max(10.0, std::ceil(elements.size() / 2)));
+        const size_t expected_output_size = static_cast<size_t>(std::max(10.0, std::ceil(elements_count / 2)));
         pos_list_build_side_local.reserve(static_cast<size_t>(expected_output_size));
         pos_list_probe_side_local.reserve(static_cast<size_t>(expected_output_size));
 
-        for (auto partition_offset = size_t{0}; partition_offset < elements_count; ++partition_offset) {
+        for (auto partition_offset = range_begin; partition_offset < range_end; ++partition_offset) {
           const auto& probe_column_element = elements[partition_offset];
 
           if (mode == JoinMode::Inner && probe_column_element.row_id == NULL_ROW_ID) {
@@ -766,7 +831,7 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
           pos_list_build_side_local.reserve(elements_count);
           pos_list_probe_side_local.reserve(elements_count);
 
-          for (auto partition_offset = size_t{0}; partition_offset < elements_count; ++partition_offset) {
+          for (auto partition_offset = range_begin; partition_offset < range_end; ++partition_offset) {
             const auto& element = elements[partition_offset];
             pos_list_build_side_local.emplace_back(NULL_ROW_ID);
             pos_list_probe_side_local.emplace_back(element.row_id);
@@ -774,8 +839,8 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
         }
       }
 
-      pos_lists_build_side[partition_idx] = std::move(pos_list_build_side_local);
-      pos_lists_probe_side[partition_idx] = std::move(pos_list_probe_side_local);
+      pos_lists_build_side[probe_range_idx] = std::move(pos_list_build_side_local);
+      pos_lists_probe_side[probe_range_idx] = std::move(pos_list_probe_side_local);
     };
 
     if (JoinHash::JOB_SPAWN_THRESHOLD > elements_count) {
@@ -791,24 +856,25 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
 template <typename ProbeColumnType, typename HashedType, JoinMode mode>
 void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_container,
                      const std::vector<std::optional<PosHashTable<HashedType>>>& hash_tables,
-                     std::vector<RowIDPosList>& pos_lists, const Table& build_table, const Table& probe_table,
+                     const std::vector<ProbeRange>& probe_ranges, std::vector<RowIDPosList>& pos_lists,
+                     const Table& build_table, const Table& probe_table,
                      const std::vector<OperatorJoinPredicate>& secondary_join_predicates) {
   std::vector<std::shared_ptr<AbstractTask>> jobs;
 
-  const auto probe_radix_container_count = probe_radix_container.size();
-  jobs.reserve(probe_radix_container_count);
-
-  for (auto partition_idx = size_t{0}; partition_idx < probe_radix_container_count; ++partition_idx) {
-    // Skip empty partitions to avoid empty output chunks
-    if (probe_radix_container[partition_idx].elements.empty()) {
-      continue;
-    }
+  const auto probe_range_count = probe_ranges.size();
+  jobs.reserve(probe_range_count);
 
+  // Empty partitions have no probe ranges, which avoids empty output chunks.
+  for (auto probe_range_idx = size_t{0}; probe_range_idx < probe_range_count; ++probe_range_idx) {
+    const auto& probe_range = probe_ranges[probe_range_idx];
+    const auto partition_idx = probe_range.partition_idx;
+    const auto range_begin = probe_range.begin;
+    const auto range_end = probe_range.end;
     const auto& partition = probe_radix_container[partition_idx];
     const auto& elements = partition.elements;
-    const auto elements_count = elements.size();
+    const auto elements_count = range_end - range_begin;
 
-    const auto probe_partition = [&, partition_idx, elements_count]() {
+    const auto probe_partition = [&, probe_range_idx, partition_idx, range_begin, range_end]() {
       // Get information from work queue
       const auto& null_values = partition.null_values;
 
@@ -823,7 +889,7 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
         MultiPredicateJoinEvaluator multi_predicate_join_evaluator(build_table, probe_table, mode,
                                                                    secondary_join_predicates);
 
-        for (auto partition_offset = size_t{0}; partition_offset < elements_count; ++partition_offset) {
+        for (auto partition_offset = range_begin; partition_offset < range_end; ++partition_offset) {
           const auto& probe_column_element = elements[partition_offset];
 
           if constexpr (mode == JoinMode::Semi) {
@@ -874,8 +940,8 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
       } else if constexpr (mode == JoinMode::AntiNullAsFalse) {  // NOLINT - doesn't like `else if`
         // no hash table on other side, but we are in AntiNullAsFalse mode which means all tuples from the probing side
         // get emitted.
-        pos_list_local.reserve(elements.size());
-        for (auto partition_offset = size_t{0}; partition_offset < elements_count; ++partition_offset) {
+        pos_list_local.reserve(range_end - range_begin);
+        for (auto partition_offset = range_begin; partition_offset < range_end; ++partition_offset) {
           auto& probe_column_element = elements[partition_offset];
           pos_list_local.emplace_back(probe_column_element.row_id);
         }
@@ -883,8 +949,8 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
         // no hash table on other side, but we are in AntiNullAsTrue mode which means all tuples from the probing side
         // get emitted. That is, except NULL values, which only get emitted if the build table is empty.
         const auto build_table_is_empty = build_table.row_count() == 0;
-        pos_list_local.reserve(elements_count);
-        for (auto partition_offset = size_t{0}; partition_offset < elements_count; ++partition_offset) {
+        pos_list_local.reserve(range_end - range_begin);
+        for (auto partition_offset = range_begin; partition_offset < range_end; ++partition_offset) {
           auto& probe_column_element = elements[partition_offset];
           // A NULL on the probe side never gets emitted, except when the build table is empty.
           // This is because `NULL NOT IN <empty list>` is actually true
@@ -895,7 +961,7 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
         }
       }
 
-      pos_lists[partition_idx] = std::move(pos_list_local);
+      pos_lists[probe_range_idx] = std::move(pos_list_local);
     };
 
     if (JoinHash::JOB_SPAWN_THRESHOLD > elements_count) {
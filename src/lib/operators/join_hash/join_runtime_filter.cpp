@@ -0,0 +1,120 @@
+#include "join_runtime_filter.hpp"
+
+#include <functional>
+
+#include "operators/join_hash.hpp"
+#include "resolve_type.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+JoinRuntimeFilter::JoinRuntimeFilter(const Table& table, const ColumnID column_id)
+    : _data_type{table.column_data_type(column_id)}, _bloom_filter{table.row_count()} {
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto hash_function = std::hash<ColumnDataType>{};
+    auto min = std::optional<ColumnDataType>{};
+    auto max = std::optional<ColumnDataType>{};
+
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      if (!chunk) {
+        continue;
+      }
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          return;
+        }
+
+        const auto& value = position.value();
+        _bloom_filter.insert(hash_function(value));
+        if (!min || value < *min) {
+          min = value;
+        }
+        if (!max || value > *max) {
+          max = value;
+        }
+      });
+    }
+
+    if (min) {
+      _value_range = std::make_pair(AllTypeVariant{*min}, AllTypeVariant{*max});
+    }
+  });
+}
+
+DataType JoinRuntimeFilter::data_type() const {
+  return _data_type;
+}
+
+const std::optional<std::pair<AllTypeVariant, AllTypeVariant>>& JoinRuntimeFilter::value_range() const {
+  return _value_range;
+}
+
+const BlockedBloomFilter& JoinRuntimeFilter::bloom_filter() const {
+  return _bloom_filter;
+}
+
+std::shared_ptr<RowIDPosList> JoinRuntimeFilter::filter(const AbstractSegment& segment,
+                                                        const std::shared_ptr<RowIDPosList>& matches) const {
+  Assert(segment.data_type() == _data_type, "Runtime filter cannot be applied to column of different data type.");
+  if (!_bloom_filter.is_active() || matches->empty()) {
+    return matches;
+  }
+
+  // All matches stem from the segment's chunk.
+  matches->guarantee_single_chunk();
+  auto filtered_matches = std::make_shared<RowIDPosList>();
+  filtered_matches->reserve(matches->size());
+  filtered_matches->guarantee_single_chunk();
+
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto hash_function = std::hash<ColumnDataType>{};
+    const auto passes = [&](const auto& position) {
+      return !position.is_null() && _bloom_filter.contains(hash_function(position.value()));
+    };
+
+    if (dynamic_cast<const ReferenceSegment*>(&segment)) {
+      // ReferenceSegments cannot be iterated with a position filter. As the join column is usually not the scanned
+      // column, we do not gain much from resolving the matches to the referenced segments and probe all values.
+      auto passing_chunk_offsets = std::vector<bool>(segment.size());
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        passing_chunk_offsets[position.chunk_offset()] = passes(position);
+      });
+
+      for (const auto& row_id : *matches) {
+        if (passing_chunk_offsets[row_id.chunk_offset]) {
+          filtered_matches->emplace_back(row_id);
+        }
+      }
+      return;
+    }
+
+    auto match_iter = matches->cbegin();
+    segment_iterate_filtered<ColumnDataType>(segment, matches, [&](const auto& position) {
+      if (passes(position)) {
+        filtered_matches->emplace_back(*match_iter);
+      }
+      ++match_iter;
+    });
+  });
+
+  _bloom_filter.record_probes(matches->size(), matches->size() - filtered_matches->size());
+  return filtered_matches;
+}
+
+std::shared_ptr<const JoinRuntimeFilter> JoinRuntimeFilterReference::runtime_filter() const {
+  const auto join_operator = join.lock();
+  Assert(join_operator && join_operator->type() == OperatorType::JoinHash,
+         "Runtime filter must reference a JoinHash. PQP is invalid.");
+  return static_cast<const JoinHash&>(*join_operator).runtime_filter(source_side);
+}
+
+}  // namespace hyrise
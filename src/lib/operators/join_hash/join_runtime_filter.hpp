@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "all_type_variant.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+#include "utils/blocked_bloom_filter.hpp"
+
+namespace hyrise {
+
+class AbstractOperator;
+class AbstractSegment;
+class Table;
+
+/**
+ * Runtime filter for sideways information passing. JoinHash creates it from the join column of one input (the source
+ * side) as soon as that input has been executed. Operators below the other input (the filtered side) use it to discard
+ * rows that cannot find a join partner before they reach the join:
+ *   - GetTable prunes chunks whose min/max statistics do not overlap with the value range of the source side.
+ *   - TableScan removes matches whose join key is not contained in the Bloom filter.
+ * This is only correct if rows without join partner are not part of the join result (i.e., for inner and semi joins)
+ * and if the filtered operators have no other consumers. The LQPTranslator ensures both (see
+ * LQPTranslator::translate_node()).
+ *
+ * The source and the filtered column must have the same data type. Thus, values are hashed with their own type.
+ */
+class JoinRuntimeFilter {
+ public:
+  JoinRuntimeFilter(const Table& table, const ColumnID column_id);
+
+  DataType data_type() const;
+
+  // Smallest and largest non-NULL value of the source column. std::nullopt if the source column has no non-NULL values.
+  const std::optional<std::pair<AllTypeVariant, AllTypeVariant>>& value_range() const;
+
+  const BlockedBloomFilter& bloom_filter() const;
+
+  // Removes the positions whose values in `segment` are NULL or not contained in the Bloom filter. `matches` must only
+  // reference the segment's chunk. If the Bloom filter disabled itself because it filtered too few values, `matches`
+  // is returned as is.
+  std::shared_ptr<RowIDPosList> filter(const AbstractSegment& segment,
+                                       const std::shared_ptr<RowIDPosList>& matches) const;
+
+ protected:
+  const DataType _data_type;
+  std::optional<std::pair<AllTypeVariant, AllTypeVariant>> _value_range;
+  BlockedBloomFilter _bloom_filter;
+};
+
+// Reference from an operator on the filtered side to the JoinHash that provides the runtime filter. `column_id` is the
+// filtered column, i.e., the ColumnID in the stored table for GetTable and in the input table for TableScan.
+struct JoinRuntimeFilterReference {
+  // Returns nullptr if the source side of the join has not been executed yet.
+  std::shared_ptr<const JoinRuntimeFilter> runtime_filter() const;
+
+  std::weak_ptr<const AbstractOperator> join;
+  LQPInputSide source_side;
+  ColumnID column_id;
+};
+
+}  // namespace hyrise
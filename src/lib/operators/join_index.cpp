@@ -1,18 +1,20 @@
 #include "join_index.hpp"
 
-#include <map>
+#include <algorithm>
 #include <memory>
-#include <numeric>
-#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "hyrise.hpp"
+#include "join_helper/join_output_writing.hpp"
 #include "join_nested_loop.hpp"
 #include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/index/abstract_chunk_index.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
@@ -98,23 +100,24 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
     _index_input_table = right_input_table();
   }
 
-  _index_matches.resize(_index_input_table->chunk_count());
-  _probe_matches.resize(_probe_input_table->chunk_count());
+  const auto probe_chunk_count = _probe_input_table->chunk_count();
+  const auto index_chunk_count = _index_input_table->chunk_count();
+  _index_matches.resize(index_chunk_count);
+  _probe_matches.resize(probe_chunk_count);
 
   const auto semi_or_anti_join = is_semi_or_anti_join(_mode);
 
-  const auto track_probe_matches = _mode == JoinMode::FullOuter ||
-                                   (_mode == JoinMode::Left && _index_side == IndexSide::Right) ||
-                                   (_mode == JoinMode::Right && _index_side == IndexSide::Left) ||
-                                   (semi_or_anti_join && _index_side == IndexSide::Right);
-  const auto track_index_matches = _mode == JoinMode::FullOuter ||
-                                   (_mode == JoinMode::Left && _index_side == IndexSide::Left) ||
-                                   (_mode == JoinMode::Right && _index_side == IndexSide::Right) ||
-                                   (semi_or_anti_join && _index_side == IndexSide::Left);
-
-  if (track_probe_matches) {
-    const auto chunk_count = _probe_input_table->chunk_count();
-    for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count; ++probe_chunk_id) {
+  _track_probe_matches = _mode == JoinMode::FullOuter ||
+                         (_mode == JoinMode::Left && _index_side == IndexSide::Right) ||
+                         (_mode == JoinMode::Right && _index_side == IndexSide::Left) ||
+                         (semi_or_anti_join && _index_side == IndexSide::Right);
+  _track_index_matches = _mode == JoinMode::FullOuter ||
+                         (_mode == JoinMode::Left && _index_side == IndexSide::Left) ||
+                         (_mode == JoinMode::Right && _index_side == IndexSide::Right) ||
+                         (semi_or_anti_join && _index_side == IndexSide::Left);
+
+  if (_track_probe_matches) {
+    for (ChunkID probe_chunk_id{0}; probe_chunk_id < probe_chunk_count; ++probe_chunk_id) {
       const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
       Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
@@ -122,9 +125,8 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
     }
   }
 
-  if (track_index_matches) {
-    const auto chunk_count = _index_input_table->chunk_count();
-    for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count; ++index_chunk_id) {
+  if (_track_index_matches) {
+    for (ChunkID index_chunk_id{0}; index_chunk_id < index_chunk_count; ++index_chunk_id) {
       const auto chunk = _index_input_table->get_chunk(index_chunk_id);
       Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
@@ -132,128 +134,146 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
     }
   }
 
-  _probe_pos_list = std::make_shared<RowIDPosList>();
-  _index_pos_list = std::make_shared<RowIDPosList>();
-
-  auto pos_list_size_to_reserve =
-      std::max(uint64_t{100}, std::min(_probe_input_table->row_count(), _index_input_table->row_count()));
-
-  _probe_pos_list->reserve(pos_list_size_to_reserve);
-  _index_pos_list->reserve(pos_list_size_to_reserve);
-
   auto& join_index_performance_data = static_cast<PerformanceData&>(*performance_data);
   join_index_performance_data.right_input_is_index_side = _index_side == IndexSide::Right;
 
-  auto secondary_predicate_evaluator = MultiPredicateJoinEvaluator{*_probe_input_table, *_index_input_table, _mode, {}};
-
-  auto index_joining_duration = std::chrono::nanoseconds{0};
-  auto nested_loop_joining_duration = std::chrono::nanoseconds{0};
-  Timer timer;
-  if (_mode == JoinMode::Inner && _index_input_table->type() == TableType::References &&
-      _secondary_predicates.empty()) {  // INNER REFERENCE JOIN
-    // Scan all chunks for index input
-    const auto chunk_count_index_input_table = _index_input_table->chunk_count();
-    for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
-      const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
-      Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  // Look up the indexes of all index side chunks once, before the probe side chunks are joined with them in parallel.
+  const auto index_column_id = _adjusted_primary_predicate.column_ids.second;
+  auto index_chunks = std::vector<IndexChunk>(index_chunk_count);
+  for (ChunkID index_chunk_id{0}; index_chunk_id < index_chunk_count; ++index_chunk_id) {
+    const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
+    Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
+    if (_index_input_table->type() == TableType::References) {
+      // INNER REFERENCE JOIN since only inner joins are supported for a reference table on the index side
       const auto& reference_segment =
-          std::dynamic_pointer_cast<ReferenceSegment>(index_chunk->get_segment(_primary_predicate.column_ids.second));
+          std::dynamic_pointer_cast<ReferenceSegment>(index_chunk->get_segment(index_column_id));
       Assert(reference_segment != nullptr,
              "Non-empty index input table (reference table) has to have only reference segments.");
-      auto index_data_table = reference_segment->referenced_table();
-      const std::vector<ColumnID> index_data_table_column_ids{reference_segment->referenced_column_id()};
       const auto& reference_segment_pos_list = reference_segment->pos_list();
 
-      if (reference_segment_pos_list->references_single_chunk()) {
-        const auto index_data_table_chunk = index_data_table->get_chunk((*reference_segment_pos_list)[0].chunk_id);
+      if (reference_segment_pos_list->references_single_chunk() && !reference_segment_pos_list->empty()) {
+        const auto index_data_table_chunk =
+            reference_segment->referenced_table()->get_chunk((*reference_segment_pos_list)[0].chunk_id);
         Assert(index_data_table_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-        const auto& indexes = index_data_table_chunk->get_indexes(index_data_table_column_ids);
+        const auto& indexes =
+            index_data_table_chunk->get_indexes(std::vector<ColumnID>{reference_segment->referenced_column_id()});
 
         if (!indexes.empty()) {
           // We assume the first index to be efficient for our join
           // as we do not want to spend time on evaluating the best index inside of this join loop
-          const auto& index = indexes.front();
-
-          // Scan all chunks from the probe side input
-          const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
-          for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
-            const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
-            Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-            const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
-            segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
-              _reference_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index,
-                                                       reference_segment_pos_list);
-            });
+          auto& referenced_offsets = index_chunks[index_chunk_id].referenced_offsets;
+          referenced_offsets.reserve(reference_segment_pos_list->size());
+          auto chunk_offset = ChunkOffset{0};
+          for (const auto& referenced_row_id : *reference_segment_pos_list) {
+            referenced_offsets.emplace_back(referenced_row_id.chunk_offset, chunk_offset);
+            ++chunk_offset;
           }
-          index_joining_duration += timer.lap();
-          join_index_performance_data.chunks_scanned_with_index++;
-        } else {
-          _fallback_nested_loop(index_chunk_id, track_probe_matches, track_index_matches, semi_or_anti_join,
-                                secondary_predicate_evaluator);
-          nested_loop_joining_duration += timer.lap();
+          std::sort(referenced_offsets.begin(), referenced_offsets.end());
+          index_chunks[index_chunk_id].index = indexes.front();
         }
-      } else {
-        _fallback_nested_loop(index_chunk_id, track_probe_matches, track_index_matches, semi_or_anti_join,
-                              secondary_predicate_evaluator);
-        nested_loop_joining_duration += timer.lap();
       }
-    }
-  } else {  // DATA JOIN since only inner joins are supported for a reference table on the index side
-    // Scan all chunks for index input
-    const auto chunk_count_index_input_table = _index_input_table->chunk_count();
-    for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
-      const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
-      Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-      const auto& indexes =
-          index_chunk->get_indexes(std::vector<ColumnID>{_adjusted_primary_predicate.column_ids.second});
-
+    } else {  // DATA JOIN
+      const auto& indexes = index_chunk->get_indexes(std::vector<ColumnID>{index_column_id});
       if (!indexes.empty()) {
-        // We assume the first index to be efficient for our join
-        // as we do not want to spend time on evaluating the best index inside of this join loop
-        const auto& index = indexes.front();
-
-        // Scan all chunks from the probe side input
-        const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
-        for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
-          const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
-          Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-          const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
-          segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
-            _data_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index);
-          });
-        }
-        index_joining_duration += timer.lap();
-        join_index_performance_data.chunks_scanned_with_index++;
-      } else {
-        _fallback_nested_loop(index_chunk_id, track_probe_matches, track_index_matches, semi_or_anti_join,
-                              secondary_predicate_evaluator);
-        nested_loop_joining_duration += timer.lap();
+        index_chunks[index_chunk_id].index = indexes.front();
       }
     }
 
-    _append_matches_non_inner(semi_or_anti_join);
+    if (index_chunks[index_chunk_id].index) {
+      join_index_performance_data.chunks_scanned_with_index++;
+    } else {
+      PerformanceWarning("Fallback nested loop used.");
+      join_index_performance_data.chunks_scanned_without_index++;
+    }
   }
 
-  // Write output chunks.
-  auto output_segments = Segments{};
+  // Each job may only write the match flags of its own chunk. If the matches of both sides have to be tracked (full
+  // outer join), a single job joins all chunks.
+  const auto job_per_probe_chunk = !_track_index_matches;
+  const auto job_per_index_chunk = !job_per_probe_chunk && !_track_probe_matches;
+  auto job_count = size_t{1};
+  if (job_per_probe_chunk) {
+    job_count = probe_chunk_count;
+  } else if (job_per_index_chunk) {
+    job_count = index_chunk_count;
+  }
 
-  if (_index_side == IndexSide::Left) {
-    _write_output_segments(output_segments, _index_input_table, _index_pos_list);
-  } else {
-    _write_output_segments(output_segments, _probe_input_table, _probe_pos_list);
+  auto job_outputs = std::vector<JobOutput>(job_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      auto& job_output = job_outputs[job_id];
+      auto secondary_predicate_evaluator =
+          MultiPredicateJoinEvaluator{*_probe_input_table, *_index_input_table, _mode, {}};
+
+      const auto job_chunk_id = ChunkID{static_cast<ChunkID::base_type>(job_id)};
+      const auto probe_chunk_begin = job_per_probe_chunk ? job_chunk_id : ChunkID{0};
+      const auto probe_chunk_end = job_per_probe_chunk ? ChunkID{job_chunk_id + 1} : probe_chunk_count;
+      const auto index_chunk_begin = job_per_index_chunk ? job_chunk_id : ChunkID{0};
+      const auto index_chunk_end = job_per_index_chunk ? ChunkID{job_chunk_id + 1} : index_chunk_count;
+
+      for (auto index_chunk_id = index_chunk_begin; index_chunk_id < index_chunk_end; ++index_chunk_id) {
+        for (auto probe_chunk_id = probe_chunk_begin; probe_chunk_id < probe_chunk_end; ++probe_chunk_id) {
+          _join_chunks(probe_chunk_id, index_chunk_id, index_chunks[index_chunk_id], job_output,
+                       secondary_predicate_evaluator);
+        }
+      }
+    }));
   }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
+  auto index_joining_duration = std::chrono::nanoseconds{0};
+  auto nested_loop_joining_duration = std::chrono::nanoseconds{0};
+  for (const auto& job_output : job_outputs) {
+    index_joining_duration += job_output.index_joining_duration;
+    nested_loop_joining_duration += job_output.nested_loop_joining_duration;
+  }
+
+  // Write output chunks. Each job's matches form one partition. Unmatched rows of outer joins and the rows emitted by
+  // semi/anti joins form an additional partition.
+  auto timer = Timer{};
+  auto probe_pos_lists = std::vector<RowIDPosList>{};
+  auto index_pos_lists = std::vector<RowIDPosList>{};
+  probe_pos_lists.reserve(job_count + 1);
+  index_pos_lists.reserve(job_count + 1);
   if (!semi_or_anti_join) {
-    if (_index_side == IndexSide::Left) {
-      _write_output_segments(output_segments, _probe_input_table, _probe_pos_list);
-    } else {
-      _write_output_segments(output_segments, _index_input_table, _index_pos_list);
+    for (auto& job_output : job_outputs) {
+      probe_pos_lists.emplace_back(std::move(job_output.probe_pos_list));
+      index_pos_lists.emplace_back(std::move(job_output.index_pos_list));
     }
   }
+  job_outputs.clear();
+
+  if (_mode != JoinMode::Inner) {
+    probe_pos_lists.emplace_back();
+    index_pos_lists.emplace_back();
+    _append_matches_non_inner(probe_pos_lists.back(), index_pos_lists.back());
+  }
+
+  auto& left_pos_lists = _index_side == IndexSide::Left ? index_pos_lists : probe_pos_lists;
+  auto& right_pos_lists = _index_side == IndexSide::Left ? probe_pos_lists : index_pos_lists;
+  const auto create_left_side_pos_lists_by_segment = left_input_table()->type() == TableType::References;
+  const auto create_right_side_pos_lists_by_segment = right_input_table()->type() == TableType::References;
+
+  // An index join's probe side is often small (e.g., a few rows selected by a predicate) and split into many chunks,
+  // which leads to many small partitions. Similar to the hash join, these are merged.
+  constexpr auto ALLOW_PARTITION_MERGE = true;
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  if (semi_or_anti_join) {
+    // Only the columns of the left input are part of the output. write_output_chunks() expects them as its right
+    // side for OutputColumnOrder::RightOnly.
+    output_chunks = write_output_chunks(right_pos_lists, left_pos_lists, right_input_table(), left_input_table(), false,
+                                        create_left_side_pos_lists_by_segment, OutputColumnOrder::RightOnly,
+                                        ALLOW_PARTITION_MERGE);
+  } else {
+    output_chunks = write_output_chunks(left_pos_lists, right_pos_lists, left_input_table(), right_input_table(),
+                                        create_left_side_pos_lists_by_segment,
+                                        create_right_side_pos_lists_by_segment,
+                                        OutputColumnOrder::LeftFirstRightSecond, ALLOW_PARTITION_MERGE);
+  }
+
   join_index_performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer.lap());
   join_index_performance_data.set_step_runtime(OperatorSteps::IndexJoining, index_joining_duration);
   join_index_performance_data.set_step_runtime(OperatorSteps::NestedLoopJoining, nested_loop_joining_duration);
@@ -267,149 +287,149 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
                        " chunks processed using an index.");
   }
 
-  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
-  if (output_segments.at(0)->size() > 0) {
-    chunks.emplace_back(std::make_shared<Chunk>(std::move(output_segments)));
+  return _build_output_table(std::move(output_chunks));
+}
+
+void JoinIndex::_join_chunks(const ChunkID probe_chunk_id, const ChunkID index_chunk_id, const IndexChunk& index_chunk,
+                             JobOutput& job_output, MultiPredicateJoinEvaluator& secondary_predicate_evaluator) {
+  auto timer = Timer{};
+  if (!index_chunk.index) {
+    _fallback_nested_loop(probe_chunk_id, index_chunk_id, job_output, secondary_predicate_evaluator);
+    job_output.nested_loop_joining_duration += timer.lap();
+    return;
   }
-  return _build_output_table(std::move(chunks));
+
+  const auto probe_chunk = _probe_input_table->get_chunk(probe_chunk_id);
+  Assert(probe_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+  const auto& probe_segment = *probe_chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+  _join_segment_using_index(probe_segment, probe_chunk_id, index_chunk_id, index_chunk, job_output);
+  job_output.index_joining_duration += timer.lap();
 }
 
-void JoinIndex::_fallback_nested_loop(const ChunkID index_chunk_id, const bool track_probe_matches,
-                                      const bool track_index_matches, const bool is_semi_or_anti_join,
+void JoinIndex::_fallback_nested_loop(const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
+                                      JobOutput& job_output,
                                       MultiPredicateJoinEvaluator& secondary_predicate_evaluator) {
-  PerformanceWarning("Fallback nested loop used.");
-  auto& join_index_performance_data = static_cast<PerformanceData&>(*performance_data);
-
   const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
   Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  const auto probe_chunk = _probe_input_table->get_chunk(probe_chunk_id);
+  Assert(probe_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
   const auto& index_segment = index_chunk->get_segment(_adjusted_primary_predicate.column_ids.second);
-  const auto& index_pos_list_size_pre_fallback = _index_pos_list->size();
-
-  const auto chunk_count = _probe_input_table->chunk_count();
-  for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count; ++probe_chunk_id) {
-    const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
-    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-    const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
-    JoinNestedLoop::JoinParams params{*_probe_pos_list,
-                                      *_index_pos_list,
-                                      _probe_matches[probe_chunk_id],
-                                      _index_matches[index_chunk_id],
-                                      track_probe_matches,
-                                      track_index_matches,
-                                      _mode,
-                                      _adjusted_primary_predicate.predicate_condition,
-                                      secondary_predicate_evaluator,
-                                      !is_semi_or_anti_join};
-    JoinNestedLoop::_join_two_untyped_segments(*probe_segment, *index_segment, probe_chunk_id, index_chunk_id, params);
-  }
-  const auto& index_pos_list_size_post_fallback = _index_pos_list->size();
-  const auto& count_index_positions = index_pos_list_size_post_fallback - index_pos_list_size_pre_fallback;
-  std::fill_n(std::back_inserter(_index_pos_dereferenced), count_index_positions, false);
-  join_index_performance_data.chunks_scanned_without_index++;
+  const auto& probe_segment = probe_chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+  JoinNestedLoop::JoinParams params{job_output.probe_pos_list,
+                                    job_output.index_pos_list,
+                                    _probe_matches[probe_chunk_id],
+                                    _index_matches[index_chunk_id],
+                                    _track_probe_matches,
+                                    _track_index_matches,
+                                    _mode,
+                                    _adjusted_primary_predicate.predicate_condition,
+                                    secondary_predicate_evaluator,
+                                    !is_semi_or_anti_join(_mode)};
+  JoinNestedLoop::_join_two_untyped_segments(*probe_segment, *index_segment, probe_chunk_id, index_chunk_id, params);
 }
 
-// join loop that joins two segments of two columns using an iterator for the probe side,
-// and an index for the index side
-template <typename ProbeIterator>
-void JoinIndex::_data_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
-                                                    const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-                                                    const std::shared_ptr<AbstractChunkIndex>& index) {
-  for (; probe_iter != probe_end; ++probe_iter) {
-    const auto probe_side_position = *probe_iter;
-    const auto index_ranges = _index_ranges_for_value(probe_side_position, index);
-    for (const auto& [index_begin, index_end] : index_ranges) {
-      _append_matches(index_begin, index_end, probe_side_position.chunk_offset(), probe_chunk_id, index_chunk_id);
-    }
+// join loop that joins a probe side segment with an index side chunk using the chunk's index
+void JoinIndex::_join_segment_using_index(const AbstractSegment& probe_segment, const ChunkID probe_chunk_id,
+                                          const ChunkID index_chunk_id, const IndexChunk& index_chunk,
+                                          JobOutput& job_output) {
+  const auto& index = *index_chunk.index;
+
+  // For dictionary segments, the index ranges only depend on the ValueID. Thus, they are looked up once per distinct
+  // value of the segment (and once for NULL) and reused for all further rows with that value.
+  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&probe_segment)) {
+    const auto null_value_id = dictionary_segment->null_value_id();
+    auto index_ranges_by_value_id = std::vector<std::vector<IndexRange>>(null_value_id + 1);
+    auto value_id_looked_up = std::vector<bool>(null_value_id + 1);
+
+    const auto attribute_vector_iterable = create_iterable_from_attribute_vector(*dictionary_segment);
+    attribute_vector_iterable.with_iterators([&](auto probe_iter, const auto probe_end) {
+      for (; probe_iter != probe_end; ++probe_iter) {
+        const auto probe_side_position = *probe_iter;
+        const auto value_id = probe_side_position.value();
+        if (!value_id_looked_up[value_id]) {
+          const auto probe_value =
+              value_id == null_value_id ? NULL_VALUE : dictionary_segment->value_of_value_id(value_id);
+          index_ranges_by_value_id[value_id] = _index_ranges_for_value(probe_value, index);
+          value_id_looked_up[value_id] = true;
+        }
+        _append_matches(index_ranges_by_value_id[value_id], probe_side_position.chunk_offset(), probe_chunk_id,
+                        index_chunk_id, index_chunk, job_output);
+      }
+    });
+    return;
   }
-}
 
-template <typename ProbeIterator>
-void JoinIndex::_reference_join_two_segments_using_index(
-    ProbeIterator probe_iter, ProbeIterator probe_end, const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-    const std::shared_ptr<AbstractChunkIndex>& index,
-    const std::shared_ptr<const AbstractPosList>& reference_segment_pos_list) {
-  for (; probe_iter != probe_end; ++probe_iter) {
-    RowIDPosList index_scan_pos_list;
-    const auto probe_side_position = *probe_iter;
-    const auto index_ranges = _index_ranges_for_value(probe_side_position, index);
-    for (const auto& [index_begin, index_end] : index_ranges) {
-      std::transform(index_begin, index_end, std::back_inserter(index_scan_pos_list),
-                     [index_chunk_id](ChunkOffset index_chunk_offset) {
-                       return RowID{index_chunk_id, index_chunk_offset};
-                     });
+  segment_with_iterators(probe_segment, [&](auto probe_iter, const auto probe_end) {
+    for (; probe_iter != probe_end; ++probe_iter) {
+      const auto probe_side_position = *probe_iter;
+      const auto probe_value =
+          probe_side_position.is_null() ? NULL_VALUE : AllTypeVariant{probe_side_position.value()};
+      _append_matches(_index_ranges_for_value(probe_value, index), probe_side_position.chunk_offset(), probe_chunk_id,
+                      index_chunk_id, index_chunk, job_output);
     }
-
-    RowIDPosList mutable_ref_seg_pos_list(reference_segment_pos_list->size());
-    std::copy(reference_segment_pos_list->begin(), reference_segment_pos_list->end(), mutable_ref_seg_pos_list.begin());
-    std::sort(mutable_ref_seg_pos_list.begin(), mutable_ref_seg_pos_list.end());
-    std::sort(index_scan_pos_list.begin(), index_scan_pos_list.end());
-
-    RowIDPosList index_table_matches{};
-    std::set_intersection(mutable_ref_seg_pos_list.begin(), mutable_ref_seg_pos_list.end(), index_scan_pos_list.begin(),
-                          index_scan_pos_list.end(), std::back_inserter(index_table_matches));
-    _append_matches_dereferenced(probe_chunk_id, probe_side_position.chunk_offset(), index_table_matches);
-  }
+  });
 }
 
-template <typename SegmentPosition>
-std::vector<IndexRange> JoinIndex::_index_ranges_for_value(const SegmentPosition probe_side_position,
-                                                           const std::shared_ptr<AbstractChunkIndex>& index) const {
+std::vector<IndexRange> JoinIndex::_index_ranges_for_value(const AllTypeVariant& probe_value,
+                                                           const AbstractChunkIndex& index) const {
   std::vector<IndexRange> index_ranges{};
   index_ranges.reserve(2);
 
+  const auto probe_value_is_null = variant_is_null(probe_value);
+
   // AntiNullAsTrue is the only join mode in which comparisons with null-values are evaluated as "true".
   // If the probe side value is null or at least one null value exists in the indexed join segment, the probe value
   // has a match.
   if (_mode == JoinMode::AntiNullAsTrue) {
-    const auto indexed_null_values = index->null_cbegin() != index->null_cend();
-    if (probe_side_position.is_null() || indexed_null_values) {
-      index_ranges.emplace_back(index->cbegin(), index->cend());
-      index_ranges.emplace_back(index->null_cbegin(), index->null_cend());
+    const auto indexed_null_values = index.null_cbegin() != index.null_cend();
+    if (probe_value_is_null || indexed_null_values) {
+      index_ranges.emplace_back(index.cbegin(), index.cend());
+      index_ranges.emplace_back(index.null_cbegin(), index.null_cend());
       return index_ranges;
     }
   }
 
-  if (!probe_side_position.is_null()) {
+  if (!probe_value_is_null) {
     auto range_begin = AbstractChunkIndex::Iterator{};
     auto range_end = AbstractChunkIndex::Iterator{};
 
     switch (_adjusted_primary_predicate.predicate_condition) {
       case PredicateCondition::Equals: {
-        range_begin = index->lower_bound({probe_side_position.value()});
-        range_end = index->upper_bound({probe_side_position.value()});
+        range_begin = index.lower_bound({probe_value});
+        range_end = index.upper_bound({probe_value});
         break;
       }
       case PredicateCondition::NotEquals: {
         // first, get all values less than the search value
-        range_begin = index->cbegin();
-        range_end = index->lower_bound({probe_side_position.value()});
+        range_begin = index.cbegin();
+        range_end = index.lower_bound({probe_value});
         index_ranges.emplace_back(range_begin, range_end);
 
         // set range for second half to all values greater than the search value
-        range_begin = index->upper_bound({probe_side_position.value()});
-        range_end = index->cend();
+        range_begin = index.upper_bound({probe_value});
+        range_end = index.cend();
         break;
       }
       case PredicateCondition::GreaterThan: {
-        range_begin = index->cbegin();
-        range_end = index->lower_bound({probe_side_position.value()});
+        range_begin = index.cbegin();
+        range_end = index.lower_bound({probe_value});
         break;
       }
       case PredicateCondition::GreaterThanEquals: {
-        range_begin = index->cbegin();
-        range_end = index->upper_bound({probe_side_position.value()});
+        range_begin = index.cbegin();
+        range_end = index.upper_bound({probe_value});
         break;
       }
       case PredicateCondition::LessThan: {
-        range_begin = index->upper_bound({probe_side_position.value()});
-        range_end = index->cend();
+        range_begin = index.upper_bound({probe_value});
+        range_end = index.cend();
         break;
       }
       case PredicateCondition::LessThanEquals: {
-        range_begin = index->lower_bound({probe_side_position.value()});
-        range_end = index->cend();
+        range_begin = index.lower_bound({probe_value});
+        range_end = index.cend();
         break;
       }
       default: {
@@ -421,52 +441,61 @@ std::vector<IndexRange> JoinIndex::_index_ranges_for_value(const SegmentPosition
   return index_ranges;
 }
 
-void JoinIndex::_append_matches(const AbstractChunkIndex::Iterator& range_begin,
-                                const AbstractChunkIndex::Iterator& range_end, const ChunkOffset probe_chunk_offset,
-                                const ChunkID probe_chunk_id, const ChunkID index_chunk_id) {
-  const auto num_index_matches = std::distance(range_begin, range_end);
+void JoinIndex::_append_matches(const std::vector<IndexRange>& index_ranges, const ChunkOffset probe_chunk_offset,
+                                const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
+                                const IndexChunk& index_chunk, JobOutput& job_output) {
+  const auto semi_or_anti_join = is_semi_or_anti_join(_mode);
+  const auto is_reference_join = _index_input_table->type() == TableType::References;
 
-  if (num_index_matches == 0) {
-    return;
-  }
+  for (const auto& [range_begin, range_end] : index_ranges) {
+    const auto num_index_matches = std::distance(range_begin, range_end);
+    if (num_index_matches == 0) {
+      continue;
+    }
 
-  const auto semi_or_anti_join = is_semi_or_anti_join(_mode);
+    // Remember the matches for non-inner joins
+    if (_track_probe_matches) {
+      _probe_matches[probe_chunk_id][probe_chunk_offset] = true;
+    }
 
-  // Remember the matches for non-inner joins
-  if (((semi_or_anti_join || _mode == JoinMode::Left) && _index_side == IndexSide::Right) ||
-      (_mode == JoinMode::Right && _index_side == IndexSide::Left) || _mode == JoinMode::FullOuter) {
-    _probe_matches[probe_chunk_id][probe_chunk_offset] = true;
-  }
+    if (_track_index_matches) {
+      std::for_each(range_begin, range_end, [this, index_chunk_id](ChunkOffset index_chunk_offset) {
+        _index_matches[index_chunk_id][index_chunk_offset] = true;
+      });
+    }
+
+    if (semi_or_anti_join) {
+      continue;
+    }
+
+    if (is_reference_join) {
+      // The index covers the whole referenced chunk. Only rows that the reference segment contains are matches, each
+      // as often as it is referenced.
+      const auto& referenced_offsets = index_chunk.referenced_offsets;
+      std::for_each(range_begin, range_end, [&](ChunkOffset referenced_chunk_offset) {
+        auto offset_iter = std::lower_bound(referenced_offsets.begin(), referenced_offsets.end(),
+                                            std::pair{referenced_chunk_offset, ChunkOffset{0}});
+        for (; offset_iter != referenced_offsets.end() && offset_iter->first == referenced_chunk_offset;
+             ++offset_iter) {
+          job_output.probe_pos_list.emplace_back(probe_chunk_id, probe_chunk_offset);
+          job_output.index_pos_list.emplace_back(index_chunk_id, offset_iter->second);
+        }
+      });
+      continue;
+    }
 
-  if (!semi_or_anti_join) {
     // we replicate the probe side value for each index side value
-    std::fill_n(std::back_inserter(*_probe_pos_list), num_index_matches, RowID{probe_chunk_id, probe_chunk_offset});
+    std::fill_n(std::back_inserter(job_output.probe_pos_list), num_index_matches,
+                RowID{probe_chunk_id, probe_chunk_offset});
 
-    std::transform(range_begin, range_end, std::back_inserter(*_index_pos_list),
+    std::transform(range_begin, range_end, std::back_inserter(job_output.index_pos_list),
                    [index_chunk_id](ChunkOffset index_chunk_offset) {
                      return RowID{index_chunk_id, index_chunk_offset};
                    });
   }
-
-  if ((_mode == JoinMode::Left && _index_side == IndexSide::Left) ||
-      (_mode == JoinMode::Right && _index_side == IndexSide::Right) || _mode == JoinMode::FullOuter ||
-      (semi_or_anti_join && _index_side == IndexSide::Left)) {
-    std::for_each(range_begin, range_end, [this, index_chunk_id](ChunkOffset index_chunk_offset) {
-      _index_matches[index_chunk_id][index_chunk_offset] = true;
-    });
-  }
 }
 
-void JoinIndex::_append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
-                                             const RowIDPosList& index_table_matches) {
-  for (const auto& index_side_row_id : index_table_matches) {
-    _probe_pos_list->emplace_back(probe_chunk_id, probe_chunk_offset);
-    _index_pos_list->emplace_back(index_side_row_id);
-    _index_pos_dereferenced.emplace_back(true);
-  }
-}
-
-void JoinIndex::_append_matches_non_inner(const bool is_semi_or_anti_join) {
+void JoinIndex::_append_matches_non_inner(RowIDPosList& probe_pos_list, RowIDPosList& index_pos_list) const {
   // For Full Outer and Left Join we need to add all unmatched rows for the probe side
   if ((_mode == JoinMode::Left && _index_side == IndexSide::Right) ||
       (_mode == JoinMode::Right && _index_side == IndexSide::Left) || _mode == JoinMode::FullOuter) {
@@ -475,8 +504,8 @@ void JoinIndex::_append_matches_non_inner(const bool is_semi_or_anti_join) {
       for (ChunkOffset chunk_offset{0}; chunk_offset < static_cast<ChunkOffset>(_probe_matches[probe_chunk_id].size());
            ++chunk_offset) {
         if (!_probe_matches[probe_chunk_id][chunk_offset]) {
-          _probe_pos_list->emplace_back(probe_chunk_id, chunk_offset);
-          _index_pos_list->emplace_back(NULL_ROW_ID);
+          probe_pos_list.emplace_back(probe_chunk_id, chunk_offset);
+          index_pos_list.emplace_back(NULL_ROW_ID);
         }
       }
     }
@@ -490,19 +519,16 @@ void JoinIndex::_append_matches_non_inner(const bool is_semi_or_anti_join) {
       for (ChunkOffset chunk_offset{0}; chunk_offset < static_cast<ChunkOffset>(_index_matches[chunk_id].size());
            ++chunk_offset) {
         if (!_index_matches[chunk_id][chunk_offset]) {
-          _index_pos_list->emplace_back(chunk_id, chunk_offset);
-          _probe_pos_list->emplace_back(NULL_ROW_ID);
+          index_pos_list.emplace_back(chunk_id, chunk_offset);
+          probe_pos_list.emplace_back(NULL_ROW_ID);
         }
       }
     }
   }
 
-  _probe_pos_list->shrink_to_fit();
-  _index_pos_list->shrink_to_fit();
-
   // Write PosLists for Semi/Anti Joins, which so far haven't written any results to the PosLists
   // We use `_probe_matches` to determine whether a tuple from the probe side found a match.
-  if (is_semi_or_anti_join) {
+  if (is_semi_or_anti_join(_mode)) {
     const auto invert = _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue;
     if (_index_side == IndexSide::Right) {
       const auto chunk_count = _probe_input_table->chunk_count();
@@ -513,7 +539,7 @@ void JoinIndex::_append_matches_non_inner(const bool is_semi_or_anti_join) {
         const auto chunk_size = chunk->size();
         for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
           if (_probe_matches[chunk_id][chunk_offset] ^ invert) {
-            _probe_pos_list->emplace_back(chunk_id, chunk_offset);
+            probe_pos_list.emplace_back(chunk_id, chunk_offset);
           }
         }
       }
@@ -526,7 +552,7 @@ void JoinIndex::_append_matches_non_inner(const bool is_semi_or_anti_join) {
         const auto chunk_size = chunk->size();
         for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
           if (_index_matches[chunk_id][chunk_offset] ^ invert) {
-            _index_pos_list->emplace_back(chunk_id, chunk_offset);
+            index_pos_list.emplace_back(chunk_id, chunk_offset);
           }
         }
       }
@@ -534,68 +560,7 @@ void JoinIndex::_append_matches_non_inner(const bool is_semi_or_anti_join) {
   }
 }
 
-void JoinIndex::_write_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
-                                       const std::shared_ptr<RowIDPosList>& pos_list) {
-  // Add segments from table to output chunk
-  const auto column_count = input_table->column_count();
-  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-    std::shared_ptr<AbstractSegment> segment;
-
-    if (input_table->type() == TableType::References) {
-      if (input_table->chunk_count() > 0) {
-        auto new_pos_list = std::make_shared<RowIDPosList>();
-
-        ChunkID current_chunk_id{0};
-
-        const auto first_chunk_input_table = input_table->get_chunk(ChunkID{0});
-        Assert(first_chunk_input_table, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-        auto reference_segment =
-            std::static_pointer_cast<const ReferenceSegment>(first_chunk_input_table->get_segment(column_id));
-
-        // de-reference to the correct RowID so the output can be used in a Multi Join
-        for (ChunkOffset pos_list_offset{0}; pos_list_offset < static_cast<ChunkOffset>(pos_list->size());
-             ++pos_list_offset) {
-          const auto& row = (*pos_list)[pos_list_offset];
-          if (row.is_null()) {
-            new_pos_list->push_back(NULL_ROW_ID);
-            continue;
-          }
-          if (pos_list == _index_pos_list && _index_pos_dereferenced[pos_list_offset]) {
-            new_pos_list->push_back(row);
-          } else {
-            if (row.chunk_id != current_chunk_id) {
-              current_chunk_id = row.chunk_id;
-
-              const auto chunk = input_table->get_chunk(current_chunk_id);
-              Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-              reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id));
-            }
-            new_pos_list->push_back((*reference_segment->pos_list())[row.chunk_offset]);
-          }
-        }
-        segment = std::make_shared<ReferenceSegment>(reference_segment->referenced_table(),
-                                                     reference_segment->referenced_column_id(), new_pos_list);
-      } else {
-        // If there are no Chunks in the input_table, we can't deduce the Table that input_table is referencing to.
-        // pos_list will contain only NULL_ROW_IDs anyway, so it doesn't matter which Table the ReferenceSegment that
-        // we output is referencing. HACK, but works fine: we create a dummy table and let the ReferenceSegment ref
-        // it.
-        const auto dummy_table = Table::create_dummy_table(input_table->column_definitions());
-        segment = std::make_shared<ReferenceSegment>(dummy_table, column_id, pos_list);
-      }
-    } else {
-      segment = std::make_shared<ReferenceSegment>(input_table, column_id, pos_list);
-    }
-
-    output_segments.push_back(segment);
-  }
-}
-
 void JoinIndex::_on_cleanup() {
-  _output_table.reset();
-  _probe_pos_list.reset();
-  _index_pos_list.reset();
   _probe_matches.clear();
   _index_matches.clear();
 }
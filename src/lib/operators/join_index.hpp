@@ -1,18 +1,20 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
-#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "abstract_join_operator.hpp"
+#include "all_type_variant.hpp"
 #include "storage/index/abstract_chunk_index.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "types.hpp"
 
 namespace hyrise {
 
+class AbstractSegment;
 class MultiPredicateJoinEvaluator;
 using IndexRange = std::pair<AbstractChunkIndex::Iterator, AbstractChunkIndex::Iterator>;
 
@@ -20,7 +22,15 @@ using IndexRange = std::pair<AbstractChunkIndex::Iterator, AbstractChunkIndex::I
    * This operator joins two tables using one column of each table.
    * A speedup compared to the Nested Loop Join is achieved by avoiding the inner loop, and instead
    * finding the index side values utilizing the index.
-   * 
+   *
+   * The join is executed in parallel. If only the matches of the probe side have to be tracked (or none), there is one
+   * job per probe side chunk. If only the matches of the index side have to be tracked, there is one job per index side
+   * chunk. Full outer joins track both and are executed in a single job. Each job writes its own pair of PosLists,
+   * which are passed as partitions to write_output_chunks().
+   *
+   * For dictionary-encoded probe segments, the index is queried once per distinct value of the segment rather than once
+   * per row.
+   *
    * For index reference joins, only the join JoinMode::Inner is supported. Additionally, if the join segments of the
    * reference table don't provide the guarantee of referencing one single chunk (of the original data table), then the
    * fallback solution (nested join loop) is used. Using the fallback solution does not increment the number of chunks
@@ -61,49 +71,51 @@ class JoinIndex : public AbstractJoinOperator {
       const std::shared_ptr<AbstractOperator>& copied_right_input,
       std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
 
-  void _fallback_nested_loop(const ChunkID index_chunk_id, const bool track_probe_matches,
-                             const bool track_index_matches, const bool is_semi_or_anti_join,
-                             MultiPredicateJoinEvaluator& secondary_predicate_evaluator);
+  // Index of an index side chunk, nullptr if the chunk has no index on the join column. For reference tables, the index
+  // belongs to the single chunk of the data table that the chunk references. `referenced_offsets` then holds pairs of
+  // (referenced chunk offset, chunk offset in the reference table), sorted by the referenced chunk offset, to map
+  // index matches back to rows of the index side table.
+  struct IndexChunk {
+    std::shared_ptr<AbstractChunkIndex> index;
+    std::vector<std::pair<ChunkOffset, ChunkOffset>> referenced_offsets;
+  };
 
-  template <typename ProbeIterator>
-  void _data_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
-                                           const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-                                           const std::shared_ptr<AbstractChunkIndex>& index);
+  // Matches of one join job. Jobs write to separate PosLists so that they do not need to synchronize.
+  struct JobOutput {
+    RowIDPosList probe_pos_list;
+    RowIDPosList index_pos_list;
+    std::chrono::nanoseconds index_joining_duration{0};
+    std::chrono::nanoseconds nested_loop_joining_duration{0};
+  };
 
-  template <typename ProbeIterator>
-  void _reference_join_two_segments_using_index(
-      ProbeIterator probe_iter, ProbeIterator probe_end, const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-      const std::shared_ptr<AbstractChunkIndex>& index,
-      const std::shared_ptr<const AbstractPosList>& reference_segment_pos_list);
+  void _join_chunks(const ChunkID probe_chunk_id, const ChunkID index_chunk_id, const IndexChunk& index_chunk,
+                    JobOutput& job_output, MultiPredicateJoinEvaluator& secondary_predicate_evaluator);
 
-  template <typename SegmentPosition>
-  std::vector<IndexRange> _index_ranges_for_value(const SegmentPosition probe_side_position,
-                                                  const std::shared_ptr<AbstractChunkIndex>& index) const;
+  void _fallback_nested_loop(const ChunkID probe_chunk_id, const ChunkID index_chunk_id, JobOutput& job_output,
+                             MultiPredicateJoinEvaluator& secondary_predicate_evaluator);
 
-  void _append_matches(const AbstractChunkIndex::Iterator& range_begin, const AbstractChunkIndex::Iterator& range_end,
-                       const ChunkOffset probe_chunk_offset, const ChunkID probe_chunk_id,
-                       const ChunkID index_chunk_id);
+  void _join_segment_using_index(const AbstractSegment& probe_segment, const ChunkID probe_chunk_id,
+                                 const ChunkID index_chunk_id, const IndexChunk& index_chunk, JobOutput& job_output);
 
-  void _append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
-                                    const RowIDPosList& index_table_matches);
+  std::vector<IndexRange> _index_ranges_for_value(const AllTypeVariant& probe_value,
+                                                  const AbstractChunkIndex& index) const;
 
-  void _append_matches_non_inner(const bool is_semi_or_anti_join);
+  void _append_matches(const std::vector<IndexRange>& index_ranges, const ChunkOffset probe_chunk_offset,
+                       const ChunkID probe_chunk_id, const ChunkID index_chunk_id, const IndexChunk& index_chunk,
+                       JobOutput& job_output);
 
-  void _write_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
-                              const std::shared_ptr<RowIDPosList>& pos_list);
+  void _append_matches_non_inner(RowIDPosList& probe_pos_list, RowIDPosList& index_pos_list) const;
 
   void _on_cleanup() override;
 
   const IndexSide _index_side;
   OperatorJoinPredicate _adjusted_primary_predicate;
-  std::shared_ptr<Table> _output_table;
 
   std::shared_ptr<const Table> _probe_input_table;
   std::shared_ptr<const Table> _index_input_table;
 
-  std::shared_ptr<RowIDPosList> _probe_pos_list;
-  std::shared_ptr<RowIDPosList> _index_pos_list;
-  std::vector<bool> _index_pos_dereferenced;
+  bool _track_probe_matches{false};
+  bool _track_index_matches{false};
 
   // for left/right/outer joins
   // The outer vector enumerates chunks, the inner enumerates chunk_offsets
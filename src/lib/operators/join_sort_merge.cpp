@@ -1,6 +1,7 @@
 #include "join_sort_merge.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <optional>
 #include <string>
@@ -25,27 +26,37 @@ namespace hyrise {
 
 // TODO(anyone) >> todos and nice-to-haves for the sort-merge join:
 //    - outer not-equal join (outer !=)
-//    - Bloom filters
 
 bool JoinSortMerge::supports(const JoinConfiguration config) {
+  // Semi and anti joins are only supported for equi joins. As for JoinHash, secondary predicates are not supported for
+  // AntiNullAsTrue.
+  if (is_semi_or_anti_join(config.join_mode) &&
+      (config.predicate_condition != PredicateCondition::Equals ||
+       (config.join_mode == JoinMode::AntiNullAsTrue && config.secondary_predicates))) {
+    return false;
+  }
+
   return (config.predicate_condition != PredicateCondition::NotEquals || config.join_mode == JoinMode::Inner) &&
-         config.left_data_type == config.right_data_type && config.join_mode != JoinMode::Semi &&
-         config.join_mode != JoinMode::AntiNullAsTrue && config.join_mode != JoinMode::AntiNullAsFalse;
+         config.left_data_type == config.right_data_type;
 }
 
 // The sort merge join performs a join on two input tables on specific join columns. For usage notes, see the
 // join_sort_merge.hpp. This is how the join works:
 // -> The input tables are materialized and clustered into a specified number of clusters.
 //    /utils/radix_cluster_sort.hpp for more info on the clustering phase.
+//    For equi joins, the values of the left input can be probed against a Bloom filter on the right input's values
+//    during materialization, which removes rows without a join partner early (see _bloom_filter_mode()).
 // -> The join is performed per cluster. For the joining phase, runs of entries with the same value are identified
-//    and handled at once. If a join-match is identified, the corresponding row_ids are noted for the output.
+//    and handled at once. If a join-match is identified, the corresponding row_ids are noted for the output. Semi and
+//    anti joins only emit row ids of the left input and stop searching for a partner of a left row once they found
+//    one.
 // -> Using the join result, the output table is built using pos lists referencing the original tables.
 JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator>& left,
                              const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                              const OperatorJoinPredicate& primary_predicate,
                              const std::vector<OperatorJoinPredicate>& secondary_predicates)
     : AbstractJoinOperator(OperatorType::JoinSortMerge, left, right, mode, primary_predicate, secondary_predicates,
-                           std::make_unique<OperatorPerformanceData<OperatorSteps>>()) {}
+                           std::make_unique<PerformanceData>()) {}
 
 std::shared_ptr<AbstractOperator> JoinSortMerge::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
@@ -78,7 +89,7 @@ std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
     _impl = std::make_unique<JoinSortMergeImpl<ColumnDataType>>(
         *this, left_input_table_ptr, right_input_table_ptr, _primary_predicate.column_ids.first,
         _primary_predicate.column_ids.second, _primary_predicate.predicate_condition, _mode, _secondary_predicates,
-        dynamic_cast<OperatorPerformanceData<JoinSortMerge::OperatorSteps>&>(*performance_data));
+        dynamic_cast<JoinSortMerge::PerformanceData&>(*performance_data));
   });
 
   return _impl->_on_execute();
@@ -100,7 +111,7 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
                     const std::shared_ptr<const Table>& right_input_table, ColumnID left_column_id,
                     ColumnID right_column_id, const PredicateCondition op, JoinMode mode,
                     const std::vector<OperatorJoinPredicate>& secondary_join_predicates,
-                    OperatorPerformanceData<JoinSortMerge::OperatorSteps>& performance_data)
+                    JoinSortMerge::PerformanceData& performance_data)
       : _sort_merge_join{sort_merge_join},
         _left_input_table{left_input_table},
         _right_input_table{right_input_table},
@@ -120,16 +131,20 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
   JoinSortMerge& _sort_merge_join;
   const std::shared_ptr<const Table> _left_input_table, _right_input_table;
 
-  OperatorPerformanceData<JoinSortMerge::OperatorSteps>& _performance;
+  JoinSortMerge::PerformanceData& _performance;
 
   // Contains the materialized sorted input tables
   MaterializedSegmentList<T> _sorted_left_table;
   MaterializedSegmentList<T> _sorted_right_table;
 
-  // Contains the null value row ids if a join column is an outer join column.
+  // Contains the null value row ids if a join column is an outer join column or the left column of an anti join. For
+  // AntiNullAsTrue, the null value row ids of the right join column are also collected.
   RowIDPosList _null_rows_left;
   RowIDPosList _null_rows_right;
 
+  // Contains the row ids of the left input that were removed by the Bloom filter in anti joins.
+  RowIDPosList _filtered_rows_left;
+
   const ColumnID _primary_left_column_id;
   const ColumnID _primary_right_column_id;
 
@@ -245,10 +260,17 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
     switch (_primary_predicate_condition) {
       case PredicateCondition::Equals:
         if (compare_result == CompareResult::Equal) {
-          _emit_qualified_combinations(cluster_id, left_run, right_run, multi_predicate_join_evaluator);
+          if (is_semi_or_anti_join(_mode)) {
+            _emit_semi_anti_rows(cluster_id, left_run, right_run, multi_predicate_join_evaluator);
+          } else {
+            _emit_qualified_combinations(cluster_id, left_run, right_run, multi_predicate_join_evaluator);
+          }
         } else if (compare_result == CompareResult::Less) {
           if (_mode == JoinMode::Left || _mode == JoinMode::FullOuter) {
             _emit_right_primary_null_combinations(cluster_id, left_run);
+          } else if (_mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue) {
+            // The left run has no join partner.
+            _emit_left_rows(cluster_id, left_run);
           }
         } else if (compare_result == CompareResult::Greater) {
           if (_mode == JoinMode::Right || _mode == JoinMode::FullOuter) {
@@ -463,6 +485,42 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
     }
   }
 
+  // Only for semi and anti joins. Emits the row ids of the left run that have a join partner in the right run (semi) or
+  // that do not have one (anti). Both runs have the same value. Without secondary predicates, every left row has a
+  // partner and the right run is not iterated at all. Otherwise, the search for a partner of a left row stops at the
+  // first right row that satisfies all secondary predicates.
+  void _emit_semi_anti_rows(size_t output_cluster, TableRange left_run, TableRange right_run,
+                            std::optional<MultiPredicateJoinEvaluator>& multi_predicate_join_evaluator) {
+    const auto emit_rows_with_partner = _mode == JoinMode::Semi;
+    if (!multi_predicate_join_evaluator) {
+      if (emit_rows_with_partner) {
+        _emit_left_rows(output_cluster, left_run);
+      }
+      return;
+    }
+
+    DebugAssert(right_run.start.cluster == right_run.end.cluster, "Runs are expected to lie within a single cluster.");
+    const auto& right_cluster = _sorted_right_table[right_run.start.cluster];
+    left_run.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
+      auto has_partner = false;
+      for (auto index = right_run.start.index; index < right_run.end.index && !has_partner; ++index) {
+        const auto right_row_id = right_cluster[index].row_id;
+        has_partner = multi_predicate_join_evaluator->satisfies_all_predicates(left_row_id, right_row_id);
+      }
+
+      if (has_partner == emit_rows_with_partner) {
+        _output_pos_lists_left[output_cluster].push_back(left_row_id);
+      }
+    });
+  }
+
+  // Only for semi and anti joins. Emits the row ids of the left table range to the join output.
+  void _emit_left_rows(size_t output_cluster, TableRange left_range) {
+    left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
+      _output_pos_lists_left[output_cluster].push_back(left_row_id);
+    });
+  }
+
   // Emits all combinations of row ids from the left table range and a NULL value on the right side
   // (regarding the primary predicate) to the join output.
   void _emit_right_primary_null_combinations(size_t output_cluster, TableRange left_range) {
@@ -808,9 +866,16 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
       _output_pos_lists_left[cluster_id] = RowIDPosList{};
       _output_pos_lists_right[cluster_id] = RowIDPosList{};
 
-      // Avoid empty jobs for inner equi joins
-      if (_mode == JoinMode::Inner && _primary_predicate_condition == PredicateCondition::Equals) {
-        if (_sorted_left_table[cluster_id].empty() || _sorted_right_table[cluster_id].empty()) {
+      // Avoid empty jobs for inner, semi, and anti equi joins. Anti joins emit the left rows of a cluster even if the
+      // right cluster is empty.
+      if (_primary_predicate_condition == PredicateCondition::Equals) {
+        if ((_mode == JoinMode::Inner || _mode == JoinMode::Semi) &&
+            (_sorted_left_table[cluster_id].empty() || _sorted_right_table[cluster_id].empty())) {
+          continue;
+        }
+
+        if ((_mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue) &&
+            _sorted_left_table[cluster_id].empty()) {
           continue;
         }
       }
@@ -859,27 +924,73 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
     }
   }
 
+  // Determines if and how the left input is filtered with a Bloom filter on the right input's values. Only equi joins
+  // can use the filter. Rows that are filtered out have no join partner, so they are dropped for inner and semi joins
+  // and directly emitted for anti joins. As the filter is built from the right input, we only use it if the right
+  // input is not larger than the left input. If the filter does not remove enough values, it disables itself.
+  BloomFilterMode _bloom_filter_mode() const {
+    if (_primary_predicate_condition != PredicateCondition::Equals ||
+        _right_input_table->row_count() > _left_input_table->row_count()) {
+      return BloomFilterMode::None;
+    }
+
+    switch (_mode) {
+      case JoinMode::Inner:
+      case JoinMode::Semi:
+        return BloomFilterMode::DropFiltered;
+      case JoinMode::AntiNullAsFalse:
+      case JoinMode::AntiNullAsTrue:
+        return BloomFilterMode::CollectFiltered;
+      default:
+        return BloomFilterMode::None;
+    }
+  }
+
  public:
   std::shared_ptr<const Table> _on_execute() override {
     const auto include_null_left = (_mode == JoinMode::Left || _mode == JoinMode::FullOuter);
     const auto include_null_right = (_mode == JoinMode::Right || _mode == JoinMode::FullOuter);
+    const auto is_anti_join = _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue;
     auto radix_clusterer = RadixClusterSort<T>(
         _sort_merge_join.left_input_table(), _sort_merge_join.right_input_table(),
         _sort_merge_join._primary_predicate.column_ids, _primary_predicate_condition == PredicateCondition::Equals,
-        include_null_left, include_null_right, _cluster_count, _performance);
+        include_null_left || is_anti_join, include_null_right || _mode == JoinMode::AntiNullAsTrue,
+        _bloom_filter_mode(), _cluster_count, _performance);
     // Sort and cluster the input tables
     auto sort_output = radix_clusterer.execute();
     _sorted_left_table = std::move(sort_output.clusters_left);
     _sorted_right_table = std::move(sort_output.clusters_right);
     _null_rows_left = std::move(sort_output.null_rows_left);
     _null_rows_right = std::move(sort_output.null_rows_right);
+    _filtered_rows_left = std::move(sort_output.filtered_rows_left);
     _end_of_left_table = _end_of_table(_sorted_left_table);
     _end_of_right_table = _end_of_table(_sorted_right_table);
 
+    // A NULL value in the right join column means that the primary predicate is never FALSE for AntiNullAsTrue, so no
+    // row is emitted (`x NOT IN (..., NULL)` is never TRUE, see JoinHash).
+    if (_mode == JoinMode::AntiNullAsTrue && !_null_rows_right.empty()) {
+      return _sort_merge_join._build_output_table({});
+    }
+
     Timer timer;
 
     _perform_join();
 
+    if (is_anti_join) {
+      // The rows removed by the Bloom filter have no join partner. Rows with a NULL value in the left join column are
+      // emitted for AntiNullAsFalse. For AntiNullAsTrue, they are only emitted if the right input is empty, because
+      // `NULL NOT IN <empty list>` is TRUE.
+      auto unmatched_rows_left = std::move(_filtered_rows_left);
+      if (_mode == JoinMode::AntiNullAsFalse || _right_input_table->row_count() == 0) {
+        unmatched_rows_left.insert(unmatched_rows_left.end(), _null_rows_left.begin(), _null_rows_left.end());
+      }
+
+      if (!unmatched_rows_left.empty()) {
+        _output_pos_lists_left.push_back(std::move(unmatched_rows_left));
+        _output_pos_lists_right.emplace_back();
+      }
+    }
+
     if (include_null_left || include_null_right) {
       auto null_output_left = RowIDPosList();
       auto null_output_right = RowIDPosList();
@@ -916,36 +1027,65 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
     // the hash join, we do not (for now) merge small partitions to keep the sorted chunk guarantees, which could be
     // exploited by subsequent operators.
     constexpr auto ALLOW_PARTITION_MERGE = false;
-    auto output_chunks =
-        write_output_chunks(_output_pos_lists_left, _output_pos_lists_right, _left_input_table, _right_input_table,
-                            create_left_side_pos_lists_by_segment, create_right_side_pos_lists_by_segment,
-                            OutputColumnOrder::LeftFirstRightSecond, ALLOW_PARTITION_MERGE);
+    auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+    if (is_semi_or_anti_join(_mode)) {
+      // Only the columns of the left input are part of the output. write_output_chunks() expects them as its right
+      // side for OutputColumnOrder::RightOnly.
+      auto empty_pos_lists = std::vector<RowIDPosList>(_output_pos_lists_left.size());
+      output_chunks =
+          write_output_chunks(empty_pos_lists, _output_pos_lists_left, _right_input_table, _left_input_table, false,
+                              create_left_side_pos_lists_by_segment, OutputColumnOrder::RightOnly,
+                              ALLOW_PARTITION_MERGE);
+    } else {
+      output_chunks =
+          write_output_chunks(_output_pos_lists_left, _output_pos_lists_right, _left_input_table, _right_input_table,
+                              create_left_side_pos_lists_by_segment, create_right_side_pos_lists_by_segment,
+                              OutputColumnOrder::LeftFirstRightSecond, ALLOW_PARTITION_MERGE);
+    }
 
     const ColumnID left_join_column = _sort_merge_join._primary_predicate.column_ids.first;
     const ColumnID right_join_column = static_cast<ColumnID>(_sort_merge_join.left_input_table()->column_count() +
                                                              _sort_merge_join._primary_predicate.column_ids.second);
 
+    const auto is_equi_join = _sort_merge_join._primary_predicate.predicate_condition == PredicateCondition::Equals;
     for (auto& chunk : output_chunks) {
-      if (_sort_merge_join._primary_predicate.predicate_condition == PredicateCondition::Equals &&
-          _mode == JoinMode::Inner) {
+      if (is_equi_join && _mode == JoinMode::Inner) {
         chunk->finalize();
         // The join columns are sorted in ascending order (ensured by radix_cluster_sort)
         chunk->set_individually_sorted_by({SortColumnDefinition(left_join_column, SortMode::Ascending),
                                            SortColumnDefinition(right_join_column, SortMode::Ascending)});
+      } else if (is_equi_join && _mode == JoinMode::Semi) {
+        chunk->finalize();
+        chunk->set_individually_sorted_by(SortColumnDefinition(left_join_column, SortMode::Ascending));
       }
     }
     _performance.set_step_runtime(OperatorSteps::OutputWriting, timer.lap());
 
     auto result_table = _sort_merge_join._build_output_table(std::move(output_chunks));
 
-    if (_mode != JoinMode::Left && _mode != JoinMode::Right && _mode != JoinMode::FullOuter &&
-        _sort_merge_join._primary_predicate.predicate_condition == PredicateCondition::Equals) {
-      // Table clustering is not defined for columns storing NULL values. Additionally, clustering is not given for
-      // non-equal predicates.
+    // Table clustering is not defined for columns storing NULL values. Additionally, clustering is not given for
+    // non-equal predicates. Anti joins emit rows with NULL values and rows removed by the Bloom filter in a separate
+    // chunk.
+    if (is_equi_join && _mode == JoinMode::Inner) {
       result_table->set_value_clustered_by({left_join_column, right_join_column});
+    } else if (is_equi_join && _mode == JoinMode::Semi) {
+      result_table->set_value_clustered_by({left_join_column});
     }
     return result_table;
   }
 };
 
+void JoinSortMerge::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  if (bloom_filter_probed_value_count > 0) {
+    const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+    const auto filter_rate =
+        static_cast<double>(bloom_filter_filtered_value_count) / static_cast<double>(bloom_filter_probed_value_count);
+    stream << separator << "Bloom filter removed " << bloom_filter_filtered_value_count << " of "
+           << bloom_filter_probed_value_count << " values (" << std::lround(filter_rate * 100.0) << " %)"
+           << (bloom_filter_disabled ? " and was disabled." : ".");
+  }
+}
+
 }  // namespace hyrise
@@ -14,7 +14,12 @@ namespace hyrise {
 
 /**
    * This operator joins two tables using one column of each table by performing radix-partition-sort and a merge join.
-   * The output is a new table with referenced columns for all columns of the two inputs and filtered pos_lists.
+   * The output is a new table with referenced columns for all columns of the two inputs and filtered pos_lists. Semi
+   * and anti joins (only supported for equi joins) output the columns of the left input only.
+   *
+   * For inner, semi, and anti equi joins whose right input is not larger than the left input, the left join column's
+   * values are probed against a Bloom filter on the right join column's values while they are materialized. Rows
+   * without a join partner are thus removed before they are clustered and sorted.
    *
    * As with most operators, we do not guarantee a stable operation with regards to positions -
    * i.e., your previous sorting order might be disturbed:
@@ -42,6 +47,16 @@ class JoinSortMerge : public AbstractJoinOperator {
     OutputWriting
   };
 
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    // Number of left values probed against the Bloom filter and number of values that were filtered out by it (see
+    // BloomFilterMode). A Bloom filter with a poor filter rate is disabled at runtime (see BlockedBloomFilter).
+    size_t bloom_filter_probed_value_count{0};
+    size_t bloom_filter_filtered_value_count{0};
+    bool bloom_filter_disabled{false};
+  };
+
   // Tasks are added to the scheduler in case the number of rows to process is above JOB_SPAWN_THRESHOLD. If not,
   // the task is executed directly. This threshold has been determined by executing a multi-threaded and shuffled TPC-H
   // run (28 cores and 50 clients). With larger system changes (e.g., scheduling), the threshold needs to be
@@ -16,6 +16,7 @@
 #include "storage/segment_iterate.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
+#include "utils/blocked_bloom_filter.hpp"
 
 namespace hyrise {
 
@@ -46,23 +47,28 @@ struct Subsample {
   std::vector<T> samples;
 };
 
-// Materializes a column and sorts it if requested.
+// Materializes a column and sorts it if requested. If a Bloom filter is passed, values that are not contained in it
+// are not materialized. Their row ids are collected instead if _collect_filtered_rows is true.
 template <typename T>
 class ColumnMaterializer {
  public:
-  explicit ColumnMaterializer(bool sort, bool materialize_null) : _sort{sort}, _materialize_null{materialize_null} {}
+  explicit ColumnMaterializer(bool sort, bool materialize_null, bool collect_filtered_rows = false)
+      : _sort{sort}, _materialize_null{materialize_null}, _collect_filtered_rows{collect_filtered_rows} {}
 
  public:
   // For sufficiently large chunks (number of rows > JOB_SPAWN_THRESHOLD), the materialization is parallelized. Returns
-  // the materialized segments and a list of null row ids if _materialize_null is true.
-  std::tuple<MaterializedSegmentList<T>, RowIDPosList, std::vector<T>> materialize(
-      const std::shared_ptr<const Table>& input, const ColumnID column_id) {
+  // the materialized segments, a list of null row ids if _materialize_null is true, the samples, and a list of the row
+  // ids filtered by the Bloom filter if _collect_filtered_rows is true.
+  std::tuple<MaterializedSegmentList<T>, RowIDPosList, std::vector<T>, RowIDPosList> materialize(
+      const std::shared_ptr<const Table>& input, const ColumnID column_id,
+      const BlockedBloomFilter* bloom_filter = nullptr) {
     constexpr auto SAMPLES_PER_CHUNK = ChunkOffset{10};
     const auto chunk_count = input->chunk_count();
 
     auto output = MaterializedSegmentList<T>(chunk_count);
 
     auto null_rows_per_chunk = std::vector<RowIDPosList>(chunk_count);
+    auto filtered_rows_per_chunk = std::vector<RowIDPosList>(chunk_count);
     auto subsamples = std::vector<Subsample<T>>{};
     subsamples.reserve(chunk_count);
 
@@ -77,7 +83,8 @@ class ColumnMaterializer {
 
       auto materialize_job = [&, chunk_id] {
         const auto& segment = input->get_chunk(chunk_id)->get_segment(column_id);
-        output[chunk_id] = _materialize_segment(segment, chunk_id, null_rows_per_chunk[chunk_id], subsamples[chunk_id]);
+        output[chunk_id] = _materialize_segment(segment, chunk_id, bloom_filter, null_rows_per_chunk[chunk_id],
+                                                filtered_rows_per_chunk[chunk_id], subsamples[chunk_id]);
       };
 
       if (chunk_size > JoinSortMerge::JOB_SPAWN_THRESHOLD) {
@@ -99,16 +106,26 @@ class ColumnMaterializer {
     auto null_rows = RowIDPosList{};
     null_rows.reserve(null_row_count);
 
+    auto filtered_row_count = size_t{0};
+    for (const auto& filtered_rows : filtered_rows_per_chunk) {
+      filtered_row_count += filtered_rows.size();
+    }
+    auto filtered_rows = RowIDPosList{};
+    filtered_rows.reserve(filtered_row_count);
+
     for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
       const auto& subsample = subsamples[chunk_id];
       gathered_samples.insert(gathered_samples.end(), subsample.samples.begin(), subsample.samples.end());
 
       const auto& chunk_null_rows = null_rows_per_chunk[chunk_id];
       null_rows.insert(null_rows.end(), chunk_null_rows.begin(), chunk_null_rows.end());
+
+      const auto& chunk_filtered_rows = filtered_rows_per_chunk[chunk_id];
+      filtered_rows.insert(filtered_rows.end(), chunk_filtered_rows.begin(), chunk_filtered_rows.end());
     }
     gathered_samples.shrink_to_fit();
 
-    return {std::move(output), std::move(null_rows), std::move(gathered_samples)};
+    return {std::move(output), std::move(null_rows), std::move(gathered_samples), std::move(filtered_rows)};
   }
 
  private:
@@ -134,21 +151,36 @@ class ColumnMaterializer {
   }
 
   MaterializedSegment<T> _materialize_segment(const std::shared_ptr<AbstractSegment>& segment, const ChunkID chunk_id,
-                                              RowIDPosList& null_rows_output, Subsample<T>& subsample) {
+                                              const BlockedBloomFilter* bloom_filter, RowIDPosList& null_rows_output,
+                                              RowIDPosList& filtered_rows_output, Subsample<T>& subsample) {
     auto output = MaterializedSegment<T>{};
     output.reserve(segment->size());
 
+    // The Bloom filter disables itself if it filters too few values. Thus, we check once per segment if it is active.
+    const auto use_bloom_filter = bloom_filter && bloom_filter->is_active();
+    const auto hash_function = std::hash<T>{};
+    auto filtered_value_count = size_t{0};
+
     segment_iterate<T>(*segment, [&](const auto& position) {
       const auto row_id = RowID{chunk_id, position.chunk_offset()};
       if (position.is_null()) {
         if (_materialize_null) {
           null_rows_output.emplace_back(row_id);
         }
+      } else if (use_bloom_filter && !bloom_filter->contains(hash_function(position.value()))) {
+        ++filtered_value_count;
+        if (_collect_filtered_rows) {
+          filtered_rows_output.emplace_back(row_id);
+        }
       } else {
         output.emplace_back(row_id, position.value());
       }
     });
 
+    if (use_bloom_filter) {
+      bloom_filter->record_probes(output.size() + filtered_value_count, filtered_value_count);
+    }
+
     if (_sort) {
       boost::sort::pdqsort(output.begin(), output.end(),
                            [](const auto& left, const auto& right) { return left.value < right.value; });
@@ -162,6 +194,7 @@ class ColumnMaterializer {
  private:
   bool _sort;
   bool _materialize_null;
+  bool _collect_filtered_rows;
 };
 
 }  // namespace hyrise
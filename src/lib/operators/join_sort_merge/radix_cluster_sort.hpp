@@ -4,6 +4,7 @@
 #include <cstring>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -13,6 +14,7 @@
 #include "column_materializer.hpp"
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "utils/blocked_bloom_filter.hpp"
 #include "utils/timer.hpp"
 
 namespace hyrise {
@@ -24,8 +26,17 @@ struct RadixClusterOutput {
   MaterializedSegmentList<T> clusters_right;
   RowIDPosList null_rows_left;
   RowIDPosList null_rows_right;
+
+  // Rows of the left input that were removed by the Bloom filter. Only collected for BloomFilterMode::CollectFiltered.
+  RowIDPosList filtered_rows_left;
 };
 
+// Determines whether the values of the left input are probed against a Bloom filter that is built from the values of
+// the right input. Values without a potential join partner are removed during materialization, which saves clustering
+// and sorting them. Depending on the join mode, their rows are dropped (e.g., for inner and semi joins) or collected
+// (e.g., for anti joins, where they are part of the result).
+enum class BloomFilterMode : uint8_t { None, DropFiltered, CollectFiltered };
+
 // Performs radix clustering for the sort merge join. The radix clustering algorithm clusters on the basis of the least
 // significant bits of the values because the values there are much more evenly distributed than for the most
 // significant bits. As a result, equal values always get moved to the same cluster and the clusters are sorted in
@@ -33,7 +44,9 @@ struct RadixClusterOutput {
 // equality. In the case of a non-equi-joins however, complete sortedness is required, because join matches exist beyond
 // cluster borders. Therefore, the clustering defaults to a range clustering algorithm for the non-equi-join.
 // General clustering process:
-//  -> Input chunks are materialized and sorted. Every value is stored together with its row id.
+//  -> Input chunks are materialized and sorted. Every value is stored together with its row id. The right input is
+//     materialized first. If requested, its values are inserted into a Bloom filter, which is used to filter the left
+//     input's values during their materialization (see BloomFilterMode).
 //  -> Then, either radix clustering or range clustering is performed.
 //  -> At last, the resulting clusters are sorted.
 //
@@ -49,8 +62,8 @@ class RadixClusterSort {
  public:
   RadixClusterSort(const std::shared_ptr<const Table> left, const std::shared_ptr<const Table> right,
                    const ColumnIDPair& column_ids, bool equi_case, const bool materialize_null_left,
-                   const bool materialize_null_right, size_t cluster_count,
-                   OperatorPerformanceData<JoinSortMerge::OperatorSteps>& performance_data)
+                   const bool materialize_null_right, const BloomFilterMode bloom_filter_mode, size_t cluster_count,
+                   JoinSortMerge::PerformanceData& performance_data)
       : _performance{performance_data},
         _left_input_table{left},
         _right_input_table{right},
@@ -59,7 +72,8 @@ class RadixClusterSort {
         _equi_case{equi_case},
         _cluster_count{cluster_count},
         _materialize_null_left{materialize_null_left},
-        _materialize_null_right{materialize_null_right} {
+        _materialize_null_right{materialize_null_right},
+        _bloom_filter_mode{bloom_filter_mode} {
     DebugAssert(cluster_count > 0, "cluster_count must be > 0");
     DebugAssert((cluster_count & (cluster_count - 1)) == 0, "cluster_count must be a power of two");
     DebugAssert(left, "left input operator is null");
@@ -82,7 +96,7 @@ class RadixClusterSort {
  protected:
   // The ChunkInformation structure is used to gather statistics regarding a chunk's values in order to be able to
   // appropriately reserve space for the clustering output.
-  OperatorPerformanceData<JoinSortMerge::OperatorSteps>& _performance;
+  JoinSortMerge::PerformanceData& _performance;
 
   struct ChunkInformation {
     explicit ChunkInformation(size_t cluster_count) {
@@ -125,6 +139,7 @@ class RadixClusterSort {
 
   bool _materialize_null_left;
   bool _materialize_null_right;
+  BloomFilterMode _bloom_filter_mode;
 
   // Determines the total size of a materialized segment list.
   static size_t _materialized_table_size(const MaterializedSegmentList<T>& table) {
@@ -150,6 +165,30 @@ class RadixClusterSort {
     return output_table;
   }
 
+  // Creates a Bloom filter that contains all values of a materialized table. The values are inserted in parallel.
+  static BlockedBloomFilter _build_bloom_filter(const MaterializedSegmentList<T>& materialized_segments) {
+    auto bloom_filter = BlockedBloomFilter{_materialized_table_size(materialized_segments)};
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (const auto& materialized_segment : materialized_segments) {
+      const auto insert_job = [&] {
+        const auto hash_function = std::hash<T>{};
+        for (const auto& entry : materialized_segment) {
+          bloom_filter.insert(hash_function(entry.value));
+        }
+      };
+
+      if (materialized_segment.size() > JoinSortMerge::JOB_SPAWN_THRESHOLD) {
+        jobs.push_back(std::make_shared<JobTask>(insert_job));
+      } else {
+        insert_job();
+      }
+    }
+
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    return bloom_filter;
+  }
+
   // Clusters a materialized table using a given clustering function that determines the appropriate cluster id for
   // each value.
   //    -> For each chunk, count how many of its values belong in each of the clusters using histograms.
@@ -318,19 +357,33 @@ class RadixClusterSort {
     RadixClusterOutput<T> output;
 
     Timer timer;
-    // Sort the chunks of the input tables in the non-equi cases
-    ColumnMaterializer<T> left_column_materializer(!_equi_case, _materialize_null_left);
-    auto [materialized_left_segments, null_rows_left, samples_left] =
-        left_column_materializer.materialize(_left_input_table, _left_column_id);
-    output.null_rows_left = std::move(null_rows_left);
-    _performance.set_step_runtime(JoinSortMerge::OperatorSteps::LeftSideMaterializing, timer.lap());
-
+    // Sort the chunks of the input tables in the non-equi cases. The right input is materialized first, so that the
+    // Bloom filter for the left input can be built from its materialized values.
     ColumnMaterializer<T> right_column_materializer(!_equi_case, _materialize_null_right);
-    auto [materialized_right_segments, null_rows_right, samples_right] =
+    auto [materialized_right_segments, null_rows_right, samples_right, filtered_rows_right] =
         right_column_materializer.materialize(_right_input_table, _right_column_id);
     output.null_rows_right = std::move(null_rows_right);
     _performance.set_step_runtime(JoinSortMerge::OperatorSteps::RightSideMaterializing, timer.lap());
 
+    auto bloom_filter = std::optional<BlockedBloomFilter>{};
+    if (_bloom_filter_mode != BloomFilterMode::None) {
+      bloom_filter.emplace(_build_bloom_filter(materialized_right_segments));
+    }
+
+    ColumnMaterializer<T> left_column_materializer(!_equi_case, _materialize_null_left,
+                                                   _bloom_filter_mode == BloomFilterMode::CollectFiltered);
+    auto [materialized_left_segments, null_rows_left, samples_left, filtered_rows_left] =
+        left_column_materializer.materialize(_left_input_table, _left_column_id,
+                                             bloom_filter ? &*bloom_filter : nullptr);
+    output.null_rows_left = std::move(null_rows_left);
+    output.filtered_rows_left = std::move(filtered_rows_left);
+    if (bloom_filter) {
+      _performance.bloom_filter_probed_value_count = bloom_filter->probed_value_count();
+      _performance.bloom_filter_filtered_value_count = bloom_filter->filtered_value_count();
+      _performance.bloom_filter_disabled = bloom_filter->block_count() > 0 && !bloom_filter->is_active();
+    }
+    _performance.set_step_runtime(JoinSortMerge::OperatorSteps::LeftSideMaterializing, timer.lap());
+
     // Append right samples to left samples and sort (reserve not necessary when insert can
     // determine the new capacity from the iterator: https://stackoverflow.com/a/35359472/1147726)
     samples_left.insert(samples_left.end(), samples_right.begin(), samples_right.end());
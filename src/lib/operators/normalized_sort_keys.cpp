@@ -0,0 +1,184 @@
+#include "normalized_sort_keys.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "resolve_type.hpp"
+#include "scheduler/job_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+struct ColumnEncoding {
+  ColumnID column_id;
+  SortMode sort_mode;
+  bool nullable;
+
+  // Offset of the column's part in the key, starting with the NULL flag if the column is nullable.
+  size_t offset;
+  size_t value_width;
+
+  // Index in the long strings, only set for string columns.
+  std::optional<size_t> long_strings_idx;
+};
+
+template <typename UnsignedType>
+void write_big_endian(UnsignedType value, uint8_t* output) {
+  for (auto byte_idx = sizeof(UnsignedType); byte_idx > 0; --byte_idx) {
+    output[byte_idx - 1] = static_cast<uint8_t>(value & UnsignedType{0xFF});
+    value >>= 8u;
+  }
+}
+
+template <typename ColumnDataType>
+size_t value_width() {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    return NormalizedSortKeys::STRING_PREFIX_LENGTH + 1;
+  } else {
+    return sizeof(ColumnDataType);
+  }
+}
+
+template <typename ColumnDataType>
+void encode_value(const ColumnDataType& value, uint8_t* output) {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    constexpr auto PREFIX_LENGTH = NormalizedSortKeys::STRING_PREFIX_LENGTH;
+    const auto prefix_length = std::min(value.size(), PREFIX_LENGTH);
+    std::memcpy(output, value.data(), prefix_length);
+    std::memset(output + prefix_length, 0, PREFIX_LENGTH - prefix_length);
+    output[PREFIX_LENGTH] = static_cast<uint8_t>(std::min(value.size(), PREFIX_LENGTH + 1));
+  } else if constexpr (std::is_integral_v<ColumnDataType>) {
+    using UnsignedType = std::make_unsigned_t<ColumnDataType>;
+    constexpr auto SIGN_BIT = UnsignedType{1} << (sizeof(UnsignedType) * 8 - 1);
+    write_big_endian(static_cast<UnsignedType>(static_cast<UnsignedType>(value) ^ SIGN_BIT), output);
+  } else {
+    static_assert(std::is_floating_point_v<ColumnDataType>, "Unexpected data type.");
+    using UnsignedType = std::conditional_t<sizeof(ColumnDataType) == 4, uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = UnsignedType{1} << (sizeof(UnsignedType) * 8 - 1);
+    // -0.0 and 0.0 are equal, but have different bit patterns.
+    auto bits = std::bit_cast<UnsignedType>(value == ColumnDataType{0} ? ColumnDataType{0} : value);
+    bits = (bits & SIGN_BIT) ? static_cast<UnsignedType>(~bits) : static_cast<UnsignedType>(bits | SIGN_BIT);
+    write_big_endian(bits, output);
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+NormalizedSortKeys::NormalizedSortKeys(const std::shared_ptr<const Table>& table,
+                                       const std::vector<SortColumnDefinition>& sort_definitions) {
+  auto column_encodings = std::vector<ColumnEncoding>{};
+  column_encodings.reserve(sort_definitions.size());
+  for (const auto& sort_definition : sort_definitions) {
+    auto column_encoding = ColumnEncoding{sort_definition.column, sort_definition.sort_mode,
+                                          table->column_is_nullable(sort_definition.column), _key_width, 0, {}};
+    resolve_data_type(table->column_data_type(sort_definition.column), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      column_encoding.value_width = value_width<ColumnDataType>();
+    });
+
+    _key_width += column_encoding.value_width + (column_encoding.nullable ? 1 : 0);
+    if (table->column_data_type(sort_definition.column) == DataType::String) {
+      column_encoding.long_strings_idx = _long_strings.size();
+      _long_strings.emplace_back(LongStrings{sort_definition.sort_mode, _key_width, {}});
+    }
+    column_encodings.emplace_back(column_encoding);
+  }
+
+  const auto row_count = table->row_count();
+  const auto chunk_count = table->chunk_count();
+  _keys.resize(row_count * _key_width);
+  _row_ids.resize(row_count);
+  for (auto& long_strings : _long_strings) {
+    long_strings.values_per_chunk.resize(chunk_count);
+  }
+
+  // Rows are numbered in the order of the chunks, so each chunk writes the keys of a known range of rows.
+  auto chunk_row_offsets = std::vector<size_t>(chunk_count);
+  auto chunk_row_offset = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+    chunk_row_offsets[chunk_id] = chunk_row_offset;
+    chunk_row_offset += chunk->size();
+  }
+
+  execute_jobs(chunk_count, [&](const size_t chunk_idx) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_idx);
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto chunk_row_offset = chunk_row_offsets[chunk_id];
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      _row_ids[chunk_row_offset + chunk_offset] = RowID{chunk_id, chunk_offset};
+    }
+
+    for (const auto& column_encoding : column_encodings) {
+      const auto& segment = *chunk->get_segment(column_encoding.column_id);
+      resolve_data_type(table->column_data_type(column_encoding.column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          const auto row = chunk_row_offset + position.chunk_offset();
+          auto* output = _keys.data() + row * _key_width + column_encoding.offset;
+          if (column_encoding.nullable) {
+            // NULLs come first for both sort modes. The value bytes of NULLs stay zero.
+            *output = position.is_null() ? 0 : 1;
+            ++output;
+          }
+
+          if (position.is_null()) {
+            return;
+          }
+
+          const auto& value = position.value();
+          encode_value(value, output);
+          if (column_encoding.sort_mode == SortMode::Descending) {
+            for (auto byte_idx = size_t{0}; byte_idx < column_encoding.value_width; ++byte_idx) {
+              output[byte_idx] = static_cast<uint8_t>(~output[byte_idx]);
+            }
+          }
+
+          if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+            if (value.size() > STRING_PREFIX_LENGTH) {
+              auto& chunk_values = _long_strings[*column_encoding.long_strings_idx].values_per_chunk[chunk_id];
+              if (chunk_values.empty()) {
+                chunk_values.resize(chunk_size);
+              }
+              chunk_values[position.chunk_offset()] = value;
+            }
+          }
+        });
+      });
+    }
+  });
+
+  // Only columns with long strings need to be compared in compare().
+  auto long_strings = std::vector<LongStrings>{};
+  const auto long_strings_count = _long_strings.size();
+  for (auto long_strings_idx = size_t{0}; long_strings_idx < long_strings_count; ++long_strings_idx) {
+    const auto& values_per_chunk = _long_strings[long_strings_idx].values_per_chunk;
+    if (std::any_of(values_per_chunk.cbegin(), values_per_chunk.cend(),
+                    [](const auto& chunk_values) { return !chunk_values.empty(); })) {
+      long_strings.emplace_back(std::move(_long_strings[long_strings_idx]));
+    }
+  }
+  _long_strings = std::move(long_strings);
+}
+
+size_t NormalizedSortKeys::row_count() const {
+  return _row_ids.size();
+}
+
+size_t NormalizedSortKeys::key_width() const {
+  return _key_width;
+}
+
+RowID NormalizedSortKeys::row_id(const size_t row) const {
+  return _row_ids[row];
+}
+
+}  // namespace hyrise
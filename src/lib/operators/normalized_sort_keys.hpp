@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+
+/**
+ * Encodes the values of multiple sort columns into one binary key per row. Comparing two keys with memcmp yields the
+ * order defined by the sort definitions, so rows can be sorted by all columns in a single pass instead of one stable
+ * sort per column. Keys have a fixed width and are stored contiguously. Per sort column, a key contains
+ *   - a NULL flag if the column is nullable: 0 for NULL and 1 otherwise, so NULLs come first for both sort modes (see
+ *     Sort). The value bytes of NULLs are zero.
+ *   - the value bytes in big-endian order:
+ *       - integers with a flipped sign bit,
+ *       - floating-point numbers with a flipped sign bit if positive and all bits flipped if negative, and
+ *       - the first STRING_PREFIX_LENGTH bytes of strings (padded with zeros), followed by one byte for the string
+ *         length, which saturates at STRING_PREFIX_LENGTH + 1.
+ *     For descending sort modes, all value bytes are inverted.
+ *
+ * Strings that are longer than STRING_PREFIX_LENGTH are truncated. When the keys of two rows are equal, compare()
+ * falls back to comparing such strings completely. The keys of all other rows are exact.
+ *
+ * The keys are computed in parallel, one job per chunk. Rows are numbered in the order of the table's chunks. Besides
+ * Sort, the keys can be used by any operator that needs to order or group rows by multiple columns.
+ */
+class NormalizedSortKeys {
+ public:
+  static constexpr auto STRING_PREFIX_LENGTH = size_t{8};
+
+  NormalizedSortKeys(const std::shared_ptr<const Table>& table,
+                     const std::vector<SortColumnDefinition>& sort_definitions);
+
+  size_t row_count() const;
+  size_t key_width() const;
+
+  RowID row_id(const size_t row) const;
+
+  const uint8_t* key(const size_t row) const {
+    return _keys.data() + row * _key_width;
+  }
+
+  // Returns a negative value if row lhs comes before row rhs, a positive value if it comes after rhs, and zero if both
+  // rows have the same sort values.
+  int compare(const size_t lhs, const size_t rhs) const {
+    const auto* lhs_key = key(lhs);
+    const auto* rhs_key = key(rhs);
+
+    // Truncated strings have to be compared before the key bytes of subsequent columns.
+    auto compared_bytes = size_t{0};
+    for (const auto& long_strings : _long_strings) {
+      const auto result =
+          std::memcmp(lhs_key + compared_bytes, rhs_key + compared_bytes, long_strings.key_end - compared_bytes);
+      if (result != 0) {
+        return result;
+      }
+      compared_bytes = long_strings.key_end;
+
+      // Equal prefixes and lengths imply that either both strings or none of them are longer than
+      // STRING_PREFIX_LENGTH.
+      const auto& lhs_row_id = _row_ids[lhs];
+      const auto& lhs_chunk_values = long_strings.values_per_chunk[lhs_row_id.chunk_id];
+      if (lhs_chunk_values.empty() || lhs_chunk_values[lhs_row_id.chunk_offset].empty()) {
+        continue;
+      }
+
+      const auto& rhs_row_id = _row_ids[rhs];
+      const auto string_result = lhs_chunk_values[lhs_row_id.chunk_offset].compare(
+          long_strings.values_per_chunk[rhs_row_id.chunk_id][rhs_row_id.chunk_offset]);
+      if (string_result != 0) {
+        return long_strings.sort_mode == SortMode::Ascending ? string_result : -string_result;
+      }
+    }
+
+    return std::memcmp(lhs_key + compared_bytes, rhs_key + compared_bytes, _key_width - compared_bytes);
+  }
+
+ protected:
+  struct LongStrings {
+    SortMode sort_mode;
+
+    // End of the column's part in the key.
+    size_t key_end;
+
+    // Strings that are longer than STRING_PREFIX_LENGTH per chunk and chunk offset. Long strings are rare, so only
+    // chunks that contain them allocate their entries. Entries of shorter strings or NULLs are empty.
+    std::vector<std::vector<pmr_string>> values_per_chunk;
+  };
+
+  size_t _key_width{0};
+  std::vector<uint8_t> _keys;
+  std::vector<RowID> _row_ids;
+
+  // String sort columns that contain long strings, ordered by sort definitions.
+  std::vector<LongStrings> _long_strings;
+};
+
+}  // namespace hyrise
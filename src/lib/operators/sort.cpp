@@ -1,5 +1,13 @@
 #include "sort.hpp"
 
+#include <numeric>
+#include <sstream>
+
+#include "operators/normalized_sort_keys.hpp"
+#include "scheduler/job_utils.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
 #include "storage/segment_iterate.hpp"
 #include "utils/timer.hpp"
 
@@ -13,109 +21,272 @@ size_t div_ceil(const size_t lhs, const ChunkOffset rhs) {
   return (lhs + rhs - 1u) / rhs;
 }
 
-// Given an unsorted_table and a pos_list that defines the output order, this materializes all columns in the table,
-// creating chunks of output_chunk_size rows at maximum.
-std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<const Table>& unsorted_table,
-                                                       RowIDPosList pos_list, const ChunkOffset output_chunk_size) {
-  // First, we create a new table as the output
-  // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
-  auto output = std::make_shared<Table>(unsorted_table->column_definitions(), TableType::Data, output_chunk_size);
+// Adds jobs that merge the adjacent sorted ranges [left_begin, left_end) and [left_end, right_end) of values into the
+// same range of merge_buffer. The merge is split into parts of about Sort::ROWS_PER_JOB rows: we cut the larger of the
+// two ranges into equally sized pieces and find the matching cut in the other range with a binary search. On ties,
+// values of the left (i.e., earlier) range come first, which keeps the merge stable.
+template <typename T, typename Compare>
+void add_merge_jobs(std::vector<std::function<void()>>& job_functions, std::vector<T>& values,
+                    std::vector<T>& merge_buffer, const size_t left_begin, const size_t left_end,
+                    const size_t right_end, const Compare& compare) {
+  const auto values_begin = values.begin();
+  const auto left_size = left_end - left_begin;
+  const auto right_size = right_end - left_end;
+  const auto part_count = (left_size + right_size + Sort::ROWS_PER_JOB - 1) / Sort::ROWS_PER_JOB;
+
+  // Positions in the left and right range where the parts begin. The last entries mark the ends of the ranges.
+  auto left_cuts = std::vector<size_t>(part_count + 1, left_begin);
+  auto right_cuts = std::vector<size_t>(part_count + 1, left_end);
+  left_cuts.back() = left_end;
+  right_cuts.back() = right_end;
+  for (auto part_idx = size_t{1}; part_idx < part_count; ++part_idx) {
+    if (left_size >= right_size) {
+      // Values of the right range that are equal to the cut value belong to the next part.
+      left_cuts[part_idx] = left_begin + part_idx * left_size / part_count;
+      const auto cut_value = values_begin + left_cuts[part_idx];
+      right_cuts[part_idx] =
+          std::lower_bound(values_begin + left_end, values_begin + right_end, *cut_value, compare) - values_begin;
+    } else {
+      // Values of the left range that are equal to the cut value belong to the current part.
+      right_cuts[part_idx] = left_end + part_idx * right_size / part_count;
+      const auto cut_value = values_begin + right_cuts[part_idx];
+      left_cuts[part_idx] =
+          std::upper_bound(values_begin + left_begin, values_begin + left_end, *cut_value, compare) - values_begin;
+    }
+  }
 
-  // After we created the output table and initialized the column structure, we can start adding values. Because the
-  // values are not sorted by input chunks anymore, we can't process them chunk by chunk. Instead the values are copied
-  // column by column for each output row.
+  for (auto part_idx = size_t{0}; part_idx < part_count; ++part_idx) {
+    const auto left_part_begin = left_cuts[part_idx];
+    const auto left_part_end = left_cuts[part_idx + 1];
+    const auto right_part_begin = right_cuts[part_idx];
+    const auto right_part_end = right_cuts[part_idx + 1];
+    // The part's output begins after all values of the previous parts.
+    const auto output_begin = left_part_begin + (right_part_begin - left_end);
+    job_functions.emplace_back([&values, &merge_buffer, compare, left_part_begin, left_part_end, right_part_begin,
+                                right_part_end, output_begin]() {
+      auto left_it = values.begin() + left_part_begin;
+      const auto left_it_end = values.begin() + left_part_end;
+      auto right_it = values.begin() + right_part_begin;
+      const auto right_it_end = values.begin() + right_part_end;
+      auto output_it = merge_buffer.begin() + output_begin;
+      while (left_it != left_it_end && right_it != right_it_end) {
+        if (compare(*right_it, *left_it)) {
+          *output_it++ = std::move(*right_it++);
+        } else {
+          *output_it++ = std::move(*left_it++);
+        }
+      }
+      output_it = std::move(left_it, left_it_end, output_it);
+      std::move(right_it, right_it_end, output_it);
+    });
+  }
+}
 
-  const auto output_chunk_count = div_ceil(pos_list.size(), output_chunk_size);
-  Assert(pos_list.size() == unsorted_table->row_count(), "Mismatching size of input table and PosList");
+// Merges the adjacent sorted runs of values pairwise until a single sorted run remains. run_bounds contains the begin
+// of each run and the end of the last run.
+template <typename T, typename Compare>
+void merge_sorted_runs(std::vector<T>& values, std::vector<size_t> run_bounds, const Compare& compare) {
+  auto merge_buffer = std::vector<T>(values.size());
+  auto job_functions = std::vector<std::function<void()>>{};
+  while (run_bounds.size() > 2) {
+    job_functions.clear();
+    auto merged_run_bounds = std::vector<size_t>{0};
+    const auto run_count = run_bounds.size() - 1;
+    for (auto run_idx = size_t{0}; run_idx < run_count; run_idx += 2) {
+      const auto left_begin = run_bounds[run_idx];
+      const auto left_end = run_bounds[run_idx + 1];
+      if (run_idx + 1 == run_count) {
+        // Odd number of runs: the last run has no partner and is moved to the buffer.
+        job_functions.emplace_back([&, left_begin, left_end]() {
+          std::move(values.begin() + left_begin, values.begin() + left_end, merge_buffer.begin() + left_begin);
+        });
+        merged_run_bounds.emplace_back(left_end);
+        continue;
+      }
 
-  // Vector of segments for each chunk
-  auto output_segments_by_chunk = std::vector<Segments>{output_chunk_count};
+      const auto right_end = run_bounds[run_idx + 2];
+      add_merge_jobs(job_functions, values, merge_buffer, left_begin, left_end, right_end, compare);
+      merged_run_bounds.emplace_back(right_end);
+    }
+    execute_jobs(job_functions);
 
-  // Materialize column by column, starting a new ValueSegment whenever output_chunk_size is reached
-  const auto input_chunk_count = unsorted_table->chunk_count();
-  const auto output_column_count = unsorted_table->column_count();
-  const auto row_count = unsorted_table->row_count();
-  for (auto column_id = ColumnID{0}; column_id < output_column_count; ++column_id) {
-    const auto column_data_type = output->column_data_type(column_id);
-    const auto column_is_nullable = unsorted_table->column_is_nullable(column_id);
+    std::swap(values, merge_buffer);
+    run_bounds = std::move(merged_run_bounds);
+  }
+}
 
-    resolve_data_type(column_data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
+// Sorts the rows of a table by multiple columns in a single pass, using NormalizedSortKeys. Runs of ROWS_PER_JOB rows
+// are sorted in parallel and merged afterwards. Ties are broken by the row number, which keeps the sort stable.
+RowIDPosList sort_by_normalized_keys(const NormalizedSortKeys& keys) {
+  const auto row_count = keys.row_count();
+  auto rows = std::vector<size_t>(row_count);
+  std::iota(rows.begin(), rows.end(), size_t{0});
+
+  const auto compare = [&keys](const size_t lhs, const size_t rhs) {
+    const auto result = keys.compare(lhs, rhs);
+    return result < 0 || (result == 0 && lhs < rhs);
+  };
+
+  auto run_bounds = std::vector<size_t>{};
+  for (auto run_begin = size_t{0}; run_begin < row_count; run_begin += Sort::ROWS_PER_JOB) {
+    run_bounds.emplace_back(run_begin);
+  }
+  run_bounds.emplace_back(row_count);
+
+  const auto run_count = run_bounds.size() - 1;
+  auto job_functions = std::vector<std::function<void()>>{};
+  job_functions.reserve(run_count);
+  for (auto run_idx = size_t{0}; run_idx < run_count; ++run_idx) {
+    job_functions.emplace_back([&, run_idx]() {
+      std::sort(rows.begin() + run_bounds[run_idx], rows.begin() + run_bounds[run_idx + 1], compare);
+    });
+  }
+  execute_jobs(job_functions);
+  merge_sorted_runs(rows, std::move(run_bounds), compare);
 
-      auto chunk_it = output_segments_by_chunk.begin();
-      auto current_segment_size = size_t{0};
+  auto pos_list = RowIDPosList{};
+  pos_list.reserve(row_count);
+  for (const auto row : rows) {
+    pos_list.emplace_back(keys.row_id(row));
+  }
+  return pos_list;
+}
 
-      auto value_segment_value_vector = pmr_vector<ColumnDataType>{};
-      auto value_segment_null_vector = pmr_vector<bool>{};
+// Adds a value to a bounded heap that keeps the k values that come first according to compare. The heap's front is the
+// value that comes last, i.e., the value that is replaced next.
+template <typename T, typename Compare>
+void add_to_bounded_heap(std::vector<T>& heap, T value, const size_t k, const Compare& compare) {
+  if (heap.size() < k) {
+    heap.emplace_back(std::move(value));
+    std::push_heap(heap.begin(), heap.end(), compare);
+  } else if (compare(value, heap.front())) {
+    std::pop_heap(heap.begin(), heap.end(), compare);
+    heap.back() = std::move(value);
+    std::push_heap(heap.begin(), heap.end(), compare);
+  }
+}
 
-      {
-        const auto next_chunk_size = std::min(static_cast<size_t>(output_chunk_size), static_cast<size_t>(row_count));
-        value_segment_value_vector.reserve(next_chunk_size);
-        if (column_is_nullable) {
-          value_segment_null_vector.reserve(next_chunk_size);
-        }
-      }
+// Merges the bounded heaps of multiple jobs and returns the first k of their values in sorted order.
+template <typename T, typename Compare>
+std::vector<T> merge_bounded_heaps(std::vector<std::vector<T>>& heaps, const size_t k, const Compare& compare) {
+  auto values = std::vector<T>{};
+  for (auto& heap : heaps) {
+    values.insert(values.end(), std::make_move_iterator(heap.begin()), std::make_move_iterator(heap.end()));
+    heap = std::vector<T>{};
+  }
 
-      auto accessor_by_chunk_id =
-          std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(unsorted_table->chunk_count());
-      for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-        const auto& abstract_segment = unsorted_table->get_chunk(input_chunk_id)->get_segment(column_id);
-        accessor_by_chunk_id[input_chunk_id] = create_segment_accessor<ColumnDataType>(abstract_segment);
+  std::sort(values.begin(), values.end(), compare);
+  if (values.size() > k) {
+    values.erase(values.begin() + static_cast<std::ptrdiff_t>(k), values.end());
+  }
+  return values;
+}
+
+// Returns the first k rows in the order of the NormalizedSortKeys. Instead of sorting all rows, each job keeps the best
+// k rows of ROWS_PER_JOB rows in a bounded heap, and the heaps are merged at the end. As in sort_by_normalized_keys,
+// ties are broken by the row number.
+RowIDPosList top_k_by_normalized_keys(const NormalizedSortKeys& keys, const size_t k) {
+  const auto row_count = keys.row_count();
+  const auto compare = [&keys](const size_t lhs, const size_t rhs) {
+    const auto result = keys.compare(lhs, rhs);
+    return result < 0 || (result == 0 && lhs < rhs);
+  };
+
+  const auto run_count = (row_count + Sort::ROWS_PER_JOB - 1) / Sort::ROWS_PER_JOB;
+  auto heaps = std::vector<std::vector<size_t>>(run_count);
+  auto job_functions = std::vector<std::function<void()>>{};
+  job_functions.reserve(run_count);
+  for (auto run_idx = size_t{0}; run_idx < run_count; ++run_idx) {
+    job_functions.emplace_back([&, run_idx]() {
+      const auto run_begin = run_idx * Sort::ROWS_PER_JOB;
+      const auto run_end = std::min(run_begin + Sort::ROWS_PER_JOB, row_count);
+      auto& heap = heaps[run_idx];
+      heap.reserve(std::min(k, run_end - run_begin));
+      for (auto row = run_begin; row < run_end; ++row) {
+        add_to_bounded_heap(heap, row, k, compare);
       }
+    });
+  }
+  execute_jobs(job_functions);
 
-      for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
-        const auto [chunk_id, chunk_offset] = pos_list[row_index];
+  const auto rows = merge_bounded_heaps(heaps, k, compare);
+  auto pos_list = RowIDPosList{};
+  pos_list.reserve(rows.size());
+  for (const auto row : rows) {
+    pos_list.emplace_back(keys.row_id(row));
+  }
+  return pos_list;
+}
 
-        auto& accessor = accessor_by_chunk_id[chunk_id];
-        const auto typed_value = accessor->access(chunk_offset);
-        const auto is_null = !typed_value;
-        value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
-        if (column_is_nullable) {
-          value_segment_null_vector.push_back(is_null);
-        }
+// Given an unsorted_table and a pos_list that defines the output order, this materializes all columns in the table,
+// creating chunks of output_chunk_size rows at maximum.
+std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<const Table>& unsorted_table,
+                                                       RowIDPosList pos_list, const ChunkOffset output_chunk_size) {
+  // First, we create a new table as the output
+  // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
+  auto output = std::make_shared<Table>(unsorted_table->column_definitions(), TableType::Data, output_chunk_size);
+
+  // After we created the output table and initialized the column structure, we can start adding values. Because the
+  // values are not sorted by input chunks anymore, we can't process them chunk by chunk. Instead, each output chunk is
+  // written by a job that copies the values of all columns for the chunk's rows.
 
-        ++current_segment_size;
+  const auto output_chunk_count = div_ceil(pos_list.size(), output_chunk_size);
+  Assert(pos_list.size() <= unsorted_table->row_count(), "PosList has more rows than the input table");
 
-        // Check if value segment is full
-        if (current_segment_size >= output_chunk_size) {
-          current_segment_size = 0;
+  // Vector of segments for each chunk
+  const auto output_column_count = unsorted_table->column_count();
+  auto output_segments_by_chunk = std::vector<Segments>(output_chunk_count, Segments(output_column_count));
 
-          std::shared_ptr<ValueSegment<ColumnDataType>> value_segment;
-          if (column_is_nullable) {
-            value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                           std::move(value_segment_null_vector));
-          } else {
-            value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector));
+  const auto input_chunk_count = unsorted_table->chunk_count();
+  const auto row_count = pos_list.size();
+  auto job_functions = std::vector<std::function<void()>>{};
+  job_functions.reserve(output_chunk_count);
+  for (auto output_chunk_id = size_t{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
+    job_functions.emplace_back([&, output_chunk_id]() {
+      const auto output_begin = output_chunk_id * static_cast<size_t>(output_chunk_size);
+      const auto output_end = std::min(output_begin + output_chunk_size, row_count);
+      const auto output_size = output_end - output_begin;
+
+      for (auto column_id = ColumnID{0}; column_id < output_column_count; ++column_id) {
+        const auto column_is_nullable = unsorted_table->column_is_nullable(column_id);
+
+        resolve_data_type(output->column_data_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+
+          auto values = pmr_vector<ColumnDataType>(output_size);
+          auto null_values = pmr_vector<bool>(column_is_nullable ? output_size : 0);
+
+          // Segment accessors are not thread-safe. Thus, each job creates the accessors for the chunks it reads.
+          auto accessor_by_chunk_id =
+              std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(input_chunk_count);
+          for (auto row_index = output_begin; row_index < output_end; ++row_index) {
+            const auto [chunk_id, chunk_offset] = pos_list[row_index];
+
+            auto& accessor = accessor_by_chunk_id[chunk_id];
+            if (!accessor) {
+              accessor =
+                  create_segment_accessor<ColumnDataType>(unsorted_table->get_chunk(chunk_id)->get_segment(column_id));
+            }
+
+            auto typed_value = accessor->access(chunk_offset);
+            if (typed_value) {
+              values[row_index - output_begin] = std::move(*typed_value);
+            } else if (column_is_nullable) {
+              null_values[row_index - output_begin] = true;
+            }
           }
 
-          chunk_it->push_back(value_segment);
-          value_segment_value_vector = pmr_vector<ColumnDataType>{};
-          value_segment_null_vector = pmr_vector<bool>{};
-
-          const auto next_chunk_size =
-              std::min(static_cast<size_t>(output_chunk_size), static_cast<size_t>(row_count - row_index));
-          value_segment_value_vector.reserve(next_chunk_size);
+          auto& output_segment = output_segments_by_chunk[output_chunk_id][column_id];
           if (column_is_nullable) {
-            value_segment_null_vector.reserve(next_chunk_size);
+            output_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+          } else {
+            output_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
           }
-
-          ++chunk_it;
-        }
-      }
-
-      // Last segment has not been added
-      if (current_segment_size > 0) {
-        std::shared_ptr<ValueSegment<ColumnDataType>> value_segment;
-        if (column_is_nullable) {
-          value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                         std::move(value_segment_null_vector));
-        } else {
-          value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector));
-        }
-        chunk_it->push_back(value_segment);
+        });
       }
     });
   }
+  execute_jobs(job_functions);
 
   for (auto& segments : output_segments_by_chunk) {
     output->append_chunk(segments);
@@ -142,7 +313,7 @@ std::shared_ptr<Table> write_reference_output_table(const std::shared_ptr<const
   const auto column_count = output_table->column_count();
 
   const auto output_chunk_count = div_ceil(input_pos_list.size(), output_chunk_size);
-  Assert(input_pos_list.size() == unsorted_table->row_count(), "Mismatching size of input table and PosList");
+  Assert(input_pos_list.size() <= unsorted_table->row_count(), "PosList has more rows than the input table");
 
   // Vector of segments for each chunk
   auto output_segments_by_chunk = std::vector<Segments>(output_chunk_count, Segments(column_count));
@@ -155,67 +326,78 @@ std::shared_ptr<Table> write_reference_output_table(const std::shared_ptr<const
       output_segments[column_id] = std::make_shared<ReferenceSegment>(unsorted_table, column_id, output_pos_list);
     }
   } else {
+    // Collect the input segments and the referenced table and column for each column.
+    const auto input_chunk_count = unsorted_table->chunk_count();
+    auto input_segments_by_column = std::vector<std::vector<std::shared_ptr<AbstractSegment>>>(column_count);
+    auto referenced_tables = std::vector<std::shared_ptr<const Table>>(column_count, unsorted_table);
+    auto referenced_column_ids = std::vector<ColumnID>(column_count);
     for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-      // To keep the implementation simple, we write the output ReferenceSegments column by column. This means that even
-      // if input ReferenceSegments share a PosList, the output will contain independent PosLists. While this is
-      // slightly more expensive to generate and slightly less efficient for following operators, we assume that the
-      // lion's share of the work has been done before the Sort operator is executed and that the relative cost of this
-      // is acceptable. In the future, this could be improved.
-      auto output_pos_list = std::make_shared<RowIDPosList>();
-      output_pos_list->reserve(output_chunk_size);
-
-      // Collect all input segments for the current column
-      const auto input_chunk_count = unsorted_table->chunk_count();
-      auto input_segments = std::vector<std::shared_ptr<AbstractSegment>>(input_chunk_count);
+      referenced_column_ids[column_id] = column_id;
+      if (!resolve_indirection) {
+        continue;
+      }
+
+      auto& input_segments = input_segments_by_column[column_id];
+      input_segments.resize(input_chunk_count);
       for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
         input_segments[input_chunk_id] = unsorted_table->get_chunk(input_chunk_id)->get_segment(column_id);
       }
 
-      const auto first_reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(input_segments.at(0));
-      const auto referenced_table = resolve_indirection ? first_reference_segment->referenced_table() : unsorted_table;
-      const auto referenced_column_id =
-          resolve_indirection ? first_reference_segment->referenced_column_id() : column_id;
-
-      // write_output_pos_list creates an output reference segment for a given ChunkID, ColumnID and PosList.
-      auto output_chunk_id = ChunkID{0};
-      const auto write_output_pos_list = [&] {
-        DebugAssert(!output_pos_list->empty(), "Asked to write empty output_pos_list");
-        output_segments_by_chunk.at(output_chunk_id)[column_id] =
-            std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, output_pos_list);
-        ++output_chunk_id;
-
-        output_pos_list = std::make_shared<RowIDPosList>();
-        if (output_chunk_id < output_chunk_count) {
-          output_pos_list->reserve(output_chunk_size);
-        }
-      };
+      const auto& first_reference_segment = static_cast<const ReferenceSegment&>(*input_segments.at(0));
+      referenced_tables[column_id] = first_reference_segment.referenced_table();
+      referenced_column_ids[column_id] = first_reference_segment.referenced_column_id();
+    }
 
-      // Iterate over rows in sorted input pos list, dereference them if necessary, and write a chunk every
-      // `output_chunk_size` rows.
-      const auto input_pos_list_size = input_pos_list.size();
-      for (auto input_pos_list_offset = size_t{0}; input_pos_list_offset < input_pos_list_size;
-           ++input_pos_list_offset) {
-        const auto& row_id = input_pos_list[input_pos_list_offset];
-        if (resolve_indirection) {
-          const auto& input_reference_segment = static_cast<ReferenceSegment&>(*input_segments[row_id.chunk_id]);
-          DebugAssert(input_reference_segment.referenced_table() == referenced_table,
-                      "Input column references more than one table");
-          DebugAssert(input_reference_segment.referenced_column_id() == referenced_column_id,
-                      "Input column references more than one column");
-          const auto& input_reference_pos_list = input_reference_segment.pos_list();
-          output_pos_list->emplace_back((*input_reference_pos_list)[row_id.chunk_offset]);
-        } else {
-          output_pos_list->emplace_back(row_id);
+    // Each output chunk is written by its own job. If the indirection does not need to be resolved, all columns of an
+    // output chunk share one PosList. Otherwise, we write the output ReferenceSegments column by column. This means
+    // that even if input ReferenceSegments share a PosList, the output will contain independent PosLists. While this
+    // is slightly more expensive to generate and slightly less efficient for following operators, we assume that the
+    // lion's share of the work has been done before the Sort operator is executed and that the relative cost of this
+    // is acceptable. In the future, this could be improved.
+    const auto input_pos_list_size = input_pos_list.size();
+    auto job_functions = std::vector<std::function<void()>>{};
+    job_functions.reserve(output_chunk_count);
+    for (auto output_chunk_id = size_t{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
+      job_functions.emplace_back([&, output_chunk_id]() {
+        const auto output_begin = output_chunk_id * static_cast<size_t>(output_chunk_size);
+        const auto output_end = std::min(output_begin + output_chunk_size, input_pos_list_size);
+        auto& output_segments = output_segments_by_chunk[output_chunk_id];
+
+        if (!resolve_indirection) {
+          const auto output_pos_list = std::make_shared<RowIDPosList>(input_pos_list.begin() + output_begin,
+                                                                      input_pos_list.begin() + output_end);
+          for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+            output_segments[column_id] = std::make_shared<ReferenceSegment>(unsorted_table, column_id, output_pos_list);
+          }
+          return;
         }
 
-        if (output_pos_list->size() == output_chunk_size) {
-          write_output_pos_list();
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          const auto& input_segments = input_segments_by_column[column_id];
+          const auto& referenced_table = referenced_tables[column_id];
+          const auto referenced_column_id = referenced_column_ids[column_id];
+
+          // Dereference the rows of the sorted input pos list.
+          auto output_pos_list = std::make_shared<RowIDPosList>();
+          output_pos_list->reserve(output_end - output_begin);
+          for (auto input_pos_list_offset = output_begin; input_pos_list_offset < output_end;
+               ++input_pos_list_offset) {
+            const auto& row_id = input_pos_list[input_pos_list_offset];
+            const auto& input_reference_segment = static_cast<ReferenceSegment&>(*input_segments[row_id.chunk_id]);
+            DebugAssert(input_reference_segment.referenced_table() == referenced_table,
+                        "Input column references more than one table");
+            DebugAssert(input_reference_segment.referenced_column_id() == referenced_column_id,
+                        "Input column references more than one column");
+            const auto& input_reference_pos_list = input_reference_segment.pos_list();
+            output_pos_list->emplace_back((*input_reference_pos_list)[row_id.chunk_offset]);
+          }
+
+          output_segments[column_id] =
+              std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, output_pos_list);
         }
-      }
-      if (!output_pos_list->empty()) {
-        write_output_pos_list();
-      }
+      });
     }
+    execute_jobs(job_functions);
   }
 
   for (auto& segments : output_segments_by_chunk) {
@@ -231,12 +413,13 @@ namespace hyrise {
 
 Sort::Sort(const std::shared_ptr<const AbstractOperator>& input_operator,
            const std::vector<SortColumnDefinition>& sort_definitions, const ChunkOffset output_chunk_size,
-           const ForceMaterialization force_materialization)
+           const ForceMaterialization force_materialization, const std::optional<size_t> top_k)
     : AbstractReadOnlyOperator(OperatorType::Sort, input_operator, nullptr,
                                std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
       _sort_definitions(sort_definitions),
       _output_chunk_size(output_chunk_size),
-      _force_materialization(force_materialization) {
+      _force_materialization(force_materialization),
+      _top_k(top_k) {
   DebugAssert(!_sort_definitions.empty(), "Expected at least one sort criterion");
 }
 
@@ -244,16 +427,32 @@ const std::vector<SortColumnDefinition>& Sort::sort_definitions() const {
   return _sort_definitions;
 }
 
+std::optional<size_t> Sort::top_k() const {
+  return _top_k;
+}
+
 const std::string& Sort::name() const {
   static const auto name = std::string{"Sort"};
   return name;
 }
 
+std::string Sort::description(DescriptionMode description_mode) const {
+  if (!_top_k) {
+    return AbstractOperator::description(description_mode);
+  }
+
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+  auto stream = std::stringstream{};
+  stream << AbstractOperator::description(description_mode) << separator << "Top-k: " << *_top_k;
+  return stream.str();
+}
+
 std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
-  return std::make_shared<Sort>(copied_left_input, _sort_definitions, _output_chunk_size, _force_materialization);
+  return std::make_shared<Sort>(copied_left_input, _sort_definitions, _output_chunk_size, _force_materialization,
+                                _top_k);
 }
 
 void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -275,30 +474,51 @@ std::shared_ptr<const Table> Sort::_on_execute() {
     return input_table;
   }
 
+  if (_top_k && *_top_k == 0) {
+    return Table::create_dummy_table(input_table->column_definitions());
+  }
+
+  // If top_k covers all rows, there is nothing to save compared to sorting the entire input.
+  const auto use_top_k = _top_k && *_top_k < input_table->row_count();
+
   std::shared_ptr<Table> sorted_table;
 
-  // After the first (least significant) sort operation has been completed, this holds the order of the table as it has
-  // been determined so far. This is not a completely proper PosList on the input table as it might point to
-  // ReferenceSegments.
-  auto previously_sorted_pos_list = std::optional<RowIDPosList>{};
+  // The order of the input table's rows. This is not a completely proper PosList on the input table as it might point
+  // to ReferenceSegments.
+  auto sorted_pos_list = RowIDPosList{};
 
   auto total_materialization_time = std::chrono::nanoseconds{};
   auto total_temporary_result_writing_time = std::chrono::nanoseconds{};
   auto total_sort_time = std::chrono::nanoseconds{};
 
-  for (auto sort_step = static_cast<int64_t>(_sort_definitions.size() - 1); sort_step >= 0; --sort_step) {
-    const auto& sort_definition = _sort_definitions[sort_step];
-    const auto data_type = input_table->column_data_type(sort_definition.column);
-
-    resolve_data_type(data_type, [&](auto type) {
+  if (_sort_definitions.size() > 1) {
+    // Sort by all columns in a single pass. Encoding the sort columns into normalized keys is accounted as
+    // materialization.
+    auto sort_timer = Timer{};
+    const auto keys = NormalizedSortKeys{input_table, _sort_definitions};
+    total_materialization_time = sort_timer.lap();
+    sorted_pos_list = use_top_k ? top_k_by_normalized_keys(keys, *_top_k) : sort_by_normalized_keys(keys);
+    total_sort_time = sort_timer.lap();
+  } else {
+    const auto& sort_definition = _sort_definitions.front();
+    resolve_data_type(input_table->column_data_type(sort_definition.column), [&](auto type) {
       using ColumnDataType = typename decltype(type)::type;
 
+      if (use_top_k) {
+        auto sort_timer = Timer{};
+        auto top_k_impl =
+            TopKImpl<ColumnDataType>(input_table, sort_definition.column, sort_definition.sort_mode, *_top_k);
+        sorted_pos_list = top_k_impl.top_k();
+        total_sort_time = sort_timer.lap();
+        return;
+      }
+
       auto sort_impl = SortImpl<ColumnDataType>(input_table, sort_definition.column, sort_definition.sort_mode);
-      previously_sorted_pos_list = sort_impl.sort(previously_sorted_pos_list);
+      sorted_pos_list = sort_impl.sort();
 
-      total_materialization_time += sort_impl.materialization_time;
-      total_temporary_result_writing_time += sort_impl.temporary_result_writing_time;
-      total_sort_time += sort_impl.sort_time;
+      total_materialization_time = sort_impl.materialization_time;
+      total_temporary_result_writing_time = sort_impl.temporary_result_writing_time;
+      total_sort_time = sort_impl.sort_time;
     });
   }
 
@@ -343,10 +563,10 @@ std::shared_ptr<const Table> Sort::_on_execute() {
 
   if (must_materialize) {
     sorted_table =
-        write_materialized_output_table(input_table, std::move(*previously_sorted_pos_list), _output_chunk_size);
+        write_materialized_output_table(input_table, std::move(sorted_pos_list), _output_chunk_size);
   } else {
     sorted_table =
-        write_reference_output_table(input_table, std::move(*previously_sorted_pos_list), _output_chunk_size);
+        write_reference_output_table(input_table, std::move(sorted_pos_list), _output_chunk_size);
   }
 
   const auto& final_sort_definition = _sort_definitions[0];
@@ -374,46 +594,34 @@ class Sort::SortImpl {
 
   SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
            const SortMode sort_mode = SortMode::Ascending)
-      : _table_in(table_in), _column_id(column_id), _sort_mode(sort_mode) {
-    const auto row_count = _table_in->row_count();
-    _row_id_value_vector.reserve(row_count);
-    _null_value_rows.reserve(row_count);
-  }
+      : _table_in(table_in), _column_id(column_id), _sort_mode(sort_mode) {}
 
-  // Sorts table_in, potentially taking the pre-existing order of previously_sorted_pos_list into account.
-  // Returns a PosList, which can either be used as an input to the next call of sort or for materializing the
-  // output table.
-  RowIDPosList sort(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
+  // Sorts table_in and returns a PosList, which is used for writing the output table.
+  RowIDPosList sort() {
     Timer timer;
-    // 1. Prepare Sort: Creating RowID-value-Structure
-    _materialize_sort_column(previously_sorted_pos_list);
+    // 1. Prepare Sort: Creating RowID-value-Structure, one run per job
+    _materialize_runs();
     materialization_time = timer.lap();
 
     // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    const auto sort_with_comparator = [&](auto comparator) {
-      std::stable_sort(
-          _row_id_value_vector.begin(), _row_id_value_vector.end(),
-          [comparator](RowIDValuePair lhs, RowIDValuePair rhs) { return comparator(lhs.second, rhs.second); });
-    };
     if (_sort_mode == SortMode::Ascending) {
-      sort_with_comparator(std::less<>{});
+      _sort_and_merge_runs(std::less<>{});
     } else {
-      sort_with_comparator(std::greater<>{});
+      _sort_and_merge_runs(std::greater<>{});
     }
     sort_time = timer.lap();
 
     // 2b. Insert null rows in front of all non-NULL rows
-    if (!_null_value_rows.empty()) {
-      // NULLs come before all values. The SQL standard allows for this to be implementation-defined. We used to have
-      // a NULLS LAST mode, but never used it over multiple years. Different databases have different behaviors, and
-      // storing NULLs first even for descending orders is somewhat uncommon:
-      //   https://docs.mendix.com/refguide/ordering-behavior#null-ordering-behavior
-      // For Hyrise, we found that storing NULLs first is the method that requires the least amount of code.
-      _row_id_value_vector.insert(_row_id_value_vector.begin(), _null_value_rows.begin(), _null_value_rows.end());
+    // NULLs come before all values. The SQL standard allows for this to be implementation-defined. We used to have
+    // a NULLS LAST mode, but never used it over multiple years. Different databases have different behaviors, and
+    // storing NULLs first even for descending orders is somewhat uncommon:
+    //   https://docs.mendix.com/refguide/ordering-behavior#null-ordering-behavior
+    // For Hyrise, we found that storing NULLs first is the method that requires the least amount of code.
+    auto pos_list = RowIDPosList{};
+    pos_list.reserve(_table_in->row_count());
+    for (const auto& run : _runs) {
+      pos_list.insert(pos_list.end(), run.null_value_rows.begin(), run.null_value_rows.end());
     }
-
-    RowIDPosList pos_list{};
-    pos_list.reserve(_row_id_value_vector.size());
     for (const auto& [row_id, _] : _row_id_value_vector) {
       pos_list.emplace_back(row_id);
     }
@@ -422,53 +630,77 @@ class Sort::SortImpl {
   }
 
  protected:
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
-    // If there was no PosList passed, this is the first sorting run and we simply fill our values and nulls data
-    // structures from our input table. Otherwise we will materialize according to the PosList which is the result of
-    // the last run.
-    if (previously_sorted_pos_list) {
-      _materialize_column_from_pos_list(*previously_sorted_pos_list);
-    } else {
-      const auto chunk_count = _table_in->chunk_count();
-      for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-        const auto chunk = _table_in->get_chunk(chunk_id);
-        Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
-
-        auto abstract_segment = chunk->get_segment(_column_id);
-
-        segment_iterate<SortColumnType>(*abstract_segment, [&](const auto& position) {
-          if (position.is_null()) {
-            _null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortColumnType{});
-          } else {
-            _row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
-          }
-        });
-      }
+  // A contiguous part of the input. Each run is materialized by a separate job. Runs are concatenated in their order,
+  // so the sort remains stable.
+  struct Run {
+    std::vector<RowIDValuePair> row_id_value_vector;
+    std::vector<RowID> null_value_rows;
+  };
+
+  // Fills our values and nulls data structures from our input table. Consecutive chunks are combined into runs of at
+  // least ROWS_PER_JOB rows.
+  void _materialize_runs() {
+    const auto chunk_ranges = chunk_ranges_for_jobs(*_table_in, Sort::ROWS_PER_JOB);
+    const auto run_count = chunk_ranges.size();
+    _runs.resize(run_count);
+    auto job_functions = std::vector<std::function<void()>>{};
+    job_functions.reserve(run_count);
+    for (auto run_idx = size_t{0}; run_idx < run_count; ++run_idx) {
+      job_functions.emplace_back([&, run_idx]() {
+        auto& run = _runs[run_idx];
+        const auto [begin_chunk_id, end_chunk_id] = chunk_ranges[run_idx];
+        for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+          const auto chunk = _table_in->get_chunk(chunk_id);
+          Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+          const auto& abstract_segment = chunk->get_segment(_column_id);
+          run.row_id_value_vector.reserve(run.row_id_value_vector.size() + abstract_segment->size());
+
+          segment_iterate<SortColumnType>(*abstract_segment, [&](const auto& position) {
+            if (position.is_null()) {
+              run.null_value_rows.emplace_back(chunk_id, position.chunk_offset());
+            } else {
+              run.row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
+            }
+          });
+        }
+      });
     }
+    execute_jobs(job_functions);
   }
 
-  // When there was a preceding sorting run, we materialize by retaining the order of the values in the passed PosList.
-  void _materialize_column_from_pos_list(const RowIDPosList& pos_list) {
-    const auto input_chunk_count = _table_in->chunk_count();
-    auto accessor_by_chunk_id =
-        std::vector<std::unique_ptr<AbstractSegmentAccessor<SortColumnType>>>(input_chunk_count);
-    for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-      const auto& abstract_segment = _table_in->get_chunk(input_chunk_id)->get_segment(_column_id);
-      accessor_by_chunk_id[input_chunk_id] = create_segment_accessor<SortColumnType>(abstract_segment);
+  // Sorts each run with its own job, moves the sorted runs into _row_id_value_vector, and merges them.
+  template <typename Comparator>
+  void _sort_and_merge_runs(const Comparator comparator) {
+    const auto compare = [comparator](const RowIDValuePair& lhs, const RowIDValuePair& rhs) {
+      return comparator(lhs.second, rhs.second);
+    };
+
+    const auto run_count = _runs.size();
+    auto run_bounds = std::vector<size_t>(run_count + 1);
+    for (auto run_idx = size_t{0}; run_idx < run_count; ++run_idx) {
+      run_bounds[run_idx + 1] = run_bounds[run_idx] + _runs[run_idx].row_id_value_vector.size();
     }
 
-    for (auto row_id : pos_list) {
-      const auto [chunk_id, chunk_offset] = row_id;
+    if (run_count == 1) {
+      _row_id_value_vector = std::move(_runs.front().row_id_value_vector);
+      std::stable_sort(_row_id_value_vector.begin(), _row_id_value_vector.end(), compare);
+      return;
+    }
 
-      auto& accessor = accessor_by_chunk_id[chunk_id];
-      const auto typed_value = accessor->access(chunk_offset);
-      if (!typed_value) {
-        _null_value_rows.emplace_back(row_id, SortColumnType{});
-      } else {
-        _row_id_value_vector.emplace_back(row_id, typed_value.value());
-      }
+    _row_id_value_vector.resize(run_bounds.back());
+    auto job_functions = std::vector<std::function<void()>>{};
+    job_functions.reserve(run_count);
+    for (auto run_idx = size_t{0}; run_idx < run_count; ++run_idx) {
+      job_functions.emplace_back([&, run_idx]() {
+        auto& run_values = _runs[run_idx].row_id_value_vector;
+        std::stable_sort(run_values.begin(), run_values.end(), compare);
+        std::move(run_values.begin(), run_values.end(), _row_id_value_vector.begin() + run_bounds[run_idx]);
+        run_values = std::vector<RowIDValuePair>{};
+      });
     }
+    execute_jobs(job_functions);
+
+    merge_sorted_runs(_row_id_value_vector, std::move(run_bounds), compare);
   }
 
   // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
@@ -479,10 +711,187 @@ class Sort::SortImpl {
   const SortMode _sort_mode;
   // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
 
+  std::vector<Run> _runs;
+
+  // Non-NULL values of all runs, sorted once _sort_and_merge_runs has finished.
   std::vector<RowIDValuePair> _row_id_value_vector;
+};
+
+template <typename SortColumnType>
+class Sort::TopKImpl {
+ public:
+  TopKImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id, const SortMode sort_mode,
+           const size_t k)
+      : _table_in(table_in),
+        _column_id(column_id),
+        _sort_mode(sort_mode),
+        _k(k),
+        _use_pruning_statistics(!table_in->column_is_nullable(column_id)) {}
+
+  // Returns the first k rows of the sorted input. Each job keeps the best k rows of a range of chunks in a bounded
+  // heap. The heaps of all jobs are merged at the end.
+  RowIDPosList top_k() {
+    const auto chunk_ranges = chunk_ranges_for_jobs(*_table_in, Sort::ROWS_PER_JOB);
+    const auto job_count = chunk_ranges.size();
+    auto heaps = std::vector<std::vector<Entry>>(job_count);
+    auto job_functions = std::vector<std::function<void()>>{};
+    job_functions.reserve(job_count);
+    for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+      job_functions.emplace_back([&, job_idx]() {
+        _fill_heap(heaps[job_idx], chunk_ranges[job_idx].first, chunk_ranges[job_idx].second);
+      });
+    }
+    execute_jobs(job_functions);
+
+    const auto entries =
+        merge_bounded_heaps(heaps, _k, [&](const Entry& lhs, const Entry& rhs) { return _comes_before(lhs, rhs); });
+    auto pos_list = RowIDPosList{};
+    pos_list.reserve(entries.size());
+    for (const auto& entry : entries) {
+      pos_list.emplace_back(entry.row_id);
+    }
+    return pos_list;
+  }
+
+ protected:
+  struct Entry {
+    RowID row_id;
+    bool is_null;
+    SortColumnType value;
+  };
+
+  using ValueBounds = std::pair<SortColumnType, SortColumnType>;
+
+  // Defines the same order as the stable sort in SortImpl: NULLs come first, ties are broken by the RowID.
+  bool _comes_before(const bool is_null, const SortColumnType& value, const RowID& row_id, const Entry& rhs) const {
+    if (is_null != rhs.is_null) {
+      return is_null;
+    }
+
+    if (!is_null) {
+      if (_value_comes_before(value, rhs.value)) {
+        return true;
+      }
+
+      if (_value_comes_before(rhs.value, value)) {
+        return false;
+      }
+    }
+
+    return row_id < rhs.row_id;
+  }
 
-  // Stored as RowIDValuePair for better type compatibility even if value is unused.
-  std::vector<RowIDValuePair> _null_value_rows;
+  bool _comes_before(const Entry& lhs, const Entry& rhs) const {
+    return _comes_before(lhs.is_null, lhs.value, lhs.row_id, rhs);
+  }
+
+  bool _value_comes_before(const SortColumnType& lhs, const SortColumnType& rhs) const {
+    return _sort_mode == SortMode::Ascending ? lhs < rhs : lhs > rhs;
+  }
+
+  void _fill_heap(std::vector<Entry>& heap, const ChunkID begin_chunk_id, const ChunkID end_chunk_id) const {
+    // Chunks with the best values are processed first, so that the heap quickly contains good rows and the remaining
+    // chunks can be skipped. Chunks without bounds cannot be skipped and are processed before all others.
+    auto chunks = std::vector<std::pair<ChunkID, std::optional<ValueBounds>>>{};
+    for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+      chunks.emplace_back(chunk_id, _use_pruning_statistics ? _value_bounds(chunk_id) : std::nullopt);
+    }
+
+    if (_use_pruning_statistics) {
+      std::stable_sort(chunks.begin(), chunks.end(), [&](const auto& lhs, const auto& rhs) {
+        if (!lhs.second || !rhs.second) {
+          return !lhs.second && rhs.second;
+        }
+        return _value_comes_before(_best_value(*lhs.second), _best_value(*rhs.second));
+      });
+    }
+
+    for (const auto& [chunk_id, value_bounds] : chunks) {
+      // The column is not nullable, so all rows in the heap have a value. If even the best value of the chunk comes
+      // after the heap's worst row, none of the chunk's rows can enter the heap.
+      if (value_bounds && heap.size() == _k && _value_comes_before(heap.front().value, _best_value(*value_bounds))) {
+        continue;
+      }
+
+      const auto compare = [&](const Entry& lhs, const Entry& rhs) {
+        return _comes_before(lhs, rhs);
+      };
+
+      const auto current_chunk_id = chunk_id;
+      const auto& segment = *_table_in->get_chunk(chunk_id)->get_segment(_column_id);
+      segment_iterate<SortColumnType>(segment, [&](const auto& position) {
+        const auto row_id = RowID{current_chunk_id, position.chunk_offset()};
+        const auto& value = position.value();
+        // Check the row before copying its value, which is expensive for strings.
+        if (heap.size() == _k && !_comes_before(position.is_null(), value, row_id, heap.front())) {
+          return;
+        }
+
+        add_to_bounded_heap(heap, Entry{row_id, position.is_null(), value}, _k, compare);
+      });
+    }
+  }
+
+  const SortColumnType& _best_value(const ValueBounds& value_bounds) const {
+    return _sort_mode == SortMode::Ascending ? value_bounds.first : value_bounds.second;
+  }
+
+  // Returns the minimum and maximum value of the sort column in the given chunk, taken from the chunk's pruning
+  // statistics. For ReferenceSegments that reference a single chunk, the statistics of the referenced chunk are used.
+  std::optional<ValueBounds> _value_bounds(const ChunkID chunk_id) const {
+    auto statistics_chunk = _table_in->get_chunk(chunk_id);
+    auto statistics_column_id = _column_id;
+    if (_table_in->type() == TableType::References) {
+      const auto& reference_segment = static_cast<const ReferenceSegment&>(*statistics_chunk->get_segment(_column_id));
+      const auto& pos_list = reference_segment.pos_list();
+      if (pos_list->empty() || !pos_list->references_single_chunk()) {
+        return std::nullopt;
+      }
+
+      statistics_chunk = reference_segment.referenced_table()->get_chunk(pos_list->common_chunk_id());
+      statistics_column_id = reference_segment.referenced_column_id();
+      if (!statistics_chunk) {
+        return std::nullopt;
+      }
+    }
+
+    const auto& pruning_statistics = statistics_chunk->pruning_statistics();
+    if (!pruning_statistics) {
+      return std::nullopt;
+    }
+
+    const auto& segment_statistics = (*pruning_statistics)[statistics_column_id];
+    const auto attribute_statistics =
+        std::dynamic_pointer_cast<const AttributeStatistics<SortColumnType>>(segment_statistics);
+    if (!attribute_statistics) {
+      return std::nullopt;
+    }
+
+    if constexpr (std::is_arithmetic_v<SortColumnType>) {
+      const auto& range_filter = attribute_statistics->range_filter;
+      if (range_filter && !range_filter->ranges.empty()) {
+        return ValueBounds{range_filter->ranges.front().first, range_filter->ranges.back().second};
+      }
+    }
+
+    const auto& min_max_filter = attribute_statistics->min_max_filter;
+    if (min_max_filter) {
+      return ValueBounds{min_max_filter->min, min_max_filter->max};
+    }
+
+    return std::nullopt;
+  }
+
+  // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
+  const std::shared_ptr<const Table> _table_in;
+  const ColumnID _column_id;
+  const SortMode _sort_mode;
+  const size_t _k;
+
+  // Chunks are only skipped for non-nullable columns, as the pruning statistics do not tell whether a chunk contains
+  // NULLs, which come before all values.
+  const bool _use_pruning_statistics;
+  // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
 };
 
 }  // namespace hyrise
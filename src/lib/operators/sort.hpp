@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -18,21 +19,38 @@ namespace hyrise {
  * Operator to sort a table by one or multiple columns. This implements a stable sort, i.e., rows that share the same
  * value will maintain their relative order.
  * By passing multiple sort column definitions it is possible to sort multiple columns with one operator run.
+ *
+ * Sorting is parallelized: The sort column is materialized and sorted in runs of about ROWS_PER_JOB rows, one job per
+ * run. The sorted runs are then merged pairwise. Each merge is split into independent parts of about ROWS_PER_JOB
+ * rows, so that the final merges are parallelized as well. Finally, each output chunk is written by its own job.
+ *
+ * When sorting by multiple columns, all sort columns are encoded into NormalizedSortKeys, and the rows are sorted by
+ * these keys in a single pass.
+ *
+ * If top_k is set, only the first top_k rows of the sorted input are returned (ORDER BY ... LIMIT, see TopKRule).
+ * Instead of sorting the entire input, each job keeps a bounded heap of the best top_k rows of its chunks, and the
+ * heaps are merged at the end. When sorting by a single non-nullable column, a job skips chunks whose pruning
+ * statistics show that none of their values can enter its heap anymore.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
   enum class ForceMaterialization : bool { Yes = true, No = false };
 
+  static constexpr auto ROWS_PER_JOB = size_t{50'000};
+
   enum class OperatorSteps : uint8_t { MaterializeSortColumns, Sort, TemporaryResultWriting, WriteOutput };
 
   Sort(const std::shared_ptr<const AbstractOperator>& input_operator,
        const std::vector<SortColumnDefinition>& sort_definitions,
        const ChunkOffset output_chunk_size = Chunk::DEFAULT_SIZE,
-       const ForceMaterialization force_materialization = ForceMaterialization::No);
+       const ForceMaterialization force_materialization = ForceMaterialization::No,
+       const std::optional<size_t> top_k = std::nullopt);
 
   const std::vector<SortColumnDefinition>& sort_definitions() const;
+  std::optional<size_t> top_k() const;
 
   const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
@@ -48,9 +66,13 @@ class Sort : public AbstractReadOnlyOperator {
   template <typename SortColumnType>
   class SortImplMaterializeOutput;
 
+  template <typename SortColumnType>
+  class TopKImpl;
+
   const std::vector<SortColumnDefinition> _sort_definitions;
   const ChunkOffset _output_chunk_size;
   const ForceMaterialization _force_materialization;
+  const std::optional<size_t> _top_k;
 };
 
 }  // namespace hyrise
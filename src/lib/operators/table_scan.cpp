@@ -2,7 +2,6 @@
 
 #include <map>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -27,6 +26,7 @@
 #include "scheduler/job_task.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
@@ -80,6 +80,14 @@ void TableScan::_on_set_parameters(const std::unordered_map<ParameterID, AllType
   expression_set_parameters(_predicate, parameters);
 }
 
+void TableScan::set_runtime_filters(std::vector<JoinRuntimeFilterReference> runtime_filters) const {
+  _runtime_filters = std::move(runtime_filters);
+}
+
+const std::vector<JoinRuntimeFilterReference>& TableScan::runtime_filters() const {
+  return _runtime_filters;
+}
+
 std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
@@ -93,12 +101,22 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   _impl = create_impl();
   _impl_description = _impl->description();
 
-  auto output_mutex = std::mutex{};
+  // Only filters whose source side has already been executed are available. Usually, the scheduler ensures this (see
+  // operator_task.cpp), but we might also be executed without a scheduler or with a cyclic dependency.
+  auto runtime_filters = std::vector<std::pair<std::shared_ptr<const JoinRuntimeFilter>, ColumnID>>{};
+  for (const auto& runtime_filter_reference : _runtime_filters) {
+    if (auto runtime_filter = runtime_filter_reference.runtime_filter()) {
+      runtime_filters.emplace_back(std::move(runtime_filter), runtime_filter_reference.column_id);
+    }
+  }
+  auto num_rows_removed_by_runtime_filters = std::atomic_size_t{0};
+  auto num_chunks_with_bitmap_output = std::atomic_size_t{0};
 
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
 
-  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
-  output_chunks.reserve(in_table->chunk_count() - excluded_chunk_set.size());
+  // The output chunk of each input chunk is stored at its ChunkID, so that the output keeps the order of the input
+  // (e.g., after a Sort) although the jobs finish in any order. Empty results are removed afterwards.
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(in_table->chunk_count());
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
   jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
@@ -112,9 +130,20 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
     // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
-    auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
+    auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &output_chunks, &runtime_filters,
+                               &num_rows_removed_by_runtime_filters, &num_chunks_with_bitmap_output]() {
       // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
+      auto matches_out = _impl->scan_chunk(chunk_id);
+      for (const auto& [runtime_filter, column_id] : runtime_filters) {
+        if (matches_out->empty()) {
+          break;
+        }
+
+        const auto match_count = matches_out->size();
+        matches_out = runtime_filter->filter(*chunk_in->get_segment(column_id), matches_out);
+        num_rows_removed_by_runtime_filters += match_count - matches_out->size();
+      }
+
       if (matches_out->empty()) {
         return;
       }
@@ -141,7 +170,8 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
             out_segments.emplace_back(segment_in);
           }
         } else {
-          auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
+          auto filtered_pos_lists =
+              std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>>{};
 
           for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
             const auto segment_in = chunk_in->get_segment(column_id);
@@ -157,22 +187,50 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
             auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
 
             if (!filtered_pos_list) {
-              filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
-              if (pos_list_in->references_single_chunk()) {
-                filtered_pos_list->guarantee_single_chunk();
+              // If the input is a bitmap (i.e., this is a chained scan on a dense result), dense matches stay a
+              // bitmap of the referenced chunk. The bitmap orders the positions just like the input did.
+              const auto bitmap_pos_list_in = std::dynamic_pointer_cast<const BitmapPosList>(pos_list_in);
+              if (bitmap_pos_list_in &&
+                  BitmapPosList::use_for(matches_out->size(), bitmap_pos_list_in->chunk_size())) {
+                const auto referenced_chunk_size = bitmap_pos_list_in->chunk_size();
+                auto words = std::vector<uint64_t>(BitmapPosList::word_count(referenced_chunk_size));
+                // The matches are usually sorted, so we walk the input bitmap alongside them and only skip to the next
+                // set bit instead of looking up every match by its index. Unsorted matches are looked up directly.
+                auto position_in = bitmap_pos_list_in->cbegin();
+                auto position_index = size_t{0};
+                for (const auto& match : *matches_out) {
+                  if (match.chunk_offset < position_index) {
+                    position_in = bitmap_pos_list_in->cbegin() + match.chunk_offset;
+                    position_index = match.chunk_offset;
+                  }
+                  for (; position_index < match.chunk_offset; ++position_index) {
+                    ++position_in;
+                  }
+                  BitmapPosList::set_bit(words, position_in->chunk_offset);
+                }
+                filtered_pos_list = std::make_shared<BitmapPosList>(bitmap_pos_list_in->common_chunk_id(),
+                                                                    referenced_chunk_size, std::move(words));
+                ++num_chunks_with_bitmap_output;
               } else {
-                // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
-                // reason is that several table scan implementations split the pos lists by chunks (see
-                // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
-                // this does not affect all scan implementations, we chose the safe and defensive path for now.
-                keep_chunk_sort_order = false;
-              }
-
-              auto offset = size_t{0};
-              for (const auto& match : *matches_out) {
-                const auto row_id = (*pos_list_in)[match.chunk_offset];
-                (*filtered_pos_list)[offset] = row_id;
-                ++offset;
+                auto row_id_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
+                if (pos_list_in->references_single_chunk()) {
+                  row_id_pos_list->guarantee_single_chunk();
+                } else {
+                  // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The
+                  // main reason is that several table scan implementations split the pos lists by chunks (see
+                  // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data.
+                  // While this does not affect all scan implementations, we chose the safe and defensive path for
+                  // now.
+                  keep_chunk_sort_order = false;
+                }
+
+                auto offset = size_t{0};
+                for (const auto& match : *matches_out) {
+                  const auto row_id = (*pos_list_in)[match.chunk_offset];
+                  (*row_id_pos_list)[offset] = row_id;
+                  ++offset;
+                }
+                filtered_pos_list = row_id_pos_list;
               }
             }
 
@@ -184,11 +242,17 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
       } else {
         matches_out->guarantee_single_chunk();
 
-        // If the entire chunk is matched, create an EntireChunkPosList instead
-        const auto output_pos_list = matches_out->size() == chunk_in->size()
-                                         ? static_cast<std::shared_ptr<AbstractPosList>>(
-                                               std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
-                                         : static_cast<std::shared_ptr<AbstractPosList>>(matches_out);
+        // If the entire chunk is matched, create an EntireChunkPosList instead. If most of the chunk is matched, store
+        // the matches as a bitmap.
+        auto output_pos_list = std::shared_ptr<AbstractPosList>{matches_out};
+        const auto chunk_size = chunk_in->size();
+        if (matches_out->size() == chunk_size) {
+          output_pos_list = std::make_shared<EntireChunkPosList>(chunk_id, chunk_size);
+        } else if (BitmapPosList::use_for(matches_out->size(), chunk_size)) {
+          output_pos_list =
+              std::make_shared<BitmapPosList>(chunk_id, chunk_size, matches_out->cbegin(), matches_out->cend());
+          ++num_chunks_with_bitmap_output;
+        }
 
         for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
           const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
@@ -201,8 +265,7 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
       if (keep_chunk_sort_order && !chunk_in->individually_sorted_by().empty()) {
         chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
       }
-      const auto lock = std::lock_guard<std::mutex>{output_mutex};
-      output_chunks.emplace_back(chunk);
+      output_chunks[chunk_id] = chunk;
     };
     // Spawn job when chunk sufficiently large. The upper bound of the chunk size, still needs to be re-evaluated over
     // time to find the value which gives the best performance.
@@ -216,11 +279,14 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   }
 
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  std::erase(output_chunks, nullptr);
 
   auto& scan_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
   scan_performance_data.num_chunks_with_early_out = _impl->num_chunks_with_early_out.load();
   scan_performance_data.num_chunks_with_all_rows_matching = _impl->num_chunks_with_all_rows_matching.load();
   scan_performance_data.num_chunks_with_binary_search = _impl->num_chunks_with_binary_search.load();
+  scan_performance_data.num_chunks_with_bitmap_output = num_chunks_with_bitmap_output.load();
+  scan_performance_data.num_rows_removed_by_runtime_filters = num_rows_removed_by_runtime_filters.load();
 
   return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
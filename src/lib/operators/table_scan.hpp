@@ -8,6 +8,7 @@
 #include "abstract_read_only_operator.hpp"
 #include "all_parameter_variant.hpp"
 #include "expression/abstract_expression.hpp"
+#include "join_hash/join_runtime_filter.hpp"
 #include "table_scan/abstract_table_scan_impl.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -52,10 +53,18 @@ class TableScan : public AbstractReadOnlyOperator {
    */
   std::vector<ChunkID> excluded_chunk_ids;
 
+  // Runtime filters of JoinHash operators above this scan. If the source side of a join has been executed when the scan
+  // starts, matches whose join key is not contained in the join's Bloom filter are removed from the output (see
+  // JoinRuntimeFilter).
+  void set_runtime_filters(std::vector<JoinRuntimeFilterReference> runtime_filters) const;
+  const std::vector<JoinRuntimeFilterReference>& runtime_filters() const;
+
   struct PerformanceData : public OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps> {
     std::atomic_size_t num_chunks_with_early_out{0};
     std::atomic_size_t num_chunks_with_all_rows_matching{0};
     std::atomic_size_t num_chunks_with_binary_search{0};
+    std::atomic_size_t num_chunks_with_bitmap_output{0};
+    std::atomic_size_t num_rows_removed_by_runtime_filters{0};
 
     void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override {
       OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps>::output_to_stream(stream, description_mode);
@@ -64,6 +73,12 @@ class TableScan : public AbstractReadOnlyOperator {
       stream << separator << "Chunks: " << num_chunks_with_early_out.load() << " skipped with no results, ";
       stream << separator << num_chunks_with_all_rows_matching.load() << " skipped with all matching, ";
       stream << num_chunks_with_binary_search.load() << " scanned using binary search.";
+      if (num_chunks_with_bitmap_output > 0) {
+        stream << separator << num_chunks_with_bitmap_output.load() << " chunks output as bitmaps.";
+      }
+      if (num_rows_removed_by_runtime_filters > 0) {
+        stream << separator << "Runtime filters removed " << num_rows_removed_by_runtime_filters.load() << " rows.";
+      }
     }
   };
 
@@ -90,6 +105,8 @@ class TableScan : public AbstractReadOnlyOperator {
 
   std::unique_ptr<AbstractTableScanImpl> _impl;
 
+  mutable std::vector<JoinRuntimeFilterReference> _runtime_filters{};
+
   // The description of the impl, so that it still available after the _impl is resetted in _on_cleanup()
   std::string _impl_description{"Unset"};
 };
@@ -1,16 +1,21 @@
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 
 #include "resolve_type.hpp"
+#include "storage/abstract_encoded_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/split_pos_list_by_chunk_id.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
 namespace hyrise {
 
@@ -77,4 +82,114 @@ void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const Refe
   }
 }
 
+bool AbstractDereferencedColumnTableScanImpl::_scans_compressed_segment(
+    const AbstractSegment& segment, const std::shared_ptr<const AbstractPosList>& position_filter) {
+  if (position_filter) {
+    return false;
+  }
+
+  const auto* encoded_segment = dynamic_cast<const AbstractEncodedSegment*>(&segment);
+  if (!encoded_segment) {
+    return false;
+  }
+
+  const auto encoding_type = encoded_segment->encoding_type();
+  return encoding_type == EncodingType::RunLength || encoding_type == EncodingType::FrameOfReference;
+}
+
+void AbstractDereferencedColumnTableScanImpl::_scan_frame_of_reference_segment(
+    const FrameOfReferenceSegment<int32_t>& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const int64_t lower_bound, const int64_t upper_bound, const bool negate) {
+  constexpr auto BLOCK_SIZE = size_t{FrameOfReferenceSegment<int32_t>::block_size};
+  static_assert(BLOCK_SIZE % BITPACKING_BLOCK_SIZE == 0, "Blocks have to start at the boundaries of bit-packed blocks");
+
+  segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment.size();
+
+  const auto& block_minima = segment.block_minima();
+  const auto* const null_values = segment.null_values() ? &*segment.null_values() : nullptr;
+  const auto size = static_cast<size_t>(segment.size());
+  const auto block_count = block_minima.size();
+
+  auto skipped_block_count = size_t{0};
+  auto fully_matching_block_count = size_t{0};
+
+  resolve_compressed_vector_type(segment.offset_values(), [&](const auto& offset_values) {
+    using OffsetVectorType = std::decay_t<decltype(offset_values)>;
+
+    auto max_offset = int64_t{0};
+    if constexpr (std::is_same_v<OffsetVectorType, BitPackingVector>) {
+      max_offset = (int64_t{1} << offset_values.data().bits()) - 1;
+    } else {
+      using OffsetType = typename std::decay_t<decltype(offset_values.data())>::value_type;
+      max_offset = std::numeric_limits<OffsetType>::max();
+    }
+
+    for (auto block_idx = size_t{0}; block_idx < block_count; ++block_idx) {
+      const auto block_begin = block_idx * BLOCK_SIZE;
+      const auto block_end = std::min(block_begin + BLOCK_SIZE, size);
+
+      // The offsets of the block that satisfy the predicate without considering `negate`.
+      const auto minimum = int64_t{block_minima[block_idx]};
+      const auto lower_offset = std::max(lower_bound - minimum, int64_t{0});
+      const auto upper_offset = std::min(upper_bound - minimum, max_offset);
+      const auto no_offset_in_range = lower_offset > upper_offset;
+      const auto all_offsets_in_range = lower_offset == 0 && upper_offset == max_offset;
+
+      if (no_offset_in_range ? !negate : (all_offsets_in_range && negate)) {
+        ++skipped_block_count;
+        continue;
+      }
+
+      if (no_offset_in_range || all_offsets_in_range) {
+        ++fully_matching_block_count;
+        if (!null_values) {
+          _append_chunk_offset_range(chunk_id, ChunkOffset{static_cast<ChunkOffset::base_type>(block_begin)},
+                                     ChunkOffset{static_cast<ChunkOffset::base_type>(block_end)}, matches);
+          continue;
+        }
+
+        for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+          if (!(*null_values)[chunk_offset]) {
+            matches.emplace_back(chunk_id, ChunkOffset{static_cast<ChunkOffset::base_type>(chunk_offset)});
+          }
+        }
+        continue;
+      }
+
+      // Unsigned wrap-around turns the two comparisons with the bounds of the range into one.
+      const auto offset_base = static_cast<uint32_t>(lower_offset);
+      const auto range_width = static_cast<uint32_t>(upper_offset - lower_offset);
+      _scan_compressed_vector_range(
+          offset_values, block_begin, block_end, chunk_id, matches,
+          [&](const auto offset) { return (static_cast<uint32_t>(offset - offset_base) <= range_width) != negate; },
+          null_values);
+    }
+  });
+
+  if (skipped_block_count == block_count) {
+    ++num_chunks_with_early_out;
+  } else if (fully_matching_block_count == block_count && !null_values) {
+    ++num_chunks_with_all_rows_matching;
+  }
+}
+
+void AbstractDereferencedColumnTableScanImpl::_append_chunk_offset_range(const ChunkID chunk_id,
+                                                                         const ChunkOffset begin,
+                                                                         const ChunkOffset end,
+                                                                         RowIDPosList& matches) {
+  const auto output_start_offset = matches.size();
+  const auto range_size = static_cast<ChunkOffset::base_type>(end - begin);
+  const auto first_offset = static_cast<ChunkOffset::base_type>(begin);
+  matches.resize(output_start_offset + range_size);
+
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd
+  // clang-format on
+  // OpenMP directives do not work with strong type defs.
+  for (auto index = ChunkOffset::base_type{0}; index < range_size; ++index) {
+    matches[output_start_offset + index] = RowID{chunk_id, ChunkOffset{first_offset + index}};
+  }
+}
+
 }  // namespace hyrise
@@ -6,6 +6,10 @@
 
 #include "abstract_table_scan_impl.hpp"
 
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
 
 namespace hyrise {
@@ -42,6 +46,90 @@ class AbstractDereferencedColumnTableScanImpl : public AbstractTableScanImpl {
                                            RowIDPosList& matches,
                                            const std::shared_ptr<const AbstractPosList>& position_filter) = 0;
 
+  /**
+   * @defgroup Scanning run-length and frame-of-reference segments without decompressing them
+   *
+   * Both are only used if the segment is scanned completely, i.e., without a position filter. Otherwise, the impls
+   * fall back to their generic scans using the segments' iterables.
+   * @{
+   */
+
+  // Returns whether the segment is run-length or frame-of-reference encoded and scanned without a position filter.
+  static bool _scans_compressed_segment(const AbstractSegment& segment,
+                                        const std::shared_ptr<const AbstractPosList>& position_filter);
+
+  // Evaluates `predicate` once per run instead of once per row and appends all rows of each matching run at once.
+  // NULL runs never match.
+  template <typename T, typename Predicate>
+  static void _scan_run_length_segment(const RunLengthSegment<T>& segment, const ChunkID chunk_id,
+                                       RowIDPosList& matches, const Predicate& predicate) {
+    segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment.size();
+
+    const auto& values = *segment.values();
+    const auto& null_values = *segment.null_values();
+    const auto& end_positions = *segment.end_positions();
+    const auto run_count = values.size();
+
+    auto run_begin = ChunkOffset{0};
+    for (auto run_idx = size_t{0}; run_idx < run_count; ++run_idx) {
+      // End positions are inclusive.
+      const auto run_end = ChunkOffset{end_positions[run_idx] + 1};
+      if (!null_values[run_idx] && predicate(values[run_idx])) {
+        _append_chunk_offset_range(chunk_id, run_begin, run_end, matches);
+      }
+      run_begin = run_end;
+    }
+  }
+
+  // Appends all non-NULL rows whose value v satisfies lower_bound <= v <= upper_bound or, if `negate` is set, all
+  // non-NULL rows whose value does not. The range is translated into a range of offsets for each block, so that the
+  // offsets are compared without adding the block minimum. As an offset vector cannot hold offsets larger than its
+  // bit width allows, the maximum of each block is bounded by its minimum plus the largest representable offset.
+  // This allows us to skip blocks that cannot contain a match and to add blocks in which all rows match without
+  // looking at their offsets.
+  void _scan_frame_of_reference_segment(const FrameOfReferenceSegment<int32_t>& segment, const ChunkID chunk_id,
+                                        RowIDPosList& matches, const int64_t lower_bound, const int64_t upper_bound,
+                                        const bool negate);
+
+  static void _append_chunk_offset_range(const ChunkID chunk_id, const ChunkOffset begin, const ChunkOffset end,
+                                         RowIDPosList& matches);
+
+  /**@}*/
+
+  /**
+   * @defgroup Scanning FSST segments on their compressed strings
+   *
+   * Like the scans above, this is only used without a position filter.
+   * @{
+   */
+
+  // Evaluates `predicate` for each non-NULL row of the segment with the range [code_begin, code_end) of the row's
+  // codes. Predicates can thus compare the codes directly or decode them into a reused buffer (see
+  // FSSTSegment::decode()) instead of materializing every string.
+  template <typename Predicate>
+  static void _scan_fsst_segment_codes(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id,
+                                       RowIDPosList& matches, const Predicate& predicate) {
+    segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment.size();
+
+    const auto& null_values = segment.null_values();
+    const auto row_count = segment.size();
+
+    resolve_compressed_vector_type(segment.code_offsets(), [&](const auto& code_offsets) {
+      auto code_offset_it = code_offsets.cbegin();
+      auto code_begin = static_cast<size_t>(*code_offset_it);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        ++code_offset_it;
+        const auto code_end = static_cast<size_t>(*code_offset_it);
+        if ((!null_values || !(*null_values)[chunk_offset]) && predicate(code_begin, code_end)) {
+          matches.emplace_back(chunk_id, chunk_offset);
+        }
+        code_begin = code_end;
+      }
+    });
+  }
+
+  /**@}*/
+
   const std::shared_ptr<const Table> _in_table;
   const ColumnID _column_id;
 };
@@ -4,13 +4,18 @@
 #include <x86intrin.h>
 #endif
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
+#include <type_traits>
 
 #include "operators/operator_performance_data.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterables.hpp"
 #include "storage/segment_iterables/any_segment_iterator.hpp"
+#include "storage/vector_compression/bitpacking/bitpacking_block_unpacking.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
 #include "utils/performance_warning.hpp"
 
@@ -239,6 +244,107 @@ class AbstractTableScanImpl {
   }
 
   /**@}*/
+
+  /**
+   * @defgroup Scanning the attribute vector of a dictionary segment
+   *
+   * Once the searched value(s) have been translated to ValueIDs, a dictionary segment without a position filter can
+   * be scanned on its compressed attribute vector directly, without creating a SegmentPosition for every entry. The
+   * attribute vector is processed in blocks of BITPACKING_BLOCK_SIZE (64) entries. The entries of a
+   * FixedWidthIntegerVector are compared in place, the entries of a BitPackingVector are unpacked block-wise (see
+   * bitpacking_block_unpacking.hpp) into a buffer that stays in the L1 cache and are compared there. The comparisons
+   * of a block produce a bitmask of matching entries, which is then converted to RowIDs. `predicate` is called with
+   * the ValueID as a ValueID::base_type and has to return false for NULLs. The same kernel scans the offsets of
+   * frame-of-reference segments, see AbstractDereferencedColumnTableScanImpl::_scan_frame_of_reference_segment().
+   * @{
+   */
+
+  template <typename Predicate>
+  static void _scan_attribute_vector(const BaseCompressedVector& attribute_vector, const ChunkID chunk_id,
+                                     RowIDPosList& matches_out, const Predicate& predicate) {
+    resolve_compressed_vector_type(attribute_vector, [&](const auto& vector) {
+      _scan_compressed_vector_range(vector, 0, vector.size(), chunk_id, matches_out, predicate);
+    });
+  }
+
+  // Scans the entries [begin, end) of a resolved compressed vector. `begin` has to be a multiple of the block size so
+  // that bit-packed blocks are unpacked as a whole. If `null_values` is given, entries that are NULL according to it
+  // never match, no matter what `predicate` returns for them.
+  template <typename VectorType, typename Predicate>
+  static void _scan_compressed_vector_range(const VectorType& vector, const size_t begin, const size_t end,
+                                            const ChunkID chunk_id, RowIDPosList& matches_out,
+                                            const Predicate& predicate,
+                                            const pmr_vector<bool>* null_values = nullptr) {
+    DebugAssert(begin % BITPACKING_BLOCK_SIZE == 0, "Range has to start at a block boundary");
+    auto block_begin = begin;
+
+    if constexpr (std::is_same_v<VectorType, BitPackingVector>) {
+      auto block = std::array<uint32_t, BITPACKING_BLOCK_SIZE>{};
+      for (; block_begin < end; block_begin += BITPACKING_BLOCK_SIZE) {
+        const auto block_size = std::min(BITPACKING_BLOCK_SIZE, end - block_begin);
+        unpack_bitpacking_values(vector.data(), block_begin, block_size, block.data());
+        auto mask = _attribute_vector_block_mask(block.data(), block_size, predicate);
+        if (null_values) {
+          mask = _clear_null_bits(mask, *null_values, block_begin);
+        }
+        _append_attribute_vector_block_matches(mask, chunk_id, block_begin, matches_out);
+      }
+    } else {
+      const auto* const values = vector.data().data();
+      for (; block_begin < end; block_begin += BITPACKING_BLOCK_SIZE) {
+        const auto block_size = std::min(BITPACKING_BLOCK_SIZE, end - block_begin);
+        auto mask = _attribute_vector_block_mask(values + block_begin, block_size, predicate);
+        if (null_values) {
+          mask = _clear_null_bits(mask, *null_values, block_begin);
+        }
+        _append_attribute_vector_block_matches(mask, chunk_id, block_begin, matches_out);
+      }
+    }
+  }
+
+  template <typename ValueIDType, typename Predicate>
+  static uint64_t _attribute_vector_block_mask(const ValueIDType* value_ids, const size_t block_size,
+                                               const Predicate& predicate) {
+    auto mask = uint64_t{0};
+
+    // NOLINTNEXTLINE
+    {}  // clang-format off
+    #pragma omp simd reduction(|:mask)
+    // clang-format on
+    for (auto index = size_t{0}; index < block_size; ++index) {
+      mask |= static_cast<uint64_t>(predicate(static_cast<ValueID::base_type>(value_ids[index]))) << index;
+    }
+
+    return mask;
+  }
+
+  // Only the matching entries are looked up in `null_values`, so that blocks without matches cost nothing extra.
+  static uint64_t _clear_null_bits(const uint64_t mask, const pmr_vector<bool>& null_values, const size_t block_begin) {
+    auto result = mask;
+    auto remaining = mask;
+    while (remaining) {
+      const auto index = std::countr_zero(remaining);
+      if (null_values[block_begin + index]) {
+        result &= ~(uint64_t{1} << index);
+      }
+      remaining &= remaining - 1;
+    }
+    return result;
+  }
+
+  static void _append_attribute_vector_block_matches(uint64_t mask, const ChunkID chunk_id, const size_t block_begin,
+                                                     RowIDPosList& matches_out) {
+    auto matches_out_index = matches_out.size();
+    matches_out.resize(matches_out_index + std::popcount(mask));
+    while (mask) {
+      const auto chunk_offset = static_cast<ChunkOffset::base_type>(block_begin + std::countr_zero(mask));
+      matches_out[matches_out_index] = RowID{chunk_id, ChunkOffset{chunk_offset}};
+      ++matches_out_index;
+      mask &= mask - 1;
+    }
+  }
+
+  /**@}*/
 };
 
 }  // namespace hyrise
@@ -59,6 +59,8 @@ void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
   // Select optimized or generic scanning implementation based on segment type
   if (dictionary_segment) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (_scans_compressed_segment(segment, position_filter)) {
+    _scan_compressed_segment(segment, chunk_id, matches);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
@@ -90,6 +92,34 @@ void ColumnBetweenTableScanImpl::_scan_generic_segment(
   });
 }
 
+void ColumnBetweenTableScanImpl::_scan_compressed_segment(const AbstractSegment& segment, const ChunkID chunk_id,
+                                                          RowIDPosList& matches) {
+  resolve_data_and_segment_type(segment, [&](const auto type, const auto& typed_segment) {
+    using ColumnDataType = typename decltype(type)::type;
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    const auto typed_left_value = boost::get<ColumnDataType>(left_value);
+    const auto typed_right_value = boost::get<ColumnDataType>(right_value);
+
+    if constexpr (std::is_same_v<SegmentType, RunLengthSegment<ColumnDataType>>) {
+      with_between_comparator(predicate_condition, [&](auto between_comparator_function) {
+        _scan_run_length_segment(typed_segment, chunk_id, matches, [&](const auto& run_value) {
+          return between_comparator_function(run_value, typed_left_value, typed_right_value);
+        });
+      });
+    } else if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<int32_t>>) {
+      // Exclusive bounds of integers are turned into inclusive ones.
+      const auto lower_bound =
+          int64_t{typed_left_value} + (is_lower_inclusive_between(predicate_condition) ? 0 : 1);
+      const auto upper_bound =
+          int64_t{typed_right_value} - (is_upper_inclusive_between(predicate_condition) ? 0 : 1);
+      _scan_frame_of_reference_segment(typed_segment, chunk_id, matches, lower_bound, upper_bound, false);
+    } else {
+      Fail("Only run-length and frame-of-reference segments are scanned on their compressed data");
+    }
+  });
+}
+
 void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
     const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
@@ -171,6 +201,18 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
     return (position.value() - lower_bound_value_id) < value_id_diff;
   };
 
+  if (!position_filter) {
+    // Compare the ValueIDs directly on the compressed attribute vector, see _scan_attribute_vector().
+    segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment.size();
+    const auto raw_lower_bound_value_id = static_cast<ValueID::base_type>(lower_bound_value_id);
+    const auto raw_value_id_diff = static_cast<ValueID::base_type>(value_id_diff);
+    _scan_attribute_vector(*segment.attribute_vector(), chunk_id, matches,
+                           [raw_lower_bound_value_id, raw_value_id_diff](const auto value_id) {
+                             return (value_id - raw_lower_bound_value_id) < raw_value_id_diff;
+                           });
+    return;
+  }
+
   attribute_vector_iterable.with_iterators(position_filter, [&](auto left_it, auto left_end) {
     // No need to check for NULL because NULL would be represented as a value ID outside of our range
     _scan_with_iterators<false>(comparator, left_it, left_end, chunk_id, matches);
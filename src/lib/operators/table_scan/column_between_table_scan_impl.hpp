@@ -43,6 +43,9 @@ class ColumnBetweenTableScanImpl : public AbstractDereferencedColumnTableScanImp
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
 
+  // Scans run-length and frame-of-reference segments without a position filter, see _scans_compressed_segment().
+  void _scan_compressed_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches);
+
   void _scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                             const std::shared_ptr<const AbstractPosList>& position_filter, const SortMode sort_mode);
 
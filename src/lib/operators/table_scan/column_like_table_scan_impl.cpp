@@ -24,7 +24,8 @@ ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Tab
                                                  const pmr_string& pattern)
     : AbstractDereferencedColumnTableScanImpl{in_table, column_id, init_predicate_condition},
       _matcher{pattern},
-      _invert_results(predicate_condition == PredicateCondition::NotLike) {}
+      _invert_results(predicate_condition == PredicateCondition::NotLike),
+      _pattern{pattern} {}
 
 std::string ColumnLikeTableScanImpl::description() const {
   return "ColumnLike";
@@ -39,6 +40,9 @@ void ColumnLikeTableScanImpl::_scan_non_reference_segment(
       dictionary_segment &&
       (!position_filter || dictionary_segment->unique_values_count() <= position_filter->size())) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (const auto* fsst_segment = dynamic_cast<const FSSTSegment<pmr_string>*>(&segment);
+             fsst_segment && !position_filter) {
+    _scan_fsst_segment(*fsst_segment, chunk_id, matches);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
@@ -113,6 +117,34 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   });
 }
 
+void ColumnLikeTableScanImpl::_scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id,
+                                                 RowIDPosList& matches) const {
+  if (!LikeMatcher::contains_wildcard(_pattern)) {
+    // Without wildcards, LIKE compares for equality. As equal strings are compressed to equal codes (see
+    // FSSTSymbolTable), the pattern is compressed once and compared to the codes of each row.
+    auto pattern_codes = pmr_vector<uint8_t>{};
+    segment.symbol_table().encode(_pattern, pattern_codes);
+
+    const auto* codes = segment.codes().data();
+    const auto pattern_code_count = pattern_codes.size();
+    _scan_fsst_segment_codes(segment, chunk_id, matches, [&](const size_t code_begin, const size_t code_end) {
+      const auto equals = code_end - code_begin == pattern_code_count &&
+                          std::equal(pattern_codes.cbegin(), pattern_codes.cend(), codes + code_begin);
+      return equals != _invert_results;
+    });
+    return;
+  }
+
+  // Otherwise, each string is decoded into the same buffer and matched as a string_view, so that no string has to be
+  // allocated.
+  auto buffer = std::vector<char>{};
+  _matcher.resolve(_invert_results, [&](const auto& resolved_matcher) {
+    _scan_fsst_segment_codes(segment, chunk_id, matches, [&](const size_t code_begin, const size_t code_end) {
+      return resolved_matcher(segment.decode(code_begin, code_end, buffer));
+    });
+  });
+}
+
 template <typename D>
 std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(const D& dictionary) const {
   auto result = std::pair<size_t, std::vector<bool>>{};
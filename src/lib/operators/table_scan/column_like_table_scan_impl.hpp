@@ -26,6 +26,8 @@ class Table;
  * - For dictionary segments, we check the values in the dictionary and store the matches in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For FSST segments, patterns without wildcards are compared to the compressed strings. For other patterns, the
+ *   strings are decoded into a reused buffer instead of being materialized one by one.
  *
  * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
  *                    e.g., StartsWithPattern. 
@@ -46,6 +48,9 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
 
+  // Scans FSST segments without a position filter, see the class comment.
+  void _scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id, RowIDPosList& matches) const;
+
   /**
    * Used for dictionary segments
    * @returns number of matches and the result of each dictionary entry
@@ -57,6 +62,8 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
 
   // For NOT LIKE support
   const bool _invert_results;
+
+  const pmr_string _pattern;
 };
 
 }  // namespace hyrise
@@ -1,6 +1,9 @@
 #include "column_vs_value_table_scan_impl.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -48,6 +51,13 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
 
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (_scans_compressed_segment(segment, position_filter)) {
+    _scan_compressed_segment(segment, chunk_id, matches);
+  } else if (const auto* fsst_segment = dynamic_cast<const FSSTSegment<pmr_string>*>(&segment);
+             fsst_segment && !position_filter &&
+             (predicate_condition == PredicateCondition::Equals ||
+              predicate_condition == PredicateCondition::NotEquals)) {
+    _scan_fsst_segment(*fsst_segment, chunk_id, matches);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
@@ -78,6 +88,72 @@ void ColumnVsValueTableScanImpl::_scan_generic_segment(
   });
 }
 
+void ColumnVsValueTableScanImpl::_scan_compressed_segment(const AbstractSegment& segment, const ChunkID chunk_id,
+                                                          RowIDPosList& matches) {
+  resolve_data_and_segment_type(segment, [&](const auto type, const auto& typed_segment) {
+    using ColumnDataType = typename decltype(type)::type;
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    const auto typed_value = boost::get<ColumnDataType>(value);
+
+    if constexpr (std::is_same_v<SegmentType, RunLengthSegment<ColumnDataType>>) {
+      with_comparator(predicate_condition, [&](auto predicate_comparator) {
+        _scan_run_length_segment(typed_segment, chunk_id, matches, [&](const auto& run_value) {
+          return predicate_comparator(run_value, typed_value);
+        });
+      });
+    } else if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<int32_t>>) {
+      // Translate the predicate into a range of values, NotEquals matches all values outside of [value, value].
+      constexpr auto MIN_VALUE = int64_t{std::numeric_limits<int32_t>::min()};
+      constexpr auto MAX_VALUE = int64_t{std::numeric_limits<int32_t>::max()};
+      const auto search_value = int64_t{typed_value};
+
+      switch (predicate_condition) {
+        case PredicateCondition::Equals:
+          _scan_frame_of_reference_segment(typed_segment, chunk_id, matches, search_value, search_value, false);
+          return;
+        case PredicateCondition::NotEquals:
+          _scan_frame_of_reference_segment(typed_segment, chunk_id, matches, search_value, search_value, true);
+          return;
+        case PredicateCondition::LessThan:
+          _scan_frame_of_reference_segment(typed_segment, chunk_id, matches, MIN_VALUE, search_value - 1, false);
+          return;
+        case PredicateCondition::LessThanEquals:
+          _scan_frame_of_reference_segment(typed_segment, chunk_id, matches, MIN_VALUE, search_value, false);
+          return;
+        case PredicateCondition::GreaterThan:
+          _scan_frame_of_reference_segment(typed_segment, chunk_id, matches, search_value + 1, MAX_VALUE, false);
+          return;
+        case PredicateCondition::GreaterThanEquals:
+          _scan_frame_of_reference_segment(typed_segment, chunk_id, matches, search_value, MAX_VALUE, false);
+          return;
+        default:
+          Fail("Unsupported comparison type encountered");
+      }
+    } else {
+      Fail("Only run-length and frame-of-reference segments are scanned on their compressed data");
+    }
+  });
+}
+
+void ColumnVsValueTableScanImpl::_scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id,
+                                                    RowIDPosList& matches) {
+  // Equal strings are compressed to equal codes (see FSSTSymbolTable). Thus, the search value is compressed once and
+  // its codes are compared to those of each row without decoding any string.
+  auto search_codes = pmr_vector<uint8_t>{};
+  segment.symbol_table().encode(boost::get<pmr_string>(value), search_codes);
+
+  const auto* codes = segment.codes().data();
+  const auto search_code_count = search_codes.size();
+  const auto negate = predicate_condition == PredicateCondition::NotEquals;
+
+  _scan_fsst_segment_codes(segment, chunk_id, matches, [&](const size_t code_begin, const size_t code_end) {
+    const auto equals = code_end - code_begin == search_code_count &&
+                        std::equal(search_codes.cbegin(), search_codes.cend(), codes + code_begin);
+    return equals != negate;
+  });
+}
+
 void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
@@ -150,6 +226,20 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     return;
   }
 
+  if (!position_filter) {
+    // Compare the ValueIDs directly on the compressed attribute vector. NULLs are represented by the null value id,
+    // which is greater than all other ValueIDs and has to be excluded explicitly for some predicate conditions.
+    segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment.size();
+    const auto raw_search_value_id = static_cast<ValueID::base_type>(search_value_id);
+    const auto raw_null_value_id = static_cast<ValueID::base_type>(segment.null_value_id());
+    _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
+      _scan_attribute_vector(*segment.attribute_vector(), chunk_id, matches, [&](const auto value_id) {
+        return predicate_comparator(value_id, raw_search_value_id) && value_id != raw_null_value_id;
+      });
+    });
+    return;
+  }
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -21,6 +21,9 @@ namespace hyrise {
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For run-length segments, the predicate is evaluated once per run. For frame-of-reference segments, it is
+ *   evaluated on the offsets of each block, whole blocks are skipped or added if their range of values allows it.
+ * - For FSST segments, (in)equality is evaluated on the compressed strings.
  */
 class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
@@ -40,6 +43,12 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
 
+  // Scans run-length and frame-of-reference segments without a position filter, see _scans_compressed_segment().
+  void _scan_compressed_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches);
+
+  // Scans FSST segments for Equals and NotEquals without a position filter by comparing codes instead of strings.
+  void _scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id, RowIDPosList& matches);
+
   void _scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                             const std::shared_ptr<const AbstractPosList>& position_filter, const SortMode sort_mode);
 
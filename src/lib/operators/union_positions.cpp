@@ -2,15 +2,18 @@
 
 #include <algorithm>
 #include <chrono>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include <boost/sort/sort.hpp>
 
 #include "storage/chunk.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -85,6 +88,11 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
     return early_result;
   }
 
+  const auto bitmap_result = _try_unite_bitmaps();
+  if (bitmap_result) {
+    return bitmap_result;
+  }
+
   const auto& left_in_table = *left_input_table();
 
   /**
@@ -326,6 +334,89 @@ std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
   return nullptr;
 }
 
+std::shared_ptr<const Table> UnionPositions::_try_unite_bitmaps() const {
+  if (_column_cluster_offsets.size() != 1) {
+    return nullptr;
+  }
+
+  // The positions of both inputs in each referenced chunk, ordered by the referenced ChunkID.
+  auto bitmaps = std::map<ChunkID, std::shared_ptr<const BitmapPosList>>{};
+
+  const auto add_input_table = [&](const Table& table) {
+    auto referenced_chunk_ids = std::unordered_set<ChunkID>{};
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto segment = table.get_chunk(chunk_id)->get_segment(ColumnID{0});
+      const auto& reference_segment = static_cast<const ReferenceSegment&>(*segment);
+      const auto pos_list = reference_segment.pos_list();
+      if (pos_list->empty()) {
+        continue;
+      }
+
+      // The sort-based merge keeps duplicates within an input, a bitmap cannot. Hence, each referenced chunk may only
+      // occur once per input and its positions have to be unique.
+      if (!pos_list->references_single_chunk()) {
+        return false;
+      }
+      const auto referenced_chunk_id = pos_list->common_chunk_id();
+      if (!referenced_chunk_ids.emplace(referenced_chunk_id).second) {
+        return false;
+      }
+
+      auto bitmap = std::dynamic_pointer_cast<const BitmapPosList>(pos_list);
+      if (!bitmap) {
+        const auto unordered_it =
+            std::adjacent_find(pos_list->cbegin(), pos_list->cend(), [](const auto& lhs, const auto& rhs) {
+              return lhs.chunk_offset >= rhs.chunk_offset;
+            });
+        if (unordered_it != pos_list->cend()) {
+          return false;
+        }
+
+        const auto referenced_chunk = reference_segment.referenced_table()->get_chunk(referenced_chunk_id);
+        Assert(referenced_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+        bitmap = std::make_shared<BitmapPosList>(referenced_chunk_id, referenced_chunk->size(), pos_list->cbegin(),
+                                                 pos_list->cend());
+      }
+
+      auto& united_bitmap = bitmaps[referenced_chunk_id];
+      united_bitmap = united_bitmap ? BitmapPosList::unite(*united_bitmap, *bitmap) : bitmap;
+    }
+    return true;
+  };
+
+  if (!add_input_table(*left_input_table()) || !add_input_table(*right_input_table())) {
+    return nullptr;
+  }
+
+  const auto& referenced_table = _referenced_tables.front();
+  const auto column_count = left_input_table()->column_count();
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(bitmaps.size());
+  for (const auto& [referenced_chunk_id, bitmap] : bitmaps) {
+    // Sparse results are cheaper to process as RowIDs.
+    auto pos_list = std::shared_ptr<const AbstractPosList>{bitmap};
+    if (!BitmapPosList::use_for(bitmap->size(), bitmap->chunk_size())) {
+      auto row_id_pos_list = std::make_shared<RowIDPosList>(bitmap->cbegin(), bitmap->cend());
+      row_id_pos_list->guarantee_single_chunk();
+      pos_list = std::move(row_id_pos_list);
+    }
+
+    auto output_segments = Segments{};
+    output_segments.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_segments.emplace_back(
+          std::make_shared<ReferenceSegment>(referenced_table, _referenced_column_ids[column_id], pos_list));
+    }
+    const auto chunk = std::make_shared<Chunk>(output_segments);
+    chunk->finalize();
+    output_chunks.emplace_back(chunk);
+  }
+
+  return std::make_shared<Table>(left_input_table()->column_definitions(), TableType::References,
+                                 std::move(output_chunks));
+}
+
 UnionPositions::ReferenceMatrix UnionPositions::_build_reference_matrix(
     const std::shared_ptr<const Table>& input_table) const {
   ReferenceMatrix reference_matrix;
@@ -110,6 +110,15 @@ class UnionPositions : public AbstractReadOnlyOperator {
    */
   std::shared_ptr<const Table> _prepare_operator();
 
+  /**
+   * If all columns share their pos lists and each pos list references a single chunk with strictly ascending
+   * positions, the union is computed by uniting one BitmapPosList per referenced chunk instead of sorting and merging
+   * the ReferenceMatrices. The output has the same order as the sort-based merge.
+   *
+   * @returns the result table, or nullptr if the inputs do not qualify.
+   */
+  std::shared_ptr<const Table> _try_unite_bitmaps() const;
+
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
   static bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                              const ReferenceMatrix& right_matrix, size_t right_row_idx);
@@ -9,6 +9,7 @@
 #include "hyrise.hpp"
 #include "operators/delete.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
@@ -86,9 +87,9 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
-  output_chunks.reserve(chunk_count);
-  auto output_mutex = std::mutex{};
+  // Each job writes the output chunks of its input chunks to their ChunkIDs, so that the output keeps the order of the
+  // input (e.g., after a Sort). Chunks without visible rows are removed afterwards.
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
 
   auto job_start_chunk_id = ChunkID{0};
   auto job_end_chunk_id = ChunkID{0};
@@ -122,12 +123,11 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
       const auto execute_directly = job_start_chunk_id == 0 && job_end_chunk_id == (chunk_count - 1);
 
       if (execute_directly) {
-        _validate_chunks(input_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id, output_chunks,
-                         output_mutex);
+        _validate_chunks(input_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id, output_chunks);
       } else {
-        jobs.push_back(std::make_shared<JobTask>([=, this, &output_chunks, &output_mutex] {
+        jobs.push_back(std::make_shared<JobTask>([=, this, &output_chunks] {
           _validate_chunks(input_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id,
-                           output_chunks, output_mutex);
+                           output_chunks);
         }));
 
         // Prepare next job
@@ -139,14 +139,15 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   }
 
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  std::erase(output_chunks, nullptr);
 
   return std::make_shared<Table>(input_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
 
 void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id_start,
                                 const ChunkID chunk_id_end, const TransactionID our_tid,
-                                const CommitID snapshot_commit_id, std::vector<std::shared_ptr<Chunk>>& output_chunks,
-                                std::mutex& output_mutex) const {
+                                const CommitID snapshot_commit_id,
+                                std::vector<std::shared_ptr<Chunk>>& output_chunks) const {
   // Stores whether a chunk has been found to be entirely visible. Only used for reference tables where no single
   // chunk guarantee has been given. Not stored in Validate object to avoid concurrency issues. This assumes that
   // only one table is referenced over all chunks. If, in the future, this is not true anymore, entirely_visible_chunks
@@ -199,10 +200,20 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
         } else {
           auto temp_pos_list = RowIDPosList{};
           temp_pos_list.guarantee_single_chunk();
-          for (auto row_id : *pos_list_in) {
-            if (hyrise::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-              temp_pos_list.emplace_back(row_id);
+          const auto add_visible_rows = [&](const auto& positions) {
+            for (const auto row_id : positions) {
+              if (hyrise::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
+                temp_pos_list.emplace_back(row_id);
+              }
             }
+          };
+
+          // The iterator of AbstractPosList looks up every position with the virtual operator[], which has to search
+          // the words of a BitmapPosList. The bitmap's own iterator only skips to the next set bit.
+          if (const auto bitmap_pos_list_in = std::dynamic_pointer_cast<const BitmapPosList>(pos_list_in)) {
+            add_visible_rows(*bitmap_pos_list_in);
+          } else {
+            add_visible_rows(*pos_list_in);
           }
           pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
         }
@@ -284,7 +295,6 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
     }
 
     if (!pos_list_out->empty()) {
-      const auto lock = std::lock_guard<std::mutex>{output_mutex};
       // The validate operator does not affect the sorted_by property. If a chunk has been sorted before, it still is
       // after the validate operator.
       const auto chunk = std::make_shared<Chunk>(output_segments);
@@ -294,7 +304,7 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
       if (!sorted_by.empty()) {
         chunk->set_individually_sorted_by(sorted_by);
       }
-      output_chunks.emplace_back(chunk);
+      output_chunks[chunk_id] = chunk;
     }
   }
 }
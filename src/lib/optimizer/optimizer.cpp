@@ -25,7 +25,9 @@
 #include "strategy/semi_join_reduction_removal_rule.hpp"
 #include "strategy/semi_join_reduction_rule.hpp"
 #include "strategy/stored_table_column_alignment_rule.hpp"
+#include "strategy/streaming_aggregate_rule.hpp"
 #include "strategy/subquery_to_join_rule.hpp"
+#include "strategy/top_k_rule.hpp"
 #include "utils/timer.hpp"
 
 namespace {
@@ -269,6 +271,12 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<PredicateMergeRule>());
 
+  // Only annotates SortNodes that are followed by a LimitNode, so it does not interfere with the other rules.
+  optimizer->add_rule(std::make_unique<TopKRule>());
+
+  // Only annotates AggregateNodes. Run it last so that no other rule changes the input of an annotated AggregateNode.
+  optimizer->add_rule(std::make_unique<StreamingAggregateRule>());
+
   return optimizer;
 }
 
@@ -0,0 +1,88 @@
+#include "streaming_aggregate_rule.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/sort_node.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+bool sort_node_groups_rows(const SortNode& sort_node,
+                           const std::vector<std::shared_ptr<AbstractExpression>>& group_by_expressions) {
+  const auto& sort_expressions = sort_node.node_expressions;
+  const auto group_by_count = group_by_expressions.size();
+  if (sort_expressions.size() >= group_by_count) {
+    const auto leading_sort_expressions = std::vector<std::shared_ptr<AbstractExpression>>(
+        sort_expressions.begin(), sort_expressions.begin() + static_cast<std::ptrdiff_t>(group_by_count));
+    if (contains_all_expressions(group_by_expressions, leading_sort_expressions) &&
+        contains_all_expressions(leading_sort_expressions, group_by_expressions)) {
+      return true;
+    }
+  }
+
+  if (group_by_count != 1) {
+    return false;
+  }
+
+  const auto& group_by_expression = *group_by_expressions.front();
+  const auto& first_sort_expression = *sort_expressions.front();
+  for (const auto& order_dependency : sort_node.order_dependencies()) {
+    if (order_dependency.ordering_expressions.size() == 1 &&
+        *order_dependency.ordering_expressions.front() == first_sort_expression &&
+        *order_dependency.ordered_expressions.front() == group_by_expression) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::string StreamingAggregateRule::name() const {
+  static const auto name = std::string{"StreamingAggregateRule"};
+  return name;
+}
+
+void StreamingAggregateRule::_apply_to_plan_without_subqueries(
+    const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type != LQPNodeType::Aggregate) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    auto& aggregate_node = static_cast<AggregateNode&>(*node);
+    const auto group_by_count = aggregate_node.aggregate_expressions_begin_idx;
+    if (group_by_count == 0) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    auto input_node = aggregate_node.left_input();
+    while (lqp_node_preserves_order(*input_node)) {
+      input_node = input_node->left_input();
+    }
+
+    if (input_node->type != LQPNodeType::Sort) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>(
+        aggregate_node.node_expressions.begin(),
+        aggregate_node.node_expressions.begin() + static_cast<std::ptrdiff_t>(group_by_count));
+    aggregate_node.input_is_sorted = sort_node_groups_rows(static_cast<const SortNode&>(*input_node),
+                                                           group_by_expressions);
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+}  // namespace hyrise
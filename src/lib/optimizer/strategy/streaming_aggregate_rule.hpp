@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace hyrise {
+
+class AbstractLQPNode;
+
+/**
+ * This rule finds AggregateNodes whose input is known to be sorted such that the rows of each group are consecutive
+ * and sets their input_is_sorted flag. The LQPTranslator then translates them into an AggregateSort that streams over
+ * its input instead of sorting it or building a hash table (see AggregateSort).
+ *
+ * The input is sorted if a SortNode is reached through nodes that preserve the order of their input (see
+ * lqp_node_preserves_order) and
+ *  - the SortNode sorts by all group-by expressions (in any order) before it sorts by other expressions, or
+ *  - there is a single group-by expression g, and an order dependency [x] |-> [g, ...] holds for the first sort
+ *    expression x. Sorting by x thus also sorts by g.
+ *
+ * Physical sortedness of stored tables is not considered here, as it can change when rows are inserted after the plan
+ * was cached. Instead, the LQPTranslator chooses an AggregateSort for such inputs, which checks the sortedness when it
+ * is executed.
+ */
+class StreamingAggregateRule : public AbstractRule {
+ public:
+  std::string name() const override;
+
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,70 @@
+#include "top_k_rule.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "expression/value_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/sort_node.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Returns the row count of a LIMIT if it is a non-negative integer literal. Parameters of prepared statements and other
+// expressions are only known when the Limit operator is executed.
+std::optional<size_t> constant_row_count(const LimitNode& limit_node) {
+  const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(limit_node.num_rows_expression());
+  if (!value_expression || variant_is_null(value_expression->value)) {
+    return std::nullopt;
+  }
+
+  auto row_count = int64_t{-1};
+  if (value_expression->data_type() == DataType::Int) {
+    row_count = boost::get<int32_t>(value_expression->value);
+  } else if (value_expression->data_type() == DataType::Long) {
+    row_count = boost::get<int64_t>(value_expression->value);
+  }
+
+  if (row_count < 0) {
+    return std::nullopt;
+  }
+
+  return static_cast<size_t>(row_count);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::string TopKRule::name() const {
+  static const auto name = std::string{"TopKRule"};
+  return name;
+}
+
+void TopKRule::_apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type != LQPNodeType::Limit || node->left_input()->type != LQPNodeType::Sort) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    auto& sort_node = static_cast<SortNode&>(*node->left_input());
+    if (sort_node.outputs().size() != 1) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto row_count = constant_row_count(static_cast<const LimitNode&>(*node));
+    if (!row_count) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    sort_node.top_k = row_count;
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+}  // namespace hyrise
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace hyrise {
+
+class AbstractLQPNode;
+
+/**
+ * This rule finds SortNodes that are directly followed by a LimitNode with a constant row count (ORDER BY ... LIMIT k)
+ * and sets the SortNode's top_k to k. The Sort operator then only determines the first k rows instead of sorting its
+ * entire input (see Sort).
+ *
+ * The LimitNode is kept, so the LQP remains valid if the SortNode is not translated into a Sort operator with top_k.
+ * SortNodes with multiple outputs are not modified, as other consumers might need all rows.
+ */
+class TopKRule : public AbstractRule {
+ public:
+  std::string name() const override;
+
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+};
+
+}  // namespace hyrise
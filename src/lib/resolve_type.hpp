@@ -16,6 +16,7 @@
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 
 namespace hyrise {
@@ -146,6 +147,14 @@ void resolve_pos_list_type(const std::shared_ptr<const AbstractPosList>& untyped
     } else if (const auto entire_chunk_pos_list =
                    std::dynamic_pointer_cast<const EntireChunkPosList>(untyped_pos_list)) {
       functor(entire_chunk_pos_list);
+    } else if (const auto bitmap_pos_list = std::dynamic_pointer_cast<const BitmapPosList>(untyped_pos_list)) {
+      // Instantiating every functor for BitmapPosList as well would considerably increase the compile time. As the
+      // positions of a bitmap are found by skipping to the next set bit, materializing them is cheap compared to the
+      // functors, which usually access the referenced segments for each position.
+      auto materialized_pos_list = std::make_shared<RowIDPosList>(bitmap_pos_list->cbegin(), bitmap_pos_list->cend());
+      materialized_pos_list->guarantee_single_chunk();
+      const auto row_id_pos_list = std::shared_ptr<const RowIDPosList>{std::move(materialized_pos_list)};
+      functor(row_id_pos_list);
     } else {
       Fail("Unrecognized PosList type encountered");
     }
@@ -0,0 +1,56 @@
+#include "job_utils.hpp"
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+void execute_jobs(const std::vector<std::function<void()>>& job_functions, const SchedulePriority priority) {
+  if (job_functions.size() == 1) {
+    job_functions.front()();
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_functions.size());
+  for (const auto& job_function : job_functions) {
+    jobs.emplace_back(std::make_shared<JobTask>(job_function, priority));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+void execute_jobs(const size_t job_count, const std::function<void(size_t)>& job_function,
+                  const SchedulePriority priority) {
+  auto job_functions = std::vector<std::function<void()>>{};
+  job_functions.reserve(job_count);
+  for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+    job_functions.emplace_back([&job_function, job_idx]() { job_function(job_idx); });
+  }
+  execute_jobs(job_functions, priority);
+}
+
+std::vector<std::pair<ChunkID, ChunkID>> chunk_ranges_for_jobs(const Table& table, const size_t min_row_count) {
+  auto chunk_ranges = std::vector<std::pair<ChunkID, ChunkID>>{};
+  auto range_begin_chunk_id = ChunkID{0};
+  auto range_row_count = size_t{0};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    range_row_count += chunk ? chunk->size() : 0;
+    if (range_row_count >= min_row_count || ChunkID{chunk_id + 1} == chunk_count) {
+      chunk_ranges.emplace_back(range_begin_chunk_id, ChunkID{chunk_id + 1});
+      range_begin_chunk_id = ChunkID{chunk_id + 1};
+      range_row_count = 0;
+    }
+  }
+  return chunk_ranges;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+
+/**
+ * Executes the given functions as JobTasks and waits for all of them to finish. A single function is executed
+ * directly, which avoids the scheduling overhead for small inputs. Operators use this for work that they partition
+ * into independent ranges of rows (e.g., Sort and the aggregate operators).
+ */
+void execute_jobs(const std::vector<std::function<void()>>& job_functions,
+                  SchedulePriority priority = SchedulePriority::Default);
+
+// Runs job_function for each index in [0, job_count) as above.
+void execute_jobs(size_t job_count, const std::function<void(size_t)>& job_function,
+                  SchedulePriority priority = SchedulePriority::Default);
+
+/**
+ * Groups consecutive chunks of the table into ranges [begin, end) of at least min_row_count rows (except for the last
+ * range), so that each range can be processed by its own job. Physically deleted chunks count as empty.
+ */
+std::vector<std::pair<ChunkID, ChunkID>> chunk_ranges_for_jobs(const Table& table, size_t min_row_count);
+
+}  // namespace hyrise
@@ -3,6 +3,7 @@
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
 #include "scheduler/task_utils.hpp"
 
 namespace {
@@ -45,6 +46,26 @@ std::shared_ptr<OperatorTask> add_operator_tasks_recursively(const std::shared_p
   return task;
 }
 
+/**
+ * Sets `predecessor` as predecessor of `task` if `predecessor` is not a successor of `task`. Cycles in the task graph
+ * would lead to deadlocks during execution.
+ */
+void set_as_predecessor_if_acyclic(const std::shared_ptr<OperatorTask>& predecessor,
+                                   const std::shared_ptr<OperatorTask>& task) {
+  auto is_acyclic = true;
+  visit_tasks_upwards(task, [&](const auto& successor) {
+    if (successor == predecessor) {
+      is_acyclic = false;
+      return TaskUpwardVisitation::DoNotVisitSuccessors;
+    }
+    return TaskUpwardVisitation::VisitSuccessors;
+  });
+
+  if (is_acyclic) {
+    predecessor->set_as_predecessor_of(task);
+  }
+}
+
 /**
  * Sets tasks that can be used to prune chunks by predicates with uncorrelated subqueries as successors of the GetTable
  * tasks. Guarantees that the resulting task graph is still acyclic.
@@ -63,21 +84,37 @@ void link_tasks_for_subquery_pruning(const std::unordered_set<std::shared_ptr<Op
         const auto& subquery_root = subquery->get_or_create_operator_task();
         Assert(tasks.contains(subquery_root), "Unknown OperatorTask.");
 
-        // Cycles in the task graph would lead to deadlocks during execution. To make sure we do not introcude cycles,
-        // we only set the subquery task as predecessor of the GetTable task if it is not a successor of the GetTable
-        // task.
-        auto is_acyclic = true;
-        visit_tasks_upwards(task, [&](const auto& successor) {
-          if (successor == subquery_root) {
-            is_acyclic = false;
-            return TaskUpwardVisitation::DoNotVisitSuccessors;
-          }
-          return TaskUpwardVisitation::VisitSuccessors;
-        });
+        set_as_predecessor_if_acyclic(subquery_root, task);
+      }
+    }
+  }
+}
 
-        if (is_acyclic) {
-          subquery_root->set_as_predecessor_of(task);
-        }
+/**
+ * Sets the tasks of the join inputs that provide runtime filters (see JoinRuntimeFilter) as predecessors of the
+ * GetTable and TableScan tasks that use these filters. Guarantees that the resulting task graph is still acyclic.
+ */
+void link_tasks_for_runtime_filters(const std::unordered_set<std::shared_ptr<OperatorTask>>& tasks) {
+  for (const auto& task : tasks) {
+    const auto& op = task->get_operator();
+    auto runtime_filters = std::vector<JoinRuntimeFilterReference>{};
+    if (op->type() == OperatorType::GetTable) {
+      runtime_filters = static_cast<const GetTable&>(*op).runtime_filters();
+    } else if (op->type() == OperatorType::TableScan) {
+      runtime_filters = static_cast<const TableScan&>(*op).runtime_filters();
+    }
+
+    for (const auto& runtime_filter : runtime_filters) {
+      const auto join = runtime_filter.join.lock();
+      Assert(join, "Runtime filter references expired join. PQP is invalid.");
+      const auto source_input =
+          runtime_filter.source_side == LQPInputSide::Left ? join->mutable_left_input() : join->mutable_right_input();
+
+      // If we only schedule a part of the PQP (which does not contain the join), the filter is simply not available
+      // during execution.
+      const auto& source_task = source_input->get_or_create_operator_task();
+      if (tasks.contains(source_task)) {
+        set_as_predecessor_if_acyclic(source_task, task);
       }
     }
   }
@@ -108,6 +145,10 @@ OperatorTask::make_tasks_from_operator(const std::shared_ptr<AbstractOperator>&
   // acyclic graph.
   link_tasks_for_subquery_pruning(operator_tasks_set);
 
+  // Similarly, GetTable and TableScan operators can use runtime filters of hash joins above them to discard rows
+  // without join partner. For that, the other input of the join has to be executed first.
+  link_tasks_for_runtime_filters(operator_tasks_set);
+
   // Ensure the task graph is acyclic, i.e., no task is any (n-th) successor of itself. Tasks in cycles would end up in
   // a deadlock during execution, mutually waiting for the other tasks' execution. Even if the tasks are never executed,
   // cycles create memory leaks since tasks hold shared pointers to their predecessors.
@@ -1,5 +1,6 @@
 #include "task_queue.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -74,9 +75,12 @@ size_t TaskQueue::estimate_load() const {
 
   // Simple heuristic to estimate the load: the higher the priority, the higher the costs. We use powers of two
   // (starting with 2^0) to calculate the cost factor per priority level.
+  constexpr auto DEFAULT_PRIORITY_LEVEL = static_cast<size_t>(SchedulePriority::Default);
   for (auto queue_id = size_t{0}; queue_id < NUM_PRIORITY_LEVELS; ++queue_id) {
-    // The lowest priority has a multiplier of 2^0, the next higher priority 2^1, and so on.
-    estimated_load += _queues[queue_id].unsafe_size() * (size_t{1} << (NUM_PRIORITY_LEVELS - 1 - queue_id));
+    // The default priority has a multiplier of 2^0, the next higher priority 2^1, and so on. Low priority tasks still
+    // occupy a worker once they are pulled, so they are counted like default priority tasks.
+    const auto priority_level = std::min(queue_id, DEFAULT_PRIORITY_LEVEL);
+    estimated_load += _queues[queue_id].unsafe_size() * (size_t{1} << (DEFAULT_PRIORITY_LEVEL - priority_level));
   }
 
   return estimated_load;
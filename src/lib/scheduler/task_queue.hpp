@@ -27,7 +27,7 @@ class AbstractTask;
  */
 class TaskQueue {
  public:
-  static constexpr uint32_t NUM_PRIORITY_LEVELS = 2;
+  static constexpr uint32_t NUM_PRIORITY_LEVELS = 3;
 
   TaskQueue() = delete;
 
@@ -53,7 +53,7 @@ class TaskQueue {
    * Returns the estimated load for the TaskQueue (i.e., all queues of the TaskQueue instance). The load is "estimated"
    * as TBB's concurrent queue does not guarantee that `unsafe_size()` returns the correct size at a given point in
    * time. The priority queues are weighted, i.e., a task in the high priority queue leads to a larger load than a task
-   * in the default priority queue.
+   * in the default priority queue. Tasks of low priority are weighted like tasks of default priority.
    */
   size_t estimate_load() const;
 
@@ -2,6 +2,7 @@
 
 #include "storage/dictionary_segment/dictionary_segment_iterable.hpp"
 #include "storage/frame_of_reference_segment/frame_of_reference_segment_iterable.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/lz4_segment/lz4_segment_iterable.hpp"
 #include "storage/run_length_segment/run_length_segment_iterable.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
@@ -81,4 +82,18 @@ auto create_iterable_from_segment(const LZ4Segment<T>& segment) {
   return AnySegmentIterable<T>(LZ4SegmentIterable<T>(segment));
 }
 
+template <typename T, bool EraseSegmentType>
+auto create_iterable_from_segment(const FSSTSegment<T>& segment) {
+#ifdef HYRISE_ERASE_FSST
+  PerformanceWarning("FSSTSegmentIterable erased by compile-time setting");
+  return AnySegmentIterable<T>(FSSTSegmentIterable<T>(segment));
+#else
+  if constexpr (EraseSegmentType) {
+    return create_any_segment_iterable<T>(segment);
+  } else {
+    return FSSTSegmentIterable<T>{segment};
+  }
+#endif
+}
+
 }  // namespace hyrise
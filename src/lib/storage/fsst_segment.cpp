@@ -0,0 +1,137 @@
+#include "fsst_segment.hpp"
+
+#include <climits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace hyrise {
+
+template <typename T>
+FSSTSegment<T>::FSSTSegment(FSSTSymbolTable symbol_table, pmr_vector<uint8_t> codes,
+                            std::unique_ptr<const BaseCompressedVector> code_offsets,
+                            std::optional<pmr_vector<bool>> null_values)
+    : AbstractEncodedSegment{data_type_from_type<T>()},
+      _symbol_table{std::move(symbol_table)},
+      _codes{std::move(codes)},
+      _code_offsets{std::move(code_offsets)},
+      _null_values{std::move(null_values)},
+      _decompressor{_code_offsets->create_base_decompressor()} {
+  Assert(_code_offsets->size() > 0, "The code offsets must contain the end of the last string");
+  Assert(!_null_values || _null_values->size() == _code_offsets->size() - 1,
+         "NULL values and code offsets do not match");
+}
+
+template <typename T>
+const FSSTSymbolTable& FSSTSegment<T>::symbol_table() const {
+  return _symbol_table;
+}
+
+template <typename T>
+const pmr_vector<uint8_t>& FSSTSegment<T>::codes() const {
+  return _codes;
+}
+
+template <typename T>
+const BaseCompressedVector& FSSTSegment<T>::code_offsets() const {
+  return *_code_offsets;
+}
+
+template <typename T>
+const std::optional<pmr_vector<bool>>& FSSTSegment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+AllTypeVariant FSSTSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T>
+std::optional<T> FSSTSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "ChunkOffset out of bounds.");
+
+  if (_null_values && (*_null_values)[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  const auto code_begin = _decompressor->get(chunk_offset);
+  const auto code_count = _decompressor->get(chunk_offset + 1) - code_begin;
+
+  auto value = T(code_count * FSSTSymbolTable::MAX_SYMBOL_LENGTH, '\0');
+  value.resize(_symbol_table.decode(_codes.data() + code_begin, code_count, value.data()));
+  return value;
+}
+
+template <typename T>
+ChunkOffset FSSTSegment<T>::size() const {
+  return static_cast<ChunkOffset>(_code_offsets->size() - 1);
+}
+
+template <typename T>
+std::string_view FSSTSegment<T>::decode(const size_t code_begin, const size_t code_end,
+                                        std::vector<char>& buffer) const {
+  const auto code_count = code_end - code_begin;
+  const auto required_size = code_count * FSSTSymbolTable::MAX_SYMBOL_LENGTH;
+  if (buffer.size() < required_size) {
+    buffer.resize(required_size);
+  }
+
+  const auto length = _symbol_table.decode(_codes.data() + code_begin, code_count, buffer.data());
+  return std::string_view{buffer.data(), length};
+}
+
+template <typename T>
+std::shared_ptr<AbstractSegment> FSSTSegment<T>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_symbol_table = _symbol_table.copy_using_allocator(alloc);
+  auto new_codes = pmr_vector<uint8_t>(_codes, alloc);
+  auto new_code_offsets = _code_offsets->copy_using_allocator(alloc);
+
+  auto new_null_values = std::optional<pmr_vector<bool>>{};
+  if (_null_values) {
+    new_null_values = pmr_vector<bool>(*_null_values, alloc);
+  }
+
+  auto copy = std::make_shared<FSSTSegment<T>>(std::move(new_symbol_table), std::move(new_codes),
+                                               std::move(new_code_offsets), std::move(new_null_values));
+  copy->access_counter = access_counter;
+  return copy;
+}
+
+template <typename T>
+size_t FSSTSegment<T>::memory_usage(const MemoryUsageCalculationMode /*mode*/) const {
+  // MemoryUsageCalculationMode ignored since full calculation is efficient.
+  auto segment_size = sizeof(*this) + _symbol_table.data_size() + _codes.capacity() + _code_offsets->data_size();
+
+  if (_null_values) {
+    segment_size += _null_values->capacity() / CHAR_BIT;
+  }
+
+  return segment_size;
+}
+
+template <typename T>
+EncodingType FSSTSegment<T>::encoding_type() const {
+  return EncodingType::FSST;
+}
+
+template <typename T>
+std::optional<CompressedVectorType> FSSTSegment<T>::compressed_vector_type() const {
+  return _code_offsets->type();
+}
+
+template class FSSTSegment<pmr_string>;
+
+}  // namespace hyrise
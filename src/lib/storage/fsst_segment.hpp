@@ -0,0 +1,88 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "abstract_encoded_segment.hpp"
+#include "fsst_segment/fsst_symbol_table.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing FSST-style string compression
+ *
+ * Each string is compressed into a sequence of one-byte codes using a symbol table that is built per segment (see
+ * FSSTSymbolTable). The codes of all strings are stored back to back. The codes of the string at chunk offset i are
+ * located in [code_offsets[i], code_offsets[i + 1]), i.e., code_offsets has one more entry than the segment has rows.
+ * The offsets are compressed using vector compression.
+ *
+ * In contrast to LZ4Segment, a single value can be decoded without decompressing a block of its neighbors. In contrast
+ * to dictionary encoding, the segment does not grow with the number of distinct values, which makes it a good fit for
+ * long strings of high cardinality, such as comments or URLs.
+ *
+ * NULL values have no codes. If the segment does not contain any NULL value, std::nullopt is stored instead of the
+ * NULL value vector.
+ */
+template <typename T>
+class FSSTSegment : public AbstractEncodedSegment {
+ public:
+  explicit FSSTSegment(FSSTSymbolTable symbol_table, pmr_vector<uint8_t> codes,
+                       std::unique_ptr<const BaseCompressedVector> code_offsets,
+                       std::optional<pmr_vector<bool>> null_values);
+
+  const FSSTSymbolTable& symbol_table() const;
+  const pmr_vector<uint8_t>& codes() const;
+  const BaseCompressedVector& code_offsets() const;
+  const std::optional<pmr_vector<bool>>& null_values() const;
+
+  /**
+   * @defgroup AbstractSegment interface
+   * @{
+   */
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  ChunkOffset size() const final;
+
+  std::shared_ptr<AbstractSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t memory_usage(const MemoryUsageCalculationMode /*mode*/) const final;
+
+  /**@}*/
+
+  /**
+   * Decodes the string whose codes are in [code_begin, code_end) into buffer and returns a view on it. The buffer is
+   * only grown, so that it can be reused to decode many strings without allocating memory for each of them.
+   */
+  std::string_view decode(const size_t code_begin, const size_t code_end, std::vector<char>& buffer) const;
+
+  /**
+   * @defgroup AbstractEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  const FSSTSymbolTable _symbol_table;
+  const pmr_vector<uint8_t> _codes;
+  const std::unique_ptr<const BaseCompressedVector> _code_offsets;
+  const std::optional<pmr_vector<bool>> _null_values;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+extern template class FSSTSegment<pmr_string>;
+
+}  // namespace hyrise
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storage/base_segment_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/segment_iterables/any_segment_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace hyrise {
+
+/**
+ * @brief Encodes a string segment using FSST-style compression
+ *
+ * The encoder builds a symbol table from a sample of the segment's values (see FSSTSymbolTable) and compresses every
+ * value with it. The offsets of the values' codes are compressed using vector compression.
+ */
+class FSSTEncoder : public SegmentEncoder<FSSTEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::FSST>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  std::shared_ptr<AbstractEncodedSegment> _on_encode(const AnySegmentIterable<pmr_string> segment_iterable,
+                                                     const PolymorphicAllocator<pmr_string>& allocator) {
+    auto values = std::vector<pmr_string>{};
+    auto null_values = pmr_vector<bool>{allocator};
+    auto segment_contains_null = false;
+
+    segment_iterable.with_iterators([&](auto it, const auto end) {
+      const auto segment_size = static_cast<size_t>(std::distance(it, end));
+      values.resize(segment_size);
+      null_values.resize(segment_size);
+
+      for (auto row_index = size_t{0}; it != end; ++it, ++row_index) {
+        const auto segment_value = *it;
+        if (segment_value.is_null()) {
+          null_values[row_index] = true;
+          segment_contains_null = true;
+        } else {
+          values[row_index] = segment_value.value();
+        }
+      }
+    });
+
+    // NULL values are stored as empty strings and thus do not influence the symbol table.
+    auto symbol_table = FSSTSymbolTable::build(values, allocator);
+
+    const auto row_count = values.size();
+    auto codes = pmr_vector<uint8_t>{allocator};
+    auto code_offsets = pmr_vector<uint32_t>(row_count + 1, allocator);
+    for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+      code_offsets[row_index] = static_cast<uint32_t>(codes.size());
+      symbol_table.encode(values[row_index], codes);
+      Assert(codes.size() <= std::numeric_limits<uint32_t>::max(), "Codes of FSST segment exceed 4 GB");
+    }
+    code_offsets[row_count] = static_cast<uint32_t>(codes.size());
+    codes.shrink_to_fit();
+
+    auto compressed_code_offsets = compress_vector(code_offsets, vector_compression_type(), allocator,
+                                                   {static_cast<uint32_t>(codes.size())});
+
+    auto optional_null_values =
+        segment_contains_null ? std::optional<pmr_vector<bool>>{std::move(null_values)} : std::nullopt;
+
+    return std::make_shared<FSSTSegment<pmr_string>>(std::move(symbol_table), std::move(codes),
+                                                     std::move(compressed_code_offsets),
+                                                     std::move(optional_null_values));
+  }
+};
+
+}  // namespace hyrise
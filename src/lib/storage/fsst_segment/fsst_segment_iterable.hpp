@@ -0,0 +1,159 @@
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+#include "storage/abstract_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/segment_iterables.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace hyrise {
+
+template <typename T>
+class FSSTSegmentIterable : public PointAccessibleSegmentIterable<FSSTSegmentIterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit FSSTSegmentIterable(const FSSTSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
+    resolve_compressed_vector_type(_segment.code_offsets(), [&](const auto& code_offsets) {
+      using CodeOffsetDecompressor = std::decay_t<decltype(code_offsets.create_decompressor())>;
+
+      auto begin = Iterator<CodeOffsetDecompressor>{&_segment, code_offsets.create_decompressor(), ChunkOffset{0}};
+      auto end = Iterator<CodeOffsetDecompressor>{&_segment, code_offsets.create_decompressor(),
+                                                  static_cast<ChunkOffset>(_segment.size())};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor, typename PosListType>
+  void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
+    resolve_compressed_vector_type(_segment.code_offsets(), [&](const auto& code_offsets) {
+      using CodeOffsetDecompressor = std::decay_t<decltype(code_offsets.create_decompressor())>;
+      using PosListIteratorType = std::decay_t<decltype(position_filter->cbegin())>;
+
+      auto begin = PointAccessIterator<CodeOffsetDecompressor, PosListIteratorType>{
+          &_segment, code_offsets.create_decompressor(), position_filter->cbegin(), position_filter->cbegin()};
+      auto end = PointAccessIterator<CodeOffsetDecompressor, PosListIteratorType>{
+          &_segment, code_offsets.create_decompressor(), position_filter->cbegin(), position_filter->cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const {
+    return _segment.size();
+  }
+
+ private:
+  const FSSTSegment<T>& _segment;
+
+  // Decodes the value at chunk_offset. The strings share a buffer, so that decoding does not allocate memory besides
+  // the returned string.
+  template <typename CodeOffsetDecompressor>
+  static T _decode(const FSSTSegment<T>& segment, CodeOffsetDecompressor& code_offset_decompressor,
+                   std::vector<char>& buffer, const ChunkOffset chunk_offset) {
+    const auto code_begin = code_offset_decompressor.get(chunk_offset);
+    const auto code_end = code_offset_decompressor.get(chunk_offset + 1);
+    return T{segment.decode(code_begin, code_end, buffer)};
+  }
+
+ private:
+  template <typename CodeOffsetDecompressor>
+  class Iterator : public AbstractSegmentIterator<Iterator<CodeOffsetDecompressor>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = FSSTSegmentIterable<T>;
+
+    Iterator(const FSSTSegment<T>* segment, CodeOffsetDecompressor code_offset_decompressor,
+             ChunkOffset chunk_offset)
+        : _segment{segment},
+          _code_offset_decompressor{std::move(code_offset_decompressor)},
+          _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_chunk_offset;
+    }
+
+    void decrement() {
+      --_chunk_offset;
+    }
+
+    void advance(std::ptrdiff_t n) {
+      _chunk_offset += n;
+    }
+
+    bool equal(const Iterator& other) const {
+      return _chunk_offset == other._chunk_offset;
+    }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._chunk_offset) - _chunk_offset;
+    }
+
+    SegmentPosition<T> dereference() const {
+      const auto& null_values = _segment->null_values();
+      if (null_values && (*null_values)[_chunk_offset]) {
+        return SegmentPosition<T>{T{}, true, _chunk_offset};
+      }
+
+      return SegmentPosition<T>{_decode(*_segment, _code_offset_decompressor, _buffer, _chunk_offset), false,
+                                _chunk_offset};
+    }
+
+   private:
+    const FSSTSegment<T>* _segment;
+    mutable CodeOffsetDecompressor _code_offset_decompressor;
+    mutable std::vector<char> _buffer;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename CodeOffsetDecompressor, typename PosListIteratorType>
+  class PointAccessIterator
+      : public AbstractPointAccessSegmentIterator<PointAccessIterator<CodeOffsetDecompressor, PosListIteratorType>,
+                                                  SegmentPosition<T>, PosListIteratorType> {
+   public:
+    using ValueType = T;
+    using IterableType = FSSTSegmentIterable<T>;
+
+    PointAccessIterator(const FSSTSegment<T>* segment, CodeOffsetDecompressor code_offset_decompressor,
+                        PosListIteratorType position_filter_begin, PosListIteratorType position_filter_it)
+        : AbstractPointAccessSegmentIterator<PointAccessIterator<CodeOffsetDecompressor, PosListIteratorType>,
+                                             SegmentPosition<T>, PosListIteratorType>{std::move(position_filter_begin),
+                                                                                      std::move(position_filter_it)},
+          _segment{segment},
+          _code_offset_decompressor{std::move(code_offset_decompressor)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto current_offset = chunk_offsets.offset_in_referenced_chunk;
+
+      const auto& null_values = _segment->null_values();
+      if (null_values && (*null_values)[current_offset]) {
+        return SegmentPosition<T>{T{}, true, chunk_offsets.offset_in_poslist};
+      }
+
+      return SegmentPosition<T>{_decode(*_segment, _code_offset_decompressor, _buffer, current_offset), false,
+                                chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const FSSTSegment<T>* _segment;
+    mutable CodeOffsetDecompressor _code_offset_decompressor;
+    mutable std::vector<char> _buffer;
+  };
+};
+
+}  // namespace hyrise
@@ -0,0 +1,185 @@
+#include "fsst_symbol_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+namespace {
+
+// Loads up to eight bytes of value starting at position into a word. Bytes after the end of value are zero.
+uint64_t load_word(const std::string_view value, const size_t position) {
+  auto word = uint64_t{0};
+  std::memcpy(&word, value.data() + position, std::min(value.size() - position, FSSTSymbolTable::MAX_SYMBOL_LENGTH));
+  return word;
+}
+
+uint64_t symbol_mask(const size_t length) {
+  return length == FSSTSymbolTable::MAX_SYMBOL_LENGTH ? ~uint64_t{0} : (uint64_t{1} << (length * 8)) - 1;
+}
+
+}  // namespace
+
+FSSTSymbolTable::FSSTSymbolTable(pmr_vector<uint64_t>&& symbols, pmr_vector<uint8_t>&& lengths)
+    : _symbols{std::move(symbols)}, _lengths{std::move(lengths)} {
+  const auto symbol_count = _symbols.size();
+  Assert(symbol_count == _lengths.size(), "Each symbol needs a length");
+  Assert(symbol_count <= MAX_SYMBOL_COUNT, "Too many symbols, the last code is reserved for escaping bytes");
+
+  auto code = size_t{0};
+  for (auto byte = size_t{0}; byte < 256; ++byte) {
+    _first_code_by_byte[byte] = static_cast<uint16_t>(code);
+    for (; code < symbol_count && (_symbols[code] & 0xFF) == byte; ++code) {
+      DebugAssert(_lengths[code] >= 1 && _lengths[code] <= MAX_SYMBOL_LENGTH, "Invalid symbol length");
+      DebugAssert((_symbols[code] & ~symbol_mask(_lengths[code])) == 0, "Bytes after the symbol must be zero");
+      DebugAssert(code == _first_code_by_byte[byte] || _lengths[code - 1] >= _lengths[code],
+                  "Symbols with the same first byte must be sorted by descending length");
+    }
+  }
+  _first_code_by_byte[256] = static_cast<uint16_t>(code);
+  Assert(code == symbol_count, "Symbols must be sorted by their first byte");
+}
+
+FSSTSymbolTable FSSTSymbolTable::build(const std::vector<pmr_string>& values,
+                                       const PolymorphicAllocator<size_t>& allocator) {
+  // Take values spread over the whole segment until the sample is full.
+  auto total_size = size_t{0};
+  for (const auto& value : values) {
+    total_size += value.size();
+  }
+
+  const auto stride = std::max(size_t{1}, total_size / SAMPLE_SIZE);
+  const auto value_count = values.size();
+  auto sample = std::vector<std::string_view>{};
+  auto sample_size = size_t{0};
+  for (auto value_idx = size_t{0}; value_idx < value_count && sample_size < SAMPLE_SIZE; value_idx += stride) {
+    sample.emplace_back(values[value_idx]);
+    sample_size += values[value_idx].size();
+  }
+
+  auto symbol_table = FSSTSymbolTable{pmr_vector<uint64_t>{allocator}, pmr_vector<uint8_t>{allocator}};
+
+  for (auto generation = size_t{0}; generation < GENERATION_COUNT; ++generation) {
+    // Encode the sample with the current table and sum up the bytes each symbol and each concatenation of two adjacent
+    // symbols would have covered. Starting from single bytes, the maximum length of the symbols doubles with every
+    // generation.
+    auto gains = std::unordered_map<std::string, size_t>{};
+    for (const auto value : sample) {
+      auto previous_symbol = std::string_view{};
+      for (auto position = size_t{0}; position < value.size();) {
+        const auto length = symbol_table._match(value, position).second;
+        const auto symbol = value.substr(position, length);
+        gains[std::string{symbol}] += length;
+
+        const auto pair_length = previous_symbol.size() + length;
+        if (!previous_symbol.empty() && pair_length <= MAX_SYMBOL_LENGTH) {
+          // Both symbols are adjacent in value.
+          gains[std::string{previous_symbol.data(), pair_length}] += pair_length;
+        }
+
+        previous_symbol = symbol;
+        position += length;
+      }
+    }
+
+    // Keep the candidates with the highest gains. Ties are broken by the symbol so that the table does not depend on
+    // the iteration order of the hash map.
+    auto candidates = std::vector<std::pair<std::string, size_t>>(gains.begin(), gains.end());
+    const auto candidate_count = std::min(candidates.size(), MAX_SYMBOL_COUNT);
+    std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(candidate_count),
+                      candidates.end(), [](const auto& lhs, const auto& rhs) {
+                        return lhs.second > rhs.second || (lhs.second == rhs.second && lhs.first < rhs.first);
+                      });
+    candidates.resize(candidate_count);
+
+    std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+      const auto lhs_first_byte = static_cast<uint8_t>(lhs.first.front());
+      const auto rhs_first_byte = static_cast<uint8_t>(rhs.first.front());
+      return lhs_first_byte < rhs_first_byte ||
+             (lhs_first_byte == rhs_first_byte && lhs.first.size() > rhs.first.size());
+    });
+
+    auto symbols = pmr_vector<uint64_t>{allocator};
+    auto lengths = pmr_vector<uint8_t>{allocator};
+    symbols.reserve(candidate_count);
+    lengths.reserve(candidate_count);
+    for (const auto& [symbol, gain] : candidates) {
+      symbols.push_back(load_word(symbol, 0));
+      lengths.push_back(static_cast<uint8_t>(symbol.size()));
+    }
+
+    symbol_table = FSSTSymbolTable{std::move(symbols), std::move(lengths)};
+  }
+
+  return symbol_table;
+}
+
+void FSSTSymbolTable::encode(const std::string_view value, pmr_vector<uint8_t>& codes) const {
+  const auto value_size = value.size();
+  for (auto position = size_t{0}; position < value_size;) {
+    const auto [code, length] = _match(value, position);
+    codes.push_back(code);
+    if (code == ESCAPE_CODE) {
+      codes.push_back(static_cast<uint8_t>(value[position]));
+    }
+    position += length;
+  }
+}
+
+size_t FSSTSymbolTable::decode(const uint8_t* codes, const size_t code_count, char* output) const {
+  auto* output_it = output;
+  for (auto code_idx = size_t{0}; code_idx < code_count; ++code_idx) {
+    const auto code = codes[code_idx];
+    if (code == ESCAPE_CODE) {
+      ++code_idx;
+      DebugAssert(code_idx < code_count, "Escape code must be followed by a byte");
+      *output_it = static_cast<char>(codes[code_idx]);
+      ++output_it;
+    } else {
+      // Always copy the full word. This is cheaper than copying only the symbol's bytes and the bytes after it are
+      // overwritten by the following symbols.
+      std::memcpy(output_it, &_symbols[code], sizeof(uint64_t));
+      output_it += _lengths[code];
+    }
+  }
+  return static_cast<size_t>(output_it - output);
+}
+
+const pmr_vector<uint64_t>& FSSTSymbolTable::symbols() const {
+  return _symbols;
+}
+
+const pmr_vector<uint8_t>& FSSTSymbolTable::lengths() const {
+  return _lengths;
+}
+
+FSSTSymbolTable FSSTSymbolTable::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  return FSSTSymbolTable{pmr_vector<uint64_t>{_symbols, alloc}, pmr_vector<uint8_t>{_lengths, alloc}};
+}
+
+size_t FSSTSymbolTable::data_size() const {
+  return _symbols.capacity() * sizeof(uint64_t) + _lengths.capacity() * sizeof(uint8_t);
+}
+
+std::pair<uint8_t, size_t> FSSTSymbolTable::_match(const std::string_view value, const size_t position) const {
+  const auto remaining_length = value.size() - position;
+  const auto word = load_word(value, position);
+  const auto first_byte = word & 0xFF;
+
+  // Symbols with the same first byte are sorted by descending length, so the first match is the longest one.
+  const auto code_end = _first_code_by_byte[first_byte + 1];
+  for (auto code = _first_code_by_byte[first_byte]; code < code_end; ++code) {
+    const auto length = _lengths[code];
+    if (length <= remaining_length && (word & symbol_mask(length)) == _symbols[code]) {
+      return {static_cast<uint8_t>(code), length};
+    }
+  }
+
+  return {ESCAPE_CODE, 1};
+}
+
+}  // namespace hyrise
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * @brief Static symbol table of an FSST segment (Fast Static Symbol Table, Boncz et al., VLDB 2020)
+ *
+ * The table holds up to 255 symbols of one to eight bytes. A string is compressed by replacing it with a sequence of
+ * one-byte codes, each of which references a symbol of the table. Bytes that are not covered by any symbol are stored
+ * as the escape code followed by the literal byte. As the table is static for a segment, every string can be decoded
+ * on its own without touching its neighbors, which makes point access as cheap as a lookup of eight bytes per code.
+ *
+ * Symbols are stored as little-endian 64-bit words whose unused high bytes are zero. They are sorted by their first
+ * byte and, for the same first byte, by descending length. Encoding greedily picks the longest symbol that matches at
+ * the current position, so only the symbols starting with the current byte have to be checked. As this choice only
+ * depends on the string and the table, equal strings always have equal codes. Thus, equality predicates can be
+ * evaluated on the codes without decoding them.
+ *
+ * Compared to the original FSST, symbols are found with a per-byte index instead of a hash table and the table is
+ * built from pairs of adjacent symbols in a fixed number of generations.
+ */
+class FSSTSymbolTable {
+ public:
+  static constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+  static constexpr auto MAX_SYMBOL_LENGTH = size_t{8};
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+
+  // The table is built from a sample of at most this many bytes of the values to encode.
+  static constexpr auto SAMPLE_SIZE = size_t{16'384};
+
+  // Each generation encodes the sample with the previous table and replaces it with the symbols and pairs of adjacent
+  // symbols that would have saved the most bytes.
+  static constexpr auto GENERATION_COUNT = size_t{5};
+
+  // Symbols must be sorted as described above, lengths must lie in [1, MAX_SYMBOL_LENGTH].
+  FSSTSymbolTable(pmr_vector<uint64_t>&& symbols, pmr_vector<uint8_t>&& lengths);
+
+  // Builds a table from a sample of the given values.
+  static FSSTSymbolTable build(const std::vector<pmr_string>& values, const PolymorphicAllocator<size_t>& allocator);
+
+  // Appends the codes of value to codes.
+  void encode(const std::string_view value, pmr_vector<uint8_t>& codes) const;
+
+  // Writes the string represented by code_count codes to output and returns its length. As every symbol is written as
+  // a full 64-bit word, output must provide space for code_count * MAX_SYMBOL_LENGTH bytes.
+  size_t decode(const uint8_t* codes, const size_t code_count, char* output) const;
+
+  const pmr_vector<uint64_t>& symbols() const;
+  const pmr_vector<uint8_t>& lengths() const;
+
+  FSSTSymbolTable copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const;
+
+  size_t data_size() const;
+
+ private:
+  // Returns the code and length of the longest symbol matching value at position. If no symbol matches, the escape
+  // code and a length of one are returned.
+  std::pair<uint8_t, size_t> _match(const std::string_view value, const size_t position) const;
+
+  pmr_vector<uint64_t> _symbols;
+  pmr_vector<uint8_t> _lengths;
+
+  // The codes of all symbols starting with byte b are in [_first_code_by_byte[b], _first_code_by_byte[b + 1]).
+  std::array<uint16_t, 257> _first_code_by_byte{};
+};
+
+}  // namespace hyrise
@@ -0,0 +1,167 @@
+#include "bitmap_pos_list.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace hyrise {
+
+BitmapPosList::BitmapPosList(const ChunkID common_chunk_id, const ChunkOffset chunk_size,
+                             std::vector<uint64_t>&& words)
+    : _common_chunk_id(common_chunk_id), _chunk_size(chunk_size), _words(std::move(words)) {
+  DebugAssert(_common_chunk_id != INVALID_CHUNK_ID, "Cannot create BitmapPosList for INVALID_CHUNK_ID");
+  Assert(_words.size() == word_count(_chunk_size), "Number of words does not match the chunk size");
+  DebugAssert(_chunk_size % WORD_SIZE == 0 || (_words.back() >> (_chunk_size % WORD_SIZE)) == 0,
+              "Bits after the chunk size must not be set");
+  _compute_word_ranks();
+}
+
+std::shared_ptr<BitmapPosList> BitmapPosList::intersect(const BitmapPosList& lhs, const BitmapPosList& rhs) {
+  Assert(lhs._common_chunk_id == rhs._common_chunk_id, "Cannot intersect bitmaps of different chunks");
+  const auto chunk_size = std::min(lhs._chunk_size, rhs._chunk_size);
+  const auto word_count = BitmapPosList::word_count(chunk_size);
+
+  // Plain loops over the words without any branches, so that the compiler can vectorize them.
+  auto words = std::vector<uint64_t>(word_count);
+  const auto* lhs_words = lhs._words.data();
+  const auto* rhs_words = rhs._words.data();
+  for (auto word_idx = size_t{0}; word_idx < word_count; ++word_idx) {
+    words[word_idx] = lhs_words[word_idx] & rhs_words[word_idx];
+  }
+
+  return std::make_shared<BitmapPosList>(lhs._common_chunk_id, chunk_size, std::move(words));
+}
+
+std::shared_ptr<BitmapPosList> BitmapPosList::unite(const BitmapPosList& lhs, const BitmapPosList& rhs) {
+  Assert(lhs._common_chunk_id == rhs._common_chunk_id, "Cannot unite bitmaps of different chunks");
+  const auto& larger = lhs._chunk_size >= rhs._chunk_size ? lhs : rhs;
+  const auto& smaller = lhs._chunk_size >= rhs._chunk_size ? rhs : lhs;
+  const auto common_word_count = smaller._words.size();
+
+  auto words = larger._words;
+  const auto* smaller_words = smaller._words.data();
+  for (auto word_idx = size_t{0}; word_idx < common_word_count; ++word_idx) {
+    words[word_idx] |= smaller_words[word_idx];
+  }
+
+  return std::make_shared<BitmapPosList>(lhs._common_chunk_id, larger._chunk_size, std::move(words));
+}
+
+bool BitmapPosList::references_single_chunk() const {
+  return true;
+}
+
+ChunkID BitmapPosList::common_chunk_id() const {
+  return _common_chunk_id;
+}
+
+RowID BitmapPosList::operator[](const size_t index) const {
+  DebugAssert(index < size(), "Index out of range");
+
+  // Find the last word with fewer set bits before it than index, i.e., the word that holds the position.
+  const auto word_it = std::upper_bound(_word_ranks.cbegin(), _word_ranks.cend(), index) - 1;
+  const auto word_idx = static_cast<size_t>(std::distance(_word_ranks.cbegin(), word_it));
+
+  // Find the position in the word by repeatedly halving the range of bits that holds it, using the number of set
+  // bits in the lower half of the range.
+  auto word = _words[word_idx];
+  auto remaining_rank = index - *word_it;
+  auto chunk_offset = word_idx * WORD_SIZE;
+  for (auto width = WORD_SIZE / 2; width > 0; width /= 2) {
+    const auto lower_half_count = static_cast<size_t>(std::popcount(word & ((uint64_t{1} << width) - 1)));
+    if (remaining_rank >= lower_half_count) {
+      remaining_rank -= lower_half_count;
+      word >>= width;
+      chunk_offset += width;
+    }
+  }
+
+  return RowID{_common_chunk_id, ChunkOffset{static_cast<ChunkOffset::base_type>(chunk_offset)}};
+}
+
+ChunkOffset BitmapPosList::chunk_size() const {
+  return _chunk_size;
+}
+
+const std::vector<uint64_t>& BitmapPosList::words() const {
+  return _words;
+}
+
+bool BitmapPosList::empty() const {
+  return size() == 0;
+}
+
+size_t BitmapPosList::size() const {
+  return _word_ranks.back();
+}
+
+size_t BitmapPosList::memory_usage(const MemoryUsageCalculationMode /*mode*/) const {
+  return sizeof *this + _words.capacity() * sizeof(uint64_t) +
+         _word_ranks.capacity() * sizeof(ChunkOffset::base_type);
+}
+
+BitmapPosList::Iterator BitmapPosList::begin() const {
+  return {this, 0, _next_set_bit(ChunkOffset{0})};
+}
+
+BitmapPosList::Iterator BitmapPosList::end() const {
+  return {this, size(), _chunk_size};
+}
+
+BitmapPosList::Iterator BitmapPosList::cbegin() const {
+  return begin();
+}
+
+BitmapPosList::Iterator BitmapPosList::cend() const {
+  return end();
+}
+
+void BitmapPosList::_compute_word_ranks() {
+  const auto word_count = _words.size();
+  _word_ranks.resize(word_count + 1);
+
+  auto rank = ChunkOffset::base_type{0};
+  for (auto word_idx = size_t{0}; word_idx < word_count; ++word_idx) {
+    _word_ranks[word_idx] = rank;
+    rank += std::popcount(_words[word_idx]);
+  }
+  _word_ranks[word_count] = rank;
+}
+
+ChunkOffset BitmapPosList::_next_set_bit(const ChunkOffset chunk_offset) const {
+  if (chunk_offset >= _chunk_size) {
+    return _chunk_size;
+  }
+
+  auto word_idx = chunk_offset / WORD_SIZE;
+  // Ignore the bits before chunk_offset in its word.
+  auto word = _words[word_idx] & (~uint64_t{0} << (chunk_offset % WORD_SIZE));
+  const auto word_count = _words.size();
+  while (word == 0) {
+    ++word_idx;
+    if (word_idx == word_count) {
+      return _chunk_size;
+    }
+    word = _words[word_idx];
+  }
+
+  return ChunkOffset{static_cast<ChunkOffset::base_type>(word_idx * WORD_SIZE + std::countr_zero(word))};
+}
+
+ChunkOffset BitmapPosList::_previous_set_bit(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset > 0, "No position before the first row");
+  const auto last_offset = chunk_offset - 1;
+
+  auto word_idx = last_offset / WORD_SIZE;
+  // Ignore the bits after last_offset in its word.
+  auto word = _words[word_idx] & (~uint64_t{0} >> (WORD_SIZE - 1 - last_offset % WORD_SIZE));
+  while (word == 0) {
+    DebugAssert(word_idx > 0, "No set bit before the given position");
+    --word_idx;
+    word = _words[word_idx];
+  }
+
+  return ChunkOffset{
+      static_cast<ChunkOffset::base_type>(word_idx * WORD_SIZE + WORD_SIZE - 1 - std::countl_zero(word))};
+}
+
+}  // namespace hyrise
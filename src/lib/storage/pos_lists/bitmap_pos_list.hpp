@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include "abstract_pos_list.hpp"
+
+namespace hyrise {
+
+/**
+ * A BitmapPosList references the rows of a single chunk with one bit per row: bit i of the bitmap is set if the row at
+ * ChunkOffset i is part of the list. Positions are thus always sorted and unique. For dense results (e.g., a scan that
+ * matches a large fraction of a chunk), a bitmap needs far less memory than a RowIDPosList with eight bytes per RowID,
+ * and two bitmaps can be intersected or united word by word (see intersect() and unite()) instead of merging sorted
+ * lists of RowIDs.
+ *
+ * Random access to the n-th position uses the number of set bits before each word (_word_ranks) to find the word that
+ * holds the position. Iterating the list via begin() and end() does not need this and only skips to the next set bit.
+ */
+class BitmapPosList : public AbstractPosList {
+ public:
+  class Iterator;
+
+  static constexpr auto WORD_SIZE = ChunkOffset::base_type{64};
+
+  // Operators output the positions of a chunk as a BitmapPosList instead of a RowIDPosList if at least this share of
+  // the chunk's rows is contained (see use_for()). For sparser results, the bitmap's words and the search for set bits
+  // cost more than storing and iterating RowIDs.
+  static constexpr auto DENSITY_THRESHOLD = 0.5;
+
+  static bool use_for(const size_t position_count, const ChunkOffset chunk_size) {
+    return static_cast<double>(position_count) >= DENSITY_THRESHOLD * static_cast<double>(chunk_size);
+  }
+
+  // The number of 64-bit words needed for a bitmap of chunk_size rows.
+  static size_t word_count(const ChunkOffset chunk_size) {
+    return (static_cast<size_t>(chunk_size) + WORD_SIZE - 1) / WORD_SIZE;
+  }
+
+  static void set_bit(std::vector<uint64_t>& words, const ChunkOffset chunk_offset) {
+    words[chunk_offset / WORD_SIZE] |= uint64_t{1} << (chunk_offset % WORD_SIZE);
+  }
+
+  // Creates a BitmapPosList for the first chunk_size rows of the chunk from word_count(chunk_size) words. Bits at
+  // positions after chunk_size must not be set.
+  BitmapPosList(const ChunkID common_chunk_id, const ChunkOffset chunk_size, std::vector<uint64_t>&& words);
+
+  // Creates a BitmapPosList from positions that all reference common_chunk_id and are smaller than chunk_size. Their
+  // order does not matter and duplicates are only contained once.
+  template <typename RowIDIterator>
+  BitmapPosList(const ChunkID common_chunk_id, const ChunkOffset chunk_size, RowIDIterator begin,
+                const RowIDIterator& end)
+      : _common_chunk_id(common_chunk_id), _chunk_size(chunk_size), _words(word_count(chunk_size)) {
+    DebugAssert(_common_chunk_id != INVALID_CHUNK_ID, "Cannot create BitmapPosList for INVALID_CHUNK_ID");
+    for (; begin != end; ++begin) {
+      const auto row_id = *begin;
+      DebugAssert(row_id.chunk_id == _common_chunk_id && row_id.chunk_offset < _chunk_size,
+                  "Position is not part of the bitmap's chunk");
+      set_bit(_words, row_id.chunk_offset);
+    }
+    _compute_word_ranks();
+  }
+
+  // Return the positions contained in both or in any of the two bitmaps. Both bitmaps have to reference the same
+  // chunk. If their chunk sizes differ (e.g., because rows were appended to the chunk in between), positions beyond
+  // the smaller size are treated as not contained in the smaller bitmap.
+  static std::shared_ptr<BitmapPosList> intersect(const BitmapPosList& lhs, const BitmapPosList& rhs);
+  static std::shared_ptr<BitmapPosList> unite(const BitmapPosList& lhs, const BitmapPosList& rhs);
+
+  bool references_single_chunk() const final;
+  ChunkID common_chunk_id() const final;
+
+  RowID operator[](const size_t index) const final;
+
+  bool contains(const ChunkOffset chunk_offset) const {
+    return chunk_offset < _chunk_size && (_words[chunk_offset / WORD_SIZE] >> (chunk_offset % WORD_SIZE)) & 1;
+  }
+
+  // The number of rows covered by the bitmap, i.e., one more than the largest possible position.
+  ChunkOffset chunk_size() const;
+  const std::vector<uint64_t>& words() const;
+
+  bool empty() const final;
+  size_t size() const final;
+  size_t memory_usage(const MemoryUsageCalculationMode /*mode*/) const final;
+
+  Iterator begin() const;
+  Iterator end() const;
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+ private:
+  void _compute_word_ranks();
+
+  // Returns the offset of the first set bit at or after chunk_offset, or _chunk_size if there is none.
+  ChunkOffset _next_set_bit(const ChunkOffset chunk_offset) const;
+
+  // Returns the offset of the last set bit before chunk_offset. At least one such bit has to exist.
+  ChunkOffset _previous_set_bit(const ChunkOffset chunk_offset) const;
+
+  const ChunkID _common_chunk_id;
+  const ChunkOffset _chunk_size;
+  std::vector<uint64_t> _words;
+
+  // Number of set bits in all words before the word with the same index. The last entry is the size of the list.
+  std::vector<ChunkOffset::base_type> _word_ranks;
+};
+
+// Iterates the positions of a BitmapPosList in ascending order. Besides its index in the list, the iterator stores the
+// position it points to, so that incrementing and decrementing only have to search for the next or previous set bit.
+class BitmapPosList::Iterator
+    : public boost::iterator_facade<BitmapPosList::Iterator, RowID, boost::random_access_traversal_tag, RowID> {
+ public:
+  Iterator(const BitmapPosList* pos_list, const size_t index, const ChunkOffset chunk_offset)
+      : _pos_list(pos_list), _index(index), _chunk_offset(chunk_offset) {}
+
+ private:
+  friend class boost::iterator_core_access;
+
+  void increment() {
+    ++_index;
+    _chunk_offset = _pos_list->_next_set_bit(ChunkOffset{_chunk_offset + 1});
+  }
+
+  void decrement() {
+    --_index;
+    _chunk_offset = _pos_list->_previous_set_bit(_chunk_offset);
+  }
+
+  void advance(const std::ptrdiff_t n) {
+    _index += n;
+    _chunk_offset = _index == _pos_list->size() ? _pos_list->_chunk_size : (*_pos_list)[_index].chunk_offset;
+  }
+
+  bool equal(const Iterator& other) const {
+    DebugAssert(_pos_list == other._pos_list, "Iterator compared to iterator on different BitmapPosList instance");
+    return _index == other._index;
+  }
+
+  std::ptrdiff_t distance_to(const Iterator& other) const {
+    return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+  }
+
+  RowID dereference() const {
+    DebugAssert(_index < _pos_list->size(), "past-the-end BitmapPosList::Iterator dereferenced");
+    return RowID{_pos_list->_common_chunk_id, _chunk_offset};
+  }
+
+  const BitmapPosList* _pos_list;
+  size_t _index;
+  ChunkOffset _chunk_offset;
+};
+
+}  // namespace hyrise
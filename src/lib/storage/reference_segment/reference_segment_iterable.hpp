@@ -10,6 +10,7 @@
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/segment_accessor.hpp"
@@ -72,6 +73,12 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
           }
 #endif
 
+#ifdef HYRISE_ERASE_FSST
+          if constexpr (std::is_same_v<SegmentType, FSSTSegment<T>>) {
+            return;
+          }
+#endif
+
 #ifdef HYRISE_ERASE_FRAMEOFREFERENCE
           if constexpr (std::is_same_v<T, int32_t>) {
             if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) {
@@ -4,6 +4,7 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -63,6 +64,7 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
       _use_mvcc(use_mvcc),
       _target_chunk_size(type == TableType::Data ? target_chunk_size.value_or(Chunk::DEFAULT_SIZE) : Chunk::MAX_SIZE),
       _append_mutex(std::make_unique<std::mutex>()),
+      _constraints_mutex(std::make_unique<std::shared_mutex>()),
       _table_indexes(table_indexes) {
   DebugAssert(target_chunk_size <= Chunk::MAX_SIZE, "Chunk size exceeds maximum");
   DebugAssert(type == TableType::Data || !target_chunk_size, "Must not set target_chunk_size for reference tables");
@@ -415,7 +417,7 @@ void Table::add_soft_key_constraint(const TableKeyConstraint& table_key_constrai
     }
   }
 
-  const auto append_lock = acquire_append_mutex();
+  const auto constraints_lock = std::unique_lock{*_constraints_mutex};
 
   for (const auto& existing_constraint : _table_key_constraints) {
     // Ensure that no other PRIMARY KEY is defined.
@@ -432,7 +434,8 @@ void Table::add_soft_key_constraint(const TableKeyConstraint& table_key_constrai
   _table_key_constraints.insert(table_key_constraint);
 }
 
-const TableKeyConstraints& Table::soft_key_constraints() const {
+TableKeyConstraints Table::soft_key_constraints() const {
+  const auto constraints_lock = std::shared_lock{*_constraints_mutex};
   return _table_key_constraints;
 }
 
@@ -457,18 +460,25 @@ void Table::add_soft_foreign_key_constraint(const ForeignKeyConstraint& foreign_
     Assert(column_id < referenced_table_column_count, "ColumnID out of range.");
   }
 
-  const auto append_lock = acquire_append_mutex();
-  const auto [_, inserted] = _foreign_key_constraints.insert(foreign_key_constraint);
-  Assert(inserted, "ForeignKeyConstraint for required columns has already been set.");
-  const auto referenced_table_append_lock = referenced_table->acquire_append_mutex();
+  {
+    const auto constraints_lock = std::unique_lock{*_constraints_mutex};
+    const auto [_, inserted] = _foreign_key_constraints.insert(foreign_key_constraint);
+    Assert(inserted, "ForeignKeyConstraint for required columns has already been set.");
+  }
+
+  // Do not hold both locks at once, as a concurrent constraint in the opposite direction would lock them in the
+  // reverse order.
+  const auto referenced_table_constraints_lock = std::unique_lock{*referenced_table->_constraints_mutex};
   referenced_table->_referenced_foreign_key_constraints.insert(foreign_key_constraint);
 }
 
-const ForeignKeyConstraints& Table::soft_foreign_key_constraints() const {
+ForeignKeyConstraints Table::soft_foreign_key_constraints() const {
+  const auto constraints_lock = std::shared_lock{*_constraints_mutex};
   return _foreign_key_constraints;
 }
 
-const ForeignKeyConstraints& Table::referenced_foreign_key_constraints() const {
+ForeignKeyConstraints Table::referenced_foreign_key_constraints() const {
+  const auto constraints_lock = std::shared_lock{*_constraints_mutex};
   return _referenced_foreign_key_constraints;
 }
 
@@ -486,7 +496,7 @@ void Table::add_soft_order_constraint(const TableOrderConstraint& table_order_co
     Assert(column_id < column_count, "ColumnID out of range.");
   }
 
-  const auto append_lock = acquire_append_mutex();
+  const auto constraints_lock = std::unique_lock{*_constraints_mutex};
   for (const auto& existing_constraint : _table_order_constraints) {
     // Do not allow intersecting order constraints. Though they can be valid, we are pessimistic for now and notice if
     // we run into intricate cases.
@@ -502,10 +512,40 @@ void Table::add_soft_order_constraint(const TableOrderConstraint& table_order_co
   _table_order_constraints.insert(table_order_constraint);
 }
 
-const TableOrderConstraints& Table::soft_order_constraints() const {
+TableOrderConstraints Table::soft_order_constraints() const {
+  const auto constraints_lock = std::shared_lock{*_constraints_mutex};
   return _table_order_constraints;
 }
 
+void Table::remove_soft_key_constraint(const TableKeyConstraint& table_key_constraint) {
+  const auto constraints_lock = std::unique_lock{*_constraints_mutex};
+  const auto erased_count = _table_key_constraints.erase(table_key_constraint);
+  Assert(erased_count == 1, "TableKeyConstraint to remove is not set.");
+}
+
+void Table::remove_soft_foreign_key_constraint(const ForeignKeyConstraint& foreign_key_constraint) {
+  Assert(foreign_key_constraint.foreign_key_table().get() == this,
+         "ForeignKeyConstraint is removed from the wrong table.");
+
+  {
+    const auto constraints_lock = std::unique_lock{*_constraints_mutex};
+    const auto erased_count = _foreign_key_constraints.erase(foreign_key_constraint);
+    Assert(erased_count == 1, "ForeignKeyConstraint to remove is not set.");
+  }
+
+  // The referenced table might have been deleted in the meantime.
+  if (const auto referenced_table = foreign_key_constraint.primary_key_table()) {
+    const auto referenced_table_constraints_lock = std::unique_lock{*referenced_table->_constraints_mutex};
+    referenced_table->_referenced_foreign_key_constraints.erase(foreign_key_constraint);
+  }
+}
+
+void Table::remove_soft_order_constraint(const TableOrderConstraint& table_order_constraint) {
+  const auto constraints_lock = std::unique_lock{*_constraints_mutex};
+  const auto erased_count = _table_order_constraints.erase(table_order_constraint);
+  Assert(erased_count == 1, "TableOrderConstraint to remove is not set.");
+}
+
 const std::vector<ColumnID>& Table::value_clustered_by() const {
   return _value_clustered_by;
 }
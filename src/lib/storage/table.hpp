@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -203,18 +204,27 @@ class Table : private Noncopyable {
   /**
    * NOTE: constraints are currently NOT ENFORCED and are only used to develop optimization rules.
    * We call them "soft" constraints to draw attention to that.
+   *
+   * Constraints can be added and removed while other threads (e.g., the optimizer) read them. Thus, the getters return
+   * copies of the constraints.
    */
   void add_soft_key_constraint(const TableKeyConstraint& table_key_constraint);
-  const TableKeyConstraints& soft_key_constraints() const;
+  TableKeyConstraints soft_key_constraints() const;
 
   // Adds foreign key constraint so it can be retrieved by soft_foreign_key_constraints() of this table and by
   // referenced_foreign_key_constraints() of the table that has the primary key columns.
   void add_soft_foreign_key_constraint(const ForeignKeyConstraint& foreign_key_constraint);
-  const ForeignKeyConstraints& soft_foreign_key_constraints() const;
-  const ForeignKeyConstraints& referenced_foreign_key_constraints() const;
+  ForeignKeyConstraints soft_foreign_key_constraints() const;
+  ForeignKeyConstraints referenced_foreign_key_constraints() const;
 
   void add_soft_order_constraint(const TableOrderConstraint& table_order_constraint);
-  const TableOrderConstraints& soft_order_constraints() const;
+  TableOrderConstraints soft_order_constraints() const;
+
+  // Remove soft constraints, e.g., if they do not hold anymore after the table has been modified. Foreign key
+  // constraints are also removed from the referenced_foreign_key_constraints() of the referenced table.
+  void remove_soft_key_constraint(const TableKeyConstraint& table_key_constraint);
+  void remove_soft_foreign_key_constraint(const ForeignKeyConstraint& foreign_key_constraint);
+  void remove_soft_order_constraint(const TableOrderConstraint& table_order_constraint);
 
   /**
    * Returns all table indexes created for this table.
@@ -275,6 +285,8 @@ class Table : private Noncopyable {
   std::vector<ColumnID> _value_clustered_by;
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
+  // Guards the soft constraints above.
+  std::unique_ptr<std::shared_mutex> _constraints_mutex;
   std::vector<ChunkIndexStatistics> _chunk_indexes_statistics;
   std::vector<TableIndexStatistics> _table_indexes_statistics;
   pmr_vector<std::shared_ptr<PartialHashIndex>> _table_indexes;
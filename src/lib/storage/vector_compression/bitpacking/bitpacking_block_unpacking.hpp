@@ -0,0 +1,90 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include "bitpacking_vector_type.hpp"
+
+namespace hyrise {
+
+/**
+ * Block-wise decoding of bit-packed vectors
+ *
+ * compact::vector stores values with a bit width of b back to back in 64-bit words, starting at the lowest bit of the
+ * first word. Hence, a block of BITPACKING_BLOCK_SIZE (64) values occupies exactly b words and every block starts at a
+ * word boundary. Instead of extracting one value per call with a variable shift and mask (as compact::vector's
+ * operator[] does), such a block can be unpacked at once. The unpacking kernel is instantiated for every bit width and
+ * unrolled for every value of the block, so that all word offsets, shifts, and masks are constants. The kernel for the
+ * vector's bit width is looked up once per call.
+ */
+constexpr auto BITPACKING_BLOCK_SIZE = size_t{64};
+
+namespace detail {
+
+template <uint32_t BitWidth, size_t Index>
+uint32_t unpack_bitpacking_value(const uint64_t* words) {
+  constexpr auto BIT = Index * BitWidth;
+  constexpr auto WORD = BIT / 64;
+  constexpr auto SHIFT = BIT % 64;
+  constexpr auto MASK = (uint64_t{1} << BitWidth) - 1;
+
+  if constexpr (SHIFT + BitWidth > 64) {
+    // The value spans two words.
+    return static_cast<uint32_t>(((words[WORD] >> SHIFT) | (words[WORD + 1] << (64 - SHIFT))) & MASK);
+  } else {
+    return static_cast<uint32_t>((words[WORD] >> SHIFT) & MASK);
+  }
+}
+
+template <uint32_t BitWidth, size_t... Indices>
+void unpack_bitpacking_block(const uint64_t* words, uint32_t* output, std::index_sequence<Indices...> /*indices*/) {
+  ((output[Indices] = unpack_bitpacking_value<BitWidth, Indices>(words)), ...);
+}
+
+template <uint32_t BitWidth>
+void unpack_bitpacking_block(const uint64_t* words, uint32_t* output) {
+  // The values are unpacked without a loop, so that the positions of all values are compile-time constants.
+  unpack_bitpacking_block<BitWidth>(words, output, std::make_index_sequence<BITPACKING_BLOCK_SIZE>{});
+}
+
+using UnpackBitpackingBlockFunction = void (*)(const uint64_t*, uint32_t*);
+
+template <size_t... BitWidths>
+constexpr auto make_unpack_bitpacking_block_functions(std::index_sequence<BitWidths...> /*bit_widths*/) {
+  return std::array<UnpackBitpackingBlockFunction, sizeof...(BitWidths)>{
+      &unpack_bitpacking_block<static_cast<uint32_t>(BitWidths)>...};
+}
+
+// Values of a BitPackingVector are at most 32 bits wide.
+inline constexpr auto UNPACK_BITPACKING_BLOCK_FUNCTIONS =
+    make_unpack_bitpacking_block_functions(std::make_index_sequence<33>{});
+
+}  // namespace detail
+
+// Decodes the `count` values starting at index `first` into `output`. All blocks that lie completely in the requested
+// range are unpacked at once. Values before the first and after the last of these blocks are decoded one by one.
+inline void unpack_bitpacking_values(const pmr_compact_vector& data, const size_t first, const size_t count,
+                                     uint32_t* output) {
+  const auto end = first + count;
+  auto index = first;
+
+  const auto first_block_begin =
+      std::min(end, (first + BITPACKING_BLOCK_SIZE - 1) / BITPACKING_BLOCK_SIZE * BITPACKING_BLOCK_SIZE);
+  for (; index < first_block_begin; ++index, ++output) {
+    *output = data[index];
+  }
+
+  const auto bit_width = data.bits();
+  const auto unpack_block = detail::UNPACK_BITPACKING_BLOCK_FUNCTIONS[bit_width];
+  for (; index + BITPACKING_BLOCK_SIZE <= end; index += BITPACKING_BLOCK_SIZE, output += BITPACKING_BLOCK_SIZE) {
+    unpack_block(data.get() + (index / BITPACKING_BLOCK_SIZE) * bit_width, output);
+  }
+
+  for (; index < end; ++index, ++output) {
+    *output = data[index];
+  }
+}
+
+}  // namespace hyrise
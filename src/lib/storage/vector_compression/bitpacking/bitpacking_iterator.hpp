@@ -1,21 +1,36 @@
 #pragma once
 
 #include <array>
+#include <limits>
 #include <memory>
+#include <utility>
 
+#include "bitpacking_block_unpacking.hpp"
 #include "bitpacking_decompressor.hpp"
 #include "bitpacking_vector_type.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 
 namespace hyrise {
 
+/**
+ * Sequential scans dereference the values of a block one after another. Thus, when the first value of a block is
+ * dereferenced, the iterator unpacks the whole block into a buffer and serves the block's remaining values from it.
+ * Values of other blocks (e.g., during a binary search) are decoded one by one. The buffer is allocated when the first
+ * block is unpacked, so that iterators that are only compared or used for point accesses stay small and cheap to copy.
+ * Copies do not share the buffer, which keeps them safe to use in different jobs.
+ */
 class BitPackingIterator : public BaseCompressedVectorIterator<BitPackingIterator> {
  public:
   explicit BitPackingIterator(const pmr_compact_vector& data, const size_t absolute_index = 0u)
       : _data{data}, _absolute_index{absolute_index} {}
 
-  BitPackingIterator(const BitPackingIterator& other) = default;
-  BitPackingIterator(BitPackingIterator&& other) = default;
+  BitPackingIterator(const BitPackingIterator& other) : _data{other._data}, _absolute_index{other._absolute_index} {}
+
+  BitPackingIterator(BitPackingIterator&& other) noexcept
+      : _data{other._data},
+        _absolute_index{other._absolute_index},
+        _block{std::move(other._block)},
+        _block_begin{std::exchange(other._block_begin, INVALID_BLOCK_BEGIN)} {}
 
   BitPackingIterator& operator=(const BitPackingIterator& other) {
     if (this == &other) {
@@ -24,6 +39,7 @@ class BitPackingIterator : public BaseCompressedVectorIterator<BitPackingIterato
 
     DebugAssert(&_data == &other._data, "Cannot reassign BitPackingIterator");
     _absolute_index = other._absolute_index;
+    _block_begin = INVALID_BLOCK_BEGIN;
     return *this;
   }
 
@@ -34,6 +50,7 @@ class BitPackingIterator : public BaseCompressedVectorIterator<BitPackingIterato
 
     DebugAssert(&_data == &other._data, "Cannot reassign BitPackingIterator");
     _absolute_index = other._absolute_index;
+    _block_begin = INVALID_BLOCK_BEGIN;
     return *this;
   }
 
@@ -63,12 +80,33 @@ class BitPackingIterator : public BaseCompressedVectorIterator<BitPackingIterato
   }
 
   uint32_t dereference() const {
-    return _data[_absolute_index];
+    const auto offset_in_block = _absolute_index % BITPACKING_BLOCK_SIZE;
+    const auto block_begin = _absolute_index - offset_in_block;
+    if (block_begin != _block_begin) {
+      if (offset_in_block != 0) {
+        return _data[_absolute_index];
+      }
+
+      if (!_block) {
+        _block = std::make_unique<std::array<uint32_t, BITPACKING_BLOCK_SIZE>>();
+      }
+      unpack_bitpacking_values(_data, block_begin, std::min(BITPACKING_BLOCK_SIZE, _data.size() - block_begin),
+                               _block->data());
+      _block_begin = block_begin;
+    }
+
+    return (*_block)[offset_in_block];
   }
 
  private:
+  static constexpr auto INVALID_BLOCK_BEGIN = std::numeric_limits<size_t>::max();
+
   const pmr_compact_vector& _data;
   size_t _absolute_index = 0u;
+
+  // Buffer of the values of the last unpacked block.
+  mutable std::unique_ptr<std::array<uint32_t, BITPACKING_BLOCK_SIZE>> _block;
+  mutable size_t _block_begin = INVALID_BLOCK_BEGIN;
 };
 
 }  // namespace hyrise
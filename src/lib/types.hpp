@@ -159,8 +159,9 @@ constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max(
 // use a really short one here.
 const size_t SSO_STRING_CAPACITY = pmr_string{"."}.capacity();
 
-// The Scheduler currently supports just these two priorities.
+// The Scheduler currently supports just these three priorities.
 enum class SchedulePriority {
+  Low = 2,      // Schedule task of low priority (e.g., background work), only executed if no other tasks are queued.
   Default = 1,  // Schedule task of normal priority.
   High = 0      // Schedule task of high priority, subject to be preferred in scheduling.
 };
@@ -0,0 +1,82 @@
+#include "blocked_bloom_filter.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace hyrise {
+
+BlockedBloomFilter::BlockedBloomFilter(const size_t expected_value_count) {
+  const auto requested_bits = std::max(expected_value_count, size_t{1}) * BITS_PER_VALUE;
+  const auto requested_block_count = (requested_bits + BLOCK_BITS - 1) / BLOCK_BITS;
+  const auto block_count = std::min(std::bit_ceil(requested_block_count), MAX_BLOCK_COUNT);
+
+  _blocks = std::vector<Block>(block_count);
+  _block_mask = block_count - 1;
+
+  // The false positive rate is minimal for k = ln(2) * m/n hash functions, where m/n is the number of bits per value.
+  // As we set at most one bit per lane, k is limited by the lane count.
+  const auto bits_per_value = static_cast<double>(block_count * BLOCK_BITS) /
+                              static_cast<double>(std::max(expected_value_count, size_t{1}));
+  const auto optimal_hash_count = std::round(std::log(2.0) * bits_per_value);
+  _hash_count = static_cast<uint8_t>(std::clamp(optimal_hash_count, 1.0, static_cast<double>(LANE_COUNT)));
+}
+
+void BlockedBloomFilter::insert(const size_t hash) {
+  DebugAssert(!_blocks.empty(), "Cannot insert into an empty Bloom filter.");
+  const auto mixed_hash = fibonacci_mix(hash);
+  auto& block = _blocks[_block_index(mixed_hash)];
+
+  for (auto lane = uint8_t{0}; lane < _hash_count; ++lane) {
+    const auto mask = _lane_mask(mixed_hash, lane);
+    // Frequent values would otherwise write to the same cache line over and over again, which leads to contention when
+    // multiple threads insert concurrently.
+    if ((block.lanes[lane].load(std::memory_order_relaxed) & mask) != mask) {
+      block.lanes[lane].fetch_or(mask, std::memory_order_relaxed);
+    }
+  }
+}
+
+bool BlockedBloomFilter::is_active() const {
+  return !_blocks.empty() && !_disabled.load(std::memory_order_relaxed);
+}
+
+void BlockedBloomFilter::record_probes(const size_t probed_value_count, const size_t filtered_value_count) const {
+  DebugAssert(filtered_value_count <= probed_value_count, "Cannot filter more values than were probed.");
+  const auto total_probed_value_count =
+      _probed_value_count.fetch_add(probed_value_count, std::memory_order_relaxed) + probed_value_count;
+  const auto total_filtered_value_count =
+      _filtered_value_count.fetch_add(filtered_value_count, std::memory_order_relaxed) + filtered_value_count;
+
+  if (total_probed_value_count >= MIN_PROBE_COUNT_FOR_ADAPTION &&
+      static_cast<double>(total_filtered_value_count) <
+          MIN_FILTER_RATE * static_cast<double>(total_probed_value_count)) {
+    _disabled.store(true, std::memory_order_relaxed);
+  }
+}
+
+size_t BlockedBloomFilter::probed_value_count() const {
+  return _probed_value_count.load();
+}
+
+size_t BlockedBloomFilter::filtered_value_count() const {
+  return _filtered_value_count.load();
+}
+
+std::optional<double> BlockedBloomFilter::filter_rate() const {
+  const auto probed_value_count = _probed_value_count.load();
+  if (probed_value_count == 0) {
+    return std::nullopt;
+  }
+  return static_cast<double>(_filtered_value_count.load()) / static_cast<double>(probed_value_count);
+}
+
+size_t BlockedBloomFilter::block_count() const {
+  return _blocks.size();
+}
+
+uint8_t BlockedBloomFilter::hash_count() const {
+  return _hash_count;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/copyable_atomic.hpp"
+#include "utils/fibonacci_hash.hpp"
+
+namespace hyrise {
+
+/**
+ * Cache-line-blocked Bloom filter [1] for hash values. Each value is mapped to a single block of 512 bits (one cache
+ * line), which consists of eight 64-bit lanes. The first hash_count() lanes get one bit set per value. Thus, inserting
+ * or probing a value touches exactly one cache line. The bit positions of all lanes are computed independently of each
+ * other in a fixed-width, branch-free loop, which allows the compiler to vectorize probing.
+ *
+ * The filter is sized from the expected number of (distinct) values, usually the cardinality of the side that builds
+ * it, with BITS_PER_VALUE bits per value. The size is rounded up to a power of two blocks and capped at
+ * MAX_BLOCK_COUNT. The hash count is then chosen as the optimum for the resulting bits per value (ln(2) * m/n).
+ *
+ * Values can be inserted concurrently. Probing must only happen once all values have been inserted.
+ *
+ * Consumers can report how many values they probed and how many values were filtered out. If the observed filter rate
+ * is poor (see MIN_FILTER_RATE), the filter disables itself, i.e., is_active() returns false and consumers should stop
+ * probing it. A default-constructed filter is never active and can be used when no filter is available.
+ *
+ * [1] Putze et al. "Cache-, Hash- and Space-Efficient Bloom Filters", 2007.
+ * [2] Lang et al. "Performance-Optimal Filtering: Bloom Overtakes Cuckoo at High Throughput", 2019.
+ */
+class BlockedBloomFilter {
+ public:
+  static constexpr auto LANE_COUNT = uint8_t{8};
+  static constexpr auto BLOCK_BITS = size_t{LANE_COUNT * 64};
+  static constexpr auto BITS_PER_VALUE = size_t{8};
+  static constexpr auto MAX_BLOCK_COUNT = size_t{1} << 18;  // 16 MiB
+
+  // The filter is disabled if less than MIN_FILTER_RATE of the probed values were filtered out. This decision is only
+  // made after at least MIN_PROBE_COUNT_FOR_ADAPTION values have been probed.
+  static constexpr auto MIN_FILTER_RATE = 0.1;
+  static constexpr auto MIN_PROBE_COUNT_FOR_ADAPTION = size_t{10'000};
+
+  BlockedBloomFilter() = default;
+  explicit BlockedBloomFilter(const size_t expected_value_count);
+
+  void insert(const size_t hash);
+
+  bool contains(const size_t hash) const {
+    DebugAssert(!_blocks.empty(), "Cannot probe an empty Bloom filter.");
+    const auto mixed_hash = fibonacci_mix(hash);
+    const auto& block = _blocks[_block_index(mixed_hash)];
+
+    auto matches = true;
+    for (auto lane = uint8_t{0}; lane < LANE_COUNT; ++lane) {
+      const auto mask = _lane_mask(mixed_hash, lane);
+      matches &= (block.lanes[lane].load(std::memory_order_relaxed) & mask) == mask;
+    }
+    return matches;
+  }
+
+  // Returns false for default-constructed filters and filters that disabled themselves due to a poor filter rate.
+  bool is_active() const;
+
+  // Records the outcome of probing `probed_value_count` values, of which `filtered_value_count` were not contained.
+  // Consumers should call this once per batch of values (e.g., a chunk) rather than for every single value. Recording
+  // is thread-safe and might disable the filter.
+  void record_probes(const size_t probed_value_count, const size_t filtered_value_count) const;
+
+  size_t probed_value_count() const;
+  size_t filtered_value_count() const;
+
+  // Share of the probed values that were filtered out. std::nullopt if no values were probed.
+  std::optional<double> filter_rate() const;
+
+  size_t block_count() const;
+  uint8_t hash_count() const;
+
+ protected:
+  struct alignas(64) Block {
+    std::array<std::atomic_uint64_t, LANE_COUNT> lanes{};
+  };
+
+  size_t _block_index(const size_t mixed_hash) const {
+    return (mixed_hash >> 32u) & _block_mask;
+  }
+
+  uint64_t _lane_mask(const size_t mixed_hash, const uint8_t lane) const {
+    // Odd multipliers derive independent bit positions for each lane from the lower 32 bits of the hash (see [2]).
+    static constexpr auto SALTS = std::array<uint32_t, LANE_COUNT>{0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                                   0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+    const auto bit = (static_cast<uint32_t>(mixed_hash) * SALTS[lane]) >> 26u;
+    return lane < _hash_count ? uint64_t{1} << bit : uint64_t{0};
+  }
+
+  std::vector<Block> _blocks;
+  size_t _block_mask{0};
+  uint8_t _hash_count{0};
+
+  mutable copyable_atomic<size_t> _probed_value_count{0};
+  mutable copyable_atomic<size_t> _filtered_value_count{0};
+  mutable copyable_atomic<bool> _disabled{false};
+};
+
+}  // namespace hyrise
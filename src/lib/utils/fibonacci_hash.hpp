@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hyrise {
+
+/**
+ * std::hash is the identity for integers, so the lower bits of clustered keys (e.g., surrogate keys) carry little
+ * entropy and the upper bits are mostly zero. Multiplying with an odd constant close to 2^64 / phi (Fibonacci hashing)
+ * distributes the entropy of the lower bits to the upper bits. Thus, the upper bits of the result should be used, e.g.,
+ * to select a partition or a block.
+ */
+constexpr size_t fibonacci_mix(const size_t hash) {
+  return hash * size_t{0x9E3779B97F4A7C15};
+}
+
+// Maps hash to [0, 2^bits) using the upper bits of its mixed value.
+constexpr size_t fibonacci_partition(const size_t hash, const uint32_t bits) {
+  return bits == 0 ? size_t{0} : fibonacci_mix(hash) >> (64 - bits);
+}
+
+}  // namespace hyrise
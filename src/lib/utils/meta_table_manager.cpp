@@ -1,5 +1,8 @@
 #include "meta_table_manager.hpp"
 
+#include <algorithm>
+
+#include "utils/assert.hpp"
 #include "utils/meta_tables/meta_chunk_sort_orders_table.hpp"
 #include "utils/meta_tables/meta_chunks_table.hpp"
 #include "utils/meta_tables/meta_columns_table.hpp"
@@ -70,6 +73,13 @@ void MetaTableManager::add_table(const std::shared_ptr<AbstractMetaTable>& table
   std::sort(_table_names.begin(), _table_names.end());
 }
 
+void MetaTableManager::remove_table(const std::string& table_name) {
+  const auto trimmed_table_name = trim_table_name(table_name);
+  const auto removed_table_count = _meta_tables.erase(trimmed_table_name);
+  Assert(removed_table_count == 1, "Meta table " + trimmed_table_name + " does not exist.");
+  _table_names.erase(std::find(_table_names.begin(), _table_names.end(), trimmed_table_name));
+}
+
 bool MetaTableManager::has_table(const std::string& table_name) const {
   return _meta_tables.contains(trim_table_name(table_name));
 }
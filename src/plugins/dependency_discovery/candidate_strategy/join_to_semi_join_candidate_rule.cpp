@@ -15,37 +15,52 @@ void JoinToSemiJoinCandidateRule::apply_to_node(const std::shared_ptr<const Abst
   const auto& join_node = static_cast<const JoinNode&>(*lqp_node);
 
   const auto prunable_side = join_node.prunable_input_side();
-  const auto& join_predicates = join_node.join_predicates();
-  if (join_node.join_mode != JoinMode::Inner || !prunable_side || join_predicates.size() != 1) {
-    return;
-  }
-
-  const auto& binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_predicates.front());
-  Assert(binary_predicate, "JoinNode must have at least one BinaryPredicateExpression.");
-  if (binary_predicate->predicate_condition != PredicateCondition::Equals) {
+  if (join_node.join_mode != JoinMode::Inner || !prunable_side) {
     return;
   }
 
+  // JoinToSemiJoinRule requires a UCC among the columns of all equals predicates on the prunable side. Thus, we collect
+  // these columns and let the validation find a minimal UCC among them.
   const auto& subtree_root = join_node.input(*prunable_side);
-  auto candidate_expression = binary_predicate->left_operand();
-  if (!expression_evaluable_on_lqp(candidate_expression, *subtree_root)) {
-    candidate_expression = binary_predicate->right_operand();
-  }
+  auto stored_table_node = std::shared_ptr<const AbstractLQPNode>{};
+  auto column_ids = std::vector<ColumnID>{};
+  for (const auto& join_predicate : join_node.join_predicates()) {
+    const auto& binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_predicate);
+    Assert(binary_predicate, "JoinNode must have at least one BinaryPredicateExpression.");
+    if (binary_predicate->predicate_condition != PredicateCondition::Equals) {
+      continue;
+    }
 
-  const auto& lqp_column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(candidate_expression);
-  if (!lqp_column_expression) {
-    return;
+    auto candidate_expression = binary_predicate->left_operand();
+    if (!expression_evaluable_on_lqp(candidate_expression, *subtree_root)) {
+      candidate_expression = binary_predicate->right_operand();
+    }
+
+    const auto& lqp_column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(candidate_expression);
+    if (!lqp_column_expression) {
+      return;
+    }
+
+    // For JoinToSemiJoinRule, the join columns are already interesting for optimization. All of them must stem from
+    // the same StoredTableNode to form a UCC candidate.
+    const auto& original_node = lqp_column_expression->original_node.lock();
+    if (original_node->type != LQPNodeType::StoredTable) {
+      return;
+    }
+
+    if (stored_table_node && stored_table_node != original_node) {
+      return;
+    }
+    stored_table_node = original_node;
+    column_ids.emplace_back(lqp_column_expression->original_column_id);
   }
 
-  // For JoinToSemiJoinRule, the join column is already interesting for optimization.
-  const auto& original_node = lqp_column_expression->original_node.lock();
-  if (original_node->type != LQPNodeType::StoredTable) {
+  if (!stored_table_node) {
     return;
   }
 
-  const auto& stored_table_node = static_cast<const StoredTableNode&>(*original_node);
-  candidates.emplace(
-      std::make_shared<UccCandidate>(stored_table_node.table_name, lqp_column_expression->original_column_id));
+  const auto& table_name = static_cast<const StoredTableNode&>(*stored_table_node).table_name;
+  candidates.emplace(std::make_shared<UccCandidate>(table_name, column_ids));
 }
 
 }  // namespace hyrise
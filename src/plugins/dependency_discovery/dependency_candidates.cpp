@@ -58,6 +58,15 @@ std::vector<ColumnID> sort_fd_candidate_columns(const std::string& table_name,
   return columns;
 }
 
+// UCC candidates are sets of columns. Sorting and deduplicating the ColumnIDs makes equal sets compare and hash
+// equally.
+std::vector<ColumnID> sort_ucc_candidate_columns(const std::vector<ColumnID>& column_ids) {
+  auto columns = column_ids;
+  std::sort(columns.begin(), columns.end());
+  columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+  return columns;
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -97,20 +106,38 @@ std::ostream& operator<<(std::ostream& stream, const AbstractDependencyCandidate
 
 // UccCandidate
 UccCandidate::UccCandidate(const std::string& init_table_name, const ColumnID init_column_id)
+    : UccCandidate{init_table_name, std::vector<ColumnID>{init_column_id}} {}
+
+UccCandidate::UccCandidate(const std::string& init_table_name, const std::vector<ColumnID>& init_column_ids)
     : AbstractDependencyCandidate{DependencyType::UniqueColumn},
       table_name(init_table_name),
-      column_id{init_column_id} {}
+      column_ids{sort_ucc_candidate_columns(init_column_ids)} {
+  Assert(!column_ids.empty(), "UCC candidate requires at least one column.");
+}
 
 std::string UccCandidate::description() const {
   const auto& table = Hyrise::get().storage_manager.get_table(table_name);
   auto stream = std::stringstream{};
-  stream << "UCC " << table_name << "." << table->column_name(column_id);
+  stream << "UCC " << table_name << ".";
+  if (column_ids.size() == 1) {
+    stream << table->column_name(column_ids.front());
+    return stream.str();
+  }
+
+  stream << "{";
+  for (auto column_id_it = column_ids.cbegin(); column_id_it != column_ids.cend(); ++column_id_it) {
+    stream << table->column_name(*column_id_it);
+    if (std::next(column_id_it) != column_ids.cend()) {
+      stream << ", ";
+    }
+  }
+  stream << "}";
   return stream.str();
 }
 
 size_t UccCandidate::_on_hash() const {
   auto hash_value = boost::hash_value(table_name);
-  boost::hash_combine(hash_value, column_id);
+  boost::hash_range(hash_value, column_ids.cbegin(), column_ids.cend());
   return hash_value;
 }
 
@@ -118,7 +145,7 @@ bool UccCandidate::_on_equals(const AbstractDependencyCandidate& rhs) const {
   DebugAssert(dynamic_cast<const UccCandidate*>(&rhs),
               "Different dependency type should have been caught by AbstractDependencyCandidate::operator==");
   const auto& ucc_candidate = static_cast<const UccCandidate&>(rhs);
-  return table_name == ucc_candidate.table_name && column_id == ucc_candidate.column_id;
+  return table_name == ucc_candidate.table_name && column_ids == ucc_candidate.column_ids;
 }
 
 // OdCandidate
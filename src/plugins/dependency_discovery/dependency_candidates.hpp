@@ -102,11 +102,13 @@ using DependencyCandidates = std::unordered_set<std::shared_ptr<AbstractDependen
 class UccCandidate : public AbstractDependencyCandidate {
  public:
   UccCandidate(const std::string& init_table_name, const ColumnID init_column_id);
+  UccCandidate(const std::string& init_table_name, const std::vector<ColumnID>& init_column_ids);
 
   std::string description() const final;
 
   const std::string table_name;
-  const ColumnID column_id;
+  // Sorted by ColumnID. Candidates with more than one column are validated by walking the column lattice.
+  const std::vector<ColumnID> column_ids;
 
  protected:
   size_t _on_hash() const final;
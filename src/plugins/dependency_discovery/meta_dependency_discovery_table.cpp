@@ -0,0 +1,40 @@
+#include "meta_dependency_discovery_table.hpp"
+
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+MetaDependencyDiscoveryTable::MetaDependencyDiscoveryTable(
+    const std::function<std::vector<DependencyDiscoveryRun>()>& init_runs)
+    : AbstractMetaTable(TableColumnDefinitions{{"run_id", DataType::Int, false},
+                                               {"timestamp", DataType::Long, false},
+                                               {"new_queries", DataType::Long, false},
+                                               {"candidates", DataType::Long, false},
+                                               {"valid_candidates", DataType::Long, false},
+                                               {"invalid_candidates", DataType::Long, false},
+                                               {"constraints", DataType::Long, false},
+                                               {"duration_ns", DataType::Long, false}}),
+      _runs{init_runs} {}
+
+const std::string& MetaDependencyDiscoveryTable::name() const {
+  static const auto name = std::string{"dependency_discovery"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaDependencyDiscoveryTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  auto run_id = int32_t{0};
+  for (const auto& run : _runs()) {
+    const auto timestamp_ns = std::chrono::nanoseconds{run.timestamp.time_since_epoch()}.count();
+    output_table->append({run_id, static_cast<int64_t>(timestamp_ns), static_cast<int64_t>(run.new_query_count),
+                          static_cast<int64_t>(run.candidate_count), static_cast<int64_t>(run.valid_count),
+                          static_cast<int64_t>(run.invalid_count), static_cast<int64_t>(run.constraint_count),
+                          static_cast<int64_t>(run.duration.count())});
+    ++run_id;
+  }
+
+  return output_table;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace hyrise {
+
+// Statistics of a single background discovery run of the DependencyDiscoveryPlugin.
+struct DependencyDiscoveryRun {
+  std::chrono::system_clock::time_point timestamp{};
+
+  // Queries that were added to the LQP cache since the previous run.
+  uint64_t new_query_count{0};
+
+  // Candidates that were extracted from the new queries and had not been validated before.
+  uint64_t candidate_count{0};
+  uint64_t valid_count{0};
+  uint64_t invalid_count{0};
+
+  // Constraints tracked by the plugin after the run.
+  uint64_t constraint_count{0};
+
+  std::chrono::nanoseconds duration{};
+};
+
+/**
+ * Reports the background discovery runs of the DependencyDiscoveryPlugin. The discovered dependencies themselves are
+ * listed in the data_dependencies meta table. The table is registered by the plugin and removed when it is unloaded.
+ */
+class MetaDependencyDiscoveryTable : public AbstractMetaTable {
+ public:
+  explicit MetaDependencyDiscoveryTable(const std::function<std::vector<DependencyDiscoveryRun>()>& init_runs);
+
+  const std::string& name() const final;
+
+ protected:
+  std::shared_ptr<Table> _on_generate() const final;
+
+  const std::function<std::vector<DependencyDiscoveryRun>()> _runs;
+};
+
+}  // namespace hyrise
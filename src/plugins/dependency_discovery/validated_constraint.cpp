@@ -0,0 +1,634 @@
+#include "validated_constraint.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "storage/constraints/foreign_key_constraint.hpp"
+#include "storage/constraints/table_key_constraint.hpp"
+#include "storage/constraints/table_order_constraint.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Calls `functor` with the position of each row in the given column. Returns false if a chunk was physically deleted.
+template <typename T, typename Functor>
+bool iterate_rows(const Table& table, const ColumnID column_id, const RowsPerChunk& rows, const Functor& functor) {
+  for (const auto& [chunk_id, chunk_offsets] : rows) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (!chunk) {
+      return false;
+    }
+
+    auto position_filter = std::make_shared<RowIDPosList>();
+    position_filter->reserve(chunk_offsets.size());
+    for (const auto chunk_offset : chunk_offsets) {
+      position_filter->emplace_back(RowID{chunk_id, chunk_offset});
+    }
+    position_filter->guarantee_single_chunk();
+    segment_iterate_filtered<T>(*chunk->get_segment(column_id), position_filter, functor);
+  }
+
+  return true;
+}
+
+// Value sets for incremental checks are only cached for tables with up to this many rows. Larger tables are validated
+// from scratch when rows were inserted.
+constexpr auto MAX_CACHED_ROW_COUNT = uint64_t{10'000'000};
+
+// Cached value sets are released after this many revalidations without inserted rows. Thus, constraints of tables that
+// are only modified once in a while do not hold them forever.
+constexpr auto MAX_IDLE_REVALIDATION_COUNT = uint32_t{8};
+
+// Returns the rows that are not contained in `excluded_rows`. Both inputs must be sorted by chunk ID and offset.
+RowsPerChunk subtract_rows(RowsPerChunk rows, const RowsPerChunk& excluded_rows) {
+  auto excluded_it = excluded_rows.cbegin();
+  for (auto& [chunk_id, chunk_offsets] : rows) {
+    while (excluded_it != excluded_rows.cend() && excluded_it->first < chunk_id) {
+      ++excluded_it;
+    }
+
+    if (excluded_it == excluded_rows.cend() || excluded_it->first != chunk_id) {
+      continue;
+    }
+
+    auto remaining_offsets = std::vector<ChunkOffset>{};
+    std::set_difference(chunk_offsets.cbegin(), chunk_offsets.cend(), excluded_it->second.cbegin(),
+                        excluded_it->second.cend(), std::back_inserter(remaining_offsets));
+    chunk_offsets = std::move(remaining_offsets);
+  }
+
+  return rows;
+}
+
+template <typename T>
+struct MaterializedRows {
+  std::vector<T> values;
+
+  // False if a chunk was physically deleted. Then, values are missing.
+  bool complete{true};
+
+  // NULLs are not part of values.
+  bool contains_nulls{false};
+};
+
+// Materializes the non-NULL values of the given rows.
+template <typename T>
+MaterializedRows<T> materialize_rows(const Table& table, const ColumnID column_id, const RowsPerChunk& rows) {
+  auto materialized_rows = MaterializedRows<T>{};
+  materialized_rows.complete = iterate_rows<T>(table, column_id, rows, [&](const auto& position) {
+    if (position.is_null()) {
+      materialized_rows.contains_nulls = true;
+      return;
+    }
+    materialized_rows.values.emplace_back(position.value());
+  });
+
+  return materialized_rows;
+}
+
+template <typename T>
+class ValidatedUcc : public AbstractValidatedConstraint {
+ public:
+  ValidatedUcc(const std::string& init_table_name, const std::shared_ptr<Table>& init_table,
+               const std::shared_ptr<AbstractTableConstraint>& init_constraint,
+               const TableValidationSnapshot& init_snapshot)
+      : AbstractValidatedConstraint{init_table_name, init_table, init_constraint},
+        _column_id{*static_cast<const TableKeyConstraint&>(*constraint).columns().cbegin()},
+        _snapshot{init_snapshot} {}
+
+  ValidationStatus revalidate() final {
+    const auto delta = _snapshot.advance();
+    if (!delta.complete) {
+      return ValidationStatus::Uncertain;
+    }
+
+    // Updates are executed as deletes followed by inserts, so we must remove the deleted values first. Without a cached
+    // set, there is nothing to remove: deleting rows cannot introduce duplicates.
+    if (_values && !delta.deleted_rows.empty()) {
+      const auto deleted_rows = materialize_rows<T>(*_snapshot.table, _column_id, delta.deleted_rows);
+      if (!deleted_rows.complete || deleted_rows.contains_nulls) {
+        _values.reset();
+        return ValidationStatus::Uncertain;
+      }
+      for (const auto& value : deleted_rows.values) {
+        _values->erase(value);
+      }
+    }
+
+    if (delta.inserted_rows.empty()) {
+      if (_values && ++_idle_revalidation_count >= MAX_IDLE_REVALIDATION_COUNT) {
+        _values.reset();
+      }
+      return ValidationStatus::Valid;
+    }
+
+    _idle_revalidation_count = 0;
+    if (!_values) {
+      // Collect the values of all current rows, including the inserted ones. The previous rows were unique, so every
+      // duplicate or NULL was inserted since the last validation.
+      if (_snapshot.table->row_count() > MAX_CACHED_ROW_COUNT) {
+        return ValidationStatus::Uncertain;
+      }
+
+      _values = ValidationSet<T>{};
+      auto duplicate_or_null = false;
+      const auto success = iterate_rows<T>(*_snapshot.table, _column_id, _snapshot.rows(), [&](const auto& position) {
+        duplicate_or_null |= position.is_null() || !_values->emplace(position.value()).second;
+      });
+
+      if (!success || duplicate_or_null) {
+        _values.reset();
+        return success ? ValidationStatus::Invalid : ValidationStatus::Uncertain;
+      }
+      return ValidationStatus::Valid;
+    }
+
+    auto status = ValidationStatus::Valid;
+    const auto success = iterate_rows<T>(*_snapshot.table, _column_id, delta.inserted_rows, [&](const auto& position) {
+      if (position.is_null() || !_values->emplace(position.value()).second) {
+        status = ValidationStatus::Invalid;
+      }
+    });
+
+    if (!success || status != ValidationStatus::Valid) {
+      _values.reset();
+    }
+    return success ? status : ValidationStatus::Uncertain;
+  }
+
+  std::shared_ptr<AbstractDependencyCandidate> candidate() const final {
+    return std::make_shared<UccCandidate>(table_name, _column_id);
+  }
+
+ private:
+  const ColumnID _column_id;
+  TableValidationSnapshot _snapshot;
+  std::optional<ValidationSet<T>> _values;
+  uint32_t _idle_revalidation_count{0};
+};
+
+// UCCs of multiple columns are not maintained incrementally. Deleting rows cannot introduce duplicates, but inserted
+// rows require validating the candidate from scratch.
+class ValidatedCompositeUcc : public AbstractValidatedConstraint {
+ public:
+  ValidatedCompositeUcc(const std::string& init_table_name, const std::shared_ptr<Table>& init_table,
+                        const std::shared_ptr<AbstractTableConstraint>& init_constraint,
+                        const TableValidationSnapshot& init_snapshot)
+      : AbstractValidatedConstraint{init_table_name, init_table, init_constraint},
+        _column_ids{static_cast<const TableKeyConstraint&>(*constraint).columns().cbegin(),
+                    static_cast<const TableKeyConstraint&>(*constraint).columns().cend()},
+        _snapshot{init_snapshot} {}
+
+  ValidationStatus revalidate() final {
+    const auto delta = _snapshot.advance();
+    if (!delta.complete || !delta.inserted_rows.empty()) {
+      return ValidationStatus::Uncertain;
+    }
+
+    return ValidationStatus::Valid;
+  }
+
+  std::shared_ptr<AbstractDependencyCandidate> candidate() const final {
+    return std::make_shared<UccCandidate>(table_name, _column_ids);
+  }
+
+ private:
+  const std::vector<ColumnID> _column_ids;
+  TableValidationSnapshot _snapshot;
+};
+
+template <typename OrderingType, typename OrderedType>
+class ValidatedOd : public AbstractValidatedConstraint {
+ public:
+  ValidatedOd(const std::string& init_table_name, const std::shared_ptr<Table>& init_table,
+              const std::shared_ptr<AbstractTableConstraint>& init_constraint,
+              const TableValidationSnapshot& init_snapshot)
+      : AbstractValidatedConstraint{init_table_name, init_table, init_constraint},
+        _ordering_column_id{static_cast<const TableOrderConstraint&>(*constraint).ordering_columns().front()},
+        _ordered_column_id{static_cast<const TableOrderConstraint&>(*constraint).ordered_columns().front()},
+        _snapshot{init_snapshot} {}
+
+  ValidationStatus revalidate() final {
+    // Deleting rows cannot violate an OD, we only have to check inserted rows.
+    const auto delta = _snapshot.advance();
+    if (!delta.complete) {
+      return ValidationStatus::Uncertain;
+    }
+
+    if (delta.inserted_rows.empty()) {
+      return ValidationStatus::Valid;
+    }
+
+    if (!_initialized) {
+      // Gather the value ranges of the rows that existed before the inserts.
+      const auto rows = subtract_rows(_snapshot.rows(), delta.inserted_rows);
+      const auto ordering_rows = materialize_rows<OrderingType>(*_snapshot.table, _ordering_column_id, rows);
+      const auto ordered_rows = materialize_rows<OrderedType>(*_snapshot.table, _ordered_column_id, rows);
+      if (!ordering_rows.complete || !ordered_rows.complete || ordering_rows.contains_nulls ||
+          ordered_rows.contains_nulls) {
+        return ValidationStatus::Uncertain;
+      }
+
+      const auto& ordering_values = ordering_rows.values;
+      const auto& ordered_values = ordered_rows.values;
+      if (!ordering_values.empty()) {
+        const auto [ordering_min, ordering_max] = std::minmax_element(ordering_values.cbegin(), ordering_values.cend());
+        const auto [ordered_min, ordered_max] = std::minmax_element(ordered_values.cbegin(), ordered_values.cend());
+        _ordering_range = std::make_pair(*ordering_min, *ordering_max);
+        _ordered_range = std::make_pair(*ordered_min, *ordered_max);
+      }
+      _initialized = true;
+    }
+
+    const auto ordering_rows =
+        materialize_rows<OrderingType>(*_snapshot.table, _ordering_column_id, delta.inserted_rows);
+    const auto ordered_rows = materialize_rows<OrderedType>(*_snapshot.table, _ordered_column_id, delta.inserted_rows);
+    if (!ordering_rows.complete || !ordered_rows.complete) {
+      // A chunk with inserted rows was physically deleted, so we cannot check them.
+      return ValidationStatus::Uncertain;
+    }
+
+    if (ordering_rows.contains_nulls || ordered_rows.contains_nulls) {
+      // The OD validation rule rejects columns containing NULLs.
+      return ValidationStatus::Invalid;
+    }
+
+    const auto row_count = ordering_rows.values.size();
+    auto inserted_rows = std::vector<std::pair<OrderingType, OrderedType>>{};
+    inserted_rows.reserve(row_count);
+    for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+      inserted_rows.emplace_back(ordering_rows.values[row_id], ordered_rows.values[row_id]);
+    }
+    std::sort(inserted_rows.begin(), inserted_rows.end());
+
+    // The inserted rows on their own must satisfy the OD.
+    for (auto row_id = size_t{1}; row_id < row_count; ++row_id) {
+      const auto& [previous_ordering_value, previous_ordered_value] = inserted_rows[row_id - 1];
+      const auto& [ordering_value, ordered_value] = inserted_rows[row_id];
+      if (ordered_value < previous_ordered_value) {
+        return ValidationStatus::Invalid;
+      }
+
+      if (ordering_value == previous_ordering_value && ordered_value != previous_ordered_value) {
+        return ValidationStatus::Uncertain;
+      }
+    }
+
+    const auto inserted_ordering_range = std::make_pair(inserted_rows.front().first, inserted_rows.back().first);
+    const auto inserted_ordered_range = std::make_pair(inserted_rows.front().second, inserted_rows.back().second);
+    if (!_ordering_range) {
+      _ordering_range = inserted_ordering_range;
+      _ordered_range = inserted_ordered_range;
+      return ValidationStatus::Valid;
+    }
+
+    // Accept inserted rows that append to or prepend the existing value ranges (e.g., increasing keys and dates).
+    // Everything else must be validated from scratch.
+    if (inserted_ordering_range.first > _ordering_range->second &&
+        inserted_ordered_range.first >= _ordered_range->second) {
+      _ordering_range->second = inserted_ordering_range.second;
+      _ordered_range->second = inserted_ordered_range.second;
+      return ValidationStatus::Valid;
+    }
+
+    if (inserted_ordering_range.second < _ordering_range->first &&
+        inserted_ordered_range.second <= _ordered_range->first) {
+      _ordering_range->first = inserted_ordering_range.first;
+      _ordered_range->first = inserted_ordered_range.first;
+      return ValidationStatus::Valid;
+    }
+
+    return ValidationStatus::Uncertain;
+  }
+
+  std::shared_ptr<AbstractDependencyCandidate> candidate() const final {
+    return std::make_shared<OdCandidate>(table_name, _ordering_column_id, _ordered_column_id);
+  }
+
+ private:
+  const ColumnID _ordering_column_id;
+  const ColumnID _ordered_column_id;
+  TableValidationSnapshot _snapshot;
+
+  bool _initialized{false};
+  std::optional<std::pair<OrderingType, OrderingType>> _ordering_range;
+  std::optional<std::pair<OrderedType, OrderedType>> _ordered_range;
+};
+
+template <typename T>
+class ValidatedInd : public AbstractValidatedConstraint {
+ public:
+  ValidatedInd(const std::string& init_table_name, const std::shared_ptr<Table>& init_table,
+               const std::shared_ptr<AbstractTableConstraint>& init_constraint,
+               const TableValidationSnapshot& init_foreign_key_snapshot, const std::string& init_primary_key_table_name,
+               const TableValidationSnapshot& init_primary_key_snapshot)
+      : AbstractValidatedConstraint{init_table_name, init_table, init_constraint},
+        _foreign_key_column_id{static_cast<const ForeignKeyConstraint&>(*constraint).foreign_key_columns().front()},
+        _primary_key_column_id{static_cast<const ForeignKeyConstraint&>(*constraint).primary_key_columns().front()},
+        _primary_key_table_name{init_primary_key_table_name},
+        _foreign_key_snapshot{init_foreign_key_snapshot},
+        _primary_key_snapshot{init_primary_key_snapshot} {
+    _tables.emplace_back(_primary_key_table_name, _primary_key_snapshot.table);
+  }
+
+  ValidationStatus revalidate() final {
+    // Deleted primary key values might still be referenced, and the primary key values are not necessarily unique. We
+    // do not track multiplicities and validate the IND from scratch instead.
+    const auto primary_key_delta = _primary_key_snapshot.advance();
+    const auto foreign_key_delta = _foreign_key_snapshot.advance();
+    if (!primary_key_delta.complete || !foreign_key_delta.complete || !primary_key_delta.deleted_rows.empty()) {
+      _primary_key_values.reset();
+      return ValidationStatus::Uncertain;
+    }
+
+    // Without a cached set, inserted primary key values are collected when the set is built.
+    if (_primary_key_values && !_add_primary_key_values(primary_key_delta.inserted_rows)) {
+      _primary_key_values.reset();
+      return ValidationStatus::Uncertain;
+    }
+
+    // Deleting foreign key values cannot violate the IND.
+    if (foreign_key_delta.inserted_rows.empty()) {
+      if (_primary_key_values && ++_idle_revalidation_count >= MAX_IDLE_REVALIDATION_COUNT) {
+        _primary_key_values.reset();
+      }
+      return ValidationStatus::Valid;
+    }
+
+    _idle_revalidation_count = 0;
+    if (!_primary_key_values) {
+      if (_primary_key_snapshot.table->row_count() > MAX_CACHED_ROW_COUNT) {
+        return ValidationStatus::Uncertain;
+      }
+
+      _primary_key_values = ValidationSet<T>{};
+      if (!_add_primary_key_values(_primary_key_snapshot.rows())) {
+        _primary_key_values.reset();
+        return ValidationStatus::Uncertain;
+      }
+    }
+
+    auto status = ValidationStatus::Valid;
+    const auto& inserted_rows = foreign_key_delta.inserted_rows;
+    const auto success =
+        iterate_rows<T>(*_foreign_key_snapshot.table, _foreign_key_column_id, inserted_rows, [&](const auto& position) {
+          if (!position.is_null() && !_primary_key_values->contains(position.value())) {
+            status = ValidationStatus::Invalid;
+          }
+        });
+
+    if (!success || status != ValidationStatus::Valid) {
+      _primary_key_values.reset();
+    }
+    return success ? status : ValidationStatus::Uncertain;
+  }
+
+  std::shared_ptr<AbstractDependencyCandidate> candidate() const final {
+    return std::make_shared<IndCandidate>(table_name, _foreign_key_column_id, _primary_key_table_name,
+                                          _primary_key_column_id);
+  }
+
+ private:
+  bool _add_primary_key_values(const RowsPerChunk& rows) {
+    return iterate_rows<T>(*_primary_key_snapshot.table, _primary_key_column_id, rows, [&](const auto& position) {
+      if (!position.is_null()) {
+        _primary_key_values->emplace(position.value());
+      }
+    });
+  }
+
+  const ColumnID _foreign_key_column_id;
+  const ColumnID _primary_key_column_id;
+  const std::string _primary_key_table_name;
+  TableValidationSnapshot _foreign_key_snapshot;
+  TableValidationSnapshot _primary_key_snapshot;
+  std::optional<ValidationSet<T>> _primary_key_values;
+  uint32_t _idle_revalidation_count{0};
+};
+
+}  // namespace
+
+namespace hyrise {
+
+TableValidationSnapshot::TableValidationSnapshot(const std::shared_ptr<const Table>& init_table)
+    : table{init_table}, _commit_id{Hyrise::get().transaction_manager.last_commit_id()} {
+  // Rows deleted by transactions that committed before _commit_id are already counted as invalid rows, as
+  // TransactionManager::last_commit_id() is only advanced after the commit of these transactions finished. Thus, we
+  // only have to count deleted rows of chunks with invalid rows.
+  const auto chunk_count = table->chunk_count();
+  _chunk_sizes.resize(chunk_count, ChunkOffset{0});
+  _deleted_row_counts.resize(chunk_count, ChunkOffset{0});
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    const auto chunk_size = chunk->size();
+    _chunk_sizes[chunk_id] = chunk_size;
+    const auto& mvcc_data = chunk->mvcc_data();
+    if (!mvcc_data || chunk->invalid_row_count() == 0) {
+      continue;
+    }
+
+    auto deleted_row_count = ChunkOffset{0};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->get_end_cid(chunk_offset) <= _commit_id) {
+        ++deleted_row_count;
+      }
+    }
+    _deleted_row_counts[chunk_id] = deleted_row_count;
+  }
+}
+
+RowsPerChunk TableValidationSnapshot::rows() const {
+  auto rows = RowsPerChunk{};
+  const auto chunk_count = static_cast<ChunkID::base_type>(_chunk_sizes.size());
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk_size = _chunk_sizes[chunk_id];
+    if (chunk_size == 0) {
+      continue;
+    }
+
+    // If the chunk was physically deleted in the meantime, the consumer fails to access it.
+    const auto& chunk = table->get_chunk(chunk_id);
+    const auto& mvcc_data = chunk ? chunk->mvcc_data() : nullptr;
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    chunk_offsets.reserve(chunk_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (!mvcc_data || mvcc_data->get_end_cid(chunk_offset) > _commit_id) {
+        chunk_offsets.emplace_back(chunk_offset);
+      }
+    }
+    rows.emplace_back(chunk_id, std::move(chunk_offsets));
+  }
+
+  return rows;
+}
+
+TableValidationSnapshot::Delta TableValidationSnapshot::advance() {
+  auto delta = Delta{};
+  const auto commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  const auto chunk_count = table->chunk_count();
+  DebugAssert(chunk_count >= _chunk_sizes.size(), "Chunks cannot be removed from a table.");
+  _chunk_sizes.resize(chunk_count, ChunkOffset{0});
+  _deleted_row_counts.resize(chunk_count, ChunkOffset{0});
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto previous_chunk_size = _chunk_sizes[chunk_id];
+    const auto& chunk = table->get_chunk(chunk_id);
+    if (!chunk) {
+      // The values of rows in physically deleted chunks cannot be accessed anymore.
+      delta.complete &= previous_chunk_size == 0;
+      _chunk_sizes[chunk_id] = ChunkOffset{0};
+      continue;
+    }
+
+    const auto chunk_size = chunk->size();
+    const auto& mvcc_data = chunk->mvcc_data();
+    const auto invalid_row_count = mvcc_data ? chunk->invalid_row_count() : ChunkOffset{0};
+    if (chunk_size == previous_chunk_size && invalid_row_count == _deleted_row_counts[chunk_id]) {
+      continue;
+    }
+
+    auto inserted_offsets = std::vector<ChunkOffset>{};
+    auto deleted_offsets = std::vector<ChunkOffset>{};
+    auto deleted_row_count = ChunkOffset{0};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto end_cid = mvcc_data ? mvcc_data->get_end_cid(chunk_offset) : MvccData::MAX_COMMIT_ID;
+      if (end_cid <= commit_id) {
+        ++deleted_row_count;
+        if (chunk_offset < previous_chunk_size && end_cid > _commit_id) {
+          deleted_offsets.emplace_back(chunk_offset);
+        }
+      } else if (chunk_offset >= previous_chunk_size) {
+        inserted_offsets.emplace_back(chunk_offset);
+      }
+    }
+
+    // Every row that was deleted since the last snapshot is either part of the old rows with an end commit ID in
+    // (_commit_id, commit_id] or part of the new rows. Otherwise, a previously visible row was invalidated without a
+    // commit ID, e.g., because its insert was rolled back.
+    const auto new_deleted_row_count = deleted_row_count - _deleted_row_counts[chunk_id];
+    const auto deleted_new_row_count = (chunk_size - previous_chunk_size) - inserted_offsets.size();
+    delta.complete &= new_deleted_row_count == deleted_offsets.size() + deleted_new_row_count;
+
+    if (!inserted_offsets.empty()) {
+      delta.inserted_rows.emplace_back(chunk_id, std::move(inserted_offsets));
+    }
+    if (!deleted_offsets.empty()) {
+      delta.deleted_rows.emplace_back(chunk_id, std::move(deleted_offsets));
+    }
+    _chunk_sizes[chunk_id] = chunk_size;
+    _deleted_row_counts[chunk_id] = deleted_row_count;
+  }
+
+  _commit_id = commit_id;
+  return delta;
+}
+
+CommitID TableValidationSnapshot::commit_id() const {
+  return _commit_id;
+}
+
+AbstractValidatedConstraint::AbstractValidatedConstraint(
+    const std::string& init_table_name, const std::shared_ptr<Table>& init_table,
+    const std::shared_ptr<AbstractTableConstraint>& init_constraint)
+    : table_name{init_table_name}, table{init_table}, constraint{init_constraint} {
+  _tables.emplace_back(table_name, table);
+}
+
+std::vector<std::string> AbstractValidatedConstraint::table_names() const {
+  auto table_names = std::vector<std::string>{};
+  table_names.reserve(_tables.size());
+  for (const auto& [name, _] : _tables) {
+    table_names.emplace_back(name);
+  }
+  return table_names;
+}
+
+bool AbstractValidatedConstraint::tables_exist() const {
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  return std::all_of(_tables.cbegin(), _tables.cend(), [&](const auto& name_and_table) {
+    const auto& [name, table] = name_and_table;
+    return storage_manager.has_table(name) && storage_manager.get_table(name) == table;
+  });
+}
+
+std::vector<std::string> candidate_table_names(const AbstractDependencyCandidate& candidate) {
+  switch (candidate.type) {
+    case DependencyType::Order:
+      return {static_cast<const OdCandidate&>(candidate).table_name};
+    case DependencyType::UniqueColumn:
+      return {static_cast<const UccCandidate&>(candidate).table_name};
+    case DependencyType::Functional:
+      return {static_cast<const FdCandidate&>(candidate).table_name};
+    case DependencyType::Inclusion: {
+      const auto& ind_candidate = static_cast<const IndCandidate&>(candidate);
+      return {ind_candidate.foreign_key_table, ind_candidate.primary_key_table};
+    }
+  }
+
+  Fail("Invalid dependency type.");
+}
+
+std::shared_ptr<AbstractValidatedConstraint> make_validated_constraint(
+    const std::string& table_name, const std::shared_ptr<Table>& table,
+    const std::shared_ptr<AbstractTableConstraint>& constraint, const TableValidationSnapshots& snapshots) {
+  const auto& snapshot = snapshots.at(table_name);
+  auto validated_constraint = std::shared_ptr<AbstractValidatedConstraint>{};
+
+  if (const auto& key_constraint = std::dynamic_pointer_cast<TableKeyConstraint>(constraint)) {
+    if (key_constraint->columns().size() > 1) {
+      validated_constraint = std::make_shared<ValidatedCompositeUcc>(table_name, table, constraint, snapshot);
+    } else {
+      const auto column_id = *key_constraint->columns().cbegin();
+      resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        validated_constraint = std::make_shared<ValidatedUcc<ColumnDataType>>(table_name, table, constraint, snapshot);
+      });
+    }
+  } else if (const auto& order_constraint = std::dynamic_pointer_cast<TableOrderConstraint>(constraint)) {
+    Assert(order_constraint->ordering_columns().size() == 1 && order_constraint->ordered_columns().size() == 1,
+           "Only unary ODs can be revalidated.");
+    const auto ordering_data_type = table->column_data_type(order_constraint->ordering_columns().front());
+    const auto ordered_data_type = table->column_data_type(order_constraint->ordered_columns().front());
+    resolve_data_type(ordering_data_type, [&](const auto ordering_data_type_t) {
+      using OrderingDataType = typename decltype(ordering_data_type_t)::type;
+      resolve_data_type(ordered_data_type, [&](const auto ordered_data_type_t) {
+        using OrderedDataType = typename decltype(ordered_data_type_t)::type;
+        validated_constraint = std::make_shared<ValidatedOd<OrderingDataType, OrderedDataType>>(table_name, table,
+                                                                                                constraint, snapshot);
+      });
+    });
+  } else if (const auto& foreign_key_constraint = std::dynamic_pointer_cast<ForeignKeyConstraint>(constraint)) {
+    Assert(foreign_key_constraint->foreign_key_columns().size() == 1, "Only unary INDs can be revalidated.");
+    const auto& primary_key_table = foreign_key_constraint->primary_key_table();
+    Assert(primary_key_table, "Referenced table was deleted.");
+    const auto primary_key_snapshot_it =
+        std::find_if(snapshots.cbegin(), snapshots.cend(), [&](const auto& name_and_snapshot) {
+          return name_and_snapshot.second.table == primary_key_table;
+        });
+    Assert(primary_key_snapshot_it != snapshots.cend(), "Expected snapshot of the referenced table.");
+
+    const auto column_id = foreign_key_constraint->foreign_key_columns().front();
+    resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      validated_constraint = std::make_shared<ValidatedInd<ColumnDataType>>(
+          table_name, table, constraint, snapshot, primary_key_snapshot_it->first, primary_key_snapshot_it->second);
+    });
+  } else {
+    Fail("Invalid table constraint.");
+  }
+
+  return validated_constraint;
+}
+
+}  // namespace hyrise
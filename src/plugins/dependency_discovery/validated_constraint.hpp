@@ -0,0 +1,118 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "dependency_discovery/dependency_candidates.hpp"
+#include "storage/constraints/abstract_table_constraint.hpp"
+
+namespace hyrise {
+
+class Table;
+
+// Offsets of rows, grouped by their chunk.
+using RowsPerChunk = std::vector<std::pair<ChunkID, std::vector<ChunkOffset>>>;
+
+/**
+ * State of a table at the time a constraint was validated: the last commit ID, the size of each chunk, and the number
+ * of rows per chunk that were deleted up to this commit ID. As chunks are append-only and updates are executed as
+ * deletes followed by inserts, comparing this snapshot to the current table yields the rows that were inserted or
+ * deleted since the validation.
+ *
+ * A row is considered deleted if its end commit ID is not greater than the snapshot's commit ID. Thus, rows of
+ * uncommitted inserts are treated as if they were committed, which is pessimistic but safe. Rows whose deletion cannot
+ * be attributed to a commit (e.g., rolled back inserts) are detected by comparing the number of deleted rows with the
+ * chunk's invalid row count. In this case, the delta is marked as incomplete.
+ */
+class TableValidationSnapshot {
+ public:
+  explicit TableValidationSnapshot(const std::shared_ptr<const Table>& init_table);
+
+  struct Delta {
+    RowsPerChunk inserted_rows;
+    RowsPerChunk deleted_rows;
+
+    // False if the changes could not be tracked reliably, e.g., because chunks were physically deleted or rows were
+    // concurrently modified.
+    bool complete{true};
+  };
+
+  // Rows that existed and were not deleted when the snapshot was taken.
+  RowsPerChunk rows() const;
+
+  // Returns the rows inserted and deleted since the snapshot and advances the snapshot to the current table state.
+  Delta advance();
+
+  CommitID commit_id() const;
+
+  const std::shared_ptr<const Table> table;
+
+ private:
+  CommitID _commit_id;
+  std::vector<ChunkOffset> _chunk_sizes;
+  std::vector<ChunkOffset> _deleted_row_counts;
+};
+
+using TableValidationSnapshots = std::unordered_map<std::string, TableValidationSnapshot>;
+
+/**
+ * Soft constraint that was discovered by the DependencyDiscoveryPlugin, together with snapshots of the table(s) it was
+ * validated against. When the tables are modified, revalidate() only checks the rows inserted or deleted since the last
+ * validation. If no rows were inserted, the constraint remains valid without accessing any values. Otherwise, the
+ * subclasses check the inserted rows using auxiliary structures, which are only built once rows were inserted:
+ *   - UCCs keep the set of distinct values and probe it with inserted values. UCCs of multiple columns only remain
+ *     valid if rows are deleted.
+ *   - ODs keep the minimum and maximum values of both columns and accept inserted rows that extend these ranges.
+ *   - INDs keep the set of distinct primary key values and probe it with inserted foreign key values.
+ * Value sets are not built for large tables, and they are released when the table was not modified for several
+ * revalidations.
+ */
+class AbstractValidatedConstraint : public Noncopyable {
+ public:
+  AbstractValidatedConstraint(const std::string& init_table_name, const std::shared_ptr<Table>& init_table,
+                              const std::shared_ptr<AbstractTableConstraint>& init_constraint);
+
+  AbstractValidatedConstraint() = delete;
+
+  virtual ~AbstractValidatedConstraint() = default;
+
+  /**
+   * Returns ValidationStatus::Valid if the constraint still holds, ValidationStatus::Invalid if the modifications
+   * violate it, and ValidationStatus::Uncertain if the modifications cannot be checked incrementally. In this case, the
+   * constraint must be validated from scratch.
+   */
+  virtual ValidationStatus revalidate() = 0;
+
+  // Candidate to validate the constraint from scratch.
+  virtual std::shared_ptr<AbstractDependencyCandidate> candidate() const = 0;
+
+  // Names of all tables whose modification can violate the constraint.
+  std::vector<std::string> table_names() const;
+
+  // False if any of the tables was dropped or replaced since the validation.
+  bool tables_exist() const;
+
+  // Table the constraint is set for.
+  const std::string table_name;
+  const std::shared_ptr<Table> table;
+  const std::shared_ptr<AbstractTableConstraint> constraint;
+
+ protected:
+  // All tables the constraint depends on, including `table`.
+  std::vector<std::pair<std::string, std::shared_ptr<const Table>>> _tables;
+};
+
+// Names of the tables a candidate is validated on.
+std::vector<std::string> candidate_table_names(const AbstractDependencyCandidate& candidate);
+
+/**
+ * Creates an AbstractValidatedConstraint for a soft constraint of the table with the given name. `snapshots` must
+ * contain the snapshots of all tables involved, taken before the constraint was validated.
+ */
+std::shared_ptr<AbstractValidatedConstraint> make_validated_constraint(
+    const std::string& table_name, const std::shared_ptr<Table>& table,
+    const std::shared_ptr<AbstractTableConstraint>& constraint, const TableValidationSnapshots& snapshots);
+
+}  // namespace hyrise
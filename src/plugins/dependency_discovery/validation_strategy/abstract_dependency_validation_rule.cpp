@@ -6,6 +6,8 @@
 #include "storage/constraints/foreign_key_constraint.hpp"
 #include "storage/constraints/table_key_constraint.hpp"
 #include "storage/constraints/table_order_constraint.hpp"
+#include "storage/table.hpp"
+#include "utils/timer.hpp"
 
 namespace {
 
@@ -31,9 +33,12 @@ bool dependency_already_known(const AbstractDependencyCandidate& candidate) {
       const auto& ucc_candidate = static_cast<const UccCandidate&>(candidate);
       const auto& table = Hyrise::get().storage_manager.get_table(ucc_candidate.table_name);
       const auto& current_constraints = table->soft_key_constraints();
+      // Any known UCC that is a subset of the candidate's columns makes the candidate unique as well.
       for (const auto& current_constraint : current_constraints) {
-        if (current_constraint.columns().size() == 1 &&
-            *current_constraint.columns().cbegin() == ucc_candidate.column_id) {
+        const auto& columns = current_constraint.columns();
+        if (std::all_of(columns.cbegin(), columns.cend(), [&](const auto column_id) {
+              return std::binary_search(ucc_candidate.column_ids.cbegin(), ucc_candidate.column_ids.cend(), column_id);
+            })) {
           return true;
         }
       }
@@ -67,10 +72,14 @@ bool dependency_already_known(const AbstractDependencyCandidate& candidate) {
       const auto& table = Hyrise::get().storage_manager.get_table(fd_candidate.table_name);
       const auto& key_constraints = table->soft_key_constraints();
 
+      // The FD holds if a proper subset of its columns is unique.
       for (const auto& key_constraint : key_constraints) {
-        if (key_constraint.columns().size() == 1 &&
-            std::find(fd_candidate.column_ids.cbegin(), fd_candidate.column_ids.cend(),
-                      *key_constraint.columns().cbegin()) != fd_candidate.column_ids.cend()) {
+        const auto& columns = key_constraint.columns();
+        if (columns.size() < fd_candidate.column_ids.size() &&
+            std::all_of(columns.cbegin(), columns.cend(), [&](const auto column_id) {
+              return std::find(fd_candidate.column_ids.cbegin(), fd_candidate.column_ids.cend(), column_id) !=
+                     fd_candidate.column_ids.cend();
+            })) {
           return true;
         }
       }
@@ -125,8 +134,9 @@ std::shared_ptr<AbstractTableConstraint> AbstractDependencyValidationRule::_cons
   switch (candidate.type) {
     case DependencyType::UniqueColumn: {
       const auto& ucc_candidate = static_cast<const UccCandidate&>(candidate);
-      return std::make_shared<TableKeyConstraint>(std::set<ColumnID>{ucc_candidate.column_id},
-                                                  KeyConstraintType::UNIQUE);
+      return std::make_shared<TableKeyConstraint>(
+          std::set<ColumnID>{ucc_candidate.column_ids.cbegin(), ucc_candidate.column_ids.cend()},
+          KeyConstraintType::UNIQUE);
     }
     case DependencyType::Order: {
       const auto& od_candidate = static_cast<const OdCandidate&>(candidate);
@@ -153,4 +163,37 @@ void AbstractDependencyValidationRule::apply_ablation_level(const AblationLevel
   Fail("Ablation level can only be applied to ablation rules.");
 }
 
+void AbstractDependencyValidationRule::set_falsification_sample_size(const uint64_t sample_size) {
+  _falsification_sample_size = sample_size;
+}
+
+void AbstractDependencyValidationRule::set_schedule_priority(const SchedulePriority priority) {
+  _schedule_priority = priority;
+}
+
+bool AbstractDependencyValidationRule::_falsified_by_sample(
+    const std::shared_ptr<const Table>& table, SamplingStatistics& sampling,
+    const std::function<bool(const RowSample&)>& sample_holds) const {
+  const auto row_count = table->row_count();
+  if (_falsification_sample_size == 0 || row_count <= _falsification_sample_size) {
+    return false;
+  }
+
+  auto sampling_timer = Timer{};
+  const auto sample = draw_row_sample(*table, _falsification_sample_size);
+  const auto falsified = !sample_holds(sample);
+  const auto sampling_time = sampling_timer.lap();
+  sampling.sampling_time += sampling_time;
+
+  if (falsified) {
+    // Assume the full validation would have taken as long per row as the sampling.
+    const auto scale = static_cast<double>(row_count) / static_cast<double>(sample_row_count(sample));
+    sampling.rejected = true;
+    sampling.estimated_saved_time += std::chrono::duration_cast<std::chrono::nanoseconds>(sampling_time * scale) -
+                                     sampling_time;
+  }
+
+  return falsified;
+}
+
 }  // namespace hyrise
@@ -1,14 +1,24 @@
 #pragma once
 
+#include <chrono>
+#include <functional>
 #include <unordered_map>
 
 #include "dependency_discovery/dependency_candidates.hpp"
+#include "dependency_discovery/validation_strategy/validation_utils.hpp"
 #include "storage/constraints/abstract_table_constraint.hpp"
 
 namespace hyrise {
 
 class Table;
 
+// Outcome of the sampling pre-pass. The saved time is extrapolated from the time spent on sampling.
+struct SamplingStatistics {
+  bool rejected{false};
+  std::chrono::nanoseconds sampling_time{};
+  std::chrono::nanoseconds estimated_saved_time{};
+};
+
 struct ValidationResult {
  public:
   explicit ValidationResult(const ValidationStatus init_status);
@@ -17,6 +27,7 @@ struct ValidationResult {
   ValidationStatus status;
   // Pointer is required for polymorphism.
   std::unordered_map<std::shared_ptr<Table>, std::shared_ptr<AbstractTableConstraint>> constraints{};
+  SamplingStatistics sampling{};
 };
 
 class AbstractDependencyValidationRule {
@@ -30,6 +41,14 @@ class AbstractDependencyValidationRule {
 
   virtual void apply_ablation_level(const AblationLevel level);
 
+  // Number of rows sampled to falsify candidates before the full validation. 0 disables the sampling pre-pass.
+  void set_falsification_sample_size(const uint64_t sample_size);
+
+  // Priority of the jobs that split the validation of a single candidate, e.g., one job per chunk or radix partition.
+  void set_schedule_priority(const SchedulePriority priority);
+
+  constexpr static uint64_t DEFAULT_FALSIFICATION_SAMPLE_SIZE{4'096};
+
   const DependencyType dependency_type;
 
  protected:
@@ -38,6 +57,17 @@ class AbstractDependencyValidationRule {
   // Pointer is required for polymorphism.
   static std::shared_ptr<AbstractTableConstraint> _constraint_from_candidate(
       const AbstractDependencyCandidate& candidate);
+
+  /**
+   * Sampling pre-pass: Most invalid candidates can be rejected after reading a few thousand rows. If enabled and the
+   * table has more rows than the sample size, draws a random sample of rows and checks whether the candidate holds for
+   * them using `sample_holds`. Returns true if the sample falsifies the candidate. `sampling` is updated in any case.
+   */
+  bool _falsified_by_sample(const std::shared_ptr<const Table>& table, SamplingStatistics& sampling,
+                            const std::function<bool(const RowSample&)>& sample_holds) const;
+
+  uint64_t _falsification_sample_size{DEFAULT_FALSIFICATION_SAMPLE_SIZE};
+  SchedulePriority _schedule_priority{SchedulePriority::Default};
 };
 
 }  // namespace hyrise
@@ -0,0 +1,204 @@
+#include "column_lattice.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <set>
+#include <unordered_map>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Groups of row indexes with equal values. Groups of a single row are omitted.
+using StrippedPartition = std::vector<std::vector<uint32_t>>;
+
+// Indexes of the columns that form a combination, sorted ascending.
+using Combination = std::vector<size_t>;
+
+struct EncodedColumn {
+  // Dense value ID of each row, in the order of the table's chunks.
+  std::vector<uint32_t> value_ids;
+  uint32_t distinct_value_count{0};
+};
+
+// Assigns dense value IDs to the values of a column. Returns std::nullopt if the column contains NULLs.
+std::optional<EncodedColumn> encode_column(const Table& table, const ColumnID column_id) {
+  auto encoded_column = EncodedColumn{};
+  encoded_column.value_ids.reserve(table.row_count());
+  auto contains_nulls = false;
+
+  resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto value_ids = std::unordered_map<ColumnDataType, uint32_t>{};
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count && !contains_nulls; ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      if (!chunk) {
+        continue;
+      }
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          contains_nulls = true;
+          return;
+        }
+
+        const auto next_value_id = static_cast<uint32_t>(value_ids.size());
+        const auto value_id_it = value_ids.try_emplace(position.value(), next_value_id).first;
+        encoded_column.value_ids.emplace_back(value_id_it->second);
+      });
+    }
+    encoded_column.distinct_value_count = static_cast<uint32_t>(value_ids.size());
+  });
+
+  if (contains_nulls) {
+    return std::nullopt;
+  }
+  return encoded_column;
+}
+
+StrippedPartition partition_column(const EncodedColumn& column) {
+  auto groups = StrippedPartition(column.distinct_value_count);
+  const auto row_count = static_cast<uint32_t>(column.value_ids.size());
+  for (auto row = uint32_t{0}; row < row_count; ++row) {
+    groups[column.value_ids[row]].emplace_back(row);
+  }
+
+  std::erase_if(groups, [](const auto& group) { return group.size() < 2; });
+  return groups;
+}
+
+// Splits each group of the partition by the value IDs of another column. Only the rows of non-unique groups have to be
+// considered, which usually are few compared to the table size.
+StrippedPartition refine_partition(const StrippedPartition& partition, const EncodedColumn& column) {
+  const auto& value_ids = column.value_ids;
+  auto refined_partition = StrippedPartition{};
+  auto rows = std::vector<uint32_t>{};
+
+  for (const auto& group : partition) {
+    rows = group;
+    std::sort(rows.begin(), rows.end(), [&](const auto lhs, const auto rhs) {
+      return value_ids[lhs] < value_ids[rhs];
+    });
+
+    auto group_begin = rows.cbegin();
+    const auto rows_end = rows.cend();
+    while (group_begin != rows_end) {
+      const auto value_id = value_ids[*group_begin];
+      const auto group_end =
+          std::find_if(group_begin, rows_end, [&](const auto row) { return value_ids[row] != value_id; });
+      if (std::distance(group_begin, group_end) > 1) {
+        refined_partition.emplace_back(group_begin, group_end);
+      }
+      group_begin = group_end;
+    }
+  }
+
+  return refined_partition;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::vector<std::vector<ColumnID>> find_minimal_uccs(const std::shared_ptr<const Table>& table,
+                                                     const std::vector<ColumnID>& column_ids, const size_t max_size) {
+  Assert(table->row_count() <= std::numeric_limits<uint32_t>::max(), "Row indexes must fit into uint32_t.");
+  auto uccs = std::vector<std::vector<ColumnID>>{};
+  if (max_size == 0) {
+    return uccs;
+  }
+
+  auto sorted_column_ids = column_ids;
+  std::sort(sorted_column_ids.begin(), sorted_column_ids.end());
+  sorted_column_ids.erase(std::unique(sorted_column_ids.begin(), sorted_column_ids.end()), sorted_column_ids.end());
+
+  auto columns = std::vector<ColumnID>{};
+  auto encoded_columns = std::vector<EncodedColumn>{};
+  for (const auto column_id : sorted_column_ids) {
+    auto encoded_column = encode_column(*table, column_id);
+    if (!encoded_column) {
+      continue;
+    }
+    columns.emplace_back(column_id);
+    encoded_columns.emplace_back(std::move(*encoded_column));
+  }
+
+  const auto to_column_ids = [&](const auto& combination) {
+    auto ucc = std::vector<ColumnID>{};
+    ucc.reserve(combination.size());
+    for (const auto column_index : combination) {
+      ucc.emplace_back(columns[column_index]);
+    }
+    return ucc;
+  };
+
+  // Non-unique combinations of the current level, ordered lexicographically.
+  auto level = std::vector<std::pair<Combination, StrippedPartition>>{};
+  const auto column_count = columns.size();
+  for (auto column_index = size_t{0}; column_index < column_count; ++column_index) {
+    auto partition = partition_column(encoded_columns[column_index]);
+    if (partition.empty()) {
+      uccs.emplace_back(to_column_ids(Combination{column_index}));
+      continue;
+    }
+    level.emplace_back(Combination{column_index}, std::move(partition));
+  }
+
+  for (auto level_size = size_t{1}; uccs.empty() && level_size < max_size && level.size() > 1; ++level_size) {
+    auto non_unique_combinations = std::set<Combination>{};
+    for (const auto& combination_and_partition : level) {
+      non_unique_combinations.emplace(combination_and_partition.first);
+    }
+
+    auto next_level = std::vector<std::pair<Combination, StrippedPartition>>{};
+    const auto level_combination_count = level.size();
+    for (auto lhs_index = size_t{0}; lhs_index < level_combination_count; ++lhs_index) {
+      const auto& [lhs, lhs_partition] = level[lhs_index];
+      for (auto rhs_index = lhs_index + 1; rhs_index < level_combination_count; ++rhs_index) {
+        // Combinations are ordered lexicographically, so all combinations with the same prefix are adjacent.
+        const auto& rhs = level[rhs_index].first;
+        if (!std::equal(lhs.cbegin(), lhs.cend() - 1, rhs.cbegin())) {
+          break;
+        }
+
+        auto combination = lhs;
+        combination.emplace_back(rhs.back());
+
+        // Prune the combination if any of its subsets is unique. Omitting one of the last two columns yields lhs and
+        // rhs, which are known to be non-unique.
+        auto subsets_non_unique = true;
+        for (auto omitted_index = size_t{0}; omitted_index + 2 < combination.size(); ++omitted_index) {
+          auto subset = combination;
+          subset.erase(subset.begin() + static_cast<std::ptrdiff_t>(omitted_index));
+          if (!non_unique_combinations.contains(subset)) {
+            subsets_non_unique = false;
+            break;
+          }
+        }
+        if (!subsets_non_unique) {
+          continue;
+        }
+
+        auto partition = refine_partition(lhs_partition, encoded_columns[rhs.back()]);
+        if (partition.empty()) {
+          uccs.emplace_back(to_column_ids(combination));
+          continue;
+        }
+        next_level.emplace_back(std::move(combination), std::move(partition));
+      }
+    }
+
+    level = std::move(next_level);
+  }
+
+  return uccs;
+}
+
+}  // namespace hyrise
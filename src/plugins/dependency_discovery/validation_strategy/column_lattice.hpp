@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+
+/**
+ * Finds the minimal unique column combinations (UCCs) of at most `max_size` columns among the given columns. The search
+ * traverses the lattice of column combinations level-wise and bottom-up, similar to TANE [1]:
+ *   - Each column is encoded to dense value IDs once. Columns that contain NULLs cannot be part of a UCC and are
+ *     skipped.
+ *   - Each combination is represented by its stripped partition, i.e., the groups of rows that share the same values in
+ *     all of the combination's columns, omitting groups of a single row. A combination is unique iff its stripped
+ *     partition is empty. The partition of a combination is computed by refining the partition of one of its subsets
+ *     with the value IDs of the remaining column. Thus, we never materialize tuples of multiple columns.
+ *   - A combination of the next level is only generated if all of its subsets are not unique (apriori-gen).
+ *     Supersets of UCCs are unique, but not minimal.
+ *
+ * The search stops at the first level that contains a UCC and returns all UCCs of this level, i.e., the smallest
+ * minimal UCCs. Each UCC is sorted by ColumnID. If no combination is unique, the result is empty.
+ *
+ * [1] Huhtala et al. "TANE: An Efficient Algorithm for Discovering Functional and Approximate Dependencies", 1999.
+ */
+std::vector<std::vector<ColumnID>> find_minimal_uccs(const std::shared_ptr<const Table>& table,
+                                                     const std::vector<ColumnID>& column_ids, const size_t max_size);
+
+}  // namespace hyrise
@@ -1,6 +1,7 @@
 #include "fd_validation_rule.hpp"
 
 #include "dependency_discovery/validation_strategy/ucc_validation_rule.hpp"
+#include "hyrise.hpp"
 
 namespace hyrise {
 
@@ -9,15 +10,46 @@ FdValidationRule::FdValidationRule() : AbstractDependencyValidationRule{Dependen
 ValidationResult FdValidationRule::_on_validate(const AbstractDependencyCandidate& candidate) const {
   const auto& fd_candidate = static_cast<const FdCandidate&>(candidate);
 
-  // We do not build a lattice and check larger FDs. We just check if one of the columns is unique.
+  // First, we check if one of the columns is unique, which is the common case and benefits from the shortcuts of the
+  // unary UCC validation. Only if none is, we walk the lattice of column combinations to find a larger UCC.
+  auto ucc_rule = UccValidationRule{};
+  ucc_rule.set_falsification_sample_size(_falsification_sample_size);
+  ucc_rule.set_schedule_priority(_schedule_priority);
+
+  // The FD is rejected by the sampling pre-pass if the samples of all columns contain duplicates. Still, sampling saves
+  // the full check of each column that it rejects.
+  auto sampling = SamplingStatistics{};
+  sampling.rejected = !fd_candidate.column_ids.empty();
   for (const auto column_id : fd_candidate.column_ids) {
-    const auto& validation_result = UccValidationRule{}.validate(UccCandidate{fd_candidate.table_name, column_id});
+    auto validation_result = ucc_rule.validate(UccCandidate{fd_candidate.table_name, column_id});
+    sampling.rejected &= validation_result.sampling.rejected;
+    sampling.sampling_time += validation_result.sampling.sampling_time;
+    sampling.estimated_saved_time += validation_result.sampling.estimated_saved_time;
     if (validation_result.status != ValidationStatus::Invalid) {
+      sampling.rejected = false;
+      validation_result.sampling = sampling;
       return validation_result;
     }
   }
 
-  return ValidationResult{ValidationStatus::Invalid};
+  // The FD holds if any proper subset of its columns is unique. All unary subsets are not unique at this point.
+  const auto column_count = fd_candidate.column_ids.size();
+  if (column_count > 2) {
+    const auto& table = Hyrise::get().storage_manager.get_table(fd_candidate.table_name);
+    auto result = ucc_rule.validate_column_combination(table, fd_candidate.column_ids, column_count - 1);
+    sampling.rejected &= result.sampling.rejected;
+    sampling.sampling_time += result.sampling.sampling_time;
+    sampling.estimated_saved_time += result.sampling.estimated_saved_time;
+    if (result.status == ValidationStatus::Valid) {
+      result.sampling = sampling;
+      result.sampling.rejected = false;
+      return result;
+    }
+  }
+
+  auto result = ValidationResult{ValidationStatus::Invalid};
+  result.sampling = sampling;
+  return result;
 }
 
 }  // namespace hyrise
@@ -12,8 +12,16 @@ namespace {
 using namespace hyrise;  // NOLINT(build/namespaces)
 
 template <typename T>
-ValidationSet<T> collect_values(const std::shared_ptr<const Table>& table, const ColumnID column_id) {
-  auto distinct_values = ValidationSet<T>(table->row_count());
+typename ValidationUtils<T>::PartitionedValidationSet collect_values(const std::shared_ptr<const Table>& table,
+                                                                     const ColumnID column_id,
+                                                                     const SchedulePriority priority) {
+  if (ValidationUtils<T>::use_parallel_validation(table)) {
+    return ValidationUtils<T>::collect_values_parallel(table, column_id, priority);
+  }
+
+  auto partitioned_values = typename ValidationUtils<T>::PartitionedValidationSet{};
+  auto& distinct_values = partitioned_values.partitions.front();
+  distinct_values.reserve(table->row_count());
   const auto chunk_count = table->chunk_count();
 
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
@@ -41,7 +49,46 @@ ValidationSet<T> collect_values(const std::shared_ptr<const Table>& table, const
     }
   }
 
-  return distinct_values;
+  return partitioned_values;
+}
+
+/**
+ * For integral columns with a dense domain, the distinct values of the including column are collected in a bitmap
+ * instead of a ValidationSet. Returns std::nullopt if the bitmap cannot be built because the min/max values are not
+ * accurate.
+ */
+template <typename T>
+std::optional<ValidationStatus> perform_bitmap_based_inclusion_check(
+    const std::shared_ptr<Table>& including_table, const ColumnID including_column_id,
+    const std::shared_ptr<Table>& included_table, const ColumnID included_column_id,
+    std::unordered_map<std::shared_ptr<Table>, std::shared_ptr<AbstractTableConstraint>>& constraints,
+    const std::pair<T, T>& including_min_max, const std::optional<std::pair<T, T>>& included_min_max,
+    const SchedulePriority priority) {
+  auto including_values = DenseDomainBitmap<T>{including_min_max.first, including_min_max.second};
+  if (!including_values.add_column(including_table, including_column_id, priority)) {
+    return std::nullopt;
+  }
+
+  const auto distinct_value_count = including_values.size();
+  Assert(distinct_value_count > 0, "Empty tables not considered.");
+  if (distinct_value_count == including_table->row_count()) {
+    constraints[including_table] =
+        std::make_shared<TableKeyConstraint>(std::set<ColumnID>{including_column_id}, KeyConstraintType::UNIQUE);
+  }
+
+  if (included_min_max) {
+    if (included_min_max->first < including_values.min || included_min_max->second > including_values.max) {
+      return ValidationStatus::Invalid;
+    }
+
+    // Skip probing if the including column is continuous.
+    if (distinct_value_count == including_values.domain_size()) {
+      return ValidationStatus::Valid;
+    }
+  }
+
+  return including_values.includes_column(included_table, included_column_id, priority) ? ValidationStatus::Valid
+                                                                                         : ValidationStatus::Invalid;
 }
 
 template <typename T>
@@ -49,11 +96,24 @@ ValidationStatus perform_set_based_inclusion_check(
     const std::shared_ptr<Table>& including_table, const ColumnID including_column_id,
     const std::shared_ptr<Table>& included_table, const ColumnID included_column_id,
     std::unordered_map<std::shared_ptr<Table>, std::shared_ptr<AbstractTableConstraint>>& constraints,
-    const std::optional<std::pair<T, T>>& including_min_max, const std::optional<std::pair<T, T>>& included_min_max) {
-  const auto including_values = collect_values<T>(including_table, including_column_id);
+    const std::optional<std::pair<T, T>>& including_min_max, const std::optional<std::pair<T, T>>& included_min_max,
+    const SchedulePriority priority) {
+  if constexpr (std::is_integral_v<T>) {
+    if (including_min_max && DenseDomainBitmap<T>::use_for_domain(including_min_max->first, including_min_max->second,
+                                                                  including_table->row_count())) {
+      const auto status = perform_bitmap_based_inclusion_check<T>(including_table, including_column_id,
+                                                                  included_table, included_column_id, constraints,
+                                                                  *including_min_max, included_min_max, priority);
+      if (status) {
+        return *status;
+      }
+    }
+  }
+
+  const auto including_values = collect_values<T>(including_table, including_column_id, priority);
 
   if constexpr (std::is_integral_v<T>) {
-    Assert(!including_values.empty(), "Empty tables not considered.");
+    Assert(including_values.size() > 0, "Empty tables not considered.");
     if (including_min_max) {
       const auto domain = static_cast<size_t>(including_min_max->second - including_min_max->first);
       if (domain == including_table->row_count() - 1) {
@@ -72,6 +132,12 @@ ValidationStatus perform_set_based_inclusion_check(
     }
   }
 
+  if (ValidationUtils<T>::use_parallel_validation(included_table)) {
+    return ValidationUtils<T>::values_included_parallel(including_values, included_table, included_column_id, priority)
+               ? ValidationStatus::Valid
+               : ValidationStatus::Invalid;
+  }
+
   auto status = ValidationStatus::Valid;
   const auto chunk_count = included_table->chunk_count();
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
@@ -136,7 +202,8 @@ ValidationResult IndValidationRule::_on_validate(const AbstractDependencyCandida
       PerformanceWarning("Could not obtain min/max values.");
       result.status = perform_set_based_inclusion_check<ColumnDataType>(including_table, including_column_id,
                                                                         included_table, included_column_id,
-                                                                        result.constraints, std::nullopt, std::nullopt);
+                                                                        result.constraints, std::nullopt, std::nullopt,
+                                                                        _schedule_priority);
       return;
     }
 
@@ -158,7 +225,7 @@ ValidationResult IndValidationRule::_on_validate(const AbstractDependencyCandida
         if (!including_min_max) {
           result.status = perform_set_based_inclusion_check<ColumnDataType>(
               including_table, including_column_id, included_table, included_column_id, result.constraints,
-              including_min_max, included_min_max);
+              including_min_max, included_min_max, _schedule_priority);
           return;
         }
 
@@ -212,7 +279,7 @@ ValidationResult IndValidationRule::_on_validate(const AbstractDependencyCandida
 
     result.status = perform_set_based_inclusion_check<ColumnDataType>(
         including_table, including_column_id, included_table, included_column_id, result.constraints, including_min_max,
-        included_min_max);
+        included_min_max, _schedule_priority);
   });
 
   if (result.status == ValidationStatus::Valid) {
@@ -129,6 +129,34 @@ bool sample_ordered(const std::shared_ptr<const Table>& table, const ColumnID or
   return true;
 }
 
+/**
+ * Checks a random sample of rows for order inversions, i.e., two rows where the ordering value increases but the
+ * ordered value decreases. Returns false if the sample contains an inversion or a NULL value.
+ */
+template <typename OrderingType, typename OrderedType>
+bool random_sample_ordered(const std::shared_ptr<const Table>& table, const ColumnID ordering_column_id,
+                           const ColumnID ordered_column_id, const RowSample& sample) {
+  const auto ordering_values = ValidationUtils<OrderingType>::materialize_sample(table, ordering_column_id, sample);
+  const auto ordered_values = ValidationUtils<OrderedType>::materialize_sample(table, ordered_column_id, sample);
+  if (!ordering_values || !ordered_values) {
+    return false;
+  }
+
+  const auto row_count = ordering_values->size();
+  auto rows = std::vector<std::pair<OrderingType, OrderedType>>{};
+  rows.reserve(row_count);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    rows.emplace_back((*ordering_values)[row_id], (*ordered_values)[row_id]);
+  }
+
+  // Sorting by both values orders rows with equal ordering values by their ordered values. Thus, only actual
+  // inversions remain.
+  std::sort(rows.begin(), rows.end());
+  return std::is_sorted(rows.cbegin(), rows.cend(), [](const auto& lhs, const auto& rhs) {
+    return lhs.second < rhs.second;
+  });
+}
+
 template <typename T>
 bool check_column_sortedness(const std::shared_ptr<const Table> table, const ColumnID column_id,
                              const ChunkID chunk_count) {
@@ -272,12 +300,22 @@ ValidationResult OdValidationRule::_on_validate(const AbstractDependencyCandidat
   const auto ordered_column_id = od_candidate.ordered_column_id;
 
   auto status = ValidationStatus::Uncertain;
+  auto sampling = SamplingStatistics{};
   const auto row_count = table->row_count();
   resolve_data_type(table->column_data_type(ordering_column_id), [&](const auto ordering_data_type_t) {
     using OrderingColumnDataType = typename decltype(ordering_data_type_t)::type;
     resolve_data_type(table->column_data_type(ordered_column_id), [&](const auto ordered_data_type_t) {
       using OrderedColumnDataType = typename decltype(ordered_data_type_t)::type;
 
+      // Check for inversions in a random sample before we check larger parts of the table.
+      if (_falsified_by_sample(table, sampling, [&](const auto& sample) {
+            return random_sample_ordered<OrderingColumnDataType, OrderedColumnDataType>(table, ordering_column_id,
+                                                                                        ordered_column_id, sample);
+          })) {
+        status = ValidationStatus::Invalid;
+        return;
+      }
+
       // Check ordering for sample.
       const auto ordered = sample_ordered<OrderingColumnDataType, OrderedColumnDataType>(table, ordering_column_id,
                                                                                          ordered_column_id, row_count);
@@ -461,6 +499,7 @@ ValidationResult OdValidationRule::_on_validate(const AbstractDependencyCandidat
   });
 
   auto result = ValidationResult(status);
+  result.sampling = sampling;
   if (status == ValidationStatus::Valid) {
     result.constraints[table] = _constraint_from_candidate(candidate);
   }
@@ -1,13 +1,56 @@
 #include "ucc_validation_rule.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+
+#include "dependency_discovery/validation_strategy/column_lattice.hpp"
 #include "dependency_discovery/validation_strategy/validation_utils.hpp"
 #include "expression/expression_utils.hpp"
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "storage/constraints/table_key_constraint.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Returns false if two sampled rows have the same values in all columns, which proves that no subset of the columns is
+// unique. NULLs are treated as equal to each other: columns that contain NULLs cannot be part of a UCC anyway.
+bool sample_unique_combination(const std::shared_ptr<const Table>& table, const std::vector<ColumnID>& column_ids,
+                               const RowSample& sample) {
+  auto rows = std::vector<std::vector<uint32_t>>(sample_row_count(sample));
+  for (const auto column_id : column_ids) {
+    resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      // Encode the values to dense IDs, where 0 represents NULL.
+      auto value_ids = std::unordered_map<ColumnDataType, uint32_t>{};
+      auto row_id = size_t{0};
+      const auto add_value_id = [&](const auto& position) {
+        auto value_id = uint32_t{0};
+        if (!position.is_null()) {
+          value_id = value_ids.emplace(position.value(), static_cast<uint32_t>(value_ids.size() + 1)).first->second;
+        }
+        rows[row_id].emplace_back(value_id);
+        ++row_id;
+      };
+
+      for (const auto& position_filter : sample) {
+        const auto& chunk = table->get_chunk(position_filter->common_chunk_id());
+        segment_iterate_filtered<ColumnDataType>(*chunk->get_segment(column_id), position_filter, add_value_id);
+      }
+    });
+  }
+
+  std::sort(rows.begin(), rows.end());
+  return std::adjacent_find(rows.cbegin(), rows.cend()) == rows.cend();
+}
+
+}  // namespace
+
 namespace hyrise {
 
 UccValidationRule::UccValidationRule() : AbstractDependencyValidationRule{DependencyType::UniqueColumn} {}
@@ -16,8 +59,13 @@ ValidationResult UccValidationRule::_on_validate(const AbstractDependencyCandida
   const auto& ucc_candidate = static_cast<const UccCandidate&>(candidate);
 
   auto status = ValidationStatus::Uncertain;
+  auto sampling = SamplingStatistics{};
   const auto& table = Hyrise::get().storage_manager.get_table(ucc_candidate.table_name);
-  const auto column_id = ucc_candidate.column_id;
+  if (ucc_candidate.column_ids.size() > 1) {
+    return validate_column_combination(table, ucc_candidate.column_ids, ucc_candidate.column_ids.size());
+  }
+
+  const auto column_id = ucc_candidate.column_ids.front();
 
   resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
     using ColumnDataType = typename decltype(data_type_t)::type;
@@ -34,8 +82,21 @@ ValidationResult UccValidationRule::_on_validate(const AbstractDependencyCandida
       }
     }
 
-    // If we reach here, we have to run the more expensive cross-segment duplicate check.
-    if (!_uniqueness_holds_across_segments<ColumnDataType>(table, column_id)) {
+    // Try to find a duplicate or NULL in a random sample before we check the entire column.
+    if (_falsified_by_sample(table, sampling, [&](const auto& sample) {
+          return ValidationUtils<ColumnDataType>::sample_unique(table, column_id, sample);
+        })) {
+      status = ValidationStatus::Invalid;
+      return;
+    }
+
+    // If we reach here, we have to run the more expensive cross-segment duplicate check. For large tables, it is split
+    // into radix partitions that are checked concurrently.
+    const auto uniqueness_holds =
+        ValidationUtils<ColumnDataType>::use_parallel_validation(table)
+            ? ValidationUtils<ColumnDataType>::uniqueness_holds_parallel(table, column_id, _schedule_priority)
+            : _uniqueness_holds_across_segments<ColumnDataType>(table, column_id);
+    if (!uniqueness_holds) {
       status = ValidationStatus::Invalid;
       return;
     }
@@ -44,6 +105,7 @@ ValidationResult UccValidationRule::_on_validate(const AbstractDependencyCandida
   });
 
   auto result = ValidationResult(status);
+  result.sampling = sampling;
   if (status == ValidationStatus::Valid) {
     result.constraints[table] = _constraint_from_candidate(candidate);
   }
@@ -51,6 +113,36 @@ ValidationResult UccValidationRule::_on_validate(const AbstractDependencyCandida
   return result;
 }
 
+ValidationResult UccValidationRule::validate_column_combination(const std::shared_ptr<Table>& table,
+                                                                const std::vector<ColumnID>& column_ids,
+                                                                const size_t max_size) const {
+  // If the combination of all columns is not unique, none of its subsets is. Try to find duplicate rows in a random
+  // sample before we walk the lattice.
+  auto sampling = SamplingStatistics{};
+  if (_falsified_by_sample(table, sampling, [&](const auto& sample) {
+        return sample_unique_combination(table, column_ids, sample);
+      })) {
+    auto result = ValidationResult{ValidationStatus::Invalid};
+    result.sampling = sampling;
+    return result;
+  }
+
+  const auto uccs = find_minimal_uccs(table, column_ids, max_size);
+  if (uccs.empty()) {
+    auto result = ValidationResult{ValidationStatus::Invalid};
+    result.sampling = sampling;
+    return result;
+  }
+
+  // The result holds a single constraint per table. All UCCs found have the same size, so we pick the first one.
+  const auto& ucc = uccs.front();
+  auto result = ValidationResult{ValidationStatus::Valid};
+  result.sampling = sampling;
+  result.constraints[table] =
+      std::make_shared<TableKeyConstraint>(std::set<ColumnID>{ucc.cbegin(), ucc.cend()}, KeyConstraintType::UNIQUE);
+  return result;
+}
+
 template <typename ColumnDataType>
 bool UccValidationRule::_uniqueness_holds_across_segments(const std::shared_ptr<Table>& table,
                                                           const ColumnID column_id) {
@@ -10,6 +10,14 @@ class UccValidationRule : public AbstractDependencyValidationRule {
  public:
   UccValidationRule();
 
+  /**
+   * Searches the minimal UCCs of at most `max_size` of the given columns (see find_minimal_uccs()). If there are any,
+   * the result is valid and holds a key constraint for one of them. Like the validation of single columns, the search
+   * is skipped if a sample of the rows contains duplicates in all columns.
+   */
+  ValidationResult validate_column_combination(const std::shared_ptr<Table>& table,
+                                               const std::vector<ColumnID>& column_ids, const size_t max_size) const;
+
  protected:
   ValidationResult _on_validate(const AbstractDependencyCandidate& candidate) const override;
 
@@ -18,7 +18,8 @@ ValidationResult UccValidationRuleAblation::_on_validate(const AbstractDependenc
 
   auto status = ValidationStatus::Uncertain;
   const auto& table = Hyrise::get().storage_manager.get_table(ucc_candidate.table_name);
-  const auto column_id = ucc_candidate.column_id;
+  Assert(ucc_candidate.column_ids.size() == 1, "Ablation rules only validate unary UCCs.");
+  const auto column_id = ucc_candidate.column_ids.front();
 
   resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
     using ColumnDataType = typename decltype(data_type_t)::type;
@@ -1,12 +1,138 @@
 #include "validation_utils.hpp"
 
+#include <atomic>
+#include <bit>
+#include <limits>
 #include <map>
+#include <random>
 
+#include "hyrise.hpp"
+#include "scheduler/job_task.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/statistics_objects/min_max_filter.hpp"
 #include "statistics/statistics_objects/range_filter.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
+#include "utils/fibonacci_hash.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Values of a column per chunk (outer vector) and radix partition (inner vector).
+template <typename T>
+using ChunkPartitions = std::vector<std::vector<std::vector<T>>>;
+
+/**
+ * Materializes the non-NULL values of all chunks into radix partitions, using one job per chunk. For dictionary
+ * segments, only the dictionary is materialized. If `require_unique` is set, `abort` is raised as soon as a segment
+ * contains NULLs or its dictionary is smaller than the segment (i.e., the segment contains duplicates). All jobs stop
+ * once `abort` is set.
+ */
+template <typename T>
+ChunkPartitions<T> materialize_partitioned(const std::shared_ptr<const Table>& table, const ColumnID column_id,
+                                           const typename ValidationUtils<T>::PartitionedValidationSet& partitioner,
+                                           const bool require_unique, std::atomic_bool& abort,
+                                           const SchedulePriority priority) {
+  const auto chunk_count = table->chunk_count();
+  const auto partition_count = partitioner.partitions.size();
+  auto chunk_partitions = ChunkPartitions<T>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id]() {
+      if (abort) {
+        return;
+      }
+
+      auto& partitions = chunk_partitions[chunk_id];
+      partitions.resize(partition_count);
+      const auto& segment = chunk->get_segment(column_id);
+
+      if (const auto& dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
+        const auto& dictionary = *dictionary_segment->dictionary();
+        if (require_unique && dictionary.size() != dictionary_segment->size()) {
+          abort = true;
+          return;
+        }
+
+        for (const auto& value : dictionary) {
+          partitions[partitioner.partition(value)].emplace_back(value);
+        }
+        return;
+      }
+
+      segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
+        while (it != end) {
+          if (abort) {
+            return;
+          }
+
+          if (it->is_null()) {
+            if (require_unique) {
+              abort = true;
+              return;
+            }
+            ++it;
+            continue;
+          }
+
+          const auto& value = it->value();
+          partitions[partitioner.partition(value)].emplace_back(value);
+          ++it;
+        }
+      });
+    }, priority));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  return chunk_partitions;
+}
+
+// Choose the partition count such that each partition holds roughly MIN_ROWS_FOR_PARALLEL_VALIDATION values.
+template <typename T>
+size_t radix_bits_for_table(const std::shared_ptr<const Table>& table) {
+  const auto row_count = table->row_count();
+  const auto radix_bits =
+      static_cast<size_t>(std::bit_width(row_count / ValidationUtils<T>::MIN_ROWS_FOR_PARALLEL_VALIDATION));
+  return std::min(radix_bits, ValidationUtils<T>::MAX_RADIX_BITS);
+}
+
+// Calls `functor` for each chunk of the table. If `parallel` is set, each chunk is processed by a separate job.
+template <typename Functor>
+void for_each_chunk(const std::shared_ptr<const Table>& table, const bool parallel, const SchedulePriority priority,
+                    const Functor& functor) {
+  const auto chunk_count = table->chunk_count();
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  if (parallel) {
+    jobs.reserve(chunk_count);
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    if (!parallel) {
+      functor(*chunk);
+      continue;
+    }
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk]() { functor(*chunk); }, priority));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+}  // namespace
 
 namespace hyrise {
 
@@ -188,6 +314,401 @@ std::optional<std::pair<T, T>> ValidationUtils<T>::get_column_min_max_value(cons
   return std::make_pair(min, max);
 }
 
+template <typename T>
+ValidationUtils<T>::PartitionedValidationSet::PartitionedValidationSet(const size_t init_radix_bits)
+    : radix_bits{init_radix_bits}, partitions(size_t{1} << init_radix_bits) {}
+
+template <typename T>
+size_t ValidationUtils<T>::PartitionedValidationSet::partition(const T& value) const {
+  // std::hash is the identity for integers. Clustered keys (e.g., multiples of a power of two) would end up in few
+  // partitions if we used the lower bits of their hashes.
+  return fibonacci_partition(std::hash<T>{}(value), static_cast<uint32_t>(radix_bits));
+}
+
+template <typename T>
+bool ValidationUtils<T>::PartitionedValidationSet::contains(const T& value) const {
+  return partitions[partition(value)].contains(value);
+}
+
+template <typename T>
+size_t ValidationUtils<T>::PartitionedValidationSet::size() const {
+  auto size = size_t{0};
+  for (const auto& partition : partitions) {
+    size += partition.size();
+  }
+  return size;
+}
+
+template <typename T>
+bool ValidationUtils<T>::use_parallel_validation(const std::shared_ptr<const Table>& table) {
+  return Hyrise::get().is_multi_threaded() && table->chunk_count() > 1 &&
+         table->row_count() >= MIN_ROWS_FOR_PARALLEL_VALIDATION;
+}
+
+template <typename T>
+bool ValidationUtils<T>::uniqueness_holds_parallel(const std::shared_ptr<const Table>& table, const ColumnID column_id,
+                                                   const SchedulePriority priority) {
+  auto abort = std::atomic_bool{false};
+  const auto partitioner = PartitionedValidationSet{radix_bits_for_table<T>(table)};
+  const auto chunk_partitions = materialize_partitioned<T>(table, column_id, partitioner, true, abort, priority);
+  if (abort) {
+    return false;
+  }
+
+  const auto partition_count = partitioner.partitions.size();
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(partition_count);
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto value_count = size_t{0};
+      for (const auto& partitions : chunk_partitions) {
+        if (!partitions.empty()) {
+          value_count += partitions[partition_id].size();
+        }
+      }
+
+      auto distinct_values = ValidationSet<T>(value_count);
+      for (const auto& partitions : chunk_partitions) {
+        if (partitions.empty()) {
+          continue;
+        }
+
+        for (const auto& value : partitions[partition_id]) {
+          if (!distinct_values.insert(value).second) {
+            abort = true;
+            return;
+          }
+        }
+
+        if (abort) {
+          return;
+        }
+      }
+    }, priority));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  return !abort;
+}
+
+template <typename T>
+typename ValidationUtils<T>::PartitionedValidationSet ValidationUtils<T>::collect_values_parallel(
+    const std::shared_ptr<const Table>& table, const ColumnID column_id, const SchedulePriority priority) {
+  auto abort = std::atomic_bool{false};
+  auto distinct_values = PartitionedValidationSet{radix_bits_for_table<T>(table)};
+  const auto chunk_partitions = materialize_partitioned<T>(table, column_id, distinct_values, false, abort, priority);
+
+  const auto partition_count = distinct_values.partitions.size();
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(partition_count);
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& partition = distinct_values.partitions[partition_id];
+      for (const auto& partitions : chunk_partitions) {
+        if (!partitions.empty()) {
+          partition.insert(partitions[partition_id].cbegin(), partitions[partition_id].cend());
+        }
+      }
+    }, priority));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  return distinct_values;
+}
+
+template <typename T>
+bool ValidationUtils<T>::values_included_parallel(const PartitionedValidationSet& values,
+                                                  const std::shared_ptr<const Table>& table, const ColumnID column_id,
+                                                  const SchedulePriority priority) {
+  auto abort = std::atomic_bool{false};
+  const auto chunk_count = table->chunk_count();
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk]() {
+      if (abort) {
+        return;
+      }
+
+      const auto& segment = chunk->get_segment(column_id);
+      if (const auto& dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
+        for (const auto& value : *dictionary_segment->dictionary()) {
+          if (!values.contains(value)) {
+            abort = true;
+            return;
+          }
+        }
+        return;
+      }
+
+      segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
+        while (it != end) {
+          if (abort) {
+            return;
+          }
+
+          if (!it->is_null() && !values.contains(it->value())) {
+            abort = true;
+            return;
+          }
+          ++it;
+        }
+      });
+    }, priority));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  return !abort;
+}
+
+template <typename T>
+std::optional<std::vector<T>> ValidationUtils<T>::materialize_sample(const std::shared_ptr<const Table>& table,
+                                                                     const ColumnID column_id,
+                                                                     const RowSample& sample) {
+  auto values = std::vector<T>{};
+  values.reserve(sample_row_count(sample));
+  auto contains_nulls = false;
+  for (const auto& position_filter : sample) {
+    const auto& chunk = table->get_chunk(position_filter->common_chunk_id());
+    segment_with_iterators_filtered<T>(*chunk->get_segment(column_id), position_filter, [&](auto it, const auto end) {
+      while (it != end) {
+        if (it->is_null()) {
+          contains_nulls = true;
+          return;
+        }
+        values.emplace_back(it->value());
+        ++it;
+      }
+    });
+
+    if (contains_nulls) {
+      return std::nullopt;
+    }
+  }
+
+  return values;
+}
+
+template <typename T>
+bool ValidationUtils<T>::sample_unique(const std::shared_ptr<const Table>& table, const ColumnID column_id,
+                                       const RowSample& sample) {
+  const auto values = materialize_sample(table, column_id, sample);
+  if (!values) {
+    return false;
+  }
+
+  // The sampled rows are distinct, so duplicate values prove that the column is not unique.
+  const auto distinct_values = ValidationSet<T>(values->cbegin(), values->cend());
+  return distinct_values.size() == values->size();
+}
+
+RowSample draw_row_sample(const Table& table, const uint64_t sample_size) {
+  auto chunk_ids = std::vector<ChunkID>{};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk && chunk->size() > 0) {
+      chunk_ids.emplace_back(chunk_id);
+    }
+  }
+
+  if (chunk_ids.empty()) {
+    return {};
+  }
+
+  auto generator = std::mt19937{1337};
+  auto chunk_distribution = std::uniform_int_distribution<size_t>{0, chunk_ids.size() - 1};
+  auto row_ids = std::vector<RowID>{};
+  row_ids.reserve(sample_size);
+  for (auto sample_id = uint64_t{0}; sample_id < sample_size; ++sample_id) {
+    const auto chunk_id = chunk_ids[chunk_distribution(generator)];
+    const auto chunk_size = table.get_chunk(chunk_id)->size();
+    auto offset_distribution = std::uniform_int_distribution<ChunkOffset::base_type>{0, chunk_size - 1};
+    row_ids.emplace_back(chunk_id, ChunkOffset{offset_distribution(generator)});
+  }
+
+  // Sampling the same row twice would yield false duplicates.
+  std::sort(row_ids.begin(), row_ids.end());
+  row_ids.erase(std::unique(row_ids.begin(), row_ids.end()), row_ids.end());
+
+  auto sample = RowSample{};
+  for (const auto& row_id : row_ids) {
+    if (sample.empty() || sample.back()->common_chunk_id() != row_id.chunk_id) {
+      sample.emplace_back(std::make_shared<RowIDPosList>());
+      sample.back()->guarantee_single_chunk();
+    }
+    sample.back()->emplace_back(row_id);
+  }
+
+  return sample;
+}
+
+size_t sample_row_count(const RowSample& sample) {
+  auto row_count = size_t{0};
+  for (const auto& position_filter : sample) {
+    row_count += position_filter->size();
+  }
+  return row_count;
+}
+
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ValidationUtils);
 
+template <typename T>
+DenseDomainBitmap<T>::DenseDomainBitmap(const T init_min, const T init_max)
+    : min{init_min}, max{init_max}, _words(_offset(init_max) / 64 + 1) {
+  Assert(min <= max, "Invalid value range.");
+}
+
+template <typename T>
+bool DenseDomainBitmap<T>::use_for_domain(const T min, const T max, const uint64_t row_count) {
+  const auto max_offset = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+  return min <= max && max_offset / MAX_BITS_PER_ROW < row_count;
+}
+
+template <typename T>
+bool DenseDomainBitmap<T>::add_column(const std::shared_ptr<const Table>& table, const ColumnID column_id,
+                                      const SchedulePriority priority) {
+  auto out_of_range = std::atomic_bool{false};
+  const auto set_bit = [&](const T value) {
+    if (value < min || value > max) {
+      out_of_range = true;
+      return;
+    }
+    const auto offset = _offset(value);
+    _words[offset / 64].fetch_or(uint64_t{1} << (offset % 64), std::memory_order_relaxed);
+  };
+
+  for_each_chunk(table, ValidationUtils<T>::use_parallel_validation(table), priority, [&](const Chunk& chunk) {
+    if (out_of_range) {
+      return;
+    }
+
+    const auto& segment = chunk.get_segment(column_id);
+    if (const auto& dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
+      for (const auto value : *dictionary_segment->dictionary()) {
+        set_bit(value);
+      }
+      return;
+    }
+
+    segment_iterate<T>(*segment, [&](const auto& position) {
+      if (!position.is_null()) {
+        set_bit(position.value());
+      }
+    });
+  });
+
+  return !out_of_range;
+}
+
+template <typename T>
+bool DenseDomainBitmap<T>::includes_column(const std::shared_ptr<const Table>& table, const ColumnID column_id,
+                                           const SchedulePriority priority) const {
+  auto abort = std::atomic_bool{false};
+
+  // Tests all values and only branches once per block, which allows the compiler to vectorize the range test.
+  const auto block_included = [&](const auto begin, const auto end) {
+    auto out_of_range = false;
+    for (auto it = begin; it != end; ++it) {
+      out_of_range |= *it < min || *it > max;
+    }
+    if (out_of_range) {
+      return false;
+    }
+
+    auto missing = false;
+    for (auto it = begin; it != end; ++it) {
+      missing |= !contains(*it);
+    }
+    return !missing;
+  };
+
+  for_each_chunk(table, ValidationUtils<T>::use_parallel_validation(table), priority, [&](const Chunk& chunk) {
+    if (abort) {
+      return;
+    }
+
+    const auto& segment = chunk.get_segment(column_id);
+    if (const auto& dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
+      // Dictionaries are sorted, so the range test only needs the first and the last value.
+      const auto& dictionary = *dictionary_segment->dictionary();
+      if (!dictionary.empty() && (dictionary.front() < min || dictionary.back() > max ||
+                                  !block_included(dictionary.cbegin(), dictionary.cend()))) {
+        abort = true;
+      }
+      return;
+    }
+
+    if (const auto& value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(segment);
+        value_segment && !value_segment->is_nullable()) {
+      constexpr auto BLOCK_SIZE = size_t{1'024};
+      const auto& values = value_segment->values();
+      const auto value_count = values.size();
+      for (auto block_begin = size_t{0}; block_begin < value_count && !abort; block_begin += BLOCK_SIZE) {
+        const auto block_end = std::min(block_begin + BLOCK_SIZE, value_count);
+        if (!block_included(values.cbegin() + static_cast<std::ptrdiff_t>(block_begin),
+                            values.cbegin() + static_cast<std::ptrdiff_t>(block_end))) {
+          abort = true;
+        }
+      }
+      return;
+    }
+
+    segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
+      while (it != end) {
+        if (abort) {
+          return;
+        }
+
+        if (!it->is_null()) {
+          const auto value = it->value();
+          if (value < min || value > max || !contains(value)) {
+            abort = true;
+            return;
+          }
+        }
+        ++it;
+      }
+    });
+  });
+
+  return !abort;
+}
+
+template <typename T>
+bool DenseDomainBitmap<T>::contains(const T value) const {
+  const auto offset = _offset(value);
+  return (_words[offset / 64].load(std::memory_order_relaxed) >> (offset % 64)) & 1;
+}
+
+template <typename T>
+uint64_t DenseDomainBitmap<T>::size() const {
+  auto count = uint64_t{0};
+  for (const auto& word : _words) {
+    count += std::popcount(word.load(std::memory_order_relaxed));
+  }
+  return count;
+}
+
+template <typename T>
+uint64_t DenseDomainBitmap<T>::domain_size() const {
+  const auto max_offset = _offset(max);
+  return max_offset == std::numeric_limits<uint64_t>::max() ? max_offset : max_offset + 1;
+}
+
+template <typename T>
+uint64_t DenseDomainBitmap<T>::_offset(const T value) const {
+  // Unsigned arithmetic wraps around, which yields the correct distance for negative values as well.
+  return static_cast<uint64_t>(value) - static_cast<uint64_t>(min);
+}
+
+template class DenseDomainBitmap<int32_t>;
+template class DenseDomainBitmap<int64_t>;
+
 }  // namespace hyrise
@@ -1,12 +1,27 @@
 #pragma once
 
+#include <atomic>
+
 #include "all_type_variant.hpp"
+#include "dependency_discovery/dependency_candidates.hpp"
 #include "types.hpp"
 
 namespace hyrise {
 
 class Table;
 class Chunk;
+class RowIDPosList;
+
+// Rows of a random sample, grouped by chunk. Each position list references a single chunk.
+using RowSample = std::vector<std::shared_ptr<RowIDPosList>>;
+
+/**
+ * Draws up to `sample_size` distinct rows by picking random chunks and random offsets within these chunks. The seed is
+ * fixed, so repeated validations of a table use the same sample.
+ */
+RowSample draw_row_sample(const Table& table, const uint64_t sample_size);
+
+size_t sample_row_count(const RowSample& sample);
 
 template <typename T>
 class ValidationUtils {
@@ -30,8 +45,106 @@ class ValidationUtils {
 
   static std::optional<std::pair<T, T>> get_column_min_max_value(const std::shared_ptr<const Table>& table,
                                                                  const ColumnID column_id);
+
+  /**
+   * Set of column values that is split into 2^radix_bits partitions by the values' hashes. Each partition can be built
+   * and probed independently, which allows us to fill the set concurrently without synchronization.
+   */
+  struct PartitionedValidationSet {
+    explicit PartitionedValidationSet(const size_t init_radix_bits = 0);
+
+    size_t partition(const T& value) const;
+    bool contains(const T& value) const;
+    size_t size() const;
+
+    size_t radix_bits;
+    std::vector<ValidationSet<T>> partitions;
+  };
+
+  // Validation of tables with fewer rows is not split into multiple jobs as the scheduling overhead does not pay off.
+  constexpr static uint64_t MIN_ROWS_FOR_PARALLEL_VALIDATION{100'000};
+  constexpr static size_t MAX_RADIX_BITS{8};
+
+  // Parallel validation requires a multi-threaded scheduler and tables with more than one chunk.
+  static bool use_parallel_validation(const std::shared_ptr<const Table>& table);
+
+  /**
+   * Checks whether all values of a column are unique and not NULL. First, the values of all chunks are materialized
+   * into radix partitions concurrently. Second, each partition is checked for duplicates by a separate job. All jobs
+   * stop as soon as any job finds a NULL value or a duplicate.
+   */
+  static bool uniqueness_holds_parallel(const std::shared_ptr<const Table>& table, const ColumnID column_id,
+                                        const SchedulePriority priority = SchedulePriority::Default);
+
+  // Collects the distinct non-NULL values of a column. Chunks are radix-partitioned and partitions are built in
+  // separate jobs.
+  static PartitionedValidationSet collect_values_parallel(const std::shared_ptr<const Table>& table,
+                                                         const ColumnID column_id,
+                                                         const SchedulePriority priority = SchedulePriority::Default);
+
+  // Checks whether all non-NULL values of a column are contained in `values`. Chunks are probed in separate jobs, which
+  // stop as soon as any job finds a missing value.
+  static bool values_included_parallel(const PartitionedValidationSet& values,
+                                       const std::shared_ptr<const Table>& table, const ColumnID column_id,
+                                       const SchedulePriority priority = SchedulePriority::Default);
+
+  // Materializes the values of the sampled rows in the order of the sample. Returns std::nullopt if any sampled value
+  // is NULL.
+  static std::optional<std::vector<T>> materialize_sample(const std::shared_ptr<const Table>& table,
+                                                          const ColumnID column_id, const RowSample& sample);
+
+  // Returns false if the sampled values contain a duplicate or NULL, which proves that the column is not unique.
+  static bool sample_unique(const std::shared_ptr<const Table>& table, const ColumnID column_id,
+                            const RowSample& sample);
 };
 
 EXPLICITLY_DECLARE_DATA_TYPES(ValidationUtils);
 
+/**
+ * Set of the non-NULL values of an integral column, stored as a bitmap over the column's value range [min, max]. For
+ * dense domains (e.g., surrogate keys with few gaps), the bitmap is much smaller than a ValidationSet and needs no
+ * hashing. Setting bits is thread-safe, so the bitmap can be built by one job per chunk.
+ */
+template <typename T>
+class DenseDomainBitmap {
+  static_assert(std::is_integral_v<T>, "DenseDomainBitmap requires integral values.");
+
+ public:
+  DenseDomainBitmap(const T init_min, const T init_max);
+
+  // A bitmap is only used if it needs fewer than MAX_BITS_PER_ROW bits per row of the column.
+  static bool use_for_domain(const T min, const T max, const uint64_t row_count);
+
+  // Sets the bits of all non-NULL values of the column. Returns false if any value is not in [min, max], e.g., because
+  // the column was modified after its min/max values were determined. In this case, the bitmap is incomplete.
+  bool add_column(const std::shared_ptr<const Table>& table, const ColumnID column_id,
+                  const SchedulePriority priority = SchedulePriority::Default);
+
+  // Checks whether all non-NULL values of the column are contained. Dictionary segments are checked by probing their
+  // dictionaries, other segments test the value range before probing the bitmap.
+  bool includes_column(const std::shared_ptr<const Table>& table, const ColumnID column_id,
+                       const SchedulePriority priority = SchedulePriority::Default) const;
+
+  bool contains(const T value) const;
+
+  // Number of distinct values.
+  uint64_t size() const;
+
+  // Number of values in [min, max], saturated at the maximum of uint64_t for the full range of int64_t.
+  uint64_t domain_size() const;
+
+  constexpr static uint64_t MAX_BITS_PER_ROW{32};
+
+  const T min;
+  const T max;
+
+ private:
+  uint64_t _offset(const T value) const;
+
+  std::vector<std::atomic_uint64_t> _words;
+};
+
+extern template class DenseDomainBitmap<int32_t>;
+extern template class DenseDomainBitmap<int64_t>;
+
 }  // namespace hyrise
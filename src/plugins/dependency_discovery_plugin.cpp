@@ -1,5 +1,7 @@
 #include "dependency_discovery_plugin.hpp"
 
+#include <filesystem>
+
 #include <boost/container_hash/hash.hpp>
 #include "magic_enum.hpp"
 
@@ -17,7 +19,13 @@
 #include "dependency_discovery/validation_strategy/ucc_validation_rule.hpp"
 #include "dependency_discovery/validation_strategy/ucc_validation_rule_ablation.hpp"
 #include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/pqp_utils.hpp"
+#include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/timer.hpp"
@@ -26,23 +34,155 @@ namespace {
 
 using namespace hyrise;  // NOLINT(build/namespaces)
 
-void add_constraint(const std::shared_ptr<Table>& table, const std::shared_ptr<AbstractTableConstraint>& constraint) {
+// Returns whether the constraint was added. Constraints that are already set for the table are not added again.
+bool add_constraint(const std::shared_ptr<Table>& table, const std::shared_ptr<AbstractTableConstraint>& constraint) {
   if (const auto& order_constraint = std::dynamic_pointer_cast<TableOrderConstraint>(constraint)) {
+    if (table->soft_order_constraints().contains(*order_constraint)) {
+      return false;
+    }
     table->add_soft_order_constraint(*order_constraint);
-    return;
+    return true;
   }
   if (const auto& key_constraint = std::dynamic_pointer_cast<TableKeyConstraint>(constraint)) {
+    if (table->soft_key_constraints().contains(*key_constraint)) {
+      return false;
+    }
     table->add_soft_key_constraint(*key_constraint);
-    return;
+    return true;
   }
   if (const auto& foreign_key_constraint = std::dynamic_pointer_cast<ForeignKeyConstraint>(constraint)) {
+    if (table->soft_foreign_key_constraints().contains(*foreign_key_constraint)) {
+      return false;
+    }
     table->add_soft_foreign_key_constraint(*foreign_key_constraint);
+    return true;
+  }
+
+  Fail("Invalid table constraint.");
+}
+
+void remove_constraint(const std::shared_ptr<Table>& table,
+                       const std::shared_ptr<AbstractTableConstraint>& constraint) {
+  if (const auto& order_constraint = std::dynamic_pointer_cast<TableOrderConstraint>(constraint)) {
+    table->remove_soft_order_constraint(*order_constraint);
+    return;
+  }
+  if (const auto& key_constraint = std::dynamic_pointer_cast<TableKeyConstraint>(constraint)) {
+    table->remove_soft_key_constraint(*key_constraint);
+    return;
+  }
+  if (const auto& foreign_key_constraint = std::dynamic_pointer_cast<ForeignKeyConstraint>(constraint)) {
+    table->remove_soft_foreign_key_constraint(*foreign_key_constraint);
     return;
   }
 
   Fail("Invalid table constraint.");
 }
 
+TableValidationSnapshots take_snapshots(const std::vector<std::string>& table_names) {
+  auto snapshots = TableValidationSnapshots{};
+  for (const auto& table_name : table_names) {
+    snapshots.emplace(table_name, TableValidationSnapshot{Hyrise::get().storage_manager.get_table(table_name)});
+  }
+  return snapshots;
+}
+
+TableValidationSnapshots take_snapshots(const AbstractDependencyCandidate& candidate) {
+  return take_snapshots(candidate_table_names(candidate));
+}
+
+std::string stored_table_name(const std::shared_ptr<const Table>& table) {
+  for (const auto& [table_name, stored_table] : Hyrise::get().storage_manager.tables()) {
+    if (stored_table == table) {
+      return table_name;
+    }
+  }
+  Fail("Table is not registered in the StorageManager.");
+}
+
+// Removes all cached plans that read from any of the given tables. Returns the number of evicted plans.
+size_t evict_cached_plans(const std::unordered_set<std::string>& table_names) {
+  auto evicted_plan_count = size_t{0};
+  auto evicted_queries = std::unordered_set<std::string>{};
+
+  if (const auto& lqp_cache = Hyrise::get().default_lqp_cache) {
+    for (const auto& [query, entry] : lqp_cache->snapshot()) {
+      auto uses_table = false;
+      for (const auto& root_node : lqp_find_subplan_roots(entry.value)) {
+        visit_lqp(root_node, [&](const auto& node) {
+          if (uses_table) {
+            return LQPVisitation::DoNotVisitInputs;
+          }
+
+          if (node->type == LQPNodeType::StoredTable) {
+            uses_table = table_names.contains(static_cast<const StoredTableNode&>(*node).table_name);
+          }
+          return LQPVisitation::VisitInputs;
+        });
+      }
+
+      if (uses_table) {
+        lqp_cache->erase(query);
+        evicted_queries.emplace(query);
+        ++evicted_plan_count;
+      }
+    }
+  }
+
+  // Subqueries of PQPs are not reachable via visit_pqp(). Thus, we also evict the PQPs of all queries whose LQP was
+  // evicted.
+  if (const auto& pqp_cache = Hyrise::get().default_pqp_cache) {
+    for (const auto& [query, entry] : pqp_cache->snapshot()) {
+      auto uses_table = evicted_queries.contains(query);
+      visit_pqp(entry.value, [&](const auto& op) {
+        if (uses_table) {
+          return PQPVisitation::DoNotVisitInputs;
+        }
+
+        if (op->type() == OperatorType::GetTable) {
+          uses_table = table_names.contains(static_cast<const GetTable&>(*op).table_name());
+        }
+        return PQPVisitation::VisitInputs;
+      });
+
+      if (uses_table) {
+        pqp_cache->erase(query);
+        ++evicted_plan_count;
+      }
+    }
+  }
+
+  return evicted_plan_count;
+}
+
+// Adds the candidates of `source` to `target`. Equal candidates keep the instance already in `target`. As in
+// JoinToPredicateCandidateRule, the dependents of IND candidates are united and mapped to the instances in `target`, so
+// an IND is only superfluous if the ODs of all queries that yielded it are invalid.
+void merge_candidates(DependencyCandidates& target, const DependencyCandidates& source) {
+  // Add all candidates first, so the dependents can be mapped to their instances in `target`.
+  target.insert(source.cbegin(), source.cend());
+
+  for (const auto& candidate : source) {
+    if (candidate->type != DependencyType::Inclusion) {
+      continue;
+    }
+
+    const auto& ind_candidate = static_cast<const IndCandidate&>(*candidate);
+    const auto& existing_candidate = static_cast<const IndCandidate&>(**target.find(candidate));
+    auto dependents = std::make_shared<DependencyCandidates>();
+    if (&existing_candidate != &ind_candidate) {
+      dependents->insert(existing_candidate.dependents->cbegin(), existing_candidate.dependents->cend());
+    }
+
+    for (const auto& dependent : *ind_candidate.dependents) {
+      const auto dependent_it = target.find(dependent);
+      Assert(dependent_it != target.end(), "Could not map dependent of IND candidate.");
+      dependents->emplace(*dependent_it);
+    }
+    existing_candidate.dependents = dependents;
+  }
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -115,35 +255,115 @@ DependencyDiscoveryPlugin::DependencyDiscoveryPlugin() {
     _validation_repetitions = static_cast<uint32_t>(requested_repetitions);
   }
   std::cout << "- Execute " << _validation_repetitions << " validation run(s)" << std::endl;
+
+  auto falsification_sample_size = AbstractDependencyValidationRule::DEFAULT_FALSIFICATION_SAMPLE_SIZE;
+  const auto sample_size = std::getenv("FALSIFICATION_SAMPLE_SIZE");
+  if (sample_size) {
+    const auto requested_sample_size = std::atol(sample_size);
+    Assert(requested_sample_size >= 0, "Sample size must not be negative!");
+    falsification_sample_size = static_cast<uint64_t>(requested_sample_size);
+  }
+
+  for (const auto& [_, rule] : _validation_rules) {
+    rule->set_falsification_sample_size(falsification_sample_size);
+  }
+
+  if (falsification_sample_size > 0) {
+    std::cout << "- Sample " << falsification_sample_size << " rows to falsify candidates" << std::endl;
+  } else {
+    std::cout << "- Disable sampling-based falsification" << std::endl;
+  }
+
+  const auto catalog_filename = std::getenv("DEPENDENCY_CATALOG");
+  if (catalog_filename) {
+    _catalog_filename = std::string{catalog_filename};
+    std::cout << "- Persist discovered dependencies in " << *_catalog_filename << std::endl;
+  }
+
+  const auto background_discovery = std::getenv("BACKGROUND_DISCOVERY");
+  if (background_discovery && !std::strcmp(background_discovery, "1")) {
+    Assert(_validation_repetitions == 1 && !_ablation, "Background discovery does not support measurement runs.");
+    _background_discovery = true;
+
+    const auto cpu_budget = std::getenv("DISCOVERY_CPU_BUDGET");
+    if (cpu_budget) {
+      _cpu_budget = std::atof(cpu_budget);
+      Assert(_cpu_budget > 0.0 && _cpu_budget <= 1.0, "CPU budget must be in (0, 1]!");
+    }
+    std::cout << "- Discover dependencies in the background with a CPU budget of " << _cpu_budget << std::endl;
+  }
 }
 
 std::string DependencyDiscoveryPlugin::description() const {
   return "Data Dependency Discovery Plugin";
 }
 
-void DependencyDiscoveryPlugin::start() {}
+void DependencyDiscoveryPlugin::start() {
+  _meta_table = std::make_shared<MetaDependencyDiscoveryTable>([&]() { return _discovery_runs(); });
+  Hyrise::get().meta_table_manager.add_table(_meta_table);
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_discovery_mutex};
+    _restore_dependency_catalog();
+  }
+
+  if (_background_discovery) {
+    _loop_thread_discovery = std::make_unique<PausableLoopThread>(
+        IDLE_DELAY_BACKGROUND_DISCOVERY, [&](size_t /*unused*/) { _background_discovery_loop(); });
+  }
+}
+
+void DependencyDiscoveryPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread.
+  _loop_thread_discovery.reset();
 
-void DependencyDiscoveryPlugin::stop() {}
+  if (_meta_table) {
+    Hyrise::get().meta_table_manager.remove_table(_meta_table->name());
+    _meta_table = nullptr;
+  }
+}
 
 std::vector<std::pair<PluginFunctionName, PluginFunctionPointer>>
 DependencyDiscoveryPlugin::provided_user_executable_functions() {
-  return {{"DiscoverDependencies", [&]() { _discover_dependencies(); }}};
+  return {{"DiscoverDependencies",
+           [&]() {
+             const auto lock = std::lock_guard<std::mutex>{_discovery_mutex};
+             _discover_dependencies();
+           }},
+          {"RevalidateDependencies", [&]() {
+             const auto lock = std::lock_guard<std::mutex>{_discovery_mutex};
+             _revalidate_constraints();
+           }}};
 }
 
 std::optional<PreBenchmarkHook> DependencyDiscoveryPlugin::pre_benchmark_hook() {
   return [&](auto& benchmark_item_runner) {
     const auto old_scheduler = Hyrise::get().scheduler();
     Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+    // Restore the dependencies of a previous run before the queries are optimized, unless the plugin already did so
+    // when it was started.
+    {
+      const auto lock = std::lock_guard<std::mutex>{_discovery_mutex};
+      _restore_dependency_catalog();
+    }
+
     for (const auto item_id : benchmark_item_runner.items()) {
       benchmark_item_runner.execute_item(item_id);
     }
-    Hyrise::get().set_scheduler(old_scheduler);
 
+    // Keep the NodeQueueScheduler active so dependency candidates are validated concurrently.
+    auto lock = std::unique_lock<std::mutex>{_discovery_mutex};
     if (!_ablation) {
       _discover_dependencies();
+      if (_catalog_filename) {
+        _store_dependency_catalog(*_catalog_filename);
+      }
     } else {
       _perform_ablation();
     }
+    lock.unlock();
+    Hyrise::get().set_scheduler(old_scheduler);
 
     for (const auto& log_entry : Hyrise::get().log_manager.log_entries()) {
       std::cout << log_entry.message << std::endl;
@@ -151,19 +371,25 @@ std::optional<PreBenchmarkHook> DependencyDiscoveryPlugin::pre_benchmark_hook()
   };
 }
 
-void DependencyDiscoveryPlugin::_discover_dependencies() const {
+void DependencyDiscoveryPlugin::_discover_dependencies() {
+  // Constraints that do not hold anymore must not prevent the rediscovery of other dependencies.
+  _revalidate_constraints();
+
   auto discovery_timer = Timer{};
 
-  _validate_dependency_candidates(_identify_dependency_candidates());
+  const auto dependency_candidates = _identify_dependency_candidates();
+  _validate_dependency_candidates(dependency_candidates);
 
   auto message = std::stringstream{};
   const auto discomery_time = discovery_timer.lap();
   message << "Executed dependency discovery in " << format_duration(discomery_time) << " (" << discomery_time << ")";
   Hyrise::get().log_manager.add_message("DependencyDiscoveryPlugin", message.str(), LogLevel::Info);
-  Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
-  Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
-  Hyrise::get().log_manager.add_message(
-      "DependencyDiscoveryPlugin", "Cleared LQP and PQP caches in " + discovery_timer.lap_formatted(), LogLevel::Info);
+
+  const auto evicted_plan_count = _evict_benefiting_plans(dependency_candidates);
+  Hyrise::get().log_manager.add_message("DependencyDiscoveryPlugin",
+                                        "Evicted " + std::to_string(evicted_plan_count) + " cached plans in " +
+                                            discovery_timer.lap_formatted(),
+                                        LogLevel::Info);
 }
 
 void DependencyDiscoveryPlugin::_perform_ablation() {
@@ -194,7 +420,7 @@ void DependencyDiscoveryPlugin::_perform_ablation() {
   }
 }
 
-DependencyCandidates DependencyDiscoveryPlugin::_identify_dependency_candidates() const {
+DependencyCandidates DependencyDiscoveryPlugin::_identify_dependency_candidates() {
   const auto lqp_cache = Hyrise::get().default_lqp_cache;
   if (!lqp_cache) {
     return {};
@@ -212,22 +438,12 @@ DependencyCandidates DependencyDiscoveryPlugin::_identify_dependency_candidates(
     // Get a snapshot of the current LQP cache to work on all currently cached queries.
     const auto snapshot = Hyrise::get().default_lqp_cache->snapshot();
 
-    for (const auto& [_, entry] : snapshot) {
-      const auto& root_node = entry.value;
-      visit_lqp(root_node, [&](const auto& node) {
-        const auto type = node->type;
-
-        const auto& rule_it = _candidate_rules.find(type);
-        if (rule_it == _candidate_rules.end()) {
-          return LQPVisitation::VisitInputs;
-        }
-
-        for (const auto& candidate_rule : rule_it->second) {
-          candidate_rule->apply_to_node(node, dependency_candidates);
-        }
-
-        return LQPVisitation::VisitInputs;
-      });
+    _query_candidates.clear();
+    for (const auto& [query, entry] : snapshot) {
+      auto query_candidates = DependencyCandidates{};
+      _add_candidates(entry.value, query_candidates);
+      merge_candidates(dependency_candidates, query_candidates);
+      _query_candidates.emplace(query, std::move(query_candidates));
     }
 
     loop_times += loop_timer.lap();
@@ -241,15 +457,24 @@ DependencyCandidates DependencyDiscoveryPlugin::_identify_dependency_candidates(
   return dependency_candidates;
 }
 
-void DependencyDiscoveryPlugin::_validate_dependency_candidates(
-    const DependencyCandidates& dependency_candidates) const {
+void DependencyDiscoveryPlugin::_validate_dependency_candidates(const DependencyCandidates& dependency_candidates,
+                                                                const SchedulePriority priority) {
+  // Jobs that split the validation of a single candidate are scheduled with the same priority.
+  for (const auto& [_, rule] : _validation_rules) {
+    rule->set_schedule_priority(priority);
+  }
+
   const auto candidate_count = dependency_candidates.size();
   auto candidate_times = std::vector<std::chrono::nanoseconds>(candidate_count);
+  auto rejected_by_sample = std::vector<bool>(candidate_count);
   auto ordered_candidates = std::vector<std::shared_ptr<AbstractDependencyCandidate>>{};
 
   auto valid_count = uint32_t{0};
   auto invalid_count = uint32_t{0};
   auto skipped_count = uint32_t{0};
+  auto sample_rejected_count = uint32_t{0};
+  auto sampling_times = std::chrono::nanoseconds{};
+  auto saved_times = std::chrono::nanoseconds{};
 
   auto loop_times = std::chrono::nanoseconds{};
   for (auto repetition = uint32_t{0}; repetition < _validation_repetitions; ++repetition) {
@@ -258,6 +483,7 @@ void DependencyDiscoveryPlugin::_validate_dependency_candidates(
       valid_count = uint32_t{0};
       invalid_count = uint32_t{0};
       skipped_count = uint32_t{0};
+      sample_rejected_count = uint32_t{0};
 
       for (const auto& candidate : dependency_candidates) {
         candidate->status = ValidationStatus::Uncertain;
@@ -276,39 +502,77 @@ void DependencyDiscoveryPlugin::_validate_dependency_candidates(
     std::sort(ordered_candidates.begin(), ordered_candidates.end(),
               [](const auto& lhs, const auto& rhs) { return lhs->type < rhs->type; });
 
-    for (auto candidate_id = size_t{0}; candidate_id < candidate_count; ++candidate_id) {
-      const auto& candidate = ordered_candidates[candidate_id];
-      DebugAssert(_validation_rules.contains(candidate->type),
-                  "Unsupported dependency: " + std::string{magic_enum::enum_name(candidate->type)});
-
-      auto candidate_timer = Timer{};
-      const auto& validation_rule = _validation_rules.at(candidate->type);
-      const auto& result = validation_rule->validate(*candidate);
-
-      switch (result.status) {
-        case ValidationStatus::Invalid:
-          ++invalid_count;
-          break;
-        case ValidationStatus::AlreadyKnown:
-          ++valid_count;
-          break;
-        case ValidationStatus::Valid:
-          Assert(!result.constraints.empty(),
-                 "Expected validation to yield constraint(s) for " + candidate->description());
-          ++valid_count;
-          break;
-        case ValidationStatus::Superfluous:
-          ++skipped_count;
-          break;
-        case ValidationStatus::Uncertain:
-          Fail("Expected explicit validation result for " + candidate->description());
+    // Candidates are validated in phases of the same dependency type, in the order of DependencyType (ODs, INDs, UCCs,
+    // FDs). Later phases depend on the results of earlier ones: INDs are superfluous if all their dependent ODs are
+    // invalid, and UCCs/FDs are already known if a previous candidate yielded a matching key constraint. Within a
+    // phase, the candidates are validated concurrently. The resulting constraints are registered after all jobs of the
+    // phase finished and in the same order as in a sequential run. Thus, no validation job reads constraints while
+    // they are modified, and the discovered dependencies do not depend on the number of workers.
+    auto phase_begin = size_t{0};
+    while (phase_begin < candidate_count) {
+      const auto phase_type = ordered_candidates[phase_begin]->type;
+      DebugAssert(_validation_rules.contains(phase_type),
+                  "Unsupported dependency: " + std::string{magic_enum::enum_name(phase_type)});
+      const auto& validation_rule = _validation_rules.at(phase_type);
+
+      auto phase_end = phase_begin + 1;
+      while (phase_end < candidate_count && ordered_candidates[phase_end]->type == phase_type) {
+        ++phase_end;
+      }
+
+      const auto phase_size = phase_end - phase_begin;
+      auto results = std::vector<ValidationResult>(phase_size, ValidationResult{ValidationStatus::Uncertain});
+      auto snapshots = std::vector<TableValidationSnapshots>(phase_size);
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      jobs.reserve(phase_size);
+      for (auto candidate_id = phase_begin; candidate_id < phase_end; ++candidate_id) {
+        jobs.emplace_back(std::make_shared<JobTask>([&, candidate_id]() {
+          // Snapshot the tables before the validation so that concurrent modifications are revalidated later.
+          snapshots[candidate_id - phase_begin] = take_snapshots(*ordered_candidates[candidate_id]);
+          auto candidate_timer = Timer{};
+          results[candidate_id - phase_begin] = validation_rule->validate(*ordered_candidates[candidate_id]);
+          candidate_times[candidate_id] += candidate_timer.lap();
+        }, priority));
       }
-      candidate_times[candidate_id] += candidate_timer.lap();
-      candidate->status = result.status;
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+      for (auto candidate_id = phase_begin; candidate_id < phase_end; ++candidate_id) {
+        const auto& candidate = ordered_candidates[candidate_id];
+        auto& result = results[candidate_id - phase_begin];
+
+        Assert(result.status != ValidationStatus::Valid || !result.constraints.empty(),
+               "Expected validation to yield constraint(s) for " + candidate->description());
+        const auto added_constraint = _register_constraints(result, snapshots[candidate_id - phase_begin]);
+
+        // Another candidate of this phase yielded the same constraint(s) before (e.g., two FD candidates that share a
+        // unique column). In a sequential run, the candidate would have been skipped as already known.
+        if (result.status == ValidationStatus::Valid && !added_constraint) {
+          result.status = ValidationStatus::AlreadyKnown;
+        }
 
-      for (const auto& [table, constraint] : result.constraints) {
-        add_constraint(table, constraint);
+        switch (result.status) {
+          case ValidationStatus::Invalid:
+            ++invalid_count;
+            break;
+          case ValidationStatus::AlreadyKnown:
+          case ValidationStatus::Valid:
+            ++valid_count;
+            break;
+          case ValidationStatus::Superfluous:
+            ++skipped_count;
+            break;
+          case ValidationStatus::Uncertain:
+            Fail("Expected explicit validation result for " + candidate->description());
+        }
+        candidate->status = result.status;
+
+        rejected_by_sample[candidate_id] = result.sampling.rejected;
+        sample_rejected_count += result.sampling.rejected ? 1 : 0;
+        sampling_times += result.sampling.sampling_time;
+        saved_times += result.sampling.estimated_saved_time;
       }
+
+      phase_begin = phase_end;
     }
     loop_times += loop_timer.lap();
   }
@@ -324,7 +588,8 @@ void DependencyDiscoveryPlugin::_validate_dependency_candidates(
 
     switch (candidate->status) {
       case ValidationStatus::Invalid:
-        message << " [rejected in " << format_duration(mean_candidate_time) << " (" << mean_candidate_time << ")]";
+        message << " [rejected" << (rejected_by_sample[candidate_id] ? " by sample" : "") << " in "
+                << format_duration(mean_candidate_time) << " (" << mean_candidate_time << ")]";
         break;
       case ValidationStatus::AlreadyKnown:
         message << " [skipped (already known) in " << format_duration(mean_candidate_time) << " ("
@@ -351,6 +616,172 @@ void DependencyDiscoveryPlugin::_validate_dependency_candidates(
           << invalid_count << " invalid, " << skipped_count << " superfluous) in " << format_duration(validation_time)
           << " (" << validation_time << ")";
   Hyrise::get().log_manager.add_message("DependencyDiscoveryPlugin", message.str(), LogLevel::Info);
+
+  if (sampling_times.count() > 0) {
+    auto sampling_message = std::stringstream{};
+    const auto sampling_time = sampling_times / _validation_repetitions;
+    const auto saved_time = saved_times / _validation_repetitions;
+    sampling_message << "Sampling rejected " << sample_rejected_count << " of " << invalid_count
+                     << " invalid candidates in " << format_duration(sampling_time) << " (" << sampling_time
+                     << "), saving an estimated " << format_duration(saved_time) << " (" << saved_time << ")";
+    Hyrise::get().log_manager.add_message("DependencyDiscoveryPlugin", sampling_message.str(), LogLevel::Info);
+  }
+}
+
+void DependencyDiscoveryPlugin::_background_discovery_loop() {
+  if (std::chrono::steady_clock::now() < _next_discovery_time) {
+    return;
+  }
+
+  const auto lqp_cache = Hyrise::get().default_lqp_cache;
+  if (!lqp_cache) {
+    return;
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_discovery_mutex};
+  auto timer = Timer{};
+  auto run = DependencyDiscoveryRun{};
+  run.timestamp = std::chrono::system_clock::now();
+
+  // The tables might not have been loaded when the plugin was started.
+  _restore_dependency_catalog();
+
+  // Constraints that do not hold anymore must not prevent the rediscovery of other dependencies.
+  _revalidate_constraints(SchedulePriority::Low);
+
+  // Only plans that were added since the previous run can contain new candidates. We keep the annotations of the
+  // currently cached queries only to bound the memory consumption. Plans that were evicted and cached again are
+  // visited again, but their candidates are known already.
+  auto query_candidates = std::unordered_map<std::string, DependencyCandidates>{};
+  auto new_candidates = DependencyCandidates{};
+  for (const auto& [query, entry] : lqp_cache->snapshot()) {
+    const auto annotation_it = _query_candidates.find(query);
+    if (annotation_it != _query_candidates.end()) {
+      query_candidates.emplace(query, std::move(annotation_it->second));
+      continue;
+    }
+
+    ++run.new_query_count;
+    auto& candidates = query_candidates[query];
+    _add_candidates(entry.value, candidates);
+    merge_candidates(new_candidates, candidates);
+  }
+  _query_candidates = std::move(query_candidates);
+
+  auto dependency_candidates = DependencyCandidates{};
+  for (const auto& candidate : new_candidates) {
+    if (!_known_candidates.contains(candidate)) {
+      dependency_candidates.emplace(candidate);
+    }
+  }
+
+  // The dependents of new IND candidates are mapped to the known instances of their ODs, which are validated already.
+  merge_candidates(_known_candidates, new_candidates);
+
+  // An IND that was skipped as superfluous must be validated if a new query yields a dependent OD that is not invalid.
+  for (const auto& candidate : new_candidates) {
+    const auto& known_candidate = *_known_candidates.find(candidate);
+    if (known_candidate->status != ValidationStatus::Superfluous) {
+      continue;
+    }
+
+    const auto& dependents = *static_cast<const IndCandidate&>(*known_candidate).dependents;
+    if (std::any_of(dependents.cbegin(), dependents.cend(),
+                    [](const auto& dependent) { return dependent->status != ValidationStatus::Invalid; })) {
+      known_candidate->status = ValidationStatus::Uncertain;
+      dependency_candidates.emplace(known_candidate);
+    }
+  }
+
+  if (!dependency_candidates.empty()) {
+    _validate_dependency_candidates(dependency_candidates, SchedulePriority::Low);
+    for (const auto& candidate : dependency_candidates) {
+      run.valid_count += candidate->status == ValidationStatus::Valid ? 1 : 0;
+      run.invalid_count += candidate->status == ValidationStatus::Invalid ? 1 : 0;
+    }
+    _evict_benefiting_plans(dependency_candidates);
+  }
+
+  run.candidate_count = dependency_candidates.size();
+  run.constraint_count = _validated_constraints.size();
+  run.duration = timer.lap();
+
+  // Delay the next run such that discovery takes at most the share of the time given by the CPU budget.
+  const auto delay = std::chrono::duration_cast<std::chrono::nanoseconds>(run.duration * (1.0 - _cpu_budget) /
+                                                                          _cpu_budget);
+  _next_discovery_time = std::chrono::steady_clock::now() + delay;
+
+  auto message = std::stringstream{};
+  message << "Background discovery validated " << run.candidate_count << " new candidates (" << run.valid_count
+          << " valid, " << run.invalid_count << " invalid) of " << run.new_query_count << " new queries in "
+          << format_duration(run.duration) << ", next run in " << format_duration(delay) << " at the earliest";
+  Hyrise::get().log_manager.add_message("DependencyDiscoveryPlugin", message.str(), LogLevel::Info);
+
+  const auto runs_lock = std::lock_guard<std::mutex>{_discovery_runs_mutex};
+  _runs.emplace_back(run);
+}
+
+size_t DependencyDiscoveryPlugin::_evict_benefiting_plans(const DependencyCandidates& validated_candidates) {
+  // Candidates that were already known did not change the constraints, which the cached plans already used.
+  auto new_dependencies = DependencyCandidates{};
+  for (const auto& candidate : validated_candidates) {
+    if (candidate->status == ValidationStatus::Valid) {
+      new_dependencies.emplace(candidate);
+    }
+  }
+
+  if (new_dependencies.empty()) {
+    return 0;
+  }
+
+  const auto& lqp_cache = Hyrise::get().default_lqp_cache;
+  const auto& pqp_cache = Hyrise::get().default_pqp_cache;
+  auto evicted_plan_count = size_t{0};
+  for (auto annotation_it = _query_candidates.begin(); annotation_it != _query_candidates.end();) {
+    const auto& [query, candidates] = *annotation_it;
+    const auto benefits = std::any_of(candidates.cbegin(), candidates.cend(), [&](const auto& candidate) {
+      return new_dependencies.contains(candidate);
+    });
+    if (!benefits) {
+      ++annotation_it;
+      continue;
+    }
+
+    if (lqp_cache && lqp_cache->has(query)) {
+      lqp_cache->erase(query);
+      ++evicted_plan_count;
+    }
+    if (pqp_cache && pqp_cache->has(query)) {
+      pqp_cache->erase(query);
+      ++evicted_plan_count;
+    }
+    annotation_it = _query_candidates.erase(annotation_it);
+  }
+
+  return evicted_plan_count;
+}
+
+std::vector<DependencyDiscoveryRun> DependencyDiscoveryPlugin::_discovery_runs() const {
+  const auto lock = std::lock_guard<std::mutex>{_discovery_runs_mutex};
+  return _runs;
+}
+
+void DependencyDiscoveryPlugin::_add_candidates(const std::shared_ptr<AbstractLQPNode>& root_node,
+                                                DependencyCandidates& dependency_candidates) const {
+  visit_lqp(root_node, [&](const auto& node) {
+    const auto type = node->type;
+
+    const auto& rule_it = _candidate_rules.find(type);
+    if (rule_it == _candidate_rules.end()) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    for (const auto& candidate_rule : rule_it->second) {
+      candidate_rule->apply_to_node(node, dependency_candidates);
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
 }
 
 void DependencyDiscoveryPlugin::_add_candidate_rule(std::unique_ptr<AbstractDependencyCandidateRule> rule) {
@@ -361,7 +792,243 @@ void DependencyDiscoveryPlugin::_add_validation_rule(std::unique_ptr<AbstractDep
   _validation_rules[rule->dependency_type] = std::move(rule);
 }
 
+void DependencyDiscoveryPlugin::_revalidate_constraints(const SchedulePriority priority) {
+  if (_validated_constraints.empty()) {
+    return;
+  }
+
+  auto revalidation_timer = Timer{};
+  for (const auto& [_, rule] : _validation_rules) {
+    rule->set_schedule_priority(priority);
+  }
+
+  // Constraints of dropped or replaced tables are gone with the old table.
+  auto validated_constraints = std::vector<std::shared_ptr<AbstractValidatedConstraint>>{};
+  validated_constraints.reserve(_validated_constraints.size());
+  std::copy_if(_validated_constraints.cbegin(), _validated_constraints.cend(),
+               std::back_inserter(validated_constraints),
+               [](const auto& validated_constraint) { return validated_constraint->tables_exist(); });
+  _validated_constraints.clear();
+
+  const auto constraint_count = validated_constraints.size();
+  auto statuses = std::vector<ValidationStatus>(constraint_count, ValidationStatus::Uncertain);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(constraint_count);
+  for (auto constraint_id = size_t{0}; constraint_id < constraint_count; ++constraint_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, constraint_id]() {
+      statuses[constraint_id] = validated_constraints[constraint_id]->revalidate();
+    }, priority));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  auto valid_count = uint32_t{0};
+  auto invalid_count = uint32_t{0};
+  auto full_validation_count = uint32_t{0};
+  auto modified_table_names = std::unordered_set<std::string>{};
+  for (auto constraint_id = size_t{0}; constraint_id < constraint_count; ++constraint_id) {
+    const auto& validated_constraint = validated_constraints[constraint_id];
+    auto status = statuses[constraint_id];
+
+    if (status == ValidationStatus::Valid) {
+      ++valid_count;
+      _validated_constraints.emplace_back(validated_constraint);
+      continue;
+    }
+
+    // The constraint must not be visible to the validation rule, which would skip the candidate as already known.
+    remove_constraint(validated_constraint->table, validated_constraint->constraint);
+    if (status == ValidationStatus::Uncertain) {
+      ++full_validation_count;
+      const auto candidate = validated_constraint->candidate();
+      auto snapshots = take_snapshots(*candidate);
+      const auto result = _validation_rules.at(candidate->type)->validate(*candidate);
+      status = result.status;
+      if (status == ValidationStatus::Valid) {
+        _register_constraints(result, snapshots);
+      }
+    }
+
+    if (status == ValidationStatus::Valid || status == ValidationStatus::AlreadyKnown) {
+      ++valid_count;
+      continue;
+    }
+
+    ++invalid_count;
+    const auto& table_names = validated_constraint->table_names();
+    modified_table_names.insert(table_names.cbegin(), table_names.cend());
+  }
+
+  const auto evicted_plan_count = evict_cached_plans(modified_table_names);
+
+  auto message = std::stringstream{};
+  const auto revalidation_time = revalidation_timer.lap();
+  message << "Revalidated " << constraint_count << " constraints (" << valid_count << " valid, " << invalid_count
+          << " invalid, " << full_validation_count << " validated from scratch) and evicted " << evicted_plan_count
+          << " cached plans in " << format_duration(revalidation_time) << " (" << revalidation_time << ")";
+  Hyrise::get().log_manager.add_message("DependencyDiscoveryPlugin", message.str(), LogLevel::Info);
+}
+
+bool DependencyDiscoveryPlugin::_register_constraints(const ValidationResult& result,
+                                                      const TableValidationSnapshots& snapshots) {
+  auto added_constraint = false;
+  for (const auto& [table, constraint] : result.constraints) {
+    if (!add_constraint(table, constraint)) {
+      continue;
+    }
+
+    added_constraint = true;
+    const auto snapshot_it = std::find_if(snapshots.cbegin(), snapshots.cend(), [&](const auto& name_and_snapshot) {
+      return name_and_snapshot.second.table == table;
+    });
+    Assert(snapshot_it != snapshots.cend(), "Expected snapshot of table with new constraint.");
+    _validated_constraints.emplace_back(make_validated_constraint(snapshot_it->first, table, constraint, snapshots));
+  }
+
+  return added_constraint;
+}
+
+void DependencyDiscoveryPlugin::_store_dependency_catalog(const std::string& filename) const {
+  auto timer = Timer{};
+  auto catalog = ConstraintCatalog{};
+  auto entry_ids = std::unordered_map<std::string, size_t>{};
+  const auto get_entry = [&](const std::string& table_name,
+                             const std::shared_ptr<const Table>& table) -> TableConstraintCatalogEntry& {
+    const auto [entry_it, inserted] = entry_ids.emplace(table_name, catalog.size());
+    if (inserted) {
+      auto entry = TableConstraintCatalogEntry{};
+      entry.table_name = table_name;
+      entry.fingerprint = TableFingerprint::compute(*table);
+      catalog.emplace_back(std::move(entry));
+    }
+    return catalog[entry_it->second];
+  };
+
+  auto constraint_count = size_t{0};
+  for (const auto& validated_constraint : _validated_constraints) {
+    if (!validated_constraint->tables_exist()) {
+      continue;
+    }
+
+    ++constraint_count;
+    const auto& constraint = validated_constraint->constraint;
+    if (const auto& key_constraint = std::dynamic_pointer_cast<TableKeyConstraint>(constraint)) {
+      get_entry(validated_constraint->table_name, validated_constraint->table)
+          .key_constraints.emplace_back(*key_constraint);
+    } else if (const auto& order_constraint = std::dynamic_pointer_cast<TableOrderConstraint>(constraint)) {
+      get_entry(validated_constraint->table_name, validated_constraint->table)
+          .order_constraints.emplace_back(*order_constraint);
+    } else if (const auto& foreign_key_constraint = std::dynamic_pointer_cast<ForeignKeyConstraint>(constraint)) {
+      // The referenced table needs an entry as well: the constraint is only restored if both tables are unchanged.
+      const auto& primary_key_table = foreign_key_constraint->primary_key_table();
+      const auto primary_key_table_name = stored_table_name(primary_key_table);
+      get_entry(primary_key_table_name, primary_key_table);
+
+      auto catalog_entry = ForeignKeyCatalogEntry{};
+      catalog_entry.foreign_key_columns = foreign_key_constraint->foreign_key_columns();
+      catalog_entry.primary_key_table_name = primary_key_table_name;
+      catalog_entry.primary_key_columns = foreign_key_constraint->primary_key_columns();
+      get_entry(validated_constraint->table_name, validated_constraint->table)
+          .foreign_key_constraints.emplace_back(std::move(catalog_entry));
+    } else {
+      Fail("Invalid table constraint.");
+    }
+  }
+
+  BinaryWriter::write_constraint_catalog(catalog, filename);
+
+  auto message = std::stringstream{};
+  message << "Stored " << constraint_count << " constraints of " << catalog.size() << " tables in " << filename
+          << " in " << timer.lap_formatted();
+  Hyrise::get().log_manager.add_message("DependencyDiscoveryPlugin", message.str(), LogLevel::Info);
+}
+
+size_t DependencyDiscoveryPlugin::_load_dependency_catalog(const std::string& filename) {
+  auto timer = Timer{};
+  const auto catalog = BinaryParser::parse_constraint_catalog(filename);
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  // Only tables whose data did not change since the catalog was written can be restored.
+  auto unchanged_table_names = std::unordered_set<std::string>{};
+  for (const auto& entry : catalog) {
+    if (storage_manager.has_table(entry.table_name) &&
+        TableFingerprint::compute(*storage_manager.get_table(entry.table_name)) == entry.fingerprint) {
+      unchanged_table_names.emplace(entry.table_name);
+    }
+  }
+
+  auto restored_count = size_t{0};
+  auto skipped_count = size_t{0};
+  const auto restore_constraint = [&](const std::string& table_name, const std::shared_ptr<Table>& table,
+                                      const std::shared_ptr<AbstractTableConstraint>& constraint,
+                                      const std::vector<std::string>& table_names) {
+    if (!add_constraint(table, constraint)) {
+      return;
+    }
+
+    // The constraint held when the snapshot would have been taken, so later modifications are revalidated. The
+    // snapshot only records the chunk sizes and deleted rows. Values are only accessed once rows are inserted.
+    _validated_constraints.emplace_back(
+        make_validated_constraint(table_name, table, constraint, take_snapshots(table_names)));
+    ++restored_count;
+  };
+
+  for (const auto& entry : catalog) {
+    const auto constraint_count =
+        entry.key_constraints.size() + entry.order_constraints.size() + entry.foreign_key_constraints.size();
+    if (!unchanged_table_names.contains(entry.table_name)) {
+      skipped_count += constraint_count;
+      continue;
+    }
+
+    const auto& table = storage_manager.get_table(entry.table_name);
+    for (const auto& key_constraint : entry.key_constraints) {
+      restore_constraint(entry.table_name, table, std::make_shared<TableKeyConstraint>(key_constraint),
+                         {entry.table_name});
+    }
+
+    for (const auto& order_constraint : entry.order_constraints) {
+      restore_constraint(entry.table_name, table, std::make_shared<TableOrderConstraint>(order_constraint),
+                         {entry.table_name});
+    }
+
+    for (const auto& foreign_key_constraint : entry.foreign_key_constraints) {
+      const auto& primary_key_table_name = foreign_key_constraint.primary_key_table_name;
+      if (!unchanged_table_names.contains(primary_key_table_name)) {
+        ++skipped_count;
+        continue;
+      }
+
+      const auto constraint = std::make_shared<ForeignKeyConstraint>(
+          foreign_key_constraint.foreign_key_columns, table, foreign_key_constraint.primary_key_columns,
+          storage_manager.get_table(primary_key_table_name));
+      restore_constraint(entry.table_name, table, constraint, {entry.table_name, primary_key_table_name});
+    }
+  }
+
+  auto message = std::stringstream{};
+  message << "Restored " << restored_count << " constraints from " << filename << " (" << skipped_count
+          << " skipped due to modified tables) in " << timer.lap_formatted();
+  Hyrise::get().log_manager.add_message("DependencyDiscoveryPlugin", message.str(), LogLevel::Info);
+  return restored_count;
+}
+
+void DependencyDiscoveryPlugin::_restore_dependency_catalog() {
+  // The ablation measures the validation of all candidates and thus ignores the catalog.
+  if (_catalog_restored || !_catalog_filename || _ablation || !std::filesystem::exists(*_catalog_filename)) {
+    return;
+  }
+
+  // Without tables, there is nothing to restore yet (e.g., the hyriseServer loads the tables after the plugins).
+  if (Hyrise::get().storage_manager.tables().empty()) {
+    return;
+  }
+
+  _load_dependency_catalog(*_catalog_filename);
+  _catalog_restored = true;
+}
+
 void DependencyDiscoveryPlugin::_clear_constraints() {
+  _validated_constraints.clear();
   for (const auto& [_, table] : Hyrise::get().storage_manager.tables()) {
     table->_table_key_constraints.clear();
     table->_table_order_constraints.clear();
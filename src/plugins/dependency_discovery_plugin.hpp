@@ -1,16 +1,28 @@
 #pragma once
 
+#include <chrono>
+#include <mutex>
+
 #include "dependency_discovery/candidate_strategy/abstract_dependency_candidate_rule.hpp"
 #include "dependency_discovery/dependency_candidates.hpp"
+#include "dependency_discovery/meta_dependency_discovery_table.hpp"
+#include "dependency_discovery/validated_constraint.hpp"
 #include "dependency_discovery/validation_strategy/abstract_dependency_validation_rule.hpp"
 #include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
 
 namespace hyrise {
 
 /**
- *  This plugin implements unary Unique Column Combination (UCC) discovery based on previously executed LQPs. Not all
- *  columns encountered in these LQPs are automatically considered for the UCC validation process. Instead, a column is
- *  only validated/invalidated as UCCs if being a UCC could have helped to optimize their LQP.
+ *  This plugin implements Unique Column Combination (UCC) discovery based on previously executed LQPs. Not all
+ *  columns encountered in these LQPs are automatically considered for the UCC validation process. Instead, a column (or
+ *  a combination of columns) is only validated/invalidated as UCC if being a UCC could have helped to optimize their
+ *  LQP. Candidates of multiple columns are validated by walking their column lattice, which yields the minimal UCCs.
+ *
+ *  Discovery runs either before a benchmark (pre_benchmark_hook), on request (user function DiscoverDependencies), or
+ *  continuously in the background (environment variable BACKGROUND_DISCOVERY=1, e.g., for the hyriseServer). In the
+ *  background mode, the plugin periodically checks the LQP cache for new queries and validates their candidates with
+ *  low scheduler priority. The meta table dependency_discovery reports the background runs.
  */
 class DependencyDiscoveryPlugin : public AbstractPlugin {
  public:
@@ -26,10 +38,20 @@ class DependencyDiscoveryPlugin : public AbstractPlugin {
 
   std::optional<PreBenchmarkHook> pre_benchmark_hook() final;
 
+  /**
+   * IDLE_DELAY_BACKGROUND_DISCOVERY: sleep between checks whether a background discovery run is due.
+   * DEFAULT_CPU_BUDGET: fraction of the time that background discovery may spend on validation. After a run that took
+   * t, the next run starts after t * (1 - budget) / budget at the earliest. Can be set via DISCOVERY_CPU_BUDGET. t is
+   * the wall time of the run, not the CPU time of its jobs. A run whose jobs occupy all workers thus uses more than
+   * the budget of the total CPU time, and a run whose low-priority jobs wait behind queries uses less.
+   */
+  constexpr static std::chrono::milliseconds IDLE_DELAY_BACKGROUND_DISCOVERY = std::chrono::milliseconds(1000);
+  constexpr static double DEFAULT_CPU_BUDGET = 0.1;
+
  protected:
   friend class DependencyDiscoveryPluginTest;
 
-  void _discover_dependencies() const;
+  void _discover_dependencies();
 
   void _perform_ablation();
 
@@ -38,29 +60,110 @@ class DependencyDiscoveryPlugin : public AbstractPlugin {
    * didates for UCC validation from each of them. A column is added as candidates if being a UCC has the potential to
    * help optimize their respective LQP.
    * 
-   * Returns an unordered set of these candidates to be used in the UCC validation function.
+   * Returns an unordered set of these candidates to be used in the UCC validation function. The candidates of each
+   * query are remembered so that only plans that can benefit from new dependencies are evicted afterwards.
+   */
+  DependencyCandidates _identify_dependency_candidates();
+
+  /**
+   * Evicts the cached plans of all queries that yielded a candidate that was confirmed as a new dependency. These
+   * plans might be optimized better now. All other plans are kept. Returns the number of evicted plans.
+   */
+  size_t _evict_benefiting_plans(const DependencyCandidates& validated_candidates);
+
+  /**
+   * Extracts candidates from the LQPs of all queries that were added to the LQP cache since the previous run and
+   * validates those that were not validated before. All validation jobs, including the jobs that split the validation
+   * of a single candidate, are scheduled with low priority. The next run is delayed such that the runs stay within the
+   * CPU budget.
    */
-  DependencyCandidates _identify_dependency_candidates() const;
+  void _background_discovery_loop();
 
   /**
    * Iterates over the provided set of columns identified as candidates for a uniqueness validation. Validates those
-   * that are not already known to be unique.
+   * that are not already known to be unique. Candidates of the same dependency type are validated concurrently as
+   * JobTasks, the resulting constraints are added in a deterministic order afterwards.
+   */
+  void _validate_dependency_candidates(const DependencyCandidates& dependency_candidates,
+                                       const SchedulePriority priority = SchedulePriority::Default);
+
+  /**
+   * Checks whether the constraints discovered so far still hold after the tables were modified. Only the rows that
+   * were inserted or deleted since the last validation are checked. If a modification cannot be checked incrementally,
+   * the constraint is validated from scratch. Invalidated constraints are removed from their tables, and cached plans
+   * that use these tables are evicted from the LQP and PQP caches.
+   */
+  void _revalidate_constraints(const SchedulePriority priority = SchedulePriority::Default);
+
+  /**
+   * Writes the constraints discovered so far, together with fingerprints of their tables, to a constraint catalog (see
+   * import_export/binary/constraint_catalog.hpp).
    */
-  void _validate_dependency_candidates(const DependencyCandidates& dependency_candidates) const;
+  void _store_dependency_catalog(const std::string& filename) const;
+
+  /**
+   * Restores the constraints of a constraint catalog for all tables whose fingerprint still matches. Restored
+   * constraints are not validated again, and candidates that yield them are skipped as already known. Returns the
+   * number of restored constraints.
+   */
+  size_t _load_dependency_catalog(const std::string& filename);
+
+  /**
+   * Loads the constraint catalog set via DEPENDENCY_CATALOG once, as soon as tables exist. Called when the plugin is
+   * started, before a benchmark, and by the background discovery.
+   */
+  void _restore_dependency_catalog();
 
  private:
   void _add_candidate_rule(std::unique_ptr<AbstractDependencyCandidateRule> rule);
 
   void _add_validation_rule(std::unique_ptr<AbstractDependencyValidationRule> rule);
 
-  static void _clear_constraints();
+  void _add_candidates(const std::shared_ptr<AbstractLQPNode>& root_node,
+                       DependencyCandidates& dependency_candidates) const;
+
+  std::vector<DependencyDiscoveryRun> _discovery_runs() const;
+
+  void _clear_constraints();
+
+  // Adds the constraints of a validation result to their tables and tracks them for revalidation. Returns whether any
+  // constraint was added.
+  bool _register_constraints(const ValidationResult& result, const TableValidationSnapshots& snapshots);
 
   std::unordered_map<LQPNodeType, std::vector<std::unique_ptr<AbstractDependencyCandidateRule>>> _candidate_rules{};
 
   std::unordered_map<DependencyType, std::unique_ptr<AbstractDependencyValidationRule>> _validation_rules{};
 
+  // Constraints added by this plugin, which are revalidated when their tables are modified.
+  std::vector<std::shared_ptr<AbstractValidatedConstraint>> _validated_constraints{};
+
   uint32_t _validation_repetitions{1};
 
+  // File to persist discovered constraints across runs (e.g., next to the binary table cache). Set via the
+  // DEPENDENCY_CATALOG environment variable.
+  std::optional<std::string> _catalog_filename{};
+  bool _catalog_restored{false};
+
+  // Serializes discovery and revalidation, which may be triggered concurrently by the background thread, user
+  // functions, and the pre-benchmark hook.
+  std::mutex _discovery_mutex{};
+
+  bool _background_discovery{false};
+  double _cpu_budget{DEFAULT_CPU_BUDGET};
+  std::unique_ptr<PausableLoopThread> _loop_thread_discovery{};
+  std::shared_ptr<MetaDependencyDiscoveryTable> _meta_table{};
+  std::chrono::steady_clock::time_point _next_discovery_time{};
+
+  // Annotation of the cached plans: the candidates extracted from each query's LQP, i.e., the tables and columns whose
+  // dependencies could change the query's optimization. Queries without annotation were not examined yet.
+  std::unordered_map<std::string, DependencyCandidates> _query_candidates{};
+
+  // All candidates validated in the background.
+  DependencyCandidates _known_candidates{};
+
+  mutable std::mutex _discovery_runs_mutex{};
+  std::vector<DependencyDiscoveryRun> _runs{};
+
   bool _ablation{false};
 };
 
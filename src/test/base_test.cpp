@@ -8,6 +8,7 @@
 
 #include "expression/expression_functional.hpp"
 #include "logical_query_plan/mock_node.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/statistics_objects/abstract_statistics_object.hpp"
@@ -233,4 +234,9 @@ std::shared_ptr<const Table> to_simple_reference_table(const std::shared_ptr<con
   return table_out;
 }
 
+void prepare_parallel_execution() {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+}
+
 }  // namespace hyrise
@@ -96,6 +96,9 @@ bool compare_files(const std::string& original_file, const std::string& created_
 // where necessary.
 std::shared_ptr<const Table> to_simple_reference_table(const std::shared_ptr<const Table>& table);
 
+// Sets up a NodeQueueScheduler with several workers, so that the jobs of operators are executed concurrently.
+void prepare_parallel_execution();
+
 const SegmentEncodingSpec all_segment_encoding_specs[]{
     SegmentEncodingSpec{EncodingType::Unencoded},
     SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedWidthInteger},
@@ -103,6 +106,8 @@ const SegmentEncodingSpec all_segment_encoding_specs[]{
     SegmentEncodingSpec{EncodingType::FixedStringDictionary, VectorCompressionType::FixedWidthInteger},
     SegmentEncodingSpec{EncodingType::FixedStringDictionary, VectorCompressionType::BitPacking},
     SegmentEncodingSpec{EncodingType::FrameOfReference},
+    SegmentEncodingSpec{EncodingType::FSST, VectorCompressionType::FixedWidthInteger},
+    SegmentEncodingSpec{EncodingType::FSST, VectorCompressionType::BitPacking},
     SegmentEncodingSpec{EncodingType::LZ4},
     SegmentEncodingSpec{EncodingType::RunLength}};
 
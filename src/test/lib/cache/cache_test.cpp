@@ -113,6 +113,26 @@ TEST_F(CacheTest, Clear) {
   ASSERT_FALSE(cache.has(2));
 }
 
+TEST_F(CacheTest, Erase) {
+  GDFSCache<int, int> cache(3);
+
+  cache.set(1, 2);
+  cache.set(2, 4);
+
+  cache.erase(1);
+  cache.erase(3);
+
+  ASSERT_EQ(cache.size(), 1u);
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_TRUE(cache.has(2));
+
+  // Erased entries do not occupy capacity.
+  cache.set(3, 6);
+  cache.set(4, 8);
+  ASSERT_EQ(cache.size(), 3u);
+  ASSERT_TRUE(cache.has(2));
+}
+
 TEST_F(CacheTest, NoGrowthOverCapacity) {
   GDFSCache<int, int> cache(3);
 
@@ -1,12 +1,14 @@
 #include <cstdio>
 #include <fstream>
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_test.hpp"
 
+#include "import_export/binary/binary_parser.hpp"
 #include "import_export/binary/binary_writer.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -262,6 +264,34 @@ TEST_F(BinaryWriterTest, LZ4MultipleBlocks) {
   EXPECT_TRUE(compare_files(reference_filename, filename));
 }
 
+TEST_F(BinaryWriterTest, FSSTRoundTrip) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::String, true);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3});
+  table->append({"https://hyrise.example/a"});
+  table->append({NULL_VALUE});
+  table->append({""});
+  table->append({"https://hyrise.example/b"});
+  table->append({"https://hyrise.example/a"});
+
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::FSST, VectorCompressionType::BitPacking});
+  BinaryWriter::write(*table, filename);
+  EXPECT_TRUE(file_exists(filename));
+
+  const auto parsed_table = BinaryParser::parse(filename);
+  EXPECT_TABLE_EQ_ORDERED(parsed_table, table);
+  ASSERT_EQ(parsed_table->chunk_count(), 2u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < parsed_table->chunk_count(); ++chunk_id) {
+    const auto segment = parsed_table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    const auto encoded_segment = std::dynamic_pointer_cast<const AbstractEncodedSegment>(segment);
+    ASSERT_TRUE(encoded_segment);
+    EXPECT_EQ(encoded_segment->encoding_type(), EncodingType::FSST);
+    EXPECT_EQ(encoded_segment->compressed_vector_type(), CompressedVectorType::BitPacking);
+  }
+}
+
 TEST_F(BinaryWriterTest, SortColumnDefinitions) {
   TableColumnDefinitions column_definitions;
   column_definitions.emplace_back("a", DataType::Int, false);
@@ -547,4 +577,64 @@ TEST_P(BinaryWriterMultiEncodingTest, RunNullValues) {
   EXPECT_TRUE(compare_files(reference_filename, filename));
 }
 
+TEST_F(BinaryWriterTest, ConstraintCatalogRoundTrip) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::String, true);
+
+  table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  table->append({1, "foo"});
+  table->append({2, NULL_VALUE});
+  table->append({3, "bar"});
+
+  auto entry = TableConstraintCatalogEntry{};
+  entry.table_name = "table_a";
+  entry.fingerprint = TableFingerprint::compute(*table);
+  entry.key_constraints.emplace_back(std::set<ColumnID>{ColumnID{0}}, KeyConstraintType::UNIQUE);
+  entry.key_constraints.emplace_back(std::set<ColumnID>{ColumnID{0}, ColumnID{1}}, KeyConstraintType::PRIMARY_KEY);
+  entry.order_constraints.emplace_back(std::vector<ColumnID>{ColumnID{0}}, std::vector<ColumnID>{ColumnID{1}});
+  entry.foreign_key_constraints.emplace_back(ForeignKeyCatalogEntry{{ColumnID{1}}, "table_b", {ColumnID{0}}});
+  const auto catalog = ConstraintCatalog{entry, TableConstraintCatalogEntry{"table_b", {}, {}, {}, {}}};
+
+  BinaryWriter::write_constraint_catalog(catalog, filename);
+  EXPECT_TRUE(file_exists(filename));
+
+  const auto parsed_catalog = BinaryParser::parse_constraint_catalog(filename);
+  ASSERT_EQ(parsed_catalog.size(), 2);
+  const auto& parsed_entry = parsed_catalog.front();
+  EXPECT_EQ(parsed_entry.table_name, "table_a");
+  EXPECT_EQ(parsed_entry.fingerprint, entry.fingerprint);
+  EXPECT_EQ(parsed_entry.fingerprint.chunk_count, 2);
+  EXPECT_EQ(parsed_entry.fingerprint.segment_checksums.size(), 4);
+  EXPECT_EQ(parsed_entry.key_constraints, entry.key_constraints);
+  EXPECT_EQ(parsed_entry.order_constraints, entry.order_constraints);
+  ASSERT_EQ(parsed_entry.foreign_key_constraints.size(), 1);
+  EXPECT_EQ(parsed_entry.foreign_key_constraints.front().foreign_key_columns, std::vector<ColumnID>{ColumnID{1}});
+  EXPECT_EQ(parsed_entry.foreign_key_constraints.front().primary_key_table_name, "table_b");
+  EXPECT_EQ(parsed_entry.foreign_key_constraints.front().primary_key_columns, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(parsed_catalog.back().table_name, "table_b");
+  EXPECT_TRUE(parsed_catalog.back().key_constraints.empty());
+}
+
+TEST_F(BinaryWriterTest, TableFingerprint) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, false);
+
+  table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  table->append({1});
+  table->append({2});
+  const auto fingerprint = TableFingerprint::compute(*table);
+  EXPECT_EQ(fingerprint, TableFingerprint::compute(*table));
+
+  // Same size, but different values.
+  const auto other_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  other_table->append({1});
+  other_table->append({3});
+  EXPECT_NE(fingerprint, TableFingerprint::compute(*other_table));
+
+  // Inserted rows.
+  table->append({3});
+  EXPECT_NE(fingerprint, TableFingerprint::compute(*table));
+}
+
 }  // namespace hyrise
@@ -58,6 +58,10 @@ TEST_F(AggregateNodeTest, Description) {
   auto description = _aggregate_node->description();
 
   EXPECT_EQ(description, "[Aggregate] GroupBy: [a, c] Aggregates: [SUM(a + b), SUM(a + c)]");
+
+  _aggregate_node->input_is_sorted = true;
+  EXPECT_EQ(_aggregate_node->description(),
+            "[Aggregate] GroupBy: [a, c] Aggregates: [SUM(a + b), SUM(a + c)] sorted input");
 }
 
 TEST_F(AggregateNodeTest, HashingAndEqualityCheck) {
@@ -89,12 +93,21 @@ TEST_F(AggregateNodeTest, HashingAndEqualityCheck) {
   // two nodes as non-equal.
   EXPECT_NE(_aggregate_node->hash(), different_aggregate_node_c->hash());
   EXPECT_NE(_aggregate_node->hash(), different_aggregate_node_d->hash());
+
+  same_aggregate_node->input_is_sorted = true;
+  EXPECT_NE(*_aggregate_node, *same_aggregate_node);
+  EXPECT_NE(_aggregate_node->hash(), same_aggregate_node->hash());
 }
 
 TEST_F(AggregateNodeTest, Copy) {
   const auto same_aggregate_node = AggregateNode::make(
       expression_vector(_a, _c), expression_vector(sum_(add_(_a, _b)), sum_(add_(_a, _c))), _mock_node);
   EXPECT_EQ(*_aggregate_node->deep_copy(), *same_aggregate_node);
+
+  _aggregate_node->input_is_sorted = true;
+  const auto copied_aggregate_node = std::static_pointer_cast<AggregateNode>(_aggregate_node->deep_copy());
+  EXPECT_EQ(*copied_aggregate_node, *_aggregate_node);
+  EXPECT_TRUE(copied_aggregate_node->input_is_sorted);
 }
 
 TEST_F(AggregateNodeTest, UniqueColumnCombinationsAdd) {
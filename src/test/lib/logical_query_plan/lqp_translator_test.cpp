@@ -33,6 +33,7 @@
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
 #include "operators/aggregate_hash.hpp"
+#include "operators/aggregate_sort.hpp"
 #include "operators/change_meta_table.hpp"
 #include "operators/export.hpp"
 #include "operators/get_table.hpp"
@@ -340,6 +341,86 @@ TEST_F(LQPTranslatorTest, Sort) {
   ASSERT_TRUE(get_table);
 }
 
+TEST_F(LQPTranslatorTest, SortWithTopK) {
+  // SELECT * FROM int_float ORDER BY a LIMIT 10, with top_k set by the TopKRule.
+  const auto sort_node =
+      SortNode::make(expression_vector(int_float_a), std::vector<SortMode>{SortMode::Ascending}, int_float_node);
+  sort_node->top_k = 10;
+  const auto lqp = LimitNode::make(value_(10), sort_node);
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto limit = std::dynamic_pointer_cast<const Limit>(pqp);
+  ASSERT_TRUE(limit);
+  const auto sort = std::dynamic_pointer_cast<const Sort>(limit->left_input());
+  ASSERT_TRUE(sort);
+  EXPECT_EQ(sort->top_k(), size_t{10});
+}
+
+TEST_F(LQPTranslatorTest, AggregateWithSortedInput) {
+  // SELECT a, SUM(b) FROM (SELECT * FROM int_float ORDER BY a) GROUP BY a, with input_is_sorted set by the
+  // StreamingAggregateRule.
+  // clang-format off
+  const auto aggregate_node =
+  AggregateNode::make(expression_vector(int_float_a), expression_vector(sum_(int_float_b)),
+    SortNode::make(expression_vector(int_float_a), std::vector<SortMode>{SortMode::Ascending},
+      int_float_node));
+  // clang-format on
+  EXPECT_TRUE(std::dynamic_pointer_cast<const AggregateHash>(LQPTranslator{}.translate_node(aggregate_node)));
+
+  aggregate_node->input_is_sorted = true;
+  const auto aggregate = std::dynamic_pointer_cast<const AggregateSort>(LQPTranslator{}.translate_node(aggregate_node));
+  ASSERT_TRUE(aggregate);
+  EXPECT_EQ(aggregate->sorted_input(), AggregateSort::SortedInput::Yes);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const Sort>(aggregate->left_input()));
+}
+
+TEST_F(LQPTranslatorTest, AggregateOnSortedStoredTable) {
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Float, false}}, TableType::Data,
+      ChunkOffset{2});
+  for (const auto value : {1, 2, 2, 3, 5}) {
+    table->append({value, static_cast<float>(5 - value)});
+  }
+  table->last_chunk()->finalize();
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    table->get_chunk(chunk_id)->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}, SortMode::Ascending});
+  }
+  Hyrise::get().storage_manager.add_table("int_float_sorted", table);
+
+  const auto stored_table_node = StoredTableNode::make("int_float_sorted");
+  const auto a = stored_table_node->get_column("a");
+  const auto b = stored_table_node->get_column("b");
+
+  // The stored table is sorted by a. AggregateSort checks the sortedness again when it is executed and falls back to
+  // hash aggregation if the table has changed.
+  // clang-format off
+  const auto aggregate_node_a =
+  AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+    PredicateNode::make(greater_than_(b, 0),
+      stored_table_node));
+  // clang-format on
+  const auto aggregate_a =
+      std::dynamic_pointer_cast<const AggregateSort>(LQPTranslator{}.translate_node(aggregate_node_a));
+  ASSERT_TRUE(aggregate_a);
+  EXPECT_EQ(aggregate_a->sorted_input(), AggregateSort::SortedInput::Expected);
+
+  // The stored table is not sorted by b.
+  const auto aggregate_node_b =
+      AggregateNode::make(expression_vector(b), expression_vector(sum_(a)), stored_table_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const AggregateHash>(LQPTranslator{}.translate_node(aggregate_node_b)));
+
+  // Joins do not preserve the order of their inputs.
+  // clang-format off
+  const auto aggregate_node_join =
+  AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+    JoinNode::make(JoinMode::Cross,
+      stored_table_node,
+      int_float_node));
+  // clang-format on
+  EXPECT_TRUE(std::dynamic_pointer_cast<const AggregateHash>(LQPTranslator{}.translate_node(aggregate_node_join)));
+}
+
 TEST_F(LQPTranslatorTest, LimitLiteral) {
   /**
    * Build LQP and translate to PQP
@@ -646,6 +727,25 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinSortMerge) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeOnSortedInputsToJoinSortMerge) {
+  const auto ascending = std::vector<SortMode>{SortMode::Ascending};
+  const auto sorted_int_float_node = SortNode::make(expression_vector(int_float_a), ascending, int_float_node);
+  const auto sorted_int_float2_node = SortNode::make(expression_vector(int_float2_a), ascending, int_float2_node);
+
+  // Both inputs are sorted by the join columns. The join predicate's operands are swapped.
+  const auto semi_join_node = JoinNode::make(JoinMode::Semi, equals_(int_float2_a, int_float_a), sorted_int_float_node,
+                                             ValidateNode::make(sorted_int_float2_node));
+  const auto semi_join_op = std::dynamic_pointer_cast<JoinSortMerge>(LQPTranslator{}.translate_node(semi_join_node));
+  ASSERT_TRUE(semi_join_op);
+  EXPECT_EQ(semi_join_op->primary_predicate().column_ids, ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(semi_join_op->mode(), JoinMode::Semi);
+
+  // The inputs are sorted by other columns than the join columns.
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_b, int_float2_b), sorted_int_float_node,
+                                        sorted_int_float2_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(join_node)));
+}
+
 TEST_F(LQPTranslatorTest, JoinNodeToJoinNestedLoop) {
   /**
    * Build LQP and translate to PQP
@@ -1171,4 +1271,67 @@ TEST_F(LQPTranslatorTest, TranslatePrunableSubqueries) {
   EXPECT_EQ(prunable_subquery_scans.front(), pqp);
 }
 
+TEST_F(LQPTranslatorTest, TranslateRuntimeFilters) {
+  // The larger input (table_int_float2) is filtered with the join column of the smaller input (table_int_float).
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+    int_float_node,
+    PredicateNode::make(greater_than_(int_float2_b, 0),
+      int_float2_node));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  ASSERT_EQ(pqp->type(), OperatorType::JoinHash);
+  const auto& table_scan = std::dynamic_pointer_cast<const TableScan>(pqp->right_input());
+  ASSERT_TRUE(table_scan);
+  const auto& get_table = std::dynamic_pointer_cast<const GetTable>(table_scan->left_input());
+  ASSERT_TRUE(get_table);
+  EXPECT_TRUE(std::static_pointer_cast<const GetTable>(pqp->left_input())->runtime_filters().empty());
+
+  for (const auto& runtime_filters : {table_scan->runtime_filters(), get_table->runtime_filters()}) {
+    ASSERT_EQ(runtime_filters.size(), 1);
+    EXPECT_EQ(runtime_filters.front().join.lock(), pqp);
+    EXPECT_EQ(runtime_filters.front().source_side, LQPInputSide::Left);
+    EXPECT_EQ(runtime_filters.front().column_id, ColumnID{0});
+  }
+
+  // Deep copies reference the copied join.
+  const auto pqp_copy = pqp->deep_copy();
+  const auto& get_table_copy = std::static_pointer_cast<const GetTable>(pqp_copy->right_input()->left_input());
+  ASSERT_EQ(get_table_copy->runtime_filters().size(), 1);
+  EXPECT_EQ(get_table_copy->runtime_filters().front().join.lock(), pqp_copy);
+
+  // Copying only the join input drops the filters.
+  const auto table_scan_copy = table_scan->deep_copy();
+  EXPECT_TRUE(std::static_pointer_cast<const TableScan>(table_scan_copy)->runtime_filters().empty());
+}
+
+TEST_F(LQPTranslatorTest, TranslateRuntimeFiltersOnlyIfSafe) {
+  // Rows without join partner are part of the result of outer joins.
+  const auto outer_join_pqp =
+      LQPTranslator{}.translate_node(JoinNode::make(JoinMode::Left, equals_(int_float_a, int_float2_a), int_float_node,
+                                                    int_float2_node));
+  ASSERT_EQ(outer_join_pqp->type(), OperatorType::JoinHash);
+  EXPECT_TRUE(std::static_pointer_cast<const GetTable>(outer_join_pqp->left_input())->runtime_filters().empty());
+  EXPECT_TRUE(std::static_pointer_cast<const GetTable>(outer_join_pqp->right_input())->runtime_filters().empty());
+
+  // The scan result is also consumed by another operator.
+  // clang-format off
+  const auto predicate_node = PredicateNode::make(greater_than_(int_float2_b, 0), int_float2_node);
+  const auto lqp =
+  UnionNode::make(SetOperationMode::All,
+    ProjectionNode::make(expression_vector(int_float2_a, int_float2_b),
+      JoinNode::make(JoinMode::Semi, equals_(int_float2_a, int_float_a),
+        predicate_node,
+        int_float_node)),
+    predicate_node);
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  const auto& table_scan = std::static_pointer_cast<const TableScan>(pqp->right_input());
+  EXPECT_TRUE(table_scan->runtime_filters().empty());
+  EXPECT_TRUE(std::static_pointer_cast<const GetTable>(table_scan->left_input())->runtime_filters().empty());
+}
+
 }  // namespace hyrise
@@ -42,6 +42,9 @@ TEST_F(SortNodeTest, Descriptions) {
                                std::vector<SortMode>{SortMode::Descending, SortMode::Ascending, SortMode::Descending});
   sort_c->set_left_input(_table_node);
   EXPECT_EQ(sort_c->description(), "[Sort] d (Descending), f (Ascending), i (Descending)");
+
+  _sort_node->top_k = 10;
+  EXPECT_EQ(_sort_node->description(), "[Sort] i (Ascending) top 10");
 }
 
 TEST_F(SortNodeTest, HashingAndEqualityCheck) {
@@ -60,6 +63,10 @@ TEST_F(SortNodeTest, HashingAndEqualityCheck) {
   EXPECT_NE(_sort_node->hash(), sort_a->hash());
   EXPECT_NE(_sort_node->hash(), sort_b->hash());
   EXPECT_EQ(_sort_node->hash(), sort_c->hash());
+
+  sort_c->top_k = 10;
+  EXPECT_NE(*_sort_node, *sort_c);
+  EXPECT_NE(_sort_node->hash(), sort_c->hash());
 }
 
 TEST_F(SortNodeTest, Copy) {
@@ -69,6 +76,11 @@ TEST_F(SortNodeTest, Copy) {
       expression_vector(_a_d, _a_f, _a_i),
       std::vector<SortMode>{SortMode::Descending, SortMode::Ascending, SortMode::Descending}, _table_node);
   EXPECT_EQ(*sort_b->deep_copy(), *sort_b);
+
+  sort_b->top_k = 10;
+  const auto copied_sort_b = std::static_pointer_cast<SortNode>(sort_b->deep_copy());
+  EXPECT_EQ(*copied_sort_b, *sort_b);
+  EXPECT_EQ(copied_sort_b->top_k, size_t{10});
 }
 
 TEST_F(SortNodeTest, NodeExpressions) {
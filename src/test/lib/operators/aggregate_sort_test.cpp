@@ -9,6 +9,7 @@
 
 #include "base_test.hpp"
 
+#include "concurrency/transaction_context.hpp"
 #include "expression/aggregate_expression.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/aggregate_hash.hpp"
@@ -18,6 +19,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
@@ -209,4 +211,203 @@ TEST_F(AggregateSortTest, AggregateOnPresortedValueClustered) {
   test_clustered_table_input(to_simple_reference_table(table_sorted_value_clustered));
 }
 
+TEST_F(AggregateSortTest, IsSortedBy) {
+  // Creates a table with one chunk per entry of `chunks`. If given, the chunks are marked as sorted by the sort mode.
+  const auto create_table = [](const std::vector<std::vector<AllTypeVariant>>& chunks,
+                               const std::vector<std::optional<SortMode>>& sort_modes) {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+    const auto chunk_count = chunks.size();
+    for (auto chunk_idx = size_t{0}; chunk_idx < chunk_count; ++chunk_idx) {
+      auto values = pmr_vector<int32_t>{};
+      auto null_values = pmr_vector<bool>{};
+      for (const auto& value : chunks[chunk_idx]) {
+        values.emplace_back(variant_is_null(value) ? 0 : boost::get<int32_t>(value));
+        null_values.emplace_back(variant_is_null(value));
+      }
+      table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(values), std::move(null_values))});
+      table->last_chunk()->finalize();
+      if (sort_modes[chunk_idx]) {
+        table->last_chunk()->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}, *sort_modes[chunk_idx]});
+      }
+    }
+    return table;
+  };
+
+  const auto ascending = std::optional<SortMode>{SortMode::Ascending};
+  const auto descending = std::optional<SortMode>{SortMode::Descending};
+
+  // Empty chunks are skipped.
+  EXPECT_TRUE(AggregateSort::is_sorted_by(*create_table({{1, 2}, {2, 3}, {}, {5}}, {ascending, ascending, ascending,
+                                                                                  ascending}),
+                                          ColumnID{0}));
+  EXPECT_TRUE(AggregateSort::is_sorted_by(*create_table({{3, 2}, {2, 1}}, {descending, descending}), ColumnID{0}));
+
+  // The chunks are sorted individually, but their values overlap.
+  EXPECT_FALSE(AggregateSort::is_sorted_by(*create_table({{1, 3}, {2, 4}}, {ascending, ascending}), ColumnID{0}));
+  EXPECT_FALSE(AggregateSort::is_sorted_by(*create_table({{3, 4}, {1, 2}}, {ascending, ascending}), ColumnID{0}));
+
+  // Different sort modes and missing sort information.
+  EXPECT_FALSE(AggregateSort::is_sorted_by(*create_table({{1, 2}, {4, 3}}, {ascending, descending}), ColumnID{0}));
+  EXPECT_FALSE(AggregateSort::is_sorted_by(*create_table({{1, 2}, {3, 4}}, {ascending, std::nullopt}), ColumnID{0}));
+
+  // NULLs come first.
+  EXPECT_TRUE(AggregateSort::is_sorted_by(*create_table({{NULL_VALUE, NULL_VALUE}, {NULL_VALUE, 1}, {2}},
+                                                        {ascending, ascending, ascending}),
+                                          ColumnID{0}));
+  EXPECT_FALSE(AggregateSort::is_sorted_by(*create_table({{1}, {NULL_VALUE, 2}}, {ascending, ascending}), ColumnID{0}));
+}
+
+TEST_F(AggregateSortTest, StreamingAggregation) {
+  // The input is sorted by both group by columns, so it is aggregated without sorting it. Groups span chunk boundaries
+  // and the input has more than AggregateSort::ROWS_PER_JOB rows, so it is aggregated in parallel. We compare the
+  // results to AggregateHash.
+  prepare_parallel_execution();
+
+  // Three full jobs and a partial one.
+  const auto row_count = 3 * AggregateSort::ROWS_PER_JOB + 500;
+  const auto column_definitions = TableColumnDefinitions{
+      {"day", DataType::Int, true}, {"hour", DataType::Long, false}, {"value", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'000});
+  for (auto row = int32_t{0}; row < static_cast<int32_t>(row_count); ++row) {
+    const auto day = row < 500 ? NULL_VALUE : AllTypeVariant{row / 2'777};
+    const auto value = row % 13 == 0 ? NULL_VALUE : AllTypeVariant{row % 1'000};
+    table->append({day, int64_t{row / 313}, value});
+  }
+  table->last_chunk()->finalize();
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    table->get_chunk(chunk_id)->set_individually_sorted_by(std::vector<SortColumnDefinition>{
+        SortColumnDefinition{ColumnID{0}, SortMode::Ascending},
+        SortColumnDefinition{ColumnID{1}, SortMode::Ascending}});
+  }
+  EXPECT_TRUE(AggregateSort::is_sorted_by(*table, ColumnID{0}));
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  // The TableScan outputs a reference table that keeps the sort information of the chunks.
+  const auto table_scan =
+      std::make_shared<TableScan>(table_wrapper, greater_than_(pqp_column_(ColumnID{1}, DataType::Long, false, "hour"),
+                                                               int64_t{3}));
+  table_scan->never_clear_output();
+  table_scan->execute();
+
+  const auto value = pqp_column_(ColumnID{2}, DataType::Int, true, "value");
+  auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  for (const auto aggregate_function :
+       {AggregateFunction::Min, AggregateFunction::Max, AggregateFunction::Sum, AggregateFunction::Avg,
+        AggregateFunction::Count, AggregateFunction::CountDistinct, AggregateFunction::StandardDeviationSample}) {
+    aggregates.emplace_back(std::make_shared<AggregateExpression>(aggregate_function, value));
+  }
+  aggregates.emplace_back(std::make_shared<AggregateExpression>(
+      AggregateFunction::Count, pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*")));
+
+  for (const auto& input : std::vector<std::shared_ptr<AbstractOperator>>{table_wrapper, table_scan}) {
+    // With a single group by column, the sort information of the chunks shows that the input is sorted.
+    for (const auto sorted_input : {AggregateSort::SortedInput::No, AggregateSort::SortedInput::Yes}) {
+      for (const auto& groupby_column_ids :
+           std::vector<std::vector<ColumnID>>{{ColumnID{0}}, {ColumnID{0}, ColumnID{1}}}) {
+        SCOPED_TRACE("GROUP BY " + std::to_string(groupby_column_ids.size()) + " column(s)");
+        const auto aggregate_sort =
+            std::make_shared<AggregateSort>(input, aggregates, groupby_column_ids, sorted_input);
+        aggregate_sort->execute();
+        const auto aggregate_hash = std::make_shared<AggregateHash>(input, aggregates, groupby_column_ids);
+        aggregate_hash->execute();
+        EXPECT_TABLE_EQ_UNORDERED(aggregate_sort->get_output(), aggregate_hash->get_output());
+      }
+    }
+  }
+
+  // Without aggregates, the output has one row per group: one for NULL and one per day.
+  const auto distinct =
+      std::make_shared<AggregateSort>(table_wrapper, std::vector<std::shared_ptr<AggregateExpression>>{},
+                                      std::vector<ColumnID>{ColumnID{0}}, AggregateSort::SortedInput::Yes);
+  distinct->execute();
+  EXPECT_EQ(distinct->get_output()->row_count(), (row_count - 1) / 2'777 + 2);
+}
+
+TEST_F(AggregateSortTest, SortedInputThroughScanAndValidate) {
+  // The StreamingAggregateRule looks through predicates and Validate nodes for a Sort. Thus, TableScan and Validate
+  // have to output the chunks of a sorted input in the same order, although they process them in concurrent jobs.
+  prepare_parallel_execution();
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10'000}, UseMvcc::Yes);
+  for (auto row = int32_t{0}; row < 200'000; ++row) {
+    table->append({(row * 7'919) % 20'011, row});
+  }
+  table->last_chunk()->finalize();
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      chunk->mvcc_data()->set_begin_cid(chunk_offset, CommitID{0});
+    }
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  const auto sort = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}, ChunkOffset{1'000});
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+  const auto table_scan = std::make_shared<TableScan>(sort, less_than_(column_b, 190'000));
+  const auto validate = std::make_shared<Validate>(table_scan);
+  validate->set_transaction_context(
+      std::make_shared<TransactionContext>(TransactionID{1}, CommitID{1}, AutoCommit::No));
+  validate->never_clear_output();
+  execute_all({table_wrapper, sort, table_scan, validate});
+
+  EXPECT_GT(validate->get_output()->chunk_count(), 100);
+  EXPECT_TRUE(AggregateSort::is_sorted_by(*validate->get_output(), ColumnID{0}));
+
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::make_shared<AggregateExpression>(AggregateFunction::Sum, column_b)};
+  const auto aggregate_sort = std::make_shared<AggregateSort>(validate, aggregates, std::vector<ColumnID>{ColumnID{0}},
+                                                              AggregateSort::SortedInput::Yes);
+  aggregate_sort->execute();
+  const auto aggregate_hash = std::make_shared<AggregateHash>(validate, aggregates, std::vector<ColumnID>{ColumnID{0}});
+  aggregate_hash->execute();
+  EXPECT_TABLE_EQ_UNORDERED(aggregate_sort->get_output(), aggregate_hash->get_output());
+}
+
+TEST_F(AggregateSortTest, ExpectedSortedInput) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+  for (const auto value : {1, 2, 2, 3}) {
+    table->append({value, value * 10});
+  }
+  table->last_chunk()->finalize();
+  table->get_chunk(ChunkID{0})->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}});
+  table->get_chunk(ChunkID{1})->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}});
+
+  const auto b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::make_shared<AggregateExpression>(AggregateFunction::Sum, b)};
+  const auto aggregate = [&]() {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    const auto aggregate_sort = std::make_shared<AggregateSort>(
+        table_wrapper, aggregates, std::vector<ColumnID>{ColumnID{0}}, AggregateSort::SortedInput::Expected);
+    aggregate_sort->execute();
+    return aggregate_sort->get_output();
+  };
+
+  const auto sorted_result = aggregate();
+  auto expected_result = std::make_shared<Table>(sorted_result->column_definitions(), TableType::Data);
+  expected_result->append({1, int64_t{10}});
+  expected_result->append({2, int64_t{40}});
+  expected_result->append({3, int64_t{30}});
+  EXPECT_TABLE_EQ_ORDERED(sorted_result, expected_result);
+
+  // Inserted rows end up in an unsorted chunk, so the operator falls back to hash aggregation.
+  table->append({2, 5});
+  table->append({1, 7});
+  expected_result = std::make_shared<Table>(sorted_result->column_definitions(), TableType::Data);
+  expected_result->append({1, int64_t{17}});
+  expected_result->append({2, int64_t{45}});
+  expected_result->append({3, int64_t{30}});
+  EXPECT_TABLE_EQ_UNORDERED(aggregate(), expected_result);
+}
+
 }  // namespace hyrise
@@ -34,6 +34,59 @@ TEST_F(OperatorsAggregateHashTest, EmptyHash) {
   EXPECT_EQ(std::hash<AggregateKeySmallVector>()(AggregateKeySmallVector{}), 0);
 }
 
+TEST_F(OperatorsAggregateHashTest, ParallelAggregation) {
+  // Inputs with more than AggregateHash::ROWS_PER_JOB rows are pre-aggregated per morsel in parallel. Many groups are
+  // merged in multiple partitions. We compare the results to AggregateSort, which does not use thread-local results.
+  prepare_parallel_execution();
+
+  // Four full morsels and a partial one.
+  const auto row_count = 4 * AggregateHash::ROWS_PER_JOB + 123;
+  const auto column_definitions =
+      TableColumnDefinitions{{"low", DataType::Int, true},
+                             {"high", DataType::Long, false},
+                             {"name", DataType::String, false},
+                             {"value", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10'000});
+  for (auto row = int32_t{0}; row < static_cast<int32_t>(row_count); ++row) {
+    // The values of `low` are too sparse for the immediate key shortcut, which does not use hash maps.
+    const auto low = row % 97 == 0 ? NULL_VALUE : AllTypeVariant{(row % 10) * 1'000'000};
+    const auto high = int64_t{row / 2} * 7;
+    const auto name = pmr_string{"name" + std::to_string(row % 3)};
+    const auto value = row % 13 == 0 ? NULL_VALUE : AllTypeVariant{row % 1'000};
+    table->append({low, high, name, value});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto value = pqp_column_(ColumnID{3}, DataType::Int, true, "value");
+  auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  for (const auto aggregate_function :
+       {AggregateFunction::Min, AggregateFunction::Max, AggregateFunction::Sum, AggregateFunction::Avg,
+        AggregateFunction::Count, AggregateFunction::CountDistinct, AggregateFunction::StandardDeviationSample}) {
+    aggregates.emplace_back(std::make_shared<AggregateExpression>(aggregate_function, value));
+  }
+  aggregates.emplace_back(std::make_shared<AggregateExpression>(
+      AggregateFunction::Count, pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*")));
+
+  const auto groupby_column_id_sets = std::vector<std::vector<ColumnID>>{
+      {}, {ColumnID{0}}, {ColumnID{1}}, {ColumnID{0}, ColumnID{2}}, {ColumnID{0}, ColumnID{1}, ColumnID{2}}};
+  for (const auto& groupby_column_ids : groupby_column_id_sets) {
+    SCOPED_TRACE("GROUP BY " + std::to_string(groupby_column_ids.size()) + " column(s)");
+    const auto aggregate_hash = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate_hash->execute();
+    const auto aggregate_sort = std::make_shared<AggregateSort>(table_wrapper, aggregates, groupby_column_ids);
+    aggregate_sort->execute();
+    EXPECT_TABLE_EQ_UNORDERED(aggregate_hash->get_output(), aggregate_sort->get_output());
+  }
+
+  // DISTINCT, i.e., grouping without aggregate functions.
+  const auto groupby_column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{2}};
+  const auto aggregate_hash = std::make_shared<AggregateHash>(
+      table_wrapper, std::vector<std::shared_ptr<AggregateExpression>>{}, groupby_column_ids);
+  aggregate_hash->execute();
+  EXPECT_EQ(aggregate_hash->get_output()->row_count(), 33);
+}
+
 template <typename T>
 void test_output(const std::shared_ptr<AbstractOperator> in,
                  const std::vector<std::pair<ColumnID, AggregateFunction>>& aggregate_definitions,
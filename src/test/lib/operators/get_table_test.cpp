@@ -8,6 +8,7 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/delete.hpp"
 #include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
@@ -444,4 +445,31 @@ TEST_F(OperatorsGetTableTest, DynamicSubqueryPruningSubqueryNotExecuted) {
             "GetTable\n(int_int_float)\npruned:\n1/4 chunk(s) (1 static, 0 dynamic)\n1/3 column(s)");
 }
 
+TEST_F(OperatorsGetTableTest, DynamicRuntimeFilterPruning) {
+  // Prune table with the value range of the other input of a hash join.
+  const auto get_table = std::make_shared<GetTable>("int_int_float", std::vector{ChunkID{0}}, std::vector{ColumnID{1}});
+  const auto dummy_table = Table::create_dummy_table({{"x", DataType::Int, false}});
+  dummy_table->append({11});
+  const auto table_wrapper = std::make_shared<TableWrapper>(dummy_table);
+  const auto join = std::make_shared<JoinHash>(
+      get_table, table_wrapper, JoinMode::Semi,
+      OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+
+  get_table->lqp_node = StoredTableNode::make("int_int_float");
+  get_table->set_runtime_filters({JoinRuntimeFilterReference{join, LQPInputSide::Right, ColumnID{0}}});
+
+  // The input of the copied join has not been executed yet. Thus, we cannot prune dynamically.
+  const auto join_copy = join->deep_copy();
+  const auto get_table_copy = std::static_pointer_cast<GetTable>(join_copy->mutable_left_input());
+  ASSERT_EQ(get_table_copy->runtime_filters().size(), 1);
+  EXPECT_EQ(get_table_copy->runtime_filters().front().join.lock(), join_copy);
+  get_table_copy->execute();
+  EXPECT_EQ(get_table_copy->get_output()->chunk_count(), 3);
+
+  execute_all({table_wrapper, get_table});
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 1);
+  EXPECT_EQ(get_table->description(DescriptionMode::SingleLine),
+            "GetTable (int_int_float) pruned: 3/4 chunk(s) (1 static, 2 dynamic), 1/3 column(s)");
+}
+
 }  // namespace hyrise
@@ -101,8 +101,8 @@ TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
   std::vector<std::vector<size_t>> histograms;
 
   // BloomFilters are ignored in this test
-  BloomFilter bloom_filter_with_nulls;
-  BloomFilter bloom_filter_without_nulls;
+  auto bloom_filter_with_nulls = BlockedBloomFilter{};
+  auto bloom_filter_without_nulls = BlockedBloomFilter{};
 
   // We materialize the table twice, once with keeping NULL values and once without
   auto materialized_with_nulls = materialize_input<int, int, true>(
@@ -160,33 +160,37 @@ TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
 TEST_F(JoinHashStepsTest, MaterializeOutputBloomFilter) {
   {
     std::vector<std::vector<size_t>> histograms;  // Ignored in this test
-    BloomFilter bloom_filter;
+    auto bloom_filter = BlockedBloomFilter{};
 
     materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0}, histograms, 1,
                                        bloom_filter);
 
-    // For all input values, their position in the bloom filter should be correctly set to true
-    for (auto value : std::vector<int>{0, 6, 7, 9, 13, 18}) {
-      EXPECT_TRUE(bloom_filter[value]);
+    // The filter is sized for the input table, which fits into a single block.
+    EXPECT_EQ(bloom_filter.block_count(), 1);
+    EXPECT_EQ(bloom_filter.hash_count(), BlockedBloomFilter::LANE_COUNT);
 
-      // Set to false for easier checking of the values that should be false
-      bloom_filter[value] = false;
+    // All input values are contained in the Bloom filter.
+    const auto hash_function = std::hash<int>{};
+    for (auto value : std::vector<int>{0, 6, 7, 9, 13, 18}) {
+      EXPECT_TRUE(bloom_filter.contains(hash_function(value)));
     }
 
-    // All other slots should be false
-    EXPECT_EQ(bloom_filter, BloomFilter{BLOOM_FILTER_SIZE});
+    // With few values and eight bits set per value, false positives are practically impossible.
+    for (auto value : std::vector<int>{1, 2, 3, 4, 5, 8, 10, 100}) {
+      EXPECT_FALSE(bloom_filter.contains(hash_function(value)));
+    }
   }
 }
 
 TEST_F(JoinHashStepsTest, MaterializeInputBloomFilter) {
   {
     std::vector<std::vector<size_t>> histograms;  // Ignored in this test
-    BloomFilter output_bloom_filter;
+    auto output_bloom_filter = BlockedBloomFilter{};
 
     // Fill input_bloom_filter
-    BloomFilter input_bloom_filter(BLOOM_FILTER_SIZE);
+    auto input_bloom_filter = BlockedBloomFilter{3};
     for (auto value : std::vector<int>{6, 7, 9}) {
-      input_bloom_filter[value] = true;
+      input_bloom_filter.insert(std::hash<int>{}(value));
     }
 
     auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
@@ -207,13 +211,49 @@ TEST_F(JoinHashStepsTest, MaterializeInputBloomFilter) {
 
     EXPECT_EQ(materialized_values, expected_values);
     EXPECT_EQ(chunk_offsets, expected_offsets);
+
+    // All non-NULL values were probed and 0, 13, and 18 were filtered out.
+    EXPECT_EQ(input_bloom_filter.probed_value_count(), 9);
+    EXPECT_EQ(input_bloom_filter.filtered_value_count(), 3);
+  }
+}
+
+TEST_F(JoinHashStepsTest, MaterializeInputDisablesIneffectiveBloomFilter) {
+  auto histograms = std::vector<std::vector<size_t>>{};  // Ignored in this test
+  auto output_bloom_filter = BlockedBloomFilter{};
+
+  // The input Bloom filter contains all values of the table. Thus, it is disabled after enough values were probed.
+  auto input_bloom_filter = BlockedBloomFilter{2};
+  input_bloom_filter.insert(std::hash<int>{}(0));
+  input_bloom_filter.insert(std::hash<int>{}(1));
+
+  const auto table =
+      std::make_shared<Table>(_table_zero_one->column_definitions(), TableType::Data, ChunkOffset{1'000});
+  const auto row_count = 2 * BlockedBloomFilter::MIN_PROBE_COUNT_FOR_ADAPTION;
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    table->append({static_cast<int>(row % 2)});
+  }
+
+  auto container = materialize_input<int, int, false>(table, ColumnID{0}, histograms, 0, output_bloom_filter,
+                                                      input_bloom_filter);
+  EXPECT_FALSE(input_bloom_filter.is_active());
+  EXPECT_EQ(input_bloom_filter.filtered_value_count(), 0);
+
+  // The filter is disabled as soon as enough values were probed. The remaining chunks do not probe it anymore.
+  EXPECT_GE(input_bloom_filter.probed_value_count(), BlockedBloomFilter::MIN_PROBE_COUNT_FOR_ADAPTION);
+  EXPECT_LT(input_bloom_filter.probed_value_count(), row_count);
+
+  auto materialized_value_count = size_t{0};
+  for (const auto& partition : container) {
+    materialized_value_count += partition.elements.size();
   }
+  EXPECT_EQ(materialized_value_count, row_count);
 }
 
 TEST_F(JoinHashStepsTest, MaterializeInputHistograms) {
   {
     std::vector<std::vector<size_t>> histograms;
-    BloomFilter bloom_filter;  // Ignored in this test
+    auto bloom_filter = BlockedBloomFilter{};  // Ignored in this test
 
     // When using 1 bit for radix partitioning, we have two radix clusters determined on the least
     // significant bit. For the 0/1 table, we should thus cluster the ones and the zeros.
@@ -231,7 +271,7 @@ TEST_F(JoinHashStepsTest, MaterializeInputHistograms) {
 
   {
     std::vector<std::vector<size_t>> histograms;
-    BloomFilter bloom_filter;  // Ignored in this test
+    auto bloom_filter = BlockedBloomFilter{};  // Ignored in this test
 
     // When using 2 bits for radix partitioning, we have four radix clusters determined on the two least
     // significant bits. For the 0/1 table, we expect two non-empty clusters (00/01) and two empty ones (10/11).
@@ -256,7 +296,7 @@ TEST_F(JoinHashStepsTest, MaterializeInputHistograms) {
 TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
   const size_t radix_bit_count = 1;
   std::vector<std::vector<size_t>> histograms;
-  BloomFilter bloom_filter;  // Ignored in this test
+  auto bloom_filter = BlockedBloomFilter{};  // Ignored in this test
 
   const auto materialized_without_null_handling = materialize_input<int, int, true>(
       _table_int_with_nulls->get_output(), ColumnID{0}, histograms, radix_bit_count, bloom_filter);
@@ -282,13 +322,13 @@ TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
 }
 
 TEST_F(JoinHashStepsTest, BuildRespectsBloomFilter) {
-  std::vector<std::vector<size_t>> histograms;  // Ignored in this test
-  BloomFilter output_bloom_filter;              // Ignored in this test
+  std::vector<std::vector<size_t>> histograms;      // Ignored in this test
+  auto output_bloom_filter = BlockedBloomFilter{};  // Ignored in this test
 
   // Fill input_bloom_filter
-  BloomFilter input_bloom_filter(BLOOM_FILTER_SIZE);
+  auto input_bloom_filter = BlockedBloomFilter{3};
   for (auto value : std::vector<int>{6, 7, 9}) {
-    input_bloom_filter[value] = true;
+    input_bloom_filter.insert(std::hash<int>{}(value));
   }
 
   auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
@@ -307,6 +347,79 @@ TEST_F(JoinHashStepsTest, BuildRespectsBloomFilter) {
   EXPECT_FALSE(hash_table->contains(18));
 }
 
+TEST_F(JoinHashStepsTest, PlanProbeRangesWithoutSkew) {
+  auto container = RadixContainer<int>(4);
+  for (auto partition_idx = size_t{0}; partition_idx < 4; ++partition_idx) {
+    if (partition_idx == 1) {
+      continue;
+    }
+
+    for (auto value = 0; value < 2'000; ++value) {
+      container[partition_idx].elements.push_back(PartitionedElement<int>{RowID{ChunkID{0}, ChunkOffset{0}}, value});
+    }
+  }
+
+  // One range per non-empty partition.
+  const auto probe_ranges = plan_probe_ranges(container, std::vector<std::optional<PosHashTable<int>>>{});
+  ASSERT_EQ(probe_ranges.size(), 3);
+  EXPECT_EQ(probe_ranges[0].partition_idx, 0);
+  EXPECT_EQ(probe_ranges[1].partition_idx, 2);
+  EXPECT_EQ(probe_ranges[2].partition_idx, 3);
+  for (const auto& probe_range : probe_ranges) {
+    EXPECT_EQ(probe_range.begin, 0);
+    EXPECT_EQ(probe_range.end, 2'000);
+  }
+}
+
+TEST_F(JoinHashStepsTest, PlanProbeRangesWithSkewedProbeSide) {
+  // Partition 1 contains a heavy hitter and is split into ranges of roughly the average partition size.
+  auto container = RadixContainer<int>(4);
+  for (auto partition_idx = size_t{0}; partition_idx < 4; ++partition_idx) {
+    const auto element_count = partition_idx == 1 ? 10'000 : 1'000;
+    for (auto value = 0; value < element_count; ++value) {
+      container[partition_idx].elements.push_back(PartitionedElement<int>{RowID{ChunkID{0}, ChunkOffset{0}}, value});
+    }
+  }
+
+  const auto probe_ranges = plan_probe_ranges(container, std::vector<std::optional<PosHashTable<int>>>{});
+  ASSERT_EQ(probe_ranges.size(), 6);
+  EXPECT_EQ(probe_ranges[0].partition_idx, 0);
+  EXPECT_EQ(probe_ranges[5].partition_idx, 3);
+  for (auto range_idx = size_t{1}; range_idx < 5; ++range_idx) {
+    EXPECT_EQ(probe_ranges[range_idx].partition_idx, 1);
+    EXPECT_EQ(probe_ranges[range_idx].begin, (range_idx - 1) * 2'500);
+    EXPECT_EQ(probe_ranges[range_idx].end, range_idx * 2'500);
+  }
+}
+
+TEST_F(JoinHashStepsTest, PlanProbeRangesWithSkewedBuildSide) {
+  // The build side of partition 0 contains a single value 1'000 times. Each probed value of that partition finds 1'000
+  // matches, so the partition is split although all probe partitions have the same size.
+  auto build_container = RadixContainer<int>(4);
+  auto probe_container = RadixContainer<int>(4);
+  for (auto partition_idx = size_t{0}; partition_idx < 4; ++partition_idx) {
+    for (auto value = 0; value < 1'000; ++value) {
+      const auto row_id = RowID{ChunkID{0}, ChunkOffset{static_cast<ChunkOffset::base_type>(value)}};
+      build_container[partition_idx].elements.push_back(
+          PartitionedElement<int>{row_id, partition_idx == 0 ? 0 : value});
+      probe_container[partition_idx].elements.push_back(PartitionedElement<int>{row_id, value});
+    }
+  }
+
+  const auto hash_tables = build<int, int>(build_container, JoinHashBuildMode::AllPositions, 2, BlockedBloomFilter{});
+  const auto probe_ranges = plan_probe_ranges(probe_container, hash_tables);
+  ASSERT_EQ(probe_ranges.size(), 5);
+  EXPECT_EQ(probe_ranges[0].partition_idx, 0);
+  EXPECT_EQ(probe_ranges[0].end, 500);
+  EXPECT_EQ(probe_ranges[1].partition_idx, 0);
+  EXPECT_EQ(probe_ranges[1].begin, 500);
+
+  // Semi and anti joins only check for existence, so skew on the build side does not matter.
+  const auto existence_hash_tables =
+      build<int, int>(build_container, JoinHashBuildMode::ExistenceOnly, 2, BlockedBloomFilter{});
+  EXPECT_EQ(plan_probe_ranges(probe_container, existence_hash_tables).size(), 4);
+}
+
 TEST_F(JoinHashStepsTest, ThrowWhenNoNullValuesArePassed) {
   if constexpr (!HYRISE_DEBUG) {
     GTEST_SKIP();
@@ -314,7 +427,7 @@ TEST_F(JoinHashStepsTest, ThrowWhenNoNullValuesArePassed) {
 
   auto radix_bit_count = size_t{0};
   auto histograms = std::vector<std::vector<size_t>>{};
-  BloomFilter bloom_filter;  // Ignored in this test
+  auto bloom_filter = BlockedBloomFilter{};  // Ignored in this test
 
   const auto materialized_without_null_handling = materialize_input<int, int, false>(
       _table_with_nulls_and_zeros->get_output(), ColumnID{0}, histograms, radix_bit_count, bloom_filter);
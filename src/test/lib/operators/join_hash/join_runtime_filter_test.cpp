@@ -0,0 +1,107 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "operators/join_hash.hpp"
+#include "operators/join_hash/join_runtime_filter.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class JoinRuntimeFilterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+    _source_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+    for (const auto& value : {AllTypeVariant{3}, AllTypeVariant{1}, NULL_VALUE, AllTypeVariant{5}}) {
+      _source_table->append({value});
+    }
+
+    _filtered_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10});
+    for (auto value = int32_t{0}; value < 7; ++value) {
+      _filtered_table->append({value});
+    }
+    _filtered_table->append({NULL_VALUE});
+  }
+
+  static std::shared_ptr<RowIDPosList> _all_positions(const ChunkID chunk_id, const ChunkOffset size) {
+    auto pos_list = std::make_shared<RowIDPosList>();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      pos_list->emplace_back(chunk_id, chunk_offset);
+    }
+    return pos_list;
+  }
+
+  std::shared_ptr<Table> _source_table;
+  std::shared_ptr<Table> _filtered_table;
+};
+
+TEST_F(JoinRuntimeFilterTest, ValueRange) {
+  const auto runtime_filter = JoinRuntimeFilter{*_source_table, ColumnID{0}};
+  EXPECT_EQ(runtime_filter.data_type(), DataType::Int);
+  ASSERT_TRUE(runtime_filter.value_range());
+  EXPECT_EQ(runtime_filter.value_range()->first, AllTypeVariant{1});
+  EXPECT_EQ(runtime_filter.value_range()->second, AllTypeVariant{5});
+  EXPECT_TRUE(runtime_filter.bloom_filter().is_active());
+
+  const auto empty_table = Table::create_dummy_table({{"a", DataType::Int, true}});
+  EXPECT_FALSE(JoinRuntimeFilter(*empty_table, ColumnID{0}).value_range());
+}
+
+TEST_F(JoinRuntimeFilterTest, FilterDataSegment) {
+  const auto runtime_filter = JoinRuntimeFilter{*_source_table, ColumnID{0}};
+  const auto& segment = *_filtered_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+
+  const auto matches = _all_positions(ChunkID{0}, ChunkOffset{8});
+  const auto filtered_matches = runtime_filter.filter(segment, matches);
+  const auto expected_matches =
+      RowIDPosList{{ChunkID{0}, ChunkOffset{1}}, {ChunkID{0}, ChunkOffset{3}}, {ChunkID{0}, ChunkOffset{5}}};
+  EXPECT_EQ(*filtered_matches, expected_matches);
+  EXPECT_EQ(runtime_filter.bloom_filter().probed_value_count(), 8);
+  EXPECT_EQ(runtime_filter.bloom_filter().filtered_value_count(), 5);
+
+  // Only the given positions are probed.
+  const auto subset = std::make_shared<RowIDPosList>(
+      RowIDPosList{{ChunkID{0}, ChunkOffset{0}}, {ChunkID{0}, ChunkOffset{5}}, {ChunkID{0}, ChunkOffset{6}}});
+  const auto expected_subset_matches = RowIDPosList{{ChunkID{0}, ChunkOffset{5}}};
+  EXPECT_EQ(*runtime_filter.filter(segment, subset), expected_subset_matches);
+}
+
+TEST_F(JoinRuntimeFilterTest, FilterReferenceSegment) {
+  const auto runtime_filter = JoinRuntimeFilter{*_source_table, ColumnID{0}};
+
+  // The reference segment contains the values 6, 5, ..., 0 of the filtered table.
+  auto referenced_positions = std::make_shared<RowIDPosList>();
+  for (auto chunk_offset = ChunkOffset{7}; chunk_offset > 0; --chunk_offset) {
+    referenced_positions->emplace_back(ChunkID{0}, chunk_offset - 1);
+  }
+  const auto segment = ReferenceSegment{_filtered_table, ColumnID{0}, referenced_positions};
+
+  // Matches reference the chunk of the reference segment (ChunkID 3 of some reference table).
+  const auto matches = std::make_shared<RowIDPosList>(
+      RowIDPosList{{ChunkID{3}, ChunkOffset{0}}, {ChunkID{3}, ChunkOffset{1}}, {ChunkID{3}, ChunkOffset{3}}});
+  const auto expected_matches = RowIDPosList{{ChunkID{3}, ChunkOffset{1}}, {ChunkID{3}, ChunkOffset{3}}};
+  EXPECT_EQ(*runtime_filter.filter(segment, matches), expected_matches);
+}
+
+TEST_F(JoinRuntimeFilterTest, JoinProvidesFilterOnceInputIsExecuted) {
+  const auto source = std::make_shared<TableWrapper>(_source_table);
+  const auto filtered = std::make_shared<TableWrapper>(_filtered_table);
+  const auto join = std::make_shared<JoinHash>(
+      filtered, source, JoinMode::Semi,
+      OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+  const auto reference = JoinRuntimeFilterReference{join, LQPInputSide::Right, ColumnID{0}};
+
+  EXPECT_FALSE(reference.runtime_filter());
+  source->execute();
+  const auto runtime_filter = reference.runtime_filter();
+  ASSERT_TRUE(runtime_filter);
+  EXPECT_EQ(runtime_filter->value_range()->second, AllTypeVariant{5});
+
+  // The filter is only created once.
+  EXPECT_EQ(reference.runtime_filter(), runtime_filter);
+}
+
+}  // namespace hyrise
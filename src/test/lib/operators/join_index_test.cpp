@@ -4,9 +4,12 @@
 #include <utility>
 #include <vector>
 
+#include "magic_enum.hpp"
+
 #include "base_test.hpp"
 
 #include "all_type_variant.hpp"
+#include "hyrise.hpp"
 #include "operators/join_index.hpp"
 #include "operators/join_verification.hpp"
 #include "operators/table_scan.hpp"
@@ -259,10 +262,10 @@ TEST_F(OperatorsJoinIndexTest, MultiJoinOnReferenceLeftIndexLeft) {
       scan_a, scan_b, JoinMode::Inner, OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
   join->execute();
 
-  // Referencing single chunk guarantee is not given since the left input of the index join is also an index join
-  // and the IndexSide is left. The execution of the index join does not provide single chunk reference guarantee.
+  // The left input of the index join is also an index join and the IndexSide is left. As the rows of scan_a are all
+  // stored in a single chunk, the output of the first join provides the single chunk reference guarantee for them.
   test_join_output(join, scan_c, {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals}, JoinMode::Inner, 1, true,
-                   IndexSide::Left, false);
+                   IndexSide::Left);
 }
 
 TEST_F(OperatorsJoinIndexTest, RightJoinPruneInputIsRefIndexInputIsDataIndexSideIsRight) {
@@ -274,4 +277,45 @@ TEST_F(OperatorsJoinIndexTest, RightJoinPruneInputIsRefIndexInputIsDataIndexSide
                    1, true);
 }
 
+TEST_F(OperatorsJoinIndexTest, ParallelJoinWithRepeatedProbeValues) {
+  // The probe side chunks are dictionary-encoded and contain each value (and NULL) several times, so the index ranges
+  // are looked up once per distinct value and reused. The chunks are joined in parallel jobs.
+  prepare_parallel_execution();
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  const auto probe_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10});
+  for (auto row = int32_t{0}; row < 45; ++row) {
+    probe_table->append({row % 6 == 0 ? NULL_VALUE : AllTypeVariant{row % 9}});
+  }
+  probe_table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(probe_table, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  const auto index_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{4});
+  for (auto row = int32_t{0}; row < 14; ++row) {
+    index_table->append({row == 5 ? NULL_VALUE : AllTypeVariant{row % 7}});
+  }
+  index_table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(index_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto index_chunk_count = index_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < index_chunk_count; ++chunk_id) {
+    index_table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+
+  const auto probe_input = std::make_shared<TableWrapper>(probe_table);
+  const auto index_input = std::make_shared<TableWrapper>(index_table);
+  probe_input->execute();
+  index_input->execute();
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::FullOuter, JoinMode::Semi,
+                          JoinMode::AntiNullAsFalse, JoinMode::AntiNullAsTrue}) {
+    for (const auto predicate_condition : {PredicateCondition::Equals, PredicateCondition::LessThan}) {
+      SCOPED_TRACE(std::string{magic_enum::enum_name(mode)} + " " +
+                   std::string{magic_enum::enum_name(predicate_condition)});
+      const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, predicate_condition};
+      test_join_output(probe_input, index_input, primary_predicate, mode, 1, true, IndexSide::Right);
+      test_join_output(index_input, probe_input, primary_predicate, mode, 1, true, IndexSide::Left);
+    }
+  }
+}
+
 }  // namespace hyrise
@@ -117,4 +117,84 @@ TEST_F(OperatorsJoinSortMergeTest, SetSortedFlagOnJoinColumns) {
   }
 }
 
+TEST_F(OperatorsJoinSortMergeTest, SemiAndAntiJoins) {
+  const auto create_table = [](const std::vector<AllTypeVariant>& values) {
+    const auto table =
+        std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, ChunkOffset{3});
+    for (const auto& value : values) {
+      table->append({value});
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  // The right input is smaller than the left input, so the Bloom filter removes the left rows without a join partner
+  // during the materialization.
+  const auto left_input = create_table({1, 2, NULL_VALUE, 3, 4, 5, 6, 2, NULL_VALUE, 7});
+  const auto right_input = create_table({2, 4, 4, 9});
+  const auto right_input_with_null = create_table({2, NULL_VALUE});
+  const auto empty_right_input = create_table({});
+
+  const auto join = [&](const std::shared_ptr<AbstractOperator>& right, const JoinMode mode) {
+    const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+    const auto join_operator = std::make_shared<JoinSortMerge>(left_input, right, mode, primary_predicate);
+    join_operator->execute();
+    return join_operator->get_output();
+  };
+
+  const auto semi_result = join(right_input, JoinMode::Semi);
+  EXPECT_TABLE_EQ_UNORDERED(semi_result, create_table({2, 4, 2})->get_output());
+  const auto chunk_count = semi_result->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto expected_sorted_columns = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}};
+    EXPECT_EQ(semi_result->get_chunk(chunk_id)->individually_sorted_by(), expected_sorted_columns);
+  }
+
+  EXPECT_TABLE_EQ_UNORDERED(join(right_input, JoinMode::AntiNullAsFalse),
+                            create_table({1, NULL_VALUE, 3, 5, 6, NULL_VALUE, 7})->get_output());
+  EXPECT_TABLE_EQ_UNORDERED(join(right_input, JoinMode::AntiNullAsTrue), create_table({1, 3, 5, 6, 7})->get_output());
+
+  // `x NOT IN (2, NULL)` is never TRUE, but `NULL NOT IN <empty list>` is.
+  EXPECT_EQ(join(right_input_with_null, JoinMode::AntiNullAsTrue)->row_count(), 0);
+  EXPECT_TABLE_EQ_UNORDERED(join(empty_right_input, JoinMode::AntiNullAsTrue), left_input->get_output());
+  EXPECT_TABLE_EQ_UNORDERED(join(empty_right_input, JoinMode::AntiNullAsFalse), left_input->get_output());
+  EXPECT_EQ(join(empty_right_input, JoinMode::Semi)->row_count(), 0);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, BloomFilterRemovesRowsWithoutPartner) {
+  const auto create_table = [](const int32_t row_count, const int32_t step) {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1000});
+    for (auto value = int32_t{0}; value < row_count * step; value += step) {
+      table->append({value});
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  // Only every 200th left row has a join partner.
+  const auto left_input = create_table(20'000, 1);
+  const auto right_input = create_table(100, 200);
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Semi, JoinMode::AntiNullAsFalse}) {
+    SCOPED_TRACE(mode);
+    const auto join_operator = std::make_shared<JoinSortMerge>(left_input, right_input, mode, primary_predicate);
+    join_operator->execute();
+    EXPECT_EQ(join_operator->get_output()->row_count(), mode == JoinMode::AntiNullAsFalse ? 19'900u : 100u);
+
+    // Rows with a join partner are never filtered. Apart from false positives, all other rows are filtered.
+    const auto& performance_data =
+        dynamic_cast<const JoinSortMerge::PerformanceData&>(*join_operator->performance_data);
+    EXPECT_EQ(performance_data.bloom_filter_probed_value_count, 20'000u);
+    EXPECT_LE(performance_data.bloom_filter_filtered_value_count, 19'900u);
+    EXPECT_GT(performance_data.bloom_filter_filtered_value_count, 19'000u);
+    EXPECT_FALSE(performance_data.bloom_filter_disabled);
+  }
+}
+
 }  // namespace hyrise
@@ -0,0 +1,93 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "operators/normalized_sort_keys.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class NormalizedSortKeysTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, true}, {"b", DataType::String, false}, {"c", DataType::Double, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3});
+    _table->append({1, pmr_string{"b"}, 0.5});                     // row 0
+    _table->append({-1, pmr_string{"a"}, -0.5});                   // row 1
+    _table->append({NULL_VALUE, pmr_string{"c"}, 1.0});            // row 2
+    _table->append({1, pmr_string{"a"}, -0.0});                    // row 3
+    _table->append({1, pmr_string{"long string 2"}, 2.0});         // row 4
+    _table->append({1, pmr_string{"long string 1"}, 0.0});         // row 5
+    _table->append({-1, pmr_string{"a"}, -0.5});                   // row 6
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(NormalizedSortKeysTest, KeyLayout) {
+  const auto keys = NormalizedSortKeys{_table, {SortColumnDefinition{ColumnID{0}, SortMode::Ascending},
+                                                SortColumnDefinition{ColumnID{1}, SortMode::Descending},
+                                                SortColumnDefinition{ColumnID{2}, SortMode::Ascending}}};
+  EXPECT_EQ(keys.row_count(), 7);
+
+  // NULL flag and four bytes for a, the string prefix and its length for b, and eight bytes for c.
+  EXPECT_EQ(keys.key_width(), 1 + 4 + NormalizedSortKeys::STRING_PREFIX_LENGTH + 1 + 8);
+
+  // Rows are numbered in the order of the chunks.
+  EXPECT_EQ(keys.row_id(0), RowID(ChunkID{0}, ChunkOffset{0}));
+  EXPECT_EQ(keys.row_id(4), RowID(ChunkID{1}, ChunkOffset{1}));
+  EXPECT_EQ(keys.row_id(6), RowID(ChunkID{2}, ChunkOffset{0}));
+
+  // Integers are stored big-endian with a flipped sign bit: -1 becomes 0x7FFFFFFF.
+  const auto* key = keys.key(1);
+  EXPECT_EQ(key[0], 1);
+  EXPECT_EQ(key[1], 0x7F);
+  EXPECT_EQ(key[4], 0xFF);
+
+  // NULLs have a zero NULL flag and zero value bytes.
+  key = keys.key(2);
+  EXPECT_EQ(key[0], 0);
+  EXPECT_EQ(key[1], 0);
+}
+
+TEST_F(NormalizedSortKeysTest, Compare) {
+  const auto keys = NormalizedSortKeys{_table, {SortColumnDefinition{ColumnID{0}, SortMode::Ascending},
+                                                SortColumnDefinition{ColumnID{1}, SortMode::Descending},
+                                                SortColumnDefinition{ColumnID{2}, SortMode::Ascending}}};
+
+  // NULLs come first.
+  EXPECT_LT(keys.compare(2, 1), 0);
+  EXPECT_GT(keys.compare(1, 2), 0);
+
+  // Equal rows.
+  EXPECT_EQ(keys.compare(1, 6), 0);
+  EXPECT_EQ(keys.compare(0, 0), 0);
+
+  // a ascending.
+  EXPECT_LT(keys.compare(1, 0), 0);
+
+  // b descending.
+  EXPECT_LT(keys.compare(0, 3), 0);
+
+  // Strings longer than the prefix are compared completely. The strings decide before the subsequent column c, which
+  // would order the rows the other way around.
+  EXPECT_LT(keys.compare(4, 5), 0);
+  EXPECT_GT(keys.compare(5, 4), 0);
+  EXPECT_LT(keys.compare(4, 0), 0);
+}
+
+TEST_F(NormalizedSortKeysTest, FloatingPointValues) {
+  const auto keys = NormalizedSortKeys{_table, {SortColumnDefinition{ColumnID{2}, SortMode::Descending},
+                                                SortColumnDefinition{ColumnID{0}, SortMode::Ascending}}};
+
+  // -0.0 and 0.0 are equal.
+  EXPECT_EQ(keys.compare(3, 5), 0);
+
+  // c descending.
+  EXPECT_LT(keys.compare(4, 2), 0);
+  EXPECT_LT(keys.compare(0, 3), 0);
+  EXPECT_LT(keys.compare(3, 1), 0);
+}
+
+}  // namespace hyrise
@@ -214,6 +214,10 @@ TEST_F(OperatorPerformanceDataTest, JoinHashBloomFilterReductions) {
   EXPECT_EQ(inner_perf.hash_tables_distinct_value_count, 2ul);     // values 2,6
   EXPECT_EQ(inner_perf.hash_tables_position_count, 3ul);           // positions 1,2,3
   EXPECT_TRUE(inner_perf.left_input_is_build_side);
+  // All probe side values are probed during materialization, all build side values in build().
+  EXPECT_EQ(inner_perf.bloom_filter_probed_value_count, table_b->row_count() + table_a->row_count());
+  EXPECT_EQ(inner_perf.bloom_filter_filtered_value_count, 11ul);  // 10 probe side values and value 7 on the build side
+  EXPECT_FALSE(inner_perf.bloom_filter_disabled);
 
   // Semi join case: We check that no positions are stored (see explanation for "AllPositions" mode in hash map).
   // Further, we force the larger input to be the build side. As we first materialize the smaller side (i.e., the probe
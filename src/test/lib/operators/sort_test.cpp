@@ -1,8 +1,12 @@
 #include "base_test.hpp"
 
 #include "operators/join_hash.hpp"
+#include "operators/limit.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "storage/segment_iterate.hpp"
 
 namespace hyrise {
 
@@ -235,4 +239,150 @@ TEST_F(SortTest, InputReferencesDifferentColumns) {
   EXPECT_EQ(sort.get_output()->type(), TableType::Data);
 }
 
+TEST_F(SortTest, ParallelSort) {
+  // Inputs with more than Sort::ROWS_PER_JOB rows are sorted in multiple runs, which are merged in parallel. Check that
+  // the result is still stable and that NULLs come first.
+  prepare_parallel_execution();
+
+  // The input is sorted in three runs, the last of which is much shorter than the others.
+  const auto row_count = 2 * Sort::ROWS_PER_JOB + 1'000;
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10'000});
+  auto expected_rows = std::vector<std::pair<std::optional<int32_t>, int32_t>>{};
+  for (auto row = int32_t{0}; row < static_cast<int32_t>(row_count); ++row) {
+    const auto value = row % 100 == 0 ? std::nullopt : std::optional<int32_t>{(row * 7'919) % 1'000};
+    table->append({value ? AllTypeVariant{*value} : NULL_VALUE, row});
+    expected_rows.emplace_back(value, row);
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto get_rows = [](const auto& result_table) {
+    auto rows = std::vector<std::pair<std::optional<int32_t>, int32_t>>{};
+    const auto chunk_count = result_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& chunk = result_table->get_chunk(chunk_id);
+      EXPECT_LE(chunk->size(), 1'000);
+      segment_iterate<int32_t>(*chunk->get_segment(ColumnID{0}), [&](const auto& position) {
+        rows.emplace_back(position.is_null() ? std::nullopt : std::optional<int32_t>{position.value()}, 0);
+      });
+      auto row_idx = rows.size() - chunk->size();
+      segment_iterate<int32_t>(*chunk->get_segment(ColumnID{1}), [&](const auto& position) {
+        rows[row_idx++].second = position.value();
+      });
+    }
+    return rows;
+  };
+
+  // ORDER BY a ASC, b DESC. std::nullopt compares less than any value.
+  std::stable_sort(expected_rows.begin(), expected_rows.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second > rhs.second);
+  });
+
+  const auto sort_definitions = std::vector<SortColumnDefinition>{
+      SortColumnDefinition{ColumnID{0}, SortMode::Ascending}, SortColumnDefinition{ColumnID{1}, SortMode::Descending}};
+  for (const auto force_materialization : {Sort::ForceMaterialization::No, Sort::ForceMaterialization::Yes}) {
+    const auto sort =
+        std::make_shared<Sort>(table_wrapper, sort_definitions, ChunkOffset{1'000}, force_materialization);
+    sort->execute();
+    EXPECT_EQ(get_rows(sort->get_output()), expected_rows);
+  }
+
+  // Sort the (reference) output of a sort again, which needs to resolve the indirection.
+  const auto sort_by_b = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{1}, SortMode::Descending}});
+  sort_by_b->execute();
+  const auto sort_by_a = std::make_shared<Sort>(
+      sort_by_b, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, SortMode::Ascending}},
+      ChunkOffset{1'000});
+  sort_by_a->execute();
+  EXPECT_EQ(sort_by_a->get_output()->type(), TableType::References);
+  EXPECT_EQ(get_rows(sort_by_a->get_output()), expected_rows);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(SortTest, TopK) {
+  // The output of a sort with top_k equals the first top_k rows of the complete sort, including ties and NULLs.
+  const auto sort_definitions_variants = std::vector<std::vector<SortColumnDefinition>>{
+      {SortColumnDefinition{ColumnID{0}, SortMode::Descending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Descending}},
+      {SortColumnDefinition{ColumnID{2}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Descending},
+       SortColumnDefinition{ColumnID{0}, SortMode::Ascending}}};
+
+  // Besides the data table, use a reference table whose row order differs from the order of the stored table.
+  const auto reference_input = std::make_shared<Sort>(
+      input_table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{2}, SortMode::Descending}},
+      ChunkOffset{15});
+  reference_input->execute();
+
+  for (const auto& input : std::vector<std::shared_ptr<AbstractOperator>>{input_table_wrapper, reference_input}) {
+    for (const auto& sort_definitions : sort_definitions_variants) {
+      const auto sort = std::make_shared<Sort>(input, sort_definitions);
+      sort->execute();
+
+      for (const auto top_k : {size_t{0}, size_t{1}, size_t{7}, size_t{30}, size_t{100}}) {
+        const auto limit = std::make_shared<Limit>(sort, value_(static_cast<int64_t>(top_k)));
+        limit->execute();
+
+        for (const auto force_materialization : {Sort::ForceMaterialization::No, Sort::ForceMaterialization::Yes}) {
+          const auto top_k_sort =
+              std::make_shared<Sort>(input, sort_definitions, ChunkOffset{5}, force_materialization, top_k);
+          top_k_sort->execute();
+          EXPECT_TABLE_EQ_ORDERED(top_k_sort->get_output(), limit->get_output());
+        }
+      }
+    }
+  }
+}
+
+TEST_F(SortTest, TopKSkipsChunksUsingPruningStatistics) {
+  // Chunk i contains the values 10 * i to 10 * i + 9, except for the last chunk, which also contains -1.
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, ChunkOffset{10});
+  for (auto value = int32_t{0}; value < 39; ++value) {
+    table->append({value});
+  }
+  table->append({int32_t{-1}});
+
+  const auto set_min_max = [&](const ChunkID chunk_id, const int32_t min, const int32_t max) {
+    const auto statistics = std::make_shared<AttributeStatistics<int32_t>>();
+    statistics->set_statistics_object(std::make_shared<MinMaxFilter<int32_t>>(min, max));
+    table->get_chunk(chunk_id)->set_pruning_statistics(ChunkPruningStatistics{statistics});
+  };
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto top_3 = [&]() {
+    const auto sort =
+        std::make_shared<Sort>(table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}},
+                               Chunk::DEFAULT_SIZE, Sort::ForceMaterialization::No, 3);
+    sort->execute();
+    auto values = std::vector<int32_t>{};
+    segment_iterate<int32_t>(*sort->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0}),
+                             [&](const auto& position) {
+                               values.emplace_back(position.value());
+                             });
+    return values;
+  };
+
+  // Without pruning statistics, all chunks are scanned.
+  EXPECT_EQ(top_3(), std::vector<int32_t>({-1, 0, 1}));
+
+  // The statistics of the last chunk pretend that its values are at least 30. Once the heap contains the values 0, 1,
+  // and 2, the chunk is skipped, so -1 is not found. Correct statistics would, of course, include -1.
+  for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{3}; ++chunk_id) {
+    const auto min = 10 * static_cast<int32_t>(chunk_id);
+    set_min_max(chunk_id, min, min + 9);
+  }
+  set_min_max(ChunkID{3}, 30, 39);
+  EXPECT_EQ(top_3(), std::vector<int32_t>({0, 1, 2}));
+
+  set_min_max(ChunkID{3}, -1, 39);
+  EXPECT_EQ(top_3(), std::vector<int32_t>({-1, 0, 1}));
+}
+
 }  // namespace hyrise
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -24,6 +25,7 @@
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -251,6 +253,51 @@ class OperatorsTableScanTest : public BaseTest, public ::testing::WithParamInter
     }
   }
 
+  // Creates a table with a nullable int column "a" from `value_of_row`, encodes it with _encoding_type and both vector
+  // compression types, and checks that the predicates yield the same rows as on the unencoded table. If given,
+  // `check_encoded_table` is called with each encoded table for further checks.
+  void compare_scans_on_encoded_tables(
+      const ChunkOffset chunk_size, const int32_t row_count, const std::function<AllTypeVariant(int32_t)>& value_of_row,
+      const std::vector<std::shared_ptr<AbstractExpression>>& predicates,
+      const std::function<void(const std::shared_ptr<TableWrapper>&)>& check_encoded_table = {}) const {
+    const auto create_table = [&]() {
+      const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                                 chunk_size);
+      for (auto row = int32_t{0}; row < row_count; ++row) {
+        table->append({value_of_row(row)});
+      }
+      table->last_chunk()->finalize();
+      return table;
+    };
+
+    const auto unencoded_table = std::make_shared<TableWrapper>(create_table());
+    unencoded_table->execute();
+
+    for (const auto vector_compression_type :
+         {VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking}) {
+      SCOPED_TRACE(vector_compression_type);
+      const auto table = create_table();
+      ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type, vector_compression_type});
+      const auto encoded_table = std::make_shared<TableWrapper>(table);
+      encoded_table->never_clear_output();
+      encoded_table->execute();
+
+      for (const auto& predicate : predicates) {
+        SCOPED_TRACE(predicate->as_column_name());
+        const auto expected_scan = std::make_shared<TableScan>(unencoded_table, predicate);
+        expected_scan->execute();
+        const auto scan = std::make_shared<TableScan>(encoded_table, predicate);
+        scan->execute();
+
+        EXPECT_TABLE_EQ_ORDERED(scan->get_output(), expected_scan->get_output());
+      }
+
+      if (check_encoded_table) {
+        check_encoded_table(encoded_table);
+      }
+    }
+  }
+
  protected:
   EncodingType _encoding_type;
   std::shared_ptr<TableWrapper> _int_int_compressed;
@@ -644,6 +691,56 @@ TEST_P(OperatorsTableScanTest, ScanOnWideDictionarySegment) {
   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
 }
 
+TEST_P(OperatorsTableScanTest, ScanOnCompressedAttributeVectors) {
+  // Dictionary segments without a position filter are scanned on their compressed attribute vectors in blocks of 64
+  // entries. The chunk sizes are no multiples of 64.
+  if (_encoding_type != EncodingType::Dictionary) {
+    GTEST_SKIP();
+  }
+
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  compare_scans_on_encoded_tables(
+      ChunkOffset{300}, 1'000, [](const auto row) { return row % 11 == 0 ? NULL_VALUE : AllTypeVariant{row % 37}; },
+      expression_vector(equals_(column, 20), not_equals_(column, 20), less_than_(column, 20),
+                        less_than_equals_(column, 20), greater_than_(column, 20), greater_than_equals_(column, 20),
+                        equals_(column, 100), between_inclusive_(column, 5, 30), between_exclusive_(column, 5, 30)));
+}
+
+TEST_P(OperatorsTableScanTest, ScanOnRunLengthAndFrameOfReferenceSegments) {
+  // Run-length segments are scanned run by run, frame-of-reference segments block by block on their offsets. Values
+  // form runs of 16 rows, and the value range of each frame-of-reference block (2048 rows) differs.
+  if (_encoding_type != EncodingType::RunLength && _encoding_type != EncodingType::FrameOfReference) {
+    GTEST_SKIP();
+  }
+
+  const auto value_of_row = [](const auto row) {
+    const auto value = (row % 5'000) / 2'048 * 1'000 + (row / 16) % 40;
+    return row % 97 == 0 ? NULL_VALUE : AllTypeVariant{value};
+  };
+
+  // No frame-of-reference block can contain 5'000, so all of them are skipped.
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto check_early_out = [&](const std::shared_ptr<TableWrapper>& encoded_table) {
+    if (_encoding_type != EncodingType::FrameOfReference) {
+      return;
+    }
+
+    const auto scan = std::make_shared<TableScan>(encoded_table, equals_(column, 5'000));
+    scan->execute();
+    const auto& performance_data = dynamic_cast<TableScan::PerformanceData&>(*scan->performance_data);
+    EXPECT_EQ(performance_data.num_chunks_with_early_out, 2);
+  };
+
+  compare_scans_on_encoded_tables(
+      ChunkOffset{5'000}, 10'000, value_of_row,
+      expression_vector(equals_(column, 1'020), not_equals_(column, 1'020), less_than_(column, 1'000),
+                        less_than_equals_(column, 1'000), greater_than_(column, 2'010),
+                        greater_than_equals_(column, 2'010), greater_than_(column, -1), equals_(column, 5'000),
+                        between_inclusive_(column, 1'005, 2'030), between_exclusive_(column, 1'005, 2'030),
+                        between_upper_exclusive_(column, 0, 1'000)),
+      check_early_out);
+}
+
 TEST_P(OperatorsTableScanTest, OperatorName) {
   auto scan_1 = std::make_shared<TableScan>(
       get_int_float_op(), greater_than_(get_column_expression(get_int_float_op(), ColumnID{0}), 12345));
@@ -1302,4 +1399,52 @@ TEST_P(OperatorsTableScanTest, SortedFlagMultipleChunksReferenced) {
   ASSERT_TRUE(chunk_sorted_by.empty());
 }
 
+TEST_P(OperatorsTableScanTest, DenseMatchesAsBitmap) {
+  // Chunks where most rows match are output as a BitmapPosList, sparse matches as a RowIDPosList.
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto data_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100});
+  for (auto value = int32_t{0}; value < 200; ++value) {
+    data_table->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(data_table, SegmentEncodingSpec{_encoding_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(data_table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto get_pos_list = [](const auto& table, const ChunkID chunk_id) {
+    const auto& segment = static_cast<const ReferenceSegment&>(*table->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    return segment.pos_list();
+  };
+
+  // 70 out of 100 rows of the first chunk and 5 rows of the second chunk match.
+  const auto dense_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(column_a, 30));
+  dense_scan->never_clear_output();
+  const auto mixed_scan = std::make_shared<TableScan>(
+      table_wrapper, or_(less_than_(column_a, 70), between_inclusive_(column_a, 100, 104)));
+  mixed_scan->execute();
+  const auto& mixed_output = mixed_scan->get_output();
+  ASSERT_EQ(mixed_output->chunk_count(), 2);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(get_pos_list(mixed_output, ChunkID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RowIDPosList>(get_pos_list(mixed_output, ChunkID{1})));
+  EXPECT_EQ(mixed_output->row_count(), 75);
+  for (auto row = size_t{0}; row < 70; ++row) {
+    EXPECT_EQ(mixed_output->get_value<int32_t>(ColumnID{0}, row), static_cast<int32_t>(row));
+  }
+
+  // A chained scan on a bitmap keeps dense matches as a bitmap of the referenced chunk.
+  dense_scan->execute();
+  ASSERT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(get_pos_list(dense_scan->get_output(), ChunkID{0})));
+  const auto chained_scan = std::make_shared<TableScan>(dense_scan, less_than_(column_a, 90));
+  chained_scan->execute();
+  const auto& chained_output = chained_scan->get_output();
+  ASSERT_EQ(chained_output->chunk_count(), 1);
+  const auto chained_pos_list = get_pos_list(chained_output, ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(chained_pos_list));
+  EXPECT_EQ(chained_pos_list->size(), 60);
+  EXPECT_EQ((*chained_pos_list)[0], (RowID{ChunkID{0}, ChunkOffset{30}}));
+  EXPECT_EQ((*chained_pos_list)[59], (RowID{ChunkID{0}, ChunkOffset{89}}));
+}
+
 }  // namespace hyrise
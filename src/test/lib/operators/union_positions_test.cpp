@@ -11,6 +11,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_positions.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 
 namespace hyrise {
@@ -341,4 +342,41 @@ TEST_F(UnionPositionsTest, SameColumnsDifferentTables) {
   EXPECT_THROW(union_positions_op->execute(), std::logic_error);
 }
 
+TEST_F(UnionPositionsTest, UniteBitmaps) {
+  /**
+   * If both inputs reference single chunks in ascending order, their positions are united as bitmaps. The result has
+   * the same rows in the same order as the sort-based union.
+   */
+  const auto data_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, ChunkOffset{100});
+  for (auto value = int32_t{0}; value < 200; ++value) {
+    data_table->append({value});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(data_table);
+
+  // Chunk 0: 80 matches (bitmap) and 10 matches. Chunk 1: 5 matches and 100 matches (entire chunk).
+  const auto& column_a = _int_column_0_non_nullable;
+  const auto table_scan_a_op = std::make_shared<TableScan>(
+      table_wrapper, or_(less_than_(column_a, 80), between_inclusive_(column_a, 100, 104)));
+  const auto table_scan_b_op = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(column_a, 90));
+  const auto union_positions_op = std::make_shared<UnionPositions>(table_scan_a_op, table_scan_b_op);
+  execute_all({table_wrapper, table_scan_a_op, table_scan_b_op, union_positions_op});
+
+  const auto& output = union_positions_op->get_output();
+  ASSERT_EQ(output->chunk_count(), 2);
+  EXPECT_EQ(output->row_count(), 190);
+  for (auto row = size_t{0}; row < 190; ++row) {
+    const auto expected_value = static_cast<int32_t>(row < 80 ? row : row + 10);
+    EXPECT_EQ(output->get_value<int32_t>(ColumnID{0}, row), expected_value);
+  }
+
+  // The bitmaps cover the entire referenced chunks, even if an input's last position is not the chunk's last row.
+  for (const auto chunk_id : {ChunkID{0}, ChunkID{1}}) {
+    const auto& segment = static_cast<const ReferenceSegment&>(*output->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    const auto bitmap = std::dynamic_pointer_cast<const BitmapPosList>(segment.pos_list());
+    ASSERT_TRUE(bitmap);
+    EXPECT_EQ(bitmap->chunk_size(), 100);
+  }
+}
+
 }  // namespace hyrise
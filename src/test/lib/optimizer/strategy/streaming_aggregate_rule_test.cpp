@@ -0,0 +1,143 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/streaming_aggregate_rule.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class StreamingAggregateRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node_a = MockNode::make(
+        MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}, {DataType::Int, "c"}}, "t_a");
+    a = node_a->get_column("a");
+    b = node_a->get_column("b");
+    c = node_a->get_column("c");
+
+    node_b = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "x"}}, "t_b");
+    x = node_b->get_column("x");
+
+    rule = std::make_shared<StreamingAggregateRule>();
+  }
+
+  std::shared_ptr<SortNode> make_sort_node(const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+                                           const std::shared_ptr<AbstractLQPNode>& input) const {
+    return SortNode::make(expressions, std::vector<SortMode>(expressions.size(), SortMode::Ascending), input);
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b;
+  std::shared_ptr<LQPColumnExpression> a, b, c, x;
+  std::shared_ptr<StreamingAggregateRule> rule;
+};
+
+TEST_F(StreamingAggregateRuleTest, SortedByGroupByColumn) {
+  // clang-format off
+  const auto aggregate_node =
+  AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+    PredicateNode::make(greater_than_(b, 5),
+      ValidateNode::make(
+        ProjectionNode::make(expression_vector(a, b),
+          make_sort_node(expression_vector(a), node_a)))));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, aggregate_node);
+
+  EXPECT_EQ(actual_lqp, aggregate_node);
+  EXPECT_TRUE(aggregate_node->input_is_sorted);
+}
+
+TEST_F(StreamingAggregateRuleTest, SortedByGroupByColumnsInDifferentOrder) {
+  // The rows of each group are consecutive if the input is sorted by all group-by columns first, in any order.
+  const auto aggregate_node = AggregateNode::make(expression_vector(b, a), expression_vector(sum_(c)),
+                                                  make_sort_node(expression_vector(a, b, c), node_a));
+
+  apply_rule(rule, aggregate_node);
+
+  EXPECT_TRUE(aggregate_node->input_is_sorted);
+}
+
+TEST_F(StreamingAggregateRuleTest, NotSortedByAllGroupByColumns) {
+  const auto aggregate_node_a =
+      AggregateNode::make(expression_vector(a, b), expression_vector(sum_(c)),
+                          make_sort_node(expression_vector(a), node_a));
+  const auto aggregate_node_b =
+      AggregateNode::make(expression_vector(a, b), expression_vector(sum_(c)),
+                          make_sort_node(expression_vector(a, c), node_a));
+
+  apply_rule(rule, aggregate_node_a);
+  apply_rule(rule, aggregate_node_b);
+
+  EXPECT_FALSE(aggregate_node_a->input_is_sorted);
+  EXPECT_FALSE(aggregate_node_b->input_is_sorted);
+}
+
+TEST_F(StreamingAggregateRuleTest, SortedByOtherColumnFirst) {
+  const auto aggregate_node =
+      AggregateNode::make(expression_vector(a), expression_vector(sum_(c)),
+                          make_sort_node(expression_vector(b, a), node_a));
+
+  apply_rule(rule, aggregate_node);
+
+  EXPECT_FALSE(aggregate_node->input_is_sorted);
+}
+
+TEST_F(StreamingAggregateRuleTest, SortedByOrderingColumnOfOrderDependency) {
+  // Sorting by a also sorts by b if the OD [a] |-> [b] holds.
+  node_a->set_order_constraints({TableOrderConstraint{{a->original_column_id}, {b->original_column_id}}});
+
+  const auto aggregate_node_b =
+      AggregateNode::make(expression_vector(b), expression_vector(sum_(c)),
+                          make_sort_node(expression_vector(a), node_a));
+  const auto aggregate_node_c =
+      AggregateNode::make(expression_vector(c), expression_vector(sum_(b)),
+                          make_sort_node(expression_vector(a), node_a));
+
+  apply_rule(rule, aggregate_node_b);
+  apply_rule(rule, aggregate_node_c);
+
+  EXPECT_TRUE(aggregate_node_b->input_is_sorted);
+  EXPECT_FALSE(aggregate_node_c->input_is_sorted);
+}
+
+TEST_F(StreamingAggregateRuleTest, NodesNotPreservingOrder) {
+  // Joins and index scans do not forward the rows of their input in the same order.
+  // clang-format off
+  const auto aggregate_node_join =
+  AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+    JoinNode::make(JoinMode::Inner, equals_(a, x),
+      make_sort_node(expression_vector(a), node_a),
+      node_b));
+  // clang-format on
+
+  const auto index_scan_node = PredicateNode::make(greater_than_(a, 5), make_sort_node(expression_vector(a), node_a));
+  index_scan_node->scan_type = ScanType::IndexScan;
+  const auto aggregate_node_index_scan =
+      AggregateNode::make(expression_vector(a), expression_vector(sum_(b)), index_scan_node);
+
+  apply_rule(rule, aggregate_node_join);
+  apply_rule(rule, aggregate_node_index_scan);
+
+  EXPECT_FALSE(aggregate_node_join->input_is_sorted);
+  EXPECT_FALSE(aggregate_node_index_scan->input_is_sorted);
+}
+
+TEST_F(StreamingAggregateRuleTest, NoGroupBy) {
+  const auto aggregate_node =
+      AggregateNode::make(expression_vector(), expression_vector(sum_(b)),
+                          make_sort_node(expression_vector(a), node_a));
+
+  apply_rule(rule, aggregate_node);
+
+  EXPECT_FALSE(aggregate_node->input_is_sorted);
+}
+
+}  // namespace hyrise
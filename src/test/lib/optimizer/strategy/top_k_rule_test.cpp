@@ -0,0 +1,93 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "optimizer/strategy/top_k_rule.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class TopKRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}});
+    a = node_a->get_column("a");
+    b = node_a->get_column("b");
+
+    rule = std::make_shared<TopKRule>();
+  }
+
+  std::shared_ptr<MockNode> node_a;
+  std::shared_ptr<LQPColumnExpression> a, b;
+  std::shared_ptr<TopKRule> rule;
+};
+
+TEST_F(TopKRuleTest, SortFollowedByLimit) {
+  const auto sort_node = SortNode::make(expression_vector(a, b),
+                                        std::vector<SortMode>{SortMode::Descending, SortMode::Ascending}, node_a);
+  const auto input_lqp = LimitNode::make(value_(10), sort_node);
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_EQ(actual_lqp, input_lqp);
+  EXPECT_EQ(actual_lqp->left_input(), sort_node);
+  EXPECT_EQ(sort_node->top_k, size_t{10});
+}
+
+TEST_F(TopKRuleTest, LongLimit) {
+  const auto sort_node = SortNode::make(expression_vector(a), std::vector<SortMode>{SortMode::Ascending}, node_a);
+  const auto input_lqp = LimitNode::make(value_(int64_t{3'000'000'000}), sort_node);
+
+  apply_rule(rule, input_lqp);
+
+  EXPECT_EQ(sort_node->top_k, size_t{3'000'000'000});
+}
+
+TEST_F(TopKRuleTest, NoConstantLimit) {
+  // The row count of a prepared statement's parameter is unknown during optimization.
+  const auto sort_node = SortNode::make(expression_vector(a), std::vector<SortMode>{SortMode::Ascending}, node_a);
+  const auto input_lqp = LimitNode::make(placeholder_(ParameterID{0}), sort_node);
+
+  apply_rule(rule, input_lqp);
+
+  EXPECT_FALSE(sort_node->top_k);
+}
+
+TEST_F(TopKRuleTest, NoSortBelowLimit) {
+  const auto sort_node = SortNode::make(expression_vector(a), std::vector<SortMode>{SortMode::Ascending}, node_a);
+
+  // clang-format off
+  const auto input_lqp =
+  LimitNode::make(value_(10),
+    ProjectionNode::make(expression_vector(a),
+      sort_node));
+  // clang-format on
+
+  apply_rule(rule, input_lqp);
+
+  EXPECT_FALSE(sort_node->top_k);
+}
+
+TEST_F(TopKRuleTest, SortWithMultipleOutputs) {
+  // The second consumer of the SortNode needs all rows.
+  const auto sort_node = SortNode::make(expression_vector(a), std::vector<SortMode>{SortMode::Ascending}, node_a);
+
+  // clang-format off
+  const auto input_lqp =
+  UnionNode::make(SetOperationMode::All,
+    LimitNode::make(value_(10),
+      sort_node),
+    sort_node);
+  // clang-format on
+
+  apply_rule(rule, input_lqp);
+
+  EXPECT_FALSE(sort_node->top_k);
+}
+
+}  // namespace hyrise
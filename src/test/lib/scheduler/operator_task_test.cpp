@@ -311,6 +311,32 @@ TEST_F(OperatorTaskTest, DoNotLinkPrunableSubqueriesWithCycles) {
   EXPECT_EQ(projection_task->successors().front(), table_scan->get_or_create_operator_task());
 }
 
+TEST_F(OperatorTaskTest, LinkRuntimeFilters) {
+  // Add the task of the join input that provides a runtime filter as predecessor of the GetTable and TableScan tasks
+  // that use the filter.
+  const auto get_table_a = std::make_shared<GetTable>("table_a");
+  const auto get_table_b = std::make_shared<GetTable>("table_b");
+  const auto table_scan =
+      std::make_shared<TableScan>(get_table_b, greater_than_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 0));
+  const auto join = std::make_shared<JoinHash>(
+      get_table_a, table_scan, JoinMode::Inner,
+      OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+
+  get_table_b->set_runtime_filters({JoinRuntimeFilterReference{join, LQPInputSide::Left, ColumnID{0}}});
+  table_scan->set_runtime_filters({JoinRuntimeFilterReference{join, LQPInputSide::Left, ColumnID{0}}});
+
+  const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(join);
+  ASSERT_EQ(tasks.size(), 4);
+  EXPECT_EQ(root_operator_task, join->get_or_create_operator_task());
+
+  const auto& successors = get_table_a->get_or_create_operator_task()->successors();
+  ASSERT_EQ(successors.size(), 3);
+  EXPECT_EQ(successors.front(), join->get_or_create_operator_task());
+  const auto successor_set = std::unordered_set<std::shared_ptr<AbstractTask>>(successors.begin(), successors.end());
+  EXPECT_TRUE(successor_set.contains(get_table_b->get_or_create_operator_task()));
+  EXPECT_TRUE(successor_set.contains(table_scan->get_or_create_operator_task()));
+}
+
 TEST_F(OperatorTaskTest, SkipOperatorTask) {
   const auto table = std::make_shared<GetTable>("table_a");
   table->execute();
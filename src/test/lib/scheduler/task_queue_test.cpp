@@ -26,6 +26,26 @@ TEST_F(TaskQueueTest, EstimateLoad) {
   // Tasks of higher priority are weighted higher. Tasks with the default priority have a multiplier of 1, while high
   // priority tasks have a multiplier of two. Thus we calculate the load as `1 * 2^0 + 1 * 2^1`.
   EXPECT_EQ(task_queue.estimate_load(), size_t{3});
+
+  // Low priority tasks are weighted like default priority tasks.
+  task_queue.push(std::make_shared<JobTask>([]() { return; }, SchedulePriority::Low), SchedulePriority::Low);
+  EXPECT_EQ(task_queue.estimate_load(), size_t{4});
+}
+
+TEST_F(TaskQueueTest, PullByPriority) {
+  auto task_queue = TaskQueue{NodeID{0}};
+
+  const auto low_priority_task = std::make_shared<JobTask>([]() { return; }, SchedulePriority::Low);
+  const auto default_priority_task = std::make_shared<JobTask>([]() { return; }, SchedulePriority::Default);
+  const auto high_priority_task = std::make_shared<JobTask>([]() { return; }, SchedulePriority::High);
+  task_queue.push(low_priority_task, SchedulePriority::Low);
+  task_queue.push(default_priority_task, SchedulePriority::Default);
+  task_queue.push(high_priority_task, SchedulePriority::High);
+
+  EXPECT_EQ(task_queue.pull(), high_priority_task);
+  EXPECT_EQ(task_queue.pull(), default_priority_task);
+  EXPECT_EQ(task_queue.pull(), low_priority_task);
+  EXPECT_TRUE(task_queue.empty());
 }
 
 }  // namespace hyrise
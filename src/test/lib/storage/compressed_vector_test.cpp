@@ -1,6 +1,10 @@
+#include <algorithm>
 #include <bitset>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 
@@ -122,4 +126,31 @@ TEST_P(CompressedVectorTest, DecodeSequenceOfZerosUsingDecompressor) {
   }
 }
 
+TEST_P(CompressedVectorTest, DecodeBlocks) {
+  // Vary the maximum value to test different bit widths for BitPacking. The decoded ranges are not aligned to blocks.
+  for (const auto max_value : {uint32_t{1}, uint32_t{100}, uint32_t{65'535}, uint32_t{1'000'003},
+                               std::numeric_limits<uint32_t>::max()}) {
+    auto sequence = pmr_vector<uint32_t>(1'000);
+    for (auto index = size_t{0}; index < sequence.size(); ++index) {
+      sequence[index] = static_cast<uint32_t>((index * 2'654'435'761u) % (uint64_t{max_value} + 1));
+    }
+    const auto encoded_sequence = compress_vector(sequence, GetParam(), {}, {max_value});
+
+    resolve_compressed_vector_type(*encoded_sequence, [&](const auto& vector) {
+      // Iterators unpack bit-packed blocks when they reach the first value of a block.
+      compare_using_iterator(vector, sequence);
+
+      if constexpr (std::is_same_v<std::decay_t<decltype(vector)>, BitPackingVector>) {
+        for (const auto& [first, count] : std::vector<std::pair<size_t, size_t>>{
+                 {0, 1'000}, {0, 64}, {3, 61}, {5, 200}, {64, 128}, {999, 1}, {500, 0}, {930, 70}}) {
+          auto decoded_values = std::vector<uint32_t>(count);
+          unpack_bitpacking_values(vector.data(), first, count, decoded_values.data());
+          EXPECT_TRUE(std::equal(decoded_values.cbegin(), decoded_values.cend(), sequence.cbegin() + first))
+              << "max value: " << max_value << ", first: " << first << ", count: " << count;
+        }
+      }
+    });
+  }
+}
+
 }  // namespace hyrise
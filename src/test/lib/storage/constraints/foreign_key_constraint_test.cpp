@@ -119,6 +119,27 @@ TEST_F(ForeignKeyConstraintTest, AddForeignKeyConstraintsInvalid) {
                std::logic_error);
 }
 
+TEST_F(ForeignKeyConstraintTest, RemoveForeignKeyConstraints) {
+  const auto foreign_key_constraint_1 = ForeignKeyConstraint{{ColumnID{0}}, _table_a, {ColumnID{0}}, _table_b};
+  const auto foreign_key_constraint_2 = ForeignKeyConstraint{{ColumnID{1}}, _table_a, {ColumnID{1}}, _table_b};
+  _table_a->add_soft_foreign_key_constraint(foreign_key_constraint_1);
+  _table_a->add_soft_foreign_key_constraint(foreign_key_constraint_2);
+
+  _table_a->remove_soft_foreign_key_constraint(foreign_key_constraint_1);
+  EXPECT_EQ(_table_a->soft_foreign_key_constraints().size(), 1);
+  EXPECT_TRUE(_table_a->soft_foreign_key_constraints().contains(foreign_key_constraint_2));
+
+  // Ensure the constraint was also removed from the other table.
+  EXPECT_EQ(_table_b->referenced_foreign_key_constraints().size(), 1);
+  EXPECT_TRUE(_table_b->referenced_foreign_key_constraints().contains(foreign_key_constraint_2));
+
+  // Invalid because the constraint is not set.
+  EXPECT_THROW(_table_a->remove_soft_foreign_key_constraint(foreign_key_constraint_1), std::logic_error);
+
+  // Invalid because the foreign key table is not the table we remove the constraint from.
+  EXPECT_THROW(_table_b->remove_soft_foreign_key_constraint(foreign_key_constraint_2), std::logic_error);
+}
+
 TEST_F(ForeignKeyConstraintTest, Equals) {
   const auto foreign_key_constraint_a = ForeignKeyConstraint{{ColumnID{0}}, _table_a, {ColumnID{1}}, _table_b};
   const auto foreign_key_constraint_a_copy = ForeignKeyConstraint{{ColumnID{0}}, _table_a, {ColumnID{1}}, _table_b};
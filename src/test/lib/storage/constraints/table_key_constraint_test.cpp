@@ -1,3 +1,6 @@
+#include <atomic>
+#include <thread>
+
 #include "base_test.hpp"
 
 #include "storage/constraints/table_key_constraint.hpp"
@@ -84,6 +87,48 @@ TEST_F(TableKeyConstraintTest, AddKeyConstraintsInvalid) {
   EXPECT_THROW(_table->add_soft_key_constraint({{ColumnID{2}}, KeyConstraintType::UNIQUE}), std::logic_error);
 }
 
+TEST_F(TableKeyConstraintTest, RemoveKeyConstraints) {
+  const auto key_constraint_1 = TableKeyConstraint{{ColumnID{0}}, KeyConstraintType::UNIQUE};
+  const auto key_constraint_2 = TableKeyConstraint{{ColumnID{1}}, KeyConstraintType::UNIQUE};
+  _table->add_soft_key_constraint(key_constraint_1);
+  _table->add_soft_key_constraint(key_constraint_2);
+
+  _table->remove_soft_key_constraint(key_constraint_1);
+  EXPECT_EQ(_table->soft_key_constraints().size(), 1);
+  EXPECT_TRUE(_table->soft_key_constraints().contains(key_constraint_2));
+
+  // Invalid because the constraint is not set.
+  EXPECT_THROW(_table->remove_soft_key_constraint(key_constraint_1), std::logic_error);
+
+  // Columns of removed constraints can be part of new constraints.
+  EXPECT_NO_THROW(_table->add_soft_key_constraint({{ColumnID{0}, ColumnID{2}}, KeyConstraintType::UNIQUE}));
+}
+
+TEST_F(TableKeyConstraintTest, ConcurrentAccess) {
+  // Readers (e.g., the optimizer) get copies of the constraints while they are added and removed by another thread.
+  const auto key_constraint = TableKeyConstraint{{ColumnID{0}}, KeyConstraintType::UNIQUE};
+  _table->add_soft_key_constraint({{ColumnID{1}}, KeyConstraintType::UNIQUE});
+
+  auto done = std::atomic_bool{false};
+  auto writer = std::thread{[&]() {
+    for (auto iteration = 0; iteration < 1'000; ++iteration) {
+      _table->add_soft_key_constraint(key_constraint);
+      _table->remove_soft_key_constraint(key_constraint);
+    }
+    done = true;
+  }};
+
+  while (!done) {
+    const auto table_key_constraints = _table->soft_key_constraints();
+    const auto constraint_count = table_key_constraints.size();
+    EXPECT_TRUE(constraint_count == 1 || constraint_count == 2);
+    EXPECT_TRUE(table_key_constraints.contains({{ColumnID{1}}, KeyConstraintType::UNIQUE}));
+  }
+  writer.join();
+
+  EXPECT_EQ(_table->soft_key_constraints().size(), 1);
+}
+
 TEST_F(TableKeyConstraintTest, Equals) {
   const auto key_constraint_a = TableKeyConstraint{{ColumnID{0}, ColumnID{2}}, KeyConstraintType::UNIQUE};
   const auto key_constraint_a_reordered = TableKeyConstraint{{ColumnID{2}, ColumnID{0}}, KeyConstraintType::UNIQUE};
@@ -88,6 +88,20 @@ TEST_F(TableOrderConstraintTest, AddOrderConstraintsInvalid) {
   }
 }
 
+TEST_F(TableOrderConstraintTest, RemoveOrderConstraints) {
+  const auto order_constraint_1 = TableOrderConstraint{{ColumnID{0}}, {ColumnID{1}}};
+  const auto order_constraint_2 = TableOrderConstraint{{ColumnID{0}}, {ColumnID{3}}};
+  _table->add_soft_order_constraint(order_constraint_1);
+  _table->add_soft_order_constraint(order_constraint_2);
+
+  _table->remove_soft_order_constraint(order_constraint_1);
+  EXPECT_EQ(_table->soft_order_constraints().size(), 1);
+  EXPECT_TRUE(_table->soft_order_constraints().contains(order_constraint_2));
+
+  // Invalid because the constraint is not set.
+  EXPECT_THROW(_table->remove_soft_order_constraint(order_constraint_1), std::logic_error);
+}
+
 TEST_F(TableOrderConstraintTest, Equals) {
   const auto order_constraint_a = TableOrderConstraint{{ColumnID{0}, ColumnID{2}}, {ColumnID{1}}};
   const auto order_constraint_a_copy = TableOrderConstraint{{ColumnID{0}, ColumnID{2}}, {ColumnID{1}}};
@@ -310,6 +310,14 @@ TEST_F(EncodedStringSegmentTest, SegmentReencoding) {
 
   encoded_segment = this->_encode_segment(value_segment, DataType::String, SegmentEncodingSpec{EncodingType::LZ4});
   EXPECT_SEGMENT_EQ_ORDERED(value_segment, encoded_segment);
+
+  encoded_segment =
+      this->_encode_segment(value_segment, DataType::String,
+                            SegmentEncodingSpec{EncodingType::FSST, VectorCompressionType::FixedWidthInteger});
+  EXPECT_SEGMENT_EQ_ORDERED(value_segment, encoded_segment);
+  encoded_segment = this->_encode_segment(value_segment, DataType::String,
+                                          SegmentEncodingSpec{EncodingType::FSST, VectorCompressionType::BitPacking});
+  EXPECT_SEGMENT_EQ_ORDERED(value_segment, encoded_segment);
 }
 
 }  // namespace hyrise
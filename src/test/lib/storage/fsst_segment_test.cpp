@@ -0,0 +1,143 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class StorageFSSTSegmentTest : public BaseTestWithParam<VectorCompressionType> {
+ protected:
+  std::shared_ptr<FSSTSegment<pmr_string>> compress(const std::shared_ptr<ValueSegment<pmr_string>>& segment) {
+    const auto encoded_segment =
+        ChunkEncoder::encode_segment(segment, DataType::String, SegmentEncodingSpec{EncodingType::FSST, GetParam()});
+    return std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(encoded_segment);
+  }
+
+  std::shared_ptr<ValueSegment<pmr_string>> vs_str = std::make_shared<ValueSegment<pmr_string>>(true);
+};
+
+INSTANTIATE_TEST_SUITE_P(VectorCompressionTypes, StorageFSSTSegmentTest,
+                         ::testing::Values(VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking),
+                         enum_formatter<VectorCompressionType>);
+
+TEST_P(StorageFSSTSegmentTest, CompressEmptySegment) {
+  const auto fsst_segment = compress(vs_str);
+  ASSERT_TRUE(fsst_segment);
+
+  EXPECT_EQ(fsst_segment->size(), 0u);
+  EXPECT_EQ(fsst_segment->code_offsets().size(), 1u);
+  EXPECT_TRUE(fsst_segment->codes().empty());
+  EXPECT_TRUE(fsst_segment->symbol_table().symbols().empty());
+  EXPECT_FALSE(fsst_segment->null_values());
+}
+
+TEST_P(StorageFSSTSegmentTest, CompressNullableAndEmptyStringSegment) {
+  vs_str->append("Alex");
+  vs_str->append("");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("Alexander");
+  vs_str->append(pmr_string{"with\0zero", 9});
+  const auto fsst_segment = compress(vs_str);
+
+  EXPECT_EQ(fsst_segment->size(), 5u);
+  ASSERT_TRUE(fsst_segment->null_values());
+  EXPECT_EQ(*fsst_segment->null_values(), pmr_vector<bool>({false, false, true, false, false}));
+
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{0}), "Alex");
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{1}), "");
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{2}), std::nullopt);
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{3}), "Alexander");
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{4}), pmr_string("with\0zero", 9));
+
+  // Neither empty strings nor NULL values have codes.
+  const auto decompressor = fsst_segment->code_offsets().create_base_decompressor();
+  EXPECT_EQ(decompressor->get(1), decompressor->get(2));
+  EXPECT_EQ(decompressor->get(2), decompressor->get(3));
+}
+
+TEST_P(StorageFSSTSegmentTest, CompressRepetitiveStrings) {
+  auto values = std::vector<pmr_string>{};
+  for (auto index = size_t{0}; index < 1'000; ++index) {
+    values.emplace_back("https://www.hyrise.example/articles/" + std::to_string(index) + "/index.html");
+    vs_str->append(values.back());
+  }
+  const auto fsst_segment = compress(vs_str);
+
+  auto row_count = size_t{0};
+  segment_iterate<pmr_string>(*fsst_segment, [&](const auto& position) {
+    ASSERT_FALSE(position.is_null());
+    EXPECT_EQ(position.value(), values[position.chunk_offset()]);
+    ++row_count;
+  });
+  EXPECT_EQ(row_count, values.size());
+
+  // The common prefix and suffix are covered by a few symbols of eight bytes each.
+  EXPECT_LT(fsst_segment->codes().size() * 3, vs_str->memory_usage(MemoryUsageCalculationMode::Full));
+  EXPECT_LT(fsst_segment->memory_usage(MemoryUsageCalculationMode::Full),
+            vs_str->memory_usage(MemoryUsageCalculationMode::Full) / 2);
+}
+
+TEST_P(StorageFSSTSegmentTest, EqualStringsHaveEqualCodes) {
+  vs_str->append("Mannheim");
+  vs_str->append("Hannover");
+  vs_str->append("Mannheim");
+  const auto fsst_segment = compress(vs_str);
+
+  const auto decompressor = fsst_segment->code_offsets().create_base_decompressor();
+  const auto& codes = fsst_segment->codes();
+  const auto codes_of = [&](const size_t chunk_offset) {
+    return std::vector<uint8_t>(codes.begin() + decompressor->get(chunk_offset),
+                                codes.begin() + decompressor->get(chunk_offset + 1));
+  };
+  EXPECT_EQ(codes_of(0), codes_of(2));
+  EXPECT_NE(codes_of(0), codes_of(1));
+
+  // Encoding a search value yields the same codes as the stored value, which allows comparing strings on codes.
+  auto search_codes = pmr_vector<uint8_t>{};
+  fsst_segment->symbol_table().encode("Mannheim", search_codes);
+  EXPECT_EQ(std::vector<uint8_t>(search_codes.begin(), search_codes.end()), codes_of(0));
+}
+
+TEST_P(StorageFSSTSegmentTest, SymbolTableEscapesUnknownBytes) {
+  vs_str->append("aaaaaaaaaaaaaaaa");
+  const auto fsst_segment = compress(vs_str);
+  const auto& symbol_table = fsst_segment->symbol_table();
+
+  auto codes = pmr_vector<uint8_t>{};
+  symbol_table.encode("aaaaaaaaz", codes);
+  ASSERT_EQ(codes.size(), 3u);
+  EXPECT_EQ(codes[1], FSSTSymbolTable::ESCAPE_CODE);
+  EXPECT_EQ(codes.back(), 'z');
+
+  auto decoded = std::string(codes.size() * FSSTSymbolTable::MAX_SYMBOL_LENGTH, '\0');
+  decoded.resize(symbol_table.decode(codes.data(), codes.size(), decoded.data()));
+  EXPECT_EQ(decoded, "aaaaaaaaz");
+}
+
+TEST_P(StorageFSSTSegmentTest, CopyUsingAllocator) {
+  vs_str->append("Alex");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("Peter");
+  const auto fsst_segment = compress(vs_str);
+  fsst_segment->access_counter[SegmentAccessCounter::AccessType::Random] = 5;
+
+  const auto copied_segment =
+      std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(fsst_segment->copy_using_allocator({}));
+  ASSERT_TRUE(copied_segment);
+
+  EXPECT_EQ(copied_segment->size(), 3u);
+  EXPECT_EQ(copied_segment->get_typed_value(ChunkOffset{0}), "Alex");
+  EXPECT_EQ(copied_segment->get_typed_value(ChunkOffset{1}), std::nullopt);
+  EXPECT_EQ(copied_segment->get_typed_value(ChunkOffset{2}), "Peter");
+  EXPECT_EQ(copied_segment->access_counter[SegmentAccessCounter::AccessType::Random], 5);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+
+namespace hyrise {
+
+class BitmapPosListTest : public BaseTest {
+ public:
+  static RowIDPosList every_nth_row(const ChunkOffset chunk_size, const ChunkOffset::base_type step,
+                                    const ChunkOffset::base_type first = 0) {
+    auto pos_list = RowIDPosList{};
+    for (auto chunk_offset = first; chunk_offset < chunk_size; chunk_offset += step) {
+      pos_list.emplace_back(ChunkID{2}, ChunkOffset{chunk_offset});
+    }
+    return pos_list;
+  }
+};
+
+TEST_F(BitmapPosListTest, AccessPositions) {
+  // Spans multiple words and ends in a partial word.
+  const auto chunk_size = ChunkOffset{200};
+  const auto row_id_pos_list = every_nth_row(chunk_size, 3, 1);
+  const auto bitmap_pos_list =
+      BitmapPosList{ChunkID{2}, chunk_size, row_id_pos_list.cbegin(), row_id_pos_list.cend()};
+
+  EXPECT_TRUE(bitmap_pos_list.references_single_chunk());
+  EXPECT_EQ(bitmap_pos_list.common_chunk_id(), ChunkID{2});
+  EXPECT_EQ(bitmap_pos_list.chunk_size(), chunk_size);
+  EXPECT_FALSE(bitmap_pos_list.empty());
+  ASSERT_EQ(bitmap_pos_list.size(), row_id_pos_list.size());
+
+  for (auto index = size_t{0}; index < row_id_pos_list.size(); ++index) {
+    EXPECT_EQ(bitmap_pos_list[index], row_id_pos_list[index]);
+  }
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size + 10; ++chunk_offset) {
+    EXPECT_EQ(bitmap_pos_list.contains(chunk_offset), chunk_offset < chunk_size && chunk_offset % 3 == 1);
+  }
+
+  EXPECT_TRUE(std::equal(bitmap_pos_list.cbegin(), bitmap_pos_list.cend(), row_id_pos_list.cbegin(),
+                         row_id_pos_list.cend()));
+
+  // Iterate backwards and jump within the list.
+  auto reverse_positions = std::vector<RowID>(std::make_reverse_iterator(bitmap_pos_list.cend()),
+                                              std::make_reverse_iterator(bitmap_pos_list.cbegin()));
+  std::reverse(reverse_positions.begin(), reverse_positions.end());
+  EXPECT_TRUE(std::equal(reverse_positions.cbegin(), reverse_positions.cend(), row_id_pos_list.cbegin(),
+                         row_id_pos_list.cend()));
+
+  auto iterator = bitmap_pos_list.cbegin();
+  iterator += 40;
+  EXPECT_EQ(*iterator, row_id_pos_list[40]);
+  EXPECT_EQ(std::distance(iterator, bitmap_pos_list.cend()), std::ssize(row_id_pos_list) - 40);
+  iterator -= 5;
+  EXPECT_EQ(*iterator, row_id_pos_list[35]);
+}
+
+TEST_F(BitmapPosListTest, EmptyAndDuplicatePositions) {
+  const auto empty_pos_list = RowIDPosList{};
+  const auto empty_bitmap_pos_list =
+      BitmapPosList{ChunkID{2}, ChunkOffset{100}, empty_pos_list.cbegin(), empty_pos_list.cend()};
+  EXPECT_TRUE(empty_bitmap_pos_list.empty());
+  EXPECT_EQ(empty_bitmap_pos_list.cbegin(), empty_bitmap_pos_list.cend());
+
+  // Positions may be unordered and contain duplicates, the bitmap orders them and contains each only once.
+  const auto unordered_pos_list =
+      RowIDPosList{RowID{ChunkID{2}, ChunkOffset{70}}, RowID{ChunkID{2}, ChunkOffset{3}},
+                   RowID{ChunkID{2}, ChunkOffset{70}}, RowID{ChunkID{2}, ChunkOffset{63}}};
+  const auto bitmap_pos_list =
+      BitmapPosList{ChunkID{2}, ChunkOffset{71}, unordered_pos_list.cbegin(), unordered_pos_list.cend()};
+  const auto expected_pos_list = RowIDPosList{RowID{ChunkID{2}, ChunkOffset{3}}, RowID{ChunkID{2}, ChunkOffset{63}},
+                                              RowID{ChunkID{2}, ChunkOffset{70}}};
+  EXPECT_TRUE(std::equal(bitmap_pos_list.cbegin(), bitmap_pos_list.cend(), expected_pos_list.cbegin(),
+                         expected_pos_list.cend()));
+}
+
+TEST_F(BitmapPosListTest, IntersectAndUnite) {
+  const auto chunk_size = ChunkOffset{1'000};
+  const auto multiples_of_two = every_nth_row(chunk_size, 2);
+  const auto multiples_of_three = every_nth_row(chunk_size, 3);
+  const auto lhs = BitmapPosList{ChunkID{2}, chunk_size, multiples_of_two.cbegin(), multiples_of_two.cend()};
+  const auto rhs = BitmapPosList{ChunkID{2}, chunk_size, multiples_of_three.cbegin(), multiples_of_three.cend()};
+
+  auto expected_intersection = RowIDPosList{};
+  std::set_intersection(multiples_of_two.cbegin(), multiples_of_two.cend(), multiples_of_three.cbegin(),
+                        multiples_of_three.cend(), std::back_inserter(expected_intersection));
+  const auto intersection = BitmapPosList::intersect(lhs, rhs);
+  EXPECT_TRUE(std::equal(intersection->cbegin(), intersection->cend(), expected_intersection.cbegin(),
+                         expected_intersection.cend()));
+
+  auto expected_union = RowIDPosList{};
+  std::set_union(multiples_of_two.cbegin(), multiples_of_two.cend(), multiples_of_three.cbegin(),
+                 multiples_of_three.cend(), std::back_inserter(expected_union));
+  const auto united = BitmapPosList::unite(lhs, rhs);
+  EXPECT_TRUE(std::equal(united->cbegin(), united->cend(), expected_union.cbegin(), expected_union.cend()));
+}
+
+TEST_F(BitmapPosListTest, IntersectAndUniteDifferentChunkSizes) {
+  // Rows might have been appended to the chunk between creating the two bitmaps.
+  const auto smaller_positions = every_nth_row(ChunkOffset{100}, 1);
+  const auto larger_positions = every_nth_row(ChunkOffset{150}, 1, 50);
+  const auto smaller =
+      BitmapPosList{ChunkID{2}, ChunkOffset{100}, smaller_positions.cbegin(), smaller_positions.cend()};
+  const auto larger = BitmapPosList{ChunkID{2}, ChunkOffset{150}, larger_positions.cbegin(), larger_positions.cend()};
+
+  const auto intersection = BitmapPosList::intersect(larger, smaller);
+  EXPECT_EQ(intersection->chunk_size(), ChunkOffset{100});
+  EXPECT_EQ(intersection->size(), 50);
+  EXPECT_EQ((*intersection)[0], (RowID{ChunkID{2}, ChunkOffset{50}}));
+
+  const auto united = BitmapPosList::unite(smaller, larger);
+  EXPECT_EQ(united->chunk_size(), ChunkOffset{150});
+  EXPECT_EQ(united->size(), 150);
+}
+
+TEST_F(BitmapPosListTest, UseForDenseResults) {
+  EXPECT_FALSE(BitmapPosList::use_for(10, ChunkOffset{1'000}));
+  EXPECT_TRUE(BitmapPosList::use_for(700, ChunkOffset{1'000}));
+}
+
+TEST_F(BitmapPosListTest, MemoryUsage) {
+  const auto chunk_size = ChunkOffset{6'400};
+  const auto positions = every_nth_row(chunk_size, 2);
+  const auto bitmap_pos_list = BitmapPosList{ChunkID{2}, chunk_size, positions.cbegin(), positions.cend()};
+
+  // One bit per row of the chunk plus the rank of each word, far less than eight bytes per RowID.
+  EXPECT_GE(bitmap_pos_list.memory_usage(MemoryUsageCalculationMode::Full), 100 * sizeof(uint64_t));
+  EXPECT_LT(bitmap_pos_list.memory_usage(MemoryUsageCalculationMode::Full),
+            positions.memory_usage(MemoryUsageCalculationMode::Full) / 10);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,75 @@
+#include "base_test.hpp"
+
+#include "utils/blocked_bloom_filter.hpp"
+
+namespace hyrise {
+
+class BlockedBloomFilterTest : public BaseTest {};
+
+TEST_F(BlockedBloomFilterTest, Sizing) {
+  // An empty filter is not active.
+  const auto empty_filter = BlockedBloomFilter{};
+  EXPECT_FALSE(empty_filter.is_active());
+  EXPECT_EQ(empty_filter.block_count(), 0);
+
+  // Few values fit into a single block and get a bit in every lane.
+  const auto small_filter = BlockedBloomFilter{10};
+  EXPECT_TRUE(small_filter.is_active());
+  EXPECT_EQ(small_filter.block_count(), 1);
+  EXPECT_EQ(small_filter.hash_count(), BlockedBloomFilter::LANE_COUNT);
+
+  // 100'000 values * 8 bits require 1'563 blocks, which is rounded up to 2'048 blocks (i.e., ~10.5 bits per value).
+  const auto medium_filter = BlockedBloomFilter{100'000};
+  EXPECT_EQ(medium_filter.block_count(), 2'048);
+  EXPECT_EQ(medium_filter.hash_count(), 7);
+
+  // The size is capped. With fewer bits per value, fewer hash functions are optimal.
+  const auto large_filter = BlockedBloomFilter{1'000'000'000};
+  EXPECT_EQ(large_filter.block_count(), BlockedBloomFilter::MAX_BLOCK_COUNT);
+  EXPECT_EQ(large_filter.hash_count(), 1);
+}
+
+TEST_F(BlockedBloomFilterTest, InsertAndProbe) {
+  const auto value_count = size_t{100'000};
+  auto filter = BlockedBloomFilter{value_count};
+  const auto hash_function = std::hash<size_t>{};
+
+  for (auto value = size_t{0}; value < value_count; ++value) {
+    filter.insert(hash_function(value * 2));
+  }
+
+  // No false negatives.
+  for (auto value = size_t{0}; value < value_count; ++value) {
+    EXPECT_TRUE(filter.contains(hash_function(value * 2)));
+  }
+
+  // With 10.5 bits per value and seven hash functions, the false positive rate of a blocked Bloom filter is about 1 %.
+  auto false_positive_count = size_t{0};
+  for (auto value = size_t{0}; value < value_count; ++value) {
+    false_positive_count += filter.contains(hash_function(value * 2 + 1));
+  }
+  EXPECT_LT(false_positive_count, value_count / 50);
+}
+
+TEST_F(BlockedBloomFilterTest, AdaptiveDisabling) {
+  const auto filter = BlockedBloomFilter{10};
+  EXPECT_FALSE(filter.filter_rate());
+
+  // Too few probes to decide.
+  filter.record_probes(100, 0);
+  EXPECT_TRUE(filter.is_active());
+  EXPECT_EQ(*filter.filter_rate(), 0.0);
+
+  // Good filter rate.
+  filter.record_probes(BlockedBloomFilter::MIN_PROBE_COUNT_FOR_ADAPTION, 5'000);
+  EXPECT_TRUE(filter.is_active());
+  EXPECT_EQ(filter.probed_value_count(), 10'100);
+  EXPECT_EQ(filter.filtered_value_count(), 5'000);
+
+  // Poor filter rate: fewer than 10 % of the values were filtered overall.
+  filter.record_probes(50'000, 0);
+  EXPECT_FALSE(filter.is_active());
+  EXPECT_NEAR(*filter.filter_rate(), 5'000.0 / 60'100.0, 0.0001);
+}
+
+}  // namespace hyrise
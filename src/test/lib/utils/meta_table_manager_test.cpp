@@ -108,6 +108,18 @@ TEST_F(MetaTableManagerTest, RetrieveAddedTable) {
   EXPECT_EQ(mock_table, std::static_pointer_cast<MetaMockTable>(mock_table2));
 }
 
+TEST_F(MetaTableManagerTest, RemoveAddedTable) {
+  auto& mtm = Hyrise::get().meta_table_manager;
+  const auto table_count = mtm.table_names().size();
+  mtm.add_table(std::make_shared<MetaMockTable>());
+  EXPECT_TRUE(mtm.has_table("mock"));
+
+  mtm.remove_table(MetaTableManager::META_PREFIX + "mock");
+  EXPECT_FALSE(mtm.has_table("mock"));
+  EXPECT_EQ(mtm.table_names().size(), table_count);
+  EXPECT_THROW(mtm.remove_table("mock"), std::logic_error);
+}
+
 TEST_P(MetaTableManagerMultiTablesTest, HasAllTables) {
   EXPECT_TRUE(Hyrise::get().meta_table_manager.has_table(GetParam()->name()));
 }
@@ -0,0 +1,98 @@
+#include "candidate_strategy_base_test.hpp"
+
+#include "../../../../plugins/dependency_discovery/candidate_strategy/join_to_semi_join_candidate_rule.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "utils/load_table.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class JoinToSemiJoinCandidateRuleTest : public CandidateStrategyBaseTest {
+ protected:
+  void SetUp() override {
+    _rule = std::make_unique<JoinToSemiJoinCandidateRule>();
+    const auto& table = load_table("resources/test_data/tbl/int_int_int.tbl");
+    Hyrise::get().storage_manager.add_table(_table_name_a, table);
+    Hyrise::get().storage_manager.add_table(_table_name_b, table);
+    Hyrise::get().storage_manager.add_table(_table_name_c, table);
+
+    _table_a = StoredTableNode::make(_table_name_a);
+    _table_b = StoredTableNode::make(_table_name_b);
+
+    _a = _table_a->get_column("a");
+    _b = _table_a->get_column("b");
+
+    _x = _table_b->get_column("a");
+    _y = _table_b->get_column("b");
+  }
+
+  std::shared_ptr<StoredTableNode> _table_a, _table_b;
+  const std::string _table_name_a{"t_a"};
+  const std::string _table_name_b{"t_b"};
+  const std::string _table_name_c{"t_c"};
+  std::shared_ptr<LQPColumnExpression> _a, _b, _x, _y;
+};
+
+TEST_F(JoinToSemiJoinCandidateRuleTest, SinglePredicate) {
+  const auto lqp = JoinNode::make(JoinMode::Inner, equals_(_a, _x), _table_a, _table_b);
+  lqp->mark_input_side_as_prunable(LQPInputSide::Right);
+
+  const auto& dependency_candidates = _apply_rule(lqp);
+  EXPECT_EQ(dependency_candidates.size(), 1);
+  EXPECT_TRUE(dependency_candidates.contains(std::make_shared<UccCandidate>(_table_name_b, _x->original_column_id)));
+}
+
+TEST_F(JoinToSemiJoinCandidateRuleTest, MultiplePredicates) {
+  // The candidate contains the columns of all equals predicates on the prunable side, other predicates are ignored.
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Inner, expression_vector(equals_(_a, _x), greater_than_(_a, _x), equals_(_y, _b)),
+    _table_a,
+    _table_b);
+  // clang-format on
+  lqp->mark_input_side_as_prunable(LQPInputSide::Right);
+
+  const auto& dependency_candidates = _apply_rule(lqp);
+  EXPECT_EQ(dependency_candidates.size(), 1);
+  const auto expected_candidate = std::make_shared<UccCandidate>(
+      _table_name_b, std::vector<ColumnID>{_y->original_column_id, _x->original_column_id});
+  EXPECT_TRUE(dependency_candidates.contains(expected_candidate));
+  EXPECT_EQ(static_cast<const UccCandidate&>(**dependency_candidates.cbegin()).column_ids,
+            std::vector<ColumnID>({ColumnID{0}, ColumnID{1}}));
+}
+
+TEST_F(JoinToSemiJoinCandidateRuleTest, NoCandidates) {
+  // Not prunable.
+  const auto unprunable_lqp = JoinNode::make(JoinMode::Inner, equals_(_a, _x), _table_a, _table_b);
+  EXPECT_TRUE(_apply_rule(unprunable_lqp).empty());
+
+  // Not an inner join.
+  const auto semi_join_lqp = JoinNode::make(JoinMode::Semi, equals_(_a, _x), _table_a, _table_b);
+  semi_join_lqp->mark_input_side_as_prunable(LQPInputSide::Right);
+  EXPECT_TRUE(_apply_rule(semi_join_lqp).empty());
+
+  // No equals predicate.
+  const auto non_equi_join_lqp = JoinNode::make(JoinMode::Inner, greater_than_(_a, _x), _table_a, _table_b);
+  non_equi_join_lqp->mark_input_side_as_prunable(LQPInputSide::Right);
+  EXPECT_TRUE(_apply_rule(non_equi_join_lqp).empty());
+
+  // Join columns on the prunable side stem from different tables.
+  const auto table_c = StoredTableNode::make(_table_name_c);
+  const auto c_a = table_c->get_column("a");
+  // clang-format off
+  const auto mixed_tables_lqp =
+  JoinNode::make(JoinMode::Inner, expression_vector(equals_(c_a, _a), equals_(c_a, _x)),
+    table_c,
+    JoinNode::make(JoinMode::Cross,
+      _table_a,
+      _table_b));
+  // clang-format on
+  mixed_tables_lqp->mark_input_side_as_prunable(LQPInputSide::Right);
+  EXPECT_TRUE(_apply_rule(mixed_tables_lqp).empty());
+}
+
+}  // namespace hyrise
@@ -1,12 +1,20 @@
+#include <cstdio>
 #include <limits>
 #include <memory>
+#include <set>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "base_test.hpp"
 #include "lib/storage/encoding_test.hpp"
 #include "lib/utils/plugin_test_utils.hpp"
 
+#include "../../plugins/dependency_discovery/validation_strategy/fd_validation_rule.hpp"
+#include "../../plugins/dependency_discovery/validation_strategy/ind_validation_rule.hpp"
+#include "../../plugins/dependency_discovery/validation_strategy/od_validation_rule.hpp"
+#include "../../plugins/dependency_discovery/validation_strategy/ucc_validation_rule.hpp"
+#include "../../plugins/dependency_discovery/validation_strategy/validation_utils.hpp"
 #include "../../plugins/dependency_discovery_plugin.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "expression/expression_functional.hpp"
@@ -18,10 +26,13 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "operators/get_table.hpp"
+#include "operators/insert.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "storage/constraints/table_key_constraint.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/load_table.hpp"
@@ -57,13 +68,53 @@ class DependencyDiscoveryPluginTest : public BaseTest {
   }
 
   void _discover_uccs() {
-    _plugin->_validate_dependency_candidates(_plugin->_identify_dependency_candidates());
+    _plugin->_discover_dependencies();
   }
 
   void _validate_dependency_candidates(const DependencyCandidates& candidates) {
     _plugin->_validate_dependency_candidates(candidates);
   }
 
+  void _revalidate_constraints() {
+    _plugin->_revalidate_constraints();
+  }
+
+  void _store_dependency_catalog(const std::string& filename) {
+    _plugin->_store_dependency_catalog(filename);
+  }
+
+  size_t _load_dependency_catalog(const std::string& filename) {
+    return _plugin->_load_dependency_catalog(filename);
+  }
+
+  void _clear_constraints() {
+    _plugin->_clear_constraints();
+  }
+
+  void _set_catalog_filename(const std::string& filename) {
+    _plugin->_catalog_filename = filename;
+  }
+
+  void _run_background_discovery() {
+    // Ignore the CPU budget, which delays the next run.
+    _plugin->_next_discovery_time = {};
+    _plugin->_background_discovery_loop();
+  }
+
+  static void _insert_row(const std::string& table_name, const std::vector<AllTypeVariant>& values) {
+    const auto& table = Hyrise::get().storage_manager.get_table(table_name);
+    const auto rows = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+    rows->append(values);
+    const auto table_wrapper = std::make_shared<TableWrapper>(rows);
+    table_wrapper->execute();
+
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    transaction_context->commit();
+  }
+
   void _encode_table(const std::shared_ptr<Table>& table, const SegmentEncodingSpec& encoding_spec) {
     auto chunk_encoding_spec = ChunkEncodingSpec{table->column_count(), SegmentEncodingSpec{EncodingType::Unencoded}};
 
@@ -104,8 +155,9 @@ TEST_F(DependencyDiscoveryPluginTest, DescriptionAndProvidedFunction) {
   auto plugin = DependencyDiscoveryPlugin{};
   EXPECT_EQ(plugin.description(), "Data Dependency Discovery Plugin");
   const auto& provided_functions = plugin.provided_user_executable_functions();
-  ASSERT_EQ(provided_functions.size(), 1);
+  ASSERT_EQ(provided_functions.size(), 2);
   EXPECT_EQ(provided_functions.front().first, "DiscoverDependencies");
+  EXPECT_EQ(provided_functions.back().first, "RevalidateDependencies");
 }
 
 TEST_F(DependencyDiscoveryPluginTest, UserCallableFunction) {
@@ -167,6 +219,44 @@ TEST_F(DependencyDiscoveryPluginTest, CorrectCandidatesGeneratedForJoin) {
   }
 }
 
+TEST_F(DependencyDiscoveryPluginTest, DependentsOfCandidatesMergedAcrossQueries) {
+  const auto column_b = _table_node_A->get_column("b");
+  // clang-format off
+  const auto lqp_b =
+  JoinNode::make(JoinMode::Semi, equals_(_join_columnB, _join_columnA),
+    _table_node_B,
+    PredicateNode::make(equals_(column_b, 2), _table_node_A));
+
+  const auto lqp_c =
+  JoinNode::make(JoinMode::Semi, equals_(_join_columnB, _join_columnA),
+    _table_node_B,
+    PredicateNode::make(equals_(_predicate_column_A, "unique"), _table_node_A));
+  // clang-format on
+
+  Hyrise::get().default_lqp_cache->set("QueryB", lqp_b);
+  Hyrise::get().default_lqp_cache->set("QueryC", lqp_c);
+
+  // Both queries yield the same IND candidate, but with different ODs.
+  const auto& dependency_candidates = _identify_dependency_candidates();
+  const auto ind_candidate = std::make_shared<IndCandidate>(_table_name_B, _join_columnB->original_column_id,
+                                                            _table_name_A, _join_columnA->original_column_id);
+  const auto ind_candidate_it = dependency_candidates.find(ind_candidate);
+  ASSERT_NE(ind_candidate_it, dependency_candidates.end());
+  const auto& dependents = *static_cast<const IndCandidate&>(**ind_candidate_it).dependents;
+  EXPECT_EQ(dependents.size(), 2);
+
+  // The IND depends on the OD instances that are validated.
+  for (const auto& ordered_column : {column_b, _predicate_column_A}) {
+    const auto od_candidate = std::make_shared<OdCandidate>(_table_name_A, _join_columnA->original_column_id,
+                                                            ordered_column->original_column_id);
+    const auto od_candidate_it = dependency_candidates.find(od_candidate);
+    const auto dependent_it = dependents.find(od_candidate);
+    ASSERT_NE(od_candidate_it, dependency_candidates.end());
+    ASSERT_NE(dependent_it, dependents.end());
+    EXPECT_EQ(*dependent_it, *od_candidate_it);
+  }
+}
+
 TEST_F(DependencyDiscoveryPluginTest, NoCandidatesGeneratedForUnsupportedJoinModes) {
   const auto join_modes = {JoinMode::Left,           JoinMode::Right,           JoinMode::FullOuter,
                            JoinMode::AntiNullAsTrue, JoinMode::AntiNullAsFalse, JoinMode::Cross};
@@ -240,6 +330,425 @@ TEST_F(DependencyDiscoveryPluginTest, NoCandidatesGeneratedForUnionNode) {
   EXPECT_TRUE(dependency_candidates.empty());
 }
 
+TEST_F(DependencyDiscoveryPluginTest, ValidateCandidatesConcurrently) {
+  prepare_parallel_execution();
+
+  // Both FD candidates are valid because column A_a is unique. When validated concurrently, both yield the same key
+  // constraint. As in a sequential run, only one of them should be confirmed and the other one should be known.
+  const auto fd_candidate_1 =
+      std::make_shared<FdCandidate>(_table_name_A, std::unordered_set<ColumnID>{ColumnID{0}, ColumnID{1}});
+  const auto fd_candidate_2 =
+      std::make_shared<FdCandidate>(_table_name_A, std::unordered_set<ColumnID>{ColumnID{0}, ColumnID{2}});
+  const auto ucc_candidate_1 = std::make_shared<UccCandidate>(_table_name_B, ColumnID{0});
+  const auto ucc_candidate_2 = std::make_shared<UccCandidate>(_table_name_B, ColumnID{1});
+  const auto od_candidate = std::make_shared<OdCandidate>(_table_name_A, ColumnID{0}, ColumnID{1});
+  const auto ind_candidate = std::make_shared<IndCandidate>(_table_name_B, ColumnID{0}, _table_name_A, ColumnID{0});
+  ind_candidate->dependents->emplace(od_candidate);
+
+  _validate_dependency_candidates(
+      {fd_candidate_1, fd_candidate_2, ucc_candidate_1, ucc_candidate_2, od_candidate, ind_candidate});
+
+  // The IND is skipped since its dependent OD is invalid.
+  EXPECT_EQ(od_candidate->status, ValidationStatus::Invalid);
+  EXPECT_EQ(ind_candidate->status, ValidationStatus::Superfluous);
+  EXPECT_EQ(ucc_candidate_1->status, ValidationStatus::Valid);
+  EXPECT_EQ(ucc_candidate_2->status, ValidationStatus::Invalid);
+
+  const auto fd_statuses = std::multiset{fd_candidate_1->status, fd_candidate_2->status};
+  EXPECT_EQ(fd_statuses, std::multiset({ValidationStatus::Valid, ValidationStatus::AlreadyKnown}));
+
+  const auto& constraints_A = _table_A->soft_key_constraints();
+  const auto& constraints_B = _table_B->soft_key_constraints();
+  EXPECT_EQ(constraints_A.size(), 1);
+  EXPECT_EQ(constraints_B.size(), 1);
+  EXPECT_TRUE(constraints_A.contains({{ColumnID{0}}, KeyConstraintType::UNIQUE}));
+  EXPECT_TRUE(constraints_B.contains({{ColumnID{0}}, KeyConstraintType::UNIQUE}));
+  EXPECT_TRUE(_table_A->soft_order_constraints().empty());
+  EXPECT_TRUE(_table_B->soft_foreign_key_constraints().empty());
+}
+
+TEST_F(DependencyDiscoveryPluginTest, ValidateLargeTableConcurrently) {
+  prepare_parallel_execution();
+
+  // The table is large enough to validate UCCs and INDs with radix-partitioned jobs. Columns a and d are unique, b and
+  // c are not. Column d holds multiples of 256, i.e., clustered keys whose lower bits are all equal.
+  const auto row_count = ValidationUtils<int32_t>::MIN_ROWS_FOR_PARALLEL_VALIDATION * 2;
+  const auto chunk_size = ChunkOffset{10'000};
+  const auto column_definitions =
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}, {"c", DataType::Int, false},
+                             {"d", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size);
+  for (auto chunk_begin = uint64_t{0}; chunk_begin < row_count; chunk_begin += chunk_size) {
+    auto a_values = pmr_vector<int32_t>(chunk_size);
+    auto b_values = pmr_vector<int32_t>(chunk_size);
+    auto c_values = pmr_vector<int32_t>(chunk_size);
+    auto d_values = pmr_vector<int32_t>(chunk_size);
+    for (auto offset = uint64_t{0}; offset < chunk_size; ++offset) {
+      const auto value = static_cast<int32_t>(chunk_begin + offset);
+      a_values[offset] = value;
+      b_values[offset] = value % 1'000;
+      // The last chunk contains a single duplicate.
+      c_values[offset] = chunk_begin + offset + 1 == row_count ? 0 : value;
+      d_values[offset] = value * 256;
+    }
+    table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(a_values)),
+                         std::make_shared<ValueSegment<int32_t>>(std::move(b_values)),
+                         std::make_shared<ValueSegment<int32_t>>(std::move(c_values)),
+                         std::make_shared<ValueSegment<int32_t>>(std::move(d_values))});
+  }
+  Hyrise::get().storage_manager.add_table("large_table", table);
+
+  const auto ucc_candidate_a = std::make_shared<UccCandidate>("large_table", ColumnID{0});
+  const auto ucc_candidate_b = std::make_shared<UccCandidate>("large_table", ColumnID{1});
+  const auto ucc_candidate_c = std::make_shared<UccCandidate>("large_table", ColumnID{2});
+  const auto ind_candidate_valid =
+      std::make_shared<IndCandidate>(_table_name_B, ColumnID{0}, "large_table", ColumnID{1});
+  const auto ind_candidate_invalid =
+      std::make_shared<IndCandidate>("large_table", ColumnID{0}, _table_name_B, ColumnID{0});
+
+  _validate_dependency_candidates(
+      {ucc_candidate_a, ucc_candidate_b, ucc_candidate_c, ind_candidate_valid, ind_candidate_invalid});
+
+  EXPECT_EQ(ucc_candidate_a->status, ValidationStatus::Valid);
+  EXPECT_EQ(ucc_candidate_b->status, ValidationStatus::Invalid);
+  EXPECT_EQ(ucc_candidate_c->status, ValidationStatus::Invalid);
+  EXPECT_EQ(ind_candidate_valid->status, ValidationStatus::Valid);
+  EXPECT_EQ(ind_candidate_invalid->status, ValidationStatus::Invalid);
+
+  // The rules above take the parallel path unless the segment statistics already decide the candidate. Check the
+  // parallel functions themselves.
+  ASSERT_TRUE(ValidationUtils<int32_t>::use_parallel_validation(table));
+  EXPECT_TRUE(ValidationUtils<int32_t>::uniqueness_holds_parallel(table, ColumnID{3}));
+  EXPECT_FALSE(ValidationUtils<int32_t>::uniqueness_holds_parallel(table, ColumnID{2}));
+
+  // The values' hashes are mixed before partitioning. Thus, the clustered keys of column d are spread evenly.
+  const auto values = ValidationUtils<int32_t>::collect_values_parallel(table, ColumnID{3});
+  EXPECT_EQ(values.size(), row_count);
+  const auto partition_count = values.partitions.size();
+  ASSERT_GT(partition_count, 1u);
+  for (const auto& partition : values.partitions) {
+    EXPECT_GT(partition.size(), row_count / partition_count / 2);
+  }
+}
+
+TEST_F(DependencyDiscoveryPluginTest, DenseDomainBitmap) {
+  EXPECT_TRUE(DenseDomainBitmap<int32_t>::use_for_domain(-10, 10, 1));
+  EXPECT_FALSE(DenseDomainBitmap<int32_t>::use_for_domain(0, 1'000, 10));
+  EXPECT_FALSE(DenseDomainBitmap<int64_t>::use_for_domain(std::numeric_limits<int64_t>::min(),
+                                                          std::numeric_limits<int64_t>::max(), 1'000));
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{4});
+  for (const auto value : {-5, -3, 0, 1, 64, 70}) {
+    table->append({value});
+  }
+  table->append({NULL_VALUE});
+
+  auto bitmap = DenseDomainBitmap<int32_t>{-5, 70};
+  EXPECT_TRUE(bitmap.add_column(table, ColumnID{0}));
+  EXPECT_EQ(bitmap.size(), 6);
+  EXPECT_EQ(bitmap.domain_size(), 76);
+  EXPECT_TRUE(bitmap.contains(-5));
+  EXPECT_FALSE(bitmap.contains(-4));
+  EXPECT_TRUE(bitmap.contains(64));
+  EXPECT_TRUE(bitmap.includes_column(table, ColumnID{0}));
+
+  table->append({71});
+  EXPECT_FALSE(bitmap.includes_column(table, ColumnID{0}));
+  EXPECT_FALSE((DenseDomainBitmap<int32_t>{-5, 70}.add_column(table, ColumnID{0})));
+}
+
+TEST_F(DependencyDiscoveryPluginTest, ValidateIndWithDenseDomain) {
+  // The primary key has gaps, so the IND cannot be validated by its min/max values alone. The domain is dense enough to
+  // collect the primary key values in a bitmap. The foreign key column c references a gap.
+  const auto primary_key_table = std::make_shared<Table>(TableColumnDefinitions{{"pk", DataType::Int, false}},
+                                                         TableType::Data, ChunkOffset{100});
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    if (value % 7 != 3) {
+      primary_key_table->append({value});
+    }
+  }
+  Hyrise::get().storage_manager.add_table("primary_key_table", primary_key_table);
+
+  const auto foreign_key_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}, {"c", DataType::Int, false}},
+      TableType::Data, ChunkOffset{100});
+  for (auto value = int32_t{0}; value < 500; ++value) {
+    const auto a = value - value % 7;
+    const auto b = value % 10 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{a};
+    foreign_key_table->append({a, b, value == 499 ? 3 : 0});
+  }
+  primary_key_table->last_chunk()->finalize();
+  foreign_key_table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(primary_key_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  ChunkEncoder::encode_all_chunks(foreign_key_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  Hyrise::get().storage_manager.add_table("foreign_key_table", foreign_key_table);
+
+  auto ind_rule = IndValidationRule{};
+  for (const auto column_id : {ColumnID{0}, ColumnID{1}}) {
+    const auto result =
+        ind_rule.validate(IndCandidate{"foreign_key_table", column_id, "primary_key_table", ColumnID{0}});
+    EXPECT_EQ(result.status, ValidationStatus::Valid);
+    EXPECT_TRUE(result.constraints.contains(primary_key_table));
+  }
+
+  const auto invalid_result =
+      ind_rule.validate(IndCandidate{"foreign_key_table", ColumnID{2}, "primary_key_table", ColumnID{0}});
+  EXPECT_EQ(invalid_result.status, ValidationStatus::Invalid);
+}
+
+TEST_F(DependencyDiscoveryPluginTest, FalsifyCandidatesBySampling) {
+  // Column a is unique and ascending, b and c contain many duplicates, and d is descending.
+  const auto row_count = int32_t{50'000};
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false},
+                                                         {"c", DataType::Int, false}, {"d", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10'000});
+  for (auto value = int32_t{0}; value < row_count; ++value) {
+    table->append({value, value % 100, value % 10, -value});
+  }
+  Hyrise::get().storage_manager.add_table("sampled_table", table);
+
+  auto ucc_rule = UccValidationRule{};
+  auto od_rule = OdValidationRule{};
+  auto fd_rule = FdValidationRule{};
+
+  const auto valid_ucc_result = ucc_rule.validate(UccCandidate{"sampled_table", ColumnID{0}});
+  EXPECT_EQ(valid_ucc_result.status, ValidationStatus::Valid);
+  EXPECT_FALSE(valid_ucc_result.sampling.rejected);
+  EXPECT_GT(valid_ucc_result.sampling.sampling_time.count(), 0);
+
+  const auto invalid_ucc_result = ucc_rule.validate(UccCandidate{"sampled_table", ColumnID{1}});
+  EXPECT_EQ(invalid_ucc_result.status, ValidationStatus::Invalid);
+  EXPECT_TRUE(invalid_ucc_result.sampling.rejected);
+
+  const auto invalid_od_result = od_rule.validate(OdCandidate{"sampled_table", ColumnID{0}, ColumnID{3}});
+  EXPECT_EQ(invalid_od_result.status, ValidationStatus::Invalid);
+  EXPECT_TRUE(invalid_od_result.sampling.rejected);
+
+  // The FD is only rejected by sampling if the samples of all columns contain duplicates.
+  const auto valid_fd_result =
+      fd_rule.validate(FdCandidate{"sampled_table", std::unordered_set<ColumnID>{ColumnID{0}, ColumnID{1}}});
+  EXPECT_EQ(valid_fd_result.status, ValidationStatus::Valid);
+  EXPECT_FALSE(valid_fd_result.sampling.rejected);
+
+  const auto invalid_fd_result =
+      fd_rule.validate(FdCandidate{"sampled_table", std::unordered_set<ColumnID>{ColumnID{1}, ColumnID{2}}});
+  EXPECT_EQ(invalid_fd_result.status, ValidationStatus::Invalid);
+  EXPECT_TRUE(invalid_fd_result.sampling.rejected);
+
+  // Combinations of columns are rejected if their sampled rows contain duplicates in all columns.
+  const auto valid_combination_result =
+      ucc_rule.validate(UccCandidate{"sampled_table", std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}});
+  EXPECT_EQ(valid_combination_result.status, ValidationStatus::Valid);
+  EXPECT_FALSE(valid_combination_result.sampling.rejected);
+  EXPECT_GT(valid_combination_result.sampling.sampling_time.count(), 0);
+
+  const auto invalid_combination_result =
+      ucc_rule.validate(UccCandidate{"sampled_table", std::vector<ColumnID>{ColumnID{1}, ColumnID{2}}});
+  EXPECT_EQ(invalid_combination_result.status, ValidationStatus::Invalid);
+  EXPECT_TRUE(invalid_combination_result.sampling.rejected);
+
+  // Without sampling, the candidates are rejected by the full validation.
+  ucc_rule.set_falsification_sample_size(0);
+  const auto unsampled_ucc_result = ucc_rule.validate(UccCandidate{"sampled_table", ColumnID{1}});
+  EXPECT_EQ(unsampled_ucc_result.status, ValidationStatus::Invalid);
+  EXPECT_FALSE(unsampled_ucc_result.sampling.rejected);
+  EXPECT_EQ(unsampled_ucc_result.sampling.sampling_time.count(), 0);
+}
+
+TEST_F(DependencyDiscoveryPluginTest, ValidateColumnCombinations) {
+  // Only the combination of a and b is unique. Column e would be unique, but it contains a NULL.
+  const auto column_definitions =
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}, {"c", DataType::Int, false},
+                             {"d", DataType::String, false}, {"e", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{30});
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    const auto e = value == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value};
+    table->append({value % 10, value / 10, value % 2, pmr_string{std::to_string(value % 5)}, e});
+  }
+  Hyrise::get().storage_manager.add_table("combination_table", table);
+
+  const auto expected_constraint = TableKeyConstraint{{ColumnID{0}, ColumnID{1}}, KeyConstraintType::UNIQUE};
+  auto ucc_rule = UccValidationRule{};
+  auto fd_rule = FdValidationRule{};
+
+  // The minimal UCC is found among the candidate's columns.
+  const auto valid_ucc_result =
+      ucc_rule.validate(UccCandidate{"combination_table", {ColumnID{0}, ColumnID{1}, ColumnID{2}, ColumnID{3}}});
+  EXPECT_EQ(valid_ucc_result.status, ValidationStatus::Valid);
+  ASSERT_EQ(valid_ucc_result.constraints.size(), 1);
+  EXPECT_EQ(*valid_ucc_result.constraints.at(table), expected_constraint);
+
+  EXPECT_EQ(ucc_rule.validate(UccCandidate{"combination_table", {ColumnID{0}, ColumnID{2}, ColumnID{3}}}).status,
+            ValidationStatus::Invalid);
+  EXPECT_EQ(ucc_rule.validate(UccCandidate{"combination_table", {ColumnID{2}, ColumnID{4}}}).status,
+            ValidationStatus::Invalid);
+
+  // The FD holds if a proper subset of its columns is unique.
+  const auto valid_fd_result = fd_rule.validate(
+      FdCandidate{"combination_table", std::unordered_set<ColumnID>{ColumnID{0}, ColumnID{1}, ColumnID{2}}});
+  EXPECT_EQ(valid_fd_result.status, ValidationStatus::Valid);
+  ASSERT_EQ(valid_fd_result.constraints.size(), 1);
+  EXPECT_EQ(*valid_fd_result.constraints.at(table), expected_constraint);
+
+  EXPECT_EQ(fd_rule.validate(FdCandidate{"combination_table", std::unordered_set<ColumnID>{ColumnID{0}, ColumnID{1}}})
+                .status,
+            ValidationStatus::Invalid);
+
+  // Supersets of known UCCs are not validated again.
+  table->add_soft_key_constraint(expected_constraint);
+  EXPECT_EQ(ucc_rule.validate(UccCandidate{"combination_table", {ColumnID{0}, ColumnID{1}, ColumnID{2}}}).status,
+            ValidationStatus::AlreadyKnown);
+  EXPECT_EQ(fd_rule
+                .validate(FdCandidate{"combination_table",
+                                      std::unordered_set<ColumnID>{ColumnID{0}, ColumnID{1}, ColumnID{3}}})
+                .status,
+            ValidationStatus::AlreadyKnown);
+}
+
+TEST_F(DependencyDiscoveryPluginTest, RevalidateConstraintsAfterInserts) {
+  const auto ucc_candidate = std::make_shared<UccCandidate>(_table_name_A, ColumnID{0});
+  const auto od_candidate = std::make_shared<OdCandidate>(_table_name_B, ColumnID{0}, ColumnID{1});
+  _validate_dependency_candidates({ucc_candidate, od_candidate});
+  ASSERT_EQ(_table_A->soft_key_constraints().size(), 1);
+  ASSERT_EQ(_table_B->soft_order_constraints().size(), 1);
+
+  const auto lqp_A = PredicateNode::make(equals_(_predicate_column_A, "unique"), _table_node_A);
+  const auto lqp_B = PredicateNode::make(equals_(_predicate_column_B, "not"), _table_node_B);
+  Hyrise::get().default_lqp_cache->set("QueryA", lqp_A);
+  Hyrise::get().default_lqp_cache->set("QueryB", lqp_B);
+  Hyrise::get().default_pqp_cache->set("QueryA", std::make_shared<GetTable>(_table_name_A));
+  Hyrise::get().default_pqp_cache->set("QueryB", std::make_shared<GetTable>(_table_name_B));
+
+  // Without modifications, all constraints still hold and no plans are evicted.
+  _revalidate_constraints();
+  EXPECT_EQ(_table_A->soft_key_constraints().size(), 1);
+  EXPECT_EQ(_table_B->soft_order_constraints().size(), 1);
+  EXPECT_EQ(Hyrise::get().default_lqp_cache->size(), 2);
+  EXPECT_EQ(Hyrise::get().default_pqp_cache->size(), 2);
+
+  // A duplicate value violates the UCC. The inserted row of table B extends the value ranges of the OD.
+  _insert_row(_table_name_A, {int32_t{4}, int32_t{7}, pmr_string{"duplicate"}});
+  _insert_row(_table_name_B, {int32_t{20}, pmr_string{"zebra"}});
+  _revalidate_constraints();
+  EXPECT_TRUE(_table_A->soft_key_constraints().empty());
+  EXPECT_EQ(_table_B->soft_order_constraints().size(), 1);
+  EXPECT_FALSE(Hyrise::get().default_lqp_cache->has("QueryA"));
+  EXPECT_FALSE(Hyrise::get().default_pqp_cache->has("QueryA"));
+  EXPECT_TRUE(Hyrise::get().default_lqp_cache->has("QueryB"));
+  EXPECT_TRUE(Hyrise::get().default_pqp_cache->has("QueryB"));
+
+  // The inserted row does not extend the value ranges of the OD, so it is validated from scratch and rejected.
+  _insert_row(_table_name_B, {int32_t{0}, pmr_string{"zebra"}});
+  _revalidate_constraints();
+  EXPECT_TRUE(_table_B->soft_order_constraints().empty());
+  EXPECT_FALSE(Hyrise::get().default_lqp_cache->has("QueryB"));
+  EXPECT_FALSE(Hyrise::get().default_pqp_cache->has("QueryB"));
+}
+
+TEST_F(DependencyDiscoveryPluginTest, RevalidateConstraintsAfterUpdate) {
+  const auto ucc_candidate = std::make_shared<UccCandidate>(_table_name_A, ColumnID{0});
+  _validate_dependency_candidates({ucc_candidate});
+  ASSERT_EQ(_table_A->soft_key_constraints().size(), 1);
+
+  // Updating a row deletes its old version. Thus, re-inserting the same key does not violate the UCC.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "A_a");
+  const auto column_c = pqp_column_(ColumnID{2}, DataType::String, false, "c");
+  const auto get_table = std::make_shared<GetTable>(_table_name_A);
+  const auto table_scan = std::make_shared<TableScan>(get_table, equals_(column_a, 4));
+  const auto validate = std::make_shared<Validate>(table_scan);
+  const auto projection = std::make_shared<Projection>(validate, expression_vector(column_a, value_(11), column_c));
+  const auto update = std::make_shared<Update>(_table_name_A, validate, projection);
+  const auto operators = std::vector<std::shared_ptr<AbstractOperator>>{get_table, table_scan, validate, projection,
+                                                                        update};
+  for (const auto& op : operators) {
+    op->set_transaction_context(transaction_context);
+    op->execute();
+  }
+  transaction_context->commit();
+
+  _revalidate_constraints();
+  EXPECT_EQ(_table_A->soft_key_constraints().size(), 1);
+}
+
+TEST_F(DependencyDiscoveryPluginTest, RestoreConstraintsFromCatalog) {
+  const auto filename = test_data_path + "dependency_catalog.bin";
+  const auto ucc_candidate = std::make_shared<UccCandidate>(_table_name_A, ColumnID{0});
+  const auto od_candidate = std::make_shared<OdCandidate>(_table_name_B, ColumnID{0}, ColumnID{1});
+  _validate_dependency_candidates({ucc_candidate, od_candidate});
+  ASSERT_EQ(_table_A->soft_key_constraints().size(), 1);
+  ASSERT_EQ(_table_B->soft_order_constraints().size(), 1);
+  _store_dependency_catalog(filename);
+
+  // Both tables are unchanged, so the constraints are restored without validation.
+  _clear_constraints();
+  EXPECT_EQ(_load_dependency_catalog(filename), 2);
+  EXPECT_EQ(_table_A->soft_key_constraints().size(), 1);
+  EXPECT_EQ(_table_B->soft_order_constraints().size(), 1);
+
+  // Restored constraints are known to the validation rules.
+  ucc_candidate->status = ValidationStatus::Uncertain;
+  _validate_dependency_candidates({ucc_candidate});
+  EXPECT_EQ(ucc_candidate->status, ValidationStatus::AlreadyKnown);
+
+  // Table A was modified, so its constraints are not restored.
+  _insert_row(_table_name_A, {int32_t{4}, int32_t{7}, pmr_string{"duplicate"}});
+  _clear_constraints();
+  EXPECT_EQ(_load_dependency_catalog(filename), 1);
+  EXPECT_TRUE(_table_A->soft_key_constraints().empty());
+  EXPECT_EQ(_table_B->soft_order_constraints().size(), 1);
+
+  // The plugin restores the catalog when it is started.
+  _clear_constraints();
+  _set_catalog_filename(filename);
+  _plugin->start();
+  EXPECT_EQ(_table_B->soft_order_constraints().size(), 1);
+  _plugin->stop();
+
+  std::remove(filename.c_str());
+}
+
+TEST_F(DependencyDiscoveryPluginTest, BackgroundDiscovery) {
+  _plugin->start();
+  auto& meta_table_manager = Hyrise::get().meta_table_manager;
+  ASSERT_TRUE(meta_table_manager.has_table("dependency_discovery"));
+  EXPECT_EQ(meta_table_manager.generate_table("dependency_discovery")->row_count(), 0);
+
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(_join_columnA, _predicate_column_A), expression_vector(),
+    PredicateNode::make(equals_(_predicate_column_A, "unique"), _table_node_A));
+  // clang-format on
+  Hyrise::get().default_lqp_cache->set("QueryA", lqp);
+
+  // The new query yields an FD candidate, which is validated. The cached plan is evicted so it can be optimized using
+  // the UCC.
+  _run_background_discovery();
+  EXPECT_EQ(_table_A->soft_key_constraints().size(), 1);
+  EXPECT_FALSE(Hyrise::get().default_lqp_cache->has("QueryA"));
+
+  // A new query with the same plan does not yield new candidates. Afterwards, there are no new queries.
+  Hyrise::get().default_lqp_cache->set("QueryB", lqp);
+  _run_background_discovery();
+  _run_background_discovery();
+
+  const auto runs = meta_table_manager.generate_table("dependency_discovery");
+  ASSERT_EQ(runs->row_count(), 3);
+  // Columns: run_id, timestamp, new_queries, candidates, valid_candidates, invalid_candidates, constraints, duration_ns
+  EXPECT_EQ(*runs->get_value<int64_t>(ColumnID{2}, 0), 1);
+  EXPECT_EQ(*runs->get_value<int64_t>(ColumnID{3}, 0), 1);
+  EXPECT_EQ(*runs->get_value<int64_t>(ColumnID{4}, 0), 1);
+  EXPECT_EQ(*runs->get_value<int64_t>(ColumnID{6}, 0), 1);
+  EXPECT_EQ(*runs->get_value<int64_t>(ColumnID{2}, 1), 1);
+  EXPECT_EQ(*runs->get_value<int64_t>(ColumnID{3}, 1), 0);
+  EXPECT_EQ(*runs->get_value<int64_t>(ColumnID{2}, 2), 0);
+  EXPECT_EQ(*runs->get_value<int64_t>(ColumnID{3}, 2), 0);
+
+  _plugin->stop();
+  EXPECT_FALSE(meta_table_manager.has_table("dependency_discovery"));
+}
+
 TEST_P(DependencyDiscoveryPluginMultiEncodingTest, ValidateCandidates) {
   _encode_table(_table_A, GetParam());
   _encode_table(_table_B, GetParam());
@@ -277,6 +786,12 @@ TEST_P(DependencyDiscoveryPluginMultiEncodingTest, PluginFullRun) {
     PredicateNode::make(equals_(_predicate_column_B, "not"), _table_node_B));
   // clang-format on
   Hyrise::get().default_lqp_cache->set("TestLQP", lqp);
+  Hyrise::get().default_pqp_cache->set("TestLQP", std::make_shared<GetTable>(_table_name_A));
+
+  // A query that does not yield any candidates.
+  const auto other_lqp = PredicateNode::make(equals_(_predicate_column_B, "not"), _table_node_B);
+  Hyrise::get().default_lqp_cache->set("OtherLQP", other_lqp);
+  Hyrise::get().default_pqp_cache->set("OtherLQP", std::make_shared<GetTable>(_table_name_B));
 
   lqp->mark_input_side_as_prunable(LQPInputSide::Left);
 
@@ -296,9 +811,17 @@ TEST_P(DependencyDiscoveryPluginMultiEncodingTest, PluginFullRun) {
   EXPECT_TRUE(constraints_A.contains({{_join_columnA->original_column_id}, KeyConstraintType::UNIQUE}));
   EXPECT_TRUE(constraints_A.contains({{_predicate_column_A->original_column_id}, KeyConstraintType::UNIQUE}));
 
-  // Ensure we clear the plan caches.
-  EXPECT_EQ(Hyrise::get().default_lqp_cache->size(), 0);
-  EXPECT_EQ(Hyrise::get().default_pqp_cache->size(), 0);
+  // Ensure we evict the plans that can benefit from the new UCCs, but keep the other plans.
+  EXPECT_FALSE(Hyrise::get().default_lqp_cache->has("TestLQP"));
+  EXPECT_FALSE(Hyrise::get().default_pqp_cache->has("TestLQP"));
+  EXPECT_TRUE(Hyrise::get().default_lqp_cache->has("OtherLQP"));
+  EXPECT_TRUE(Hyrise::get().default_pqp_cache->has("OtherLQP"));
+
+  // Running the discovery again does not find new dependencies. Thus, no plans are evicted.
+  Hyrise::get().default_lqp_cache->set("TestLQP", lqp);
+  _discover_uccs();
+  EXPECT_TRUE(Hyrise::get().default_lqp_cache->has("TestLQP"));
+  EXPECT_TRUE(Hyrise::get().default_lqp_cache->has("OtherLQP"));
 }
 
 INSTANTIATE_TEST_SUITE_P(DependencyDiscoveryPluginMultiEncodingTestInstances,